@@ -0,0 +1,330 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     BenchReport.cpp
+    \brief    JSON report of the codec benchmark and comparison against a baseline
+*/
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "BenchReport.h"
+
+//! \ingroup CodecBenchApp
+//! \{
+
+// ====================================================================================================================
+// Local functions
+// ====================================================================================================================
+
+static std::string quoted( const std::string& str )
+{
+  std::string out = "\"";
+  for( const char c : str )
+  {
+    if( c == '"' || c == '\\' )
+    {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out + "\"";
+}
+
+/// minimal reader for the flat objects of the "results" array, that is all readBenchReport needs
+class JsonScanner
+{
+public:
+  JsonScanner( const std::string& text ) : m_text( text ), m_pos( 0 ) {}
+
+  bool seek( const std::string& token )
+  {
+    m_pos = m_text.find( token, m_pos );
+    if( m_pos == std::string::npos )
+    {
+      return false;
+    }
+    m_pos += token.size();
+    return true;
+  }
+
+  char peek()
+  {
+    while( m_pos < m_text.size() && isspace( ( unsigned char ) m_text[m_pos] ) )
+    {
+      m_pos++;
+    }
+    return m_pos < m_text.size() ? m_text[m_pos] : 0;
+  }
+
+  bool expect( char c )
+  {
+    if( peek() != c )
+    {
+      return false;
+    }
+    m_pos++;
+    return true;
+  }
+
+  bool readString( std::string& str )
+  {
+    if( !expect( '"' ) )
+    {
+      return false;
+    }
+    str.clear();
+    while( m_pos < m_text.size() && m_text[m_pos] != '"' )
+    {
+      if( m_text[m_pos] == '\\' )
+      {
+        m_pos++;
+      }
+      str += m_text[m_pos++];
+    }
+    return expect( '"' );
+  }
+
+  /// numbers and literals are returned as their text
+  bool readValue( std::string& value )
+  {
+    if( peek() == '"' )
+    {
+      return readString( value );
+    }
+    value.clear();
+    while( m_pos < m_text.size() && ( isalnum( ( unsigned char ) m_text[m_pos] ) || strchr( "+-.", m_text[m_pos] ) ) )
+    {
+      value += m_text[m_pos++];
+    }
+    return !value.empty();
+  }
+
+private:
+  const std::string& m_text;
+  size_t             m_pos;
+};
+
+static void setResultField( BenchResult& result, const std::string& key, const std::string& value )
+{
+  const double number = atof( value.c_str() );
+
+  if     ( key == "content"          ) result.content          = value;
+  else if( key == "config"           ) result.config           = value;
+  else if( key == "frames"           ) result.frames           = int( number );
+  else if( key == "generateTimeSec"  ) result.generateTimeSec  = number;
+  else if( key == "encodeTimeSec"    ) result.encodeTimeSec    = number;
+  else if( key == "encodeCpuTimeSec" ) result.encodeCpuTimeSec = number;
+  else if( key == "decodeTimeSec"    ) result.decodeTimeSec    = number;
+  else if( key == "decodeCpuTimeSec" ) result.decodeCpuTimeSec = number;
+  else if( key == "encodeFps"        ) result.encodeFps        = number;
+  else if( key == "decodeFps"        ) result.decodeFps        = number;
+  else if( key == "encoderPeakRssKb" ) result.encoderPeakRssKb = long( number );
+  else if( key == "decoderPeakRssKb" ) result.decoderPeakRssKb = long( number );
+  else if( key == "bitrateKbps"      ) result.bitrateKbps      = number;
+  else if( key == "psnrY"            ) result.psnrY            = number;
+  else if( key == "psnrU"            ) result.psnrU            = number;
+  else if( key == "psnrV"            ) result.psnrV            = number;
+  else if( key == "psnrYUV"          ) result.psnrYUV          = number;
+  else if( key == "decodeMatch"      ) result.decodeMatch      = value == "true";
+}
+
+// ====================================================================================================================
+// Public functions
+// ====================================================================================================================
+
+void writeBenchReport( std::ostream& out, const std::string& settings, const std::vector<BenchResult>& results,
+                       const std::string& baselineFileName, const std::vector<std::string>& regressions )
+{
+  std::ostringstream str;
+  str.setf( std::ios::fixed );
+  str.precision( 4 );
+
+  str << "{\n";
+  str << "  \"settings\": " << quoted( settings ) << ",\n";
+  str << "  \"results\": [\n";
+  for( size_t i = 0; i < results.size(); i++ )
+  {
+    const BenchResult& r = results[i];
+    str << "    {\n";
+    str << "      \"content\": "          << quoted( r.content ) << ",\n";
+    str << "      \"config\": "           << quoted( r.config )  << ",\n";
+    str << "      \"frames\": "           << r.frames            << ",\n";
+    str << "      \"generateTimeSec\": "  << r.generateTimeSec   << ",\n";
+    str << "      \"encodeTimeSec\": "    << r.encodeTimeSec     << ",\n";
+    str << "      \"encodeCpuTimeSec\": " << r.encodeCpuTimeSec  << ",\n";
+    str << "      \"decodeTimeSec\": "    << r.decodeTimeSec     << ",\n";
+    str << "      \"decodeCpuTimeSec\": " << r.decodeCpuTimeSec  << ",\n";
+    str << "      \"encodeFps\": "        << r.encodeFps         << ",\n";
+    str << "      \"decodeFps\": "        << r.decodeFps         << ",\n";
+    str << "      \"encoderPeakRssKb\": " << r.encoderPeakRssKb  << ",\n";
+    str << "      \"decoderPeakRssKb\": " << r.decoderPeakRssKb  << ",\n";
+    str << "      \"bitrateKbps\": "      << r.bitrateKbps       << ",\n";
+    str << "      \"psnrY\": "            << r.psnrY             << ",\n";
+    str << "      \"psnrU\": "            << r.psnrU             << ",\n";
+    str << "      \"psnrV\": "            << r.psnrV             << ",\n";
+    str << "      \"psnrYUV\": "          << r.psnrYUV           << ",\n";
+    str << "      \"decodeMatch\": "      << ( r.decodeMatch ? "true" : "false" ) << "\n";
+    str << "    }" << ( i + 1 < results.size() ? "," : "" ) << "\n";
+  }
+  str << "  ],\n";
+  str << "  \"baseline\": " << quoted( baselineFileName ) << ",\n";
+  str << "  \"regressions\": [";
+  for( size_t i = 0; i < regressions.size(); i++ )
+  {
+    str << ( i ? ",\n    " : "\n    " ) << quoted( regressions[i] );
+  }
+  str << ( regressions.empty() ? "]\n" : "\n  ]\n" );
+  str << "}\n";
+
+  out << str.str();
+}
+
+bool readBenchReport( const std::string& fileName, std::vector<BenchResult>& results )
+{
+  std::ifstream file( fileName.c_str() );
+  if( !file.is_open() )
+  {
+    return false;
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  const std::string text = buffer.str();
+
+  JsonScanner scanner( text );
+  if( !scanner.seek( "\"results\"" ) || !scanner.expect( ':' ) || !scanner.expect( '[' ) )
+  {
+    return false;
+  }
+
+  results.clear();
+  while( scanner.expect( '{' ) )
+  {
+    BenchResult result;
+    std::string key, value;
+
+    while( scanner.readString( key ) )
+    {
+      if( !scanner.expect( ':' ) || !scanner.readValue( value ) )
+      {
+        return false;
+      }
+      setResultField( result, key, value );
+      scanner.expect( ',' );
+    }
+    if( !scanner.expect( '}' ) )
+    {
+      return false;
+    }
+    results.push_back( result );
+    scanner.expect( ',' );
+  }
+
+  return scanner.expect( ']' );
+}
+
+void compareBenchResults( const std::vector<BenchResult>& results, const std::vector<BenchResult>& baseline, const BenchTolerances& tolerances,
+                          std::vector<std::string>& regressions )
+{
+  for( const BenchResult& r : results )
+  {
+    const std::string name = r.content + "/" + r.config;
+
+    if( !r.decodeMatch )
+    {
+      regressions.push_back( name + ": decoder output differs from the encoder reconstruction" );
+    }
+
+    const BenchResult* base = nullptr;
+    for( const BenchResult& b : baseline )
+    {
+      if( b.content == r.content && b.config == r.config )
+      {
+        base = &b;
+        break;
+      }
+    }
+    if( base == nullptr )
+    {
+      continue;
+    }
+
+    std::ostringstream msg;
+    msg.setf( std::ios::fixed );
+    msg.precision( 4 );
+
+    auto lowerIsWorse = [&]( const char* metric, double value, double reference, double tolerance )
+    {
+      if( reference > 0 && value < reference * ( 1 - tolerance / 100 ) )
+      {
+        msg.str( "" );
+        msg << name << ": " << metric << " " << value << " below baseline " << reference << " (" << ( value / reference - 1 ) * 100 << "%)";
+        regressions.push_back( msg.str() );
+      }
+    };
+    auto higherIsWorse = [&]( const char* metric, double value, double reference, double tolerance )
+    {
+      if( reference > 0 && value > reference * ( 1 + tolerance / 100 ) )
+      {
+        msg.str( "" );
+        msg << name << ": " << metric << " " << value << " above baseline " << reference << " (+" << ( value / reference - 1 ) * 100 << "%)";
+        regressions.push_back( msg.str() );
+      }
+    };
+    auto changed = [&]( const char* metric, double value, double reference, double tolerance, bool relative )
+    {
+      const double diff = relative ? ( reference > 0 ? std::fabs( value / reference - 1 ) * 100 : 0 ) : std::fabs( value - reference );
+      if( diff > tolerance )
+      {
+        msg.str( "" );
+        msg << name << ": " << metric << " " << value << " differs from baseline " << reference;
+        regressions.push_back( msg.str() );
+      }
+    };
+
+    lowerIsWorse ( "encodeFps",        r.encodeFps,        base->encodeFps,        tolerances.fpsPercent );
+    lowerIsWorse ( "decodeFps",        r.decodeFps,        base->decodeFps,        tolerances.fpsPercent );
+    higherIsWorse( "encoderPeakRssKb", r.encoderPeakRssKb, base->encoderPeakRssKb, tolerances.rssPercent );
+    higherIsWorse( "decoderPeakRssKb", r.decoderPeakRssKb, base->decoderPeakRssKb, tolerances.rssPercent );
+    changed      ( "bitrateKbps",      r.bitrateKbps,      base->bitrateKbps,      tolerances.bitratePercent, true );
+    changed      ( "psnrY",            r.psnrY,            base->psnrY,            tolerances.psnrDb,         false );
+    changed      ( "psnrYUV",          r.psnrYUV,          base->psnrYUV,          tolerances.psnrDb,         false );
+  }
+}
+
+//! \}
@@ -0,0 +1,112 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     BenchReport.h
+    \brief    JSON report of the codec benchmark and comparison against a baseline (header)
+*/
+
+#ifndef __BENCHREPORT__
+#define __BENCHREPORT__
+
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+//! \ingroup CodecBenchApp
+//! \{
+
+// ====================================================================================================================
+// Type definitions
+// ====================================================================================================================
+
+/// measurements of one content / configuration pair
+struct BenchResult
+{
+  std::string content;
+  std::string config;
+  int         frames;               ///< coded frames, after the temporal subsampling of the configuration
+  double      generateTimeSec;      ///< wall time of the content generation
+  double      encodeTimeSec;        ///< wall time of the encoder process
+  double      encodeCpuTimeSec;     ///< user + system time of the encoder process
+  double      decodeTimeSec;        ///< wall time of the decoder process
+  double      decodeCpuTimeSec;     ///< user + system time of the decoder process
+  double      encodeFps;
+  double      decodeFps;
+  long        encoderPeakRssKb;
+  long        decoderPeakRssKb;
+  double      bitrateKbps;
+  double      psnrY;
+  double      psnrU;
+  double      psnrV;
+  double      psnrYUV;
+  bool        decodeMatch;          ///< decoder output identical to the encoder reconstruction
+
+  BenchResult()
+    : frames( 0 ), generateTimeSec( 0 ), encodeTimeSec( 0 ), encodeCpuTimeSec( 0 ), decodeTimeSec( 0 ), decodeCpuTimeSec( 0 )
+    , encodeFps( 0 ), decodeFps( 0 ), encoderPeakRssKb( 0 ), decoderPeakRssKb( 0 )
+    , bitrateKbps( 0 ), psnrY( 0 ), psnrU( 0 ), psnrV( 0 ), psnrYUV( 0 ), decodeMatch( false )
+  {}
+};
+
+/// allowed deviation from the baseline before a result counts as a regression
+struct BenchTolerances
+{
+  double fpsPercent;                ///< maximum drop of encoder and decoder fps
+  double rssPercent;                ///< maximum growth of the peak resident set size
+  double bitratePercent;            ///< maximum change of the bitrate in either direction
+  double psnrDb;                    ///< maximum change of the PSNR in either direction
+};
+
+// ====================================================================================================================
+// Function declarations
+// ====================================================================================================================
+
+/// write the results and the regressions found against the baseline as JSON
+void writeBenchReport  ( std::ostream& out, const std::string& settings, const std::vector<BenchResult>& results,
+                         const std::string& baselineFileName, const std::vector<std::string>& regressions );
+
+/// read the results of a report written by writeBenchReport
+bool readBenchReport   ( const std::string& fileName, std::vector<BenchResult>& results );
+
+/// compare every result with the baseline entry of the same content and configuration
+void compareBenchResults( const std::vector<BenchResult>& results, const std::vector<BenchResult>& baseline, const BenchTolerances& tolerances,
+                          std::vector<std::string>& regressions );
+
+//! \}
+
+#endif // __BENCHREPORT__
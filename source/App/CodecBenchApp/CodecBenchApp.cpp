@@ -0,0 +1,372 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     CodecBenchApp.cpp
+    \brief    Codec benchmark application class
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "CodecBenchApp.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+//! \ingroup CodecBenchApp
+//! \{
+
+// ====================================================================================================================
+// Local functions
+// ====================================================================================================================
+
+typedef std::chrono::steady_clock BenchClock;
+
+/// resources used by a child process
+struct ProcessStats
+{
+  double wallTimeSec;
+  double cpuTimeSec;
+  long   peakRssKb;
+  int    exitCode;
+};
+
+static double elapsedSec( const BenchClock::time_point& start )
+{
+  return std::chrono::duration<double>( BenchClock::now() - start ).count();
+}
+
+static void makeDir( const std::string& path )
+{
+#ifdef _WIN32
+  _mkdir( path.c_str() );
+#else
+  mkdir( path.c_str(), 0755 );
+#endif
+}
+
+static std::vector<std::string> splitArgs( const std::string& args )
+{
+  std::vector<std::string> items;
+  std::istringstream       str( args );
+  std::string              item;
+
+  while( str >> item )
+  {
+    items.push_back( item );
+  }
+  return items;
+}
+
+/** run a program with its standard output and error redirected to logFile
+ */
+static bool runProcess( const std::vector<std::string>& args, const std::string& logFile, ProcessStats& stats )
+{
+  const BenchClock::time_point start = BenchClock::now();
+
+  stats.cpuTimeSec = 0;
+  stats.peakRssKb  = 0;
+  stats.exitCode   = -1;
+
+#ifdef _WIN32
+  // no per process resource usage without the Win32 process API, only the wall time is measured
+  std::string cmd;
+  for( const std::string& arg : args )
+  {
+    cmd += "\"" + arg + "\" ";
+  }
+  cmd += "> \"" + logFile + "\" 2>&1";
+  stats.exitCode = system( ( "\"" + cmd + "\"" ).c_str() );
+#else
+  std::vector<char*> argv;
+  for( const std::string& arg : args )
+  {
+    argv.push_back( const_cast<char*>( arg.c_str() ) );
+  }
+  argv.push_back( nullptr );
+
+  const pid_t pid = fork();
+  if( pid < 0 )
+  {
+    return false;
+  }
+  if( pid == 0 )
+  {
+    const int fd = open( logFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+    if( fd >= 0 )
+    {
+      dup2( fd, STDOUT_FILENO );
+      dup2( fd, STDERR_FILENO );
+      close( fd );
+    }
+    execv( argv[0], argv.data() );
+    _exit( 127 );
+  }
+
+  int           status = 0;
+  struct rusage usage;
+  if( wait4( pid, &status, 0, &usage ) != pid )
+  {
+    return false;
+  }
+
+  stats.exitCode   = WIFEXITED( status ) ? WEXITSTATUS( status ) : -1;
+  stats.cpuTimeSec = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6 + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+#ifdef __APPLE__
+  stats.peakRssKb  = usage.ru_maxrss / 1024;
+#else
+  stats.peakRssKb  = usage.ru_maxrss;
+#endif
+#endif
+
+  stats.wallTimeSec = elapsedSec( start );
+  return stats.exitCode == 0;
+}
+
+/** read the number of coded frames, bitrate and PSNR from the summary the encoder prints after the "Total Frames" header
+ */
+static bool parseEncoderLog( const std::string& logFile, BenchResult& result )
+{
+  std::ifstream log( logFile.c_str() );
+  std::string   line;
+
+  while( std::getline( log, line ) )
+  {
+    if( line.find( "Total Frames" ) == std::string::npos || !std::getline( log, line ) )
+    {
+      continue;
+    }
+
+    std::istringstream str( line );
+    std::string        type;
+    if( str >> result.frames >> type >> result.bitrateKbps >> result.psnrY >> result.psnrU >> result.psnrV >> result.psnrYUV )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool filesEqual( const std::string& fileName0, const std::string& fileName1 )
+{
+  std::ifstream file0( fileName0.c_str(), std::ios::binary );
+  std::ifstream file1( fileName1.c_str(), std::ios::binary );
+  if( !file0.is_open() || !file1.is_open() )
+  {
+    return false;
+  }
+
+  std::stringstream data0, data1;
+  data0 << file0.rdbuf();
+  data1 << file1.rdbuf();
+  return data0.str() == data1.str();
+}
+
+// ====================================================================================================================
+// Constructor / destructor / initialization / destroy
+// ====================================================================================================================
+
+CodecBenchApp::CodecBenchApp()
+{
+}
+
+// ====================================================================================================================
+// Public member functions
+// ====================================================================================================================
+
+/**
+ - generate each synthetic content once
+ - encode it with every configuration and decode the bitstream
+ - write the measurements as JSON and compare them against the baseline
+ */
+uint32_t CodecBenchApp::run()
+{
+  std::vector<BenchResult> baseline;
+  if( !m_baselineFileName.empty() && !readBenchReport( m_baselineFileName, baseline ) )
+  {
+    EXIT( "Failed to read baseline " << m_baselineFileName );
+  }
+
+  makeDir( m_workDir );
+
+  std::vector<BenchResult> results;
+
+  for( const SyntheticSource::ContentType content : m_contents )
+  {
+    const std::string contentName = SyntheticSource::getName( content );
+    const std::string sourceFile  = m_workDir + "/" + contentName + ".yuv";
+
+    const BenchClock::time_point start = BenchClock::now();
+    SyntheticSource source( content, m_sourceWidth, m_sourceHeight, m_inputBitDepth, m_framesToBeEncoded );
+    if( !source.writeFile( sourceFile ) )
+    {
+      EXIT( "Failed to write " << sourceFile );
+    }
+    const double generateTimeSec = elapsedSec( start );
+
+    for( const std::string& config : m_configs )
+    {
+      const std::string configName = config.substr( 0, config.rfind( '.' ) );
+
+      BenchResult result;
+      result.content         = contentName;
+      result.config          = configName;
+      result.frames          = m_framesToBeEncoded;
+      result.generateTimeSec = generateTimeSec;
+
+      std::cerr << contentName << " / " << configName << ": " << std::flush;
+      if( !encodeAndDecode( sourceFile, config, m_workDir + "/" + contentName + "_" + configName, result ) )
+      {
+        EXIT( "Benchmark of " << contentName << " with " << config << " failed, see the logs in " << m_workDir );
+      }
+      std::cerr << result.encodeFps << " fps encoder, " << result.decodeFps << " fps decoder, "
+                << result.bitrateKbps << " kbps, " << result.psnrYUV << " dB" << std::endl;
+
+      results.push_back( result );
+    }
+
+    if( !m_keepFiles )
+    {
+      remove( sourceFile.c_str() );
+    }
+  }
+
+  std::vector<std::string> regressions;
+  compareBenchResults( results, baseline, m_tolerances, regressions );
+
+  std::ostringstream settings;
+  settings << m_sourceWidth << "x" << m_sourceHeight << " " << m_inputBitDepth << " bit, " << m_framesToBeEncoded << " frames at "
+           << m_frameRate << " fps, QP " << m_qp << ( m_encoderArgs.empty() ? "" : ", " ) << m_encoderArgs;
+
+  std::ofstream outFile( m_outputFileName.c_str(), std::ios::out );
+  if( !outFile.is_open() )
+  {
+    EXIT( "Failed to open output file " << m_outputFileName );
+  }
+  writeBenchReport( outFile, settings.str(), results, m_baselineFileName, regressions );
+
+  for( const std::string& regression : regressions )
+  {
+    std::cerr << "Regression: " << regression << std::endl;
+  }
+
+  return ( uint32_t ) regressions.size();
+}
+
+// ====================================================================================================================
+// Private member functions
+// ====================================================================================================================
+
+bool CodecBenchApp::encodeAndDecode( const std::string& sourceFile, const std::string& config, const std::string& name, BenchResult& result )
+{
+  const std::string bitstreamFile = name + ".bin";
+  const std::string reconFile     = name + "_rec.yuv";
+  const std::string decodedFile   = name + "_dec.yuv";
+  const std::string encoderLog    = name + "_enc.log";
+  const std::string decoderLog    = name + "_dec.log";
+
+  std::vector<std::string> encArgs =
+  {
+    m_encoderApp,
+    "-c", m_cfgDir + "/" + config,
+    "-i", sourceFile,
+    "-b", bitstreamFile,
+    "-o", reconFile,
+    "--SourceWidth="       + std::to_string( m_sourceWidth ),
+    "--SourceHeight="      + std::to_string( m_sourceHeight ),
+    "--FrameRate="         + std::to_string( m_frameRate ),
+    "--FramesToBeEncoded=" + std::to_string( m_framesToBeEncoded ),
+    "--QP="                + std::to_string( m_qp ),
+    "--InputBitDepth="     + std::to_string( m_inputBitDepth ),
+    "--OutputBitDepth="    + std::to_string( m_inputBitDepth ),
+  };
+  for( const std::string& arg : splitArgs( m_encoderArgs ) )
+  {
+    encArgs.push_back( arg );
+  }
+
+  const std::vector<std::string> decArgs =
+  {
+    m_decoderApp,
+    "-b", bitstreamFile,
+    "-o", decodedFile,
+    "-d", std::to_string( m_inputBitDepth ),
+  };
+
+  ProcessStats encStats, decStats;
+  if( !runProcess( encArgs, encoderLog, encStats ) || !parseEncoderLog( encoderLog, result ) )
+  {
+    return false;
+  }
+  if( !runProcess( decArgs, decoderLog, decStats ) )
+  {
+    return false;
+  }
+
+  result.encodeTimeSec    = encStats.wallTimeSec;
+  result.encodeCpuTimeSec = encStats.cpuTimeSec;
+  result.encoderPeakRssKb = encStats.peakRssKb;
+  result.decodeTimeSec    = decStats.wallTimeSec;
+  result.decodeCpuTimeSec = decStats.cpuTimeSec;
+  result.decoderPeakRssKb = decStats.peakRssKb;
+  result.encodeFps        = result.frames / std::max( encStats.wallTimeSec, 1e-6 );
+  result.decodeFps        = result.frames / std::max( decStats.wallTimeSec, 1e-6 );
+  result.decodeMatch      = filesEqual( reconFile, decodedFile );
+
+  if( !m_keepFiles )
+  {
+    remove( bitstreamFile.c_str() );
+    remove( reconFile.c_str() );
+    remove( decodedFile.c_str() );
+    remove( encoderLog.c_str() );
+    remove( decoderLog.c_str() );
+  }
+
+  return true;
+}
+
+//! \}
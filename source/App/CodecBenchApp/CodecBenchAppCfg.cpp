@@ -0,0 +1,224 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     CodecBenchAppCfg.cpp
+    \brief    Codec benchmark configuration class
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "CodecBenchAppCfg.h"
+#include "Utilities/program_options_lite.h"
+
+using namespace std;
+namespace po = df::program_options_lite;
+
+#ifndef CODEC_BENCH_CFG_DIR
+#define CODEC_BENCH_CFG_DIR "cfg"
+#endif
+
+//! \ingroup CodecBenchApp
+//! \{
+
+// ====================================================================================================================
+// Local functions
+// ====================================================================================================================
+
+static vector<string> splitList( const string& list )
+{
+  vector<string> items;
+  size_t         start = 0;
+
+  while( start <= list.size() )
+  {
+    size_t end = list.find( ',', start );
+    if( end == string::npos )
+    {
+      end = list.size();
+    }
+    if( end > start )
+    {
+      items.push_back( list.substr( start, end - start ) );
+    }
+    start = end + 1;
+  }
+
+  return items;
+}
+
+/// directory of the running executable, used to find the encoder and decoder built alongside
+static string executableDir( const char* argv0 )
+{
+  const string path = argv0;
+  const size_t pos  = path.find_last_of( "/\\" );
+
+  return pos == string::npos ? string( "." ) : path.substr( 0, pos );
+}
+
+// ====================================================================================================================
+// Public member functions
+// ====================================================================================================================
+
+/** \param argc number of arguments
+    \param argv array of arguments
+ */
+bool CodecBenchAppCfg::parseCfg( int argc, char* argv[] )
+{
+  bool   do_help = false;
+  string configs;
+  string contents;
+
+  po::Options opts;
+  opts.addOptions()
+
+  ("help",                      do_help,                               false,      "this help text")
+  ("EncoderApp",                m_encoderApp,                          string(""), "encoder executable (default: EncoderApp next to this executable)")
+  ("DecoderApp",                m_decoderApp,                          string(""), "decoder executable (default: DecoderApp next to this executable)")
+  ("CfgDir",                    m_cfgDir,                              string(CODEC_BENCH_CFG_DIR), "directory of the encoder configuration files")
+  ("Configs",                   configs,                               string("encoder_intra_vtm.cfg,encoder_lowdelay_vtm.cfg,encoder_randomaccess_vtm.cfg"), "comma separated list of encoder configuration files")
+  ("Content",                   contents,                              string("gradient,texture,scroll,noise,fade"), "comma separated list of synthetic content: gradient, texture, scroll, noise, fade")
+  ("EncoderArgs",               m_encoderArgs,                         string(""), "additional encoder arguments, separated by spaces")
+  ("SourceWidth,-wdt",          m_sourceWidth,                         176,        "width of the synthetic content")
+  ("SourceHeight,-hgt",         m_sourceHeight,                        144,        "height of the synthetic content")
+  ("FramesToBeEncoded,f",       m_framesToBeEncoded,                   4,          "number of frames per content")
+  ("FrameRate,-fr",             m_frameRate,                           30,         "frame rate")
+  ("QP,q",                      m_qp,                                  32,         "QP")
+  ("InputBitDepth",             m_inputBitDepth,                       8,          "bit depth of the synthetic content")
+  ("WorkDir",                   m_workDir,                             string("codecbench"), "directory of the generated sources, bitstreams and logs")
+  ("KeepFiles",                 m_keepFiles,                           false,      "keep the generated files in WorkDir")
+  ("Output,o",                  m_outputFileName,                      string("codecbench.json"), "JSON report file name")
+  ("Baseline,b",                m_baselineFileName,                    string(""), "JSON report of a previous run to compare against")
+  ("FpsTolerance",              m_tolerances.fpsPercent,               10.0,       "maximum drop of encoder and decoder fps against the baseline in percent")
+  ("RssTolerance",              m_tolerances.rssPercent,               10.0,       "maximum growth of the peak memory against the baseline in percent")
+  ("BitrateTolerance",          m_tolerances.bitratePercent,           1.0,        "maximum change of the bitrate against the baseline in percent")
+  ("PsnrTolerance",             m_tolerances.psnrDb,                   0.1,        "maximum change of the PSNR against the baseline in dB")
+  ;
+
+  po::setDefaults(opts);
+  po::ErrorReporter err;
+  const list<const char*>& argv_unhandled = po::scanArgv(opts, argc, (const char**) argv, err);
+
+  for (list<const char*>::const_iterator it = argv_unhandled.begin(); it != argv_unhandled.end(); it++)
+  {
+    std::cerr << "Unhandled argument ignored: "<< *it << std::endl;
+  }
+
+  if (do_help)
+  {
+    po::doHelp(cout, opts);
+    return false;
+  }
+
+  if (err.is_errored)
+  {
+    /* errors have already been reported to stderr */
+    return false;
+  }
+
+  const string binDir = executableDir( argv[0] );
+  if( m_encoderApp.empty() )
+  {
+    m_encoderApp = binDir + "/EncoderApp";
+  }
+  if( m_decoderApp.empty() )
+  {
+    m_decoderApp = binDir + "/DecoderApp";
+  }
+
+  m_configs = splitList( configs );
+  if( m_configs.empty() )
+  {
+    std::cerr << "No encoder configuration specified, aborting" << std::endl;
+    return false;
+  }
+
+  m_contents.clear();
+  for( const string& content : splitList( contents ) )
+  {
+    SyntheticSource::ContentType type;
+    if( !SyntheticSource::parseType( content, type ) )
+    {
+      std::cerr << "Unknown content " << content << ", aborting" << std::endl;
+      return false;
+    }
+    m_contents.push_back( type );
+  }
+  if( m_contents.empty() )
+  {
+    std::cerr << "No content specified, aborting" << std::endl;
+    return false;
+  }
+
+  if( m_sourceWidth <= 0 || m_sourceHeight <= 0 || ( m_sourceWidth & 7 ) || ( m_sourceHeight & 7 ) )
+  {
+    std::cerr << "Source size has to be a positive multiple of 8, aborting" << std::endl;
+    return false;
+  }
+  if( m_framesToBeEncoded <= 0 || m_frameRate <= 0 )
+  {
+    std::cerr << "Number of frames and frame rate have to be positive, aborting" << std::endl;
+    return false;
+  }
+  if( m_inputBitDepth < 8 || m_inputBitDepth > 16 )
+  {
+    std::cerr << "Input bit depth " << m_inputBitDepth << " is outside of 8..16, aborting" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+CodecBenchAppCfg::CodecBenchAppCfg()
+: m_sourceWidth( 0 )
+, m_sourceHeight( 0 )
+, m_framesToBeEncoded( 0 )
+, m_frameRate( 0 )
+, m_qp( 0 )
+, m_inputBitDepth( 8 )
+, m_keepFiles( false )
+{
+  m_tolerances.fpsPercent     = 0;
+  m_tolerances.rssPercent     = 0;
+  m_tolerances.bitratePercent = 0;
+  m_tolerances.psnrDb         = 0;
+}
+
+CodecBenchAppCfg::~CodecBenchAppCfg()
+{
+}
+
+//! \}
@@ -0,0 +1,90 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     CodecBenchAppCfg.h
+    \brief    Codec benchmark configuration class (header)
+*/
+
+#ifndef __CODECBENCHAPPCFG__
+#define __CODECBENCHAPPCFG__
+
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+#include "CommonLib/CommonDef.h"
+#include "BenchReport.h"
+#include "SyntheticSource.h"
+#include <string>
+#include <vector>
+
+//! \ingroup CodecBenchApp
+//! \{
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// Codec benchmark configuration class
+class CodecBenchAppCfg
+{
+protected:
+  std::string                               m_encoderApp;           ///< encoder executable
+  std::string                               m_decoderApp;           ///< decoder executable
+  std::string                               m_cfgDir;               ///< directory of the encoder configuration files
+  std::vector<std::string>                  m_configs;              ///< encoder configuration files, relative to m_cfgDir
+  std::vector<SyntheticSource::ContentType> m_contents;             ///< synthetic content to encode
+  std::string                               m_encoderArgs;          ///< additional encoder arguments
+  int                                       m_sourceWidth;
+  int                                       m_sourceHeight;
+  int                                       m_framesToBeEncoded;
+  int                                       m_frameRate;
+  int                                       m_qp;
+  int                                       m_inputBitDepth;
+  std::string                               m_workDir;              ///< directory of the generated sources, bitstreams and logs
+  bool                                      m_keepFiles;            ///< keep the generated files in m_workDir
+  std::string                               m_outputFileName;       ///< JSON report file name
+  std::string                               m_baselineFileName;     ///< JSON report to compare against
+  BenchTolerances                           m_tolerances;
+
+public:
+  CodecBenchAppCfg();
+  virtual ~CodecBenchAppCfg();
+
+  bool  parseCfg        ( int argc, char* argv[] );   ///< initialize option class from configuration
+};
+
+//! \}
+
+#endif  // __CODECBENCHAPPCFG__
@@ -0,0 +1,346 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     SyntheticSource.cpp
+    \brief    Deterministic synthetic test content
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+
+#include "SyntheticSource.h"
+
+//! \ingroup CodecBenchApp
+//! \{
+
+// ====================================================================================================================
+// Local functions
+// ====================================================================================================================
+
+static const char* const s_contentNames[SyntheticSource::NUM_CONTENT_TYPES] = { "gradient", "texture", "scroll", "noise", "fade" };
+
+/// integer hash of a lattice position, the basis of all pseudo random content
+static uint32_t hash3( int x, int y, uint32_t seed )
+{
+  uint32_t h = uint32_t( x ) * 0x8da6b343u ^ uint32_t( y ) * 0xd8163841u ^ seed * 0xcb1ab31fu;
+  h ^= h >> 13;
+  h *= 0x85ebca6bu;
+  h ^= h >> 16;
+  return h;
+}
+
+/// bilinearly interpolated lattice noise in [0, 255], cellSize must be a power of 2
+static int valueNoise( int x, int y, int cellSize, uint32_t seed )
+{
+  int shift = 0;
+  while( ( 1 << shift ) < cellSize )
+  {
+    shift++;
+  }
+
+  // arithmetic shift keeps the lattice continuous for negative coordinates
+  const int cx = x >> shift;
+  const int cy = y >> shift;
+  const int fx = x - ( cx << shift );
+  const int fy = y - ( cy << shift );
+
+  const int v00 = hash3( cx,     cy,     seed ) & 255;
+  const int v10 = hash3( cx + 1, cy,     seed ) & 255;
+  const int v01 = hash3( cx,     cy + 1, seed ) & 255;
+  const int v11 = hash3( cx + 1, cy + 1, seed ) & 255;
+
+  const int top    = v00 * ( cellSize - fx ) + v10 * fx;
+  const int bottom = v01 * ( cellSize - fx ) + v11 * fx;
+
+  return ( top * ( cellSize - fy ) + bottom * fy ) >> ( 2 * shift );
+}
+
+/// triangle wave with the given period, values in [0, 255]
+static int triangleWave( int pos, int period )
+{
+  const int phase = ( ( pos % period ) + period ) % period;
+  const int half  = period >> 1;
+
+  return ( phase < half ? phase : period - phase ) * 255 / half;
+}
+
+// ====================================================================================================================
+// Constructor / destructor / initialization / destroy
+// ====================================================================================================================
+
+SyntheticSource::SyntheticSource( ContentType type, int width, int height, int bitDepth, int numFrames )
+  : m_type     ( type )
+  , m_width    ( width )
+  , m_height   ( height )
+  , m_bitDepth ( bitDepth )
+  , m_numFrames( numFrames )
+{
+}
+
+// ====================================================================================================================
+// Public member functions
+// ====================================================================================================================
+
+const char* SyntheticSource::getName( ContentType type )
+{
+  return s_contentNames[type];
+}
+
+bool SyntheticSource::parseType( const std::string& name, ContentType& type )
+{
+  for( int i = 0; i < NUM_CONTENT_TYPES; i++ )
+  {
+    if( name == s_contentNames[i] )
+    {
+      type = ContentType( i );
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SyntheticSource::writeFile( const std::string& fileName ) const
+{
+  std::ofstream file( fileName.c_str(), std::ios::out | std::ios::binary );
+  if( !file.is_open() )
+  {
+    return false;
+  }
+
+  const int        bytesPerSample = m_bitDepth > 8 ? 2 : 1;
+  const int        shift          = m_bitDepth - 8;
+  std::vector<int> planes[3];
+  std::vector<char> bytes;
+
+  for( int frame = 0; frame < m_numFrames; frame++ )
+  {
+    generateFrame( frame, planes[0], planes[1], planes[2] );
+
+    for( int comp = 0; comp < 3; comp++ )
+    {
+      const std::vector<int>& plane = planes[comp];
+      bytes.resize( plane.size() * bytesPerSample );
+
+      for( size_t i = 0; i < plane.size(); i++ )
+      {
+        // the content is designed in 8 bit, higher bit depths get the same picture with zero LSBs
+        const int value = std::min( std::max( plane[i], 0 ), 255 ) << shift;
+        if( bytesPerSample == 2 )
+        {
+          bytes[2 * i]     = char( value & 0xff );
+          bytes[2 * i + 1] = char( value >> 8 );
+        }
+        else
+        {
+          bytes[i] = char( value );
+        }
+      }
+      file.write( bytes.data(), bytes.size() );
+    }
+  }
+
+  return file.good();
+}
+
+// ====================================================================================================================
+// Private member functions
+// ====================================================================================================================
+
+int SyntheticSource::gradientSample( int x, int y, int frame ) const
+{
+  return 16 + triangleWave( x + y + frame * 2, 2 * ( m_width + m_height ) ) * 219 / 255;
+}
+
+int SyntheticSource::gradientSampleCb( int x, int frame ) const
+{
+  return 64 + triangleWave( 2 * x + frame, 2 * m_width ) / 2;
+}
+
+int SyntheticSource::gradientSampleCr( int y, int frame ) const
+{
+  return 64 + triangleWave( 2 * y - frame, 2 * m_height ) / 2;
+}
+
+/// linear blend from the first sample in frame 0 to the second one in the last frame
+int SyntheticSource::crossFade( int from, int to, int frame ) const
+{
+  const int steps = std::max( m_numFrames - 1, 1 );
+
+  return ( from * ( steps - frame ) + to * frame + ( steps >> 1 ) ) / steps;
+}
+
+int SyntheticSource::textureSample( int x, int y, int frame ) const
+{
+  // object of fine grained texture moving against the panning background
+  const int objSize = std::max( 16, std::min( m_width, m_height ) / 3 );
+  const int objX    = ( m_width  - objSize ) / 2 + ( ( frame * 3 ) % m_width ) - m_width / 4;
+  const int objY    = ( m_height - objSize ) / 2 + ( ( frame * 2 ) % m_height ) - m_height / 4;
+
+  if( x >= objX && x < objX + objSize && y >= objY && y < objY + objSize )
+  {
+    return 40 + valueNoise( x - objX, y - objY, 4, 2 ) * 3 / 4;
+  }
+
+  const int bx = x + frame * 2;
+  const int by = y + frame;
+  return 16 + ( valueNoise( bx, by, 32, 1 ) * 3 + valueNoise( bx, by, 8, 3 ) ) * 219 / 1020;
+}
+
+int SyntheticSource::scrollSample( int x, int y, int frame, bool& inPanel ) const
+{
+  static const int panelColor   = 90;
+  static const int background   = 235;
+  static const int textColor    = 16;
+  static const int glyphWidth   = 8;
+  static const int lineHeight   = 16;
+
+  const int panelWidth = ( m_width / 5 ) & ~7;
+
+  inPanel = x < panelWidth;
+  if( inPanel )
+  {
+    // static icons on the side panel
+    const int iconY = y % 32;
+    const int iconX = x % 32;
+    if( iconX >= 8 && iconX < 24 && iconY >= 8 && iconY < 24 )
+    {
+      return 60 + ( hash3( x / 32, y / 32, 4 ) & 127 );
+    }
+    return panelColor;
+  }
+
+  const int pageY   = y + frame * 4;
+  const int line    = pageY / lineHeight;
+  const int column  = ( x - panelWidth ) / glyphWidth;
+  const int gx      = ( x - panelWidth ) % glyphWidth;
+  const int gy      = pageY % lineHeight;
+  const int columns = ( m_width - panelWidth ) / glyphWidth;
+
+  // ragged right margin and occasional blanks between words
+  const int lineLength = columns / 2 + int( hash3( line, 0, 5 ) % uint32_t( columns / 2 + 1 ) );
+  if( column >= lineLength || ( hash3( column, line, 6 ) % 6 ) == 0 )
+  {
+    return background;
+  }
+
+  // 5x7 glyph with one column and line of spacing
+  if( gx < 1 || gx > 5 || gy < 4 || gy > 10 )
+  {
+    return background;
+  }
+
+  const uint32_t glyph = hash3( column, line, 7 );
+  const int      bit   = ( gy - 4 ) * 5 + ( gx - 1 );
+  const bool     set   = bit < 32 ? ( glyph >> bit ) & 1 : ( hash3( column, line, 8 ) >> ( bit - 32 ) ) & 1;
+
+  return set ? textColor : background;
+}
+
+void SyntheticSource::generateFrame( int frame, std::vector<int>& luma, std::vector<int>& cb, std::vector<int>& cr ) const
+{
+  const int chromaWidth  = m_width  >> 1;
+  const int chromaHeight = m_height >> 1;
+
+  luma.resize( m_width * m_height );
+  cb  .resize( chromaWidth * chromaHeight );
+  cr  .resize( chromaWidth * chromaHeight );
+
+  for( int y = 0; y < m_height; y++ )
+  {
+    for( int x = 0; x < m_width; x++ )
+    {
+      int& sample = luma[y * m_width + x];
+      bool inPanel;
+
+      switch( m_type )
+      {
+      case CONTENT_GRADIENT:
+        sample = gradientSample( x, y, frame );
+        break;
+      case CONTENT_TEXTURE:
+        sample = textureSample( x, y, frame );
+        break;
+      case CONTENT_SCROLL:
+        sample = scrollSample( x, y, frame, inPanel );
+        break;
+      case CONTENT_NOISE:
+        sample = 128 + int( hash3( x, y, 100 + frame ) % 97 ) - 48;
+        break;
+      case CONTENT_FADE:
+      default:
+        sample = crossFade( gradientSample( x, y, frame ), textureSample( x, y, frame ), frame );
+        break;
+      }
+    }
+  }
+
+  for( int y = 0; y < chromaHeight; y++ )
+  {
+    for( int x = 0; x < chromaWidth; x++ )
+    {
+      int& sampleCb = cb[y * chromaWidth + x];
+      int& sampleCr = cr[y * chromaWidth + x];
+      bool inPanel;
+
+      switch( m_type )
+      {
+      case CONTENT_GRADIENT:
+        sampleCb = gradientSampleCb( x, frame );
+        sampleCr = gradientSampleCr( y, frame );
+        break;
+      case CONTENT_TEXTURE:
+        sampleCb = 128 + ( textureSample( 2 * x, 2 * y, frame ) - 128 ) / 4;
+        sampleCr = 128 - ( textureSample( 2 * x + 1, 2 * y + 1, frame ) - 128 ) / 4;
+        break;
+      case CONTENT_SCROLL:
+        scrollSample( 2 * x, 2 * y, frame, inPanel );
+        sampleCb = inPanel ? 150 : 128;
+        sampleCr = inPanel ? 110 : 128;
+        break;
+      case CONTENT_NOISE:
+        sampleCb = 128 + int( hash3( x, y, 200 + frame ) % 33 ) - 16;
+        sampleCr = 128 + int( hash3( x, y, 300 + frame ) % 33 ) - 16;
+        break;
+      case CONTENT_FADE:
+      default:
+        sampleCb = crossFade( gradientSampleCb( x, frame ), 128 + ( textureSample( 2 * x,     2 * y,     frame ) - 128 ) / 4, frame );
+        sampleCr = crossFade( gradientSampleCr( y, frame ), 128 - ( textureSample( 2 * x + 1, 2 * y + 1, frame ) - 128 ) / 4, frame );
+        break;
+      }
+    }
+  }
+}
+
+//! \}
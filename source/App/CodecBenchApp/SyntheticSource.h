@@ -0,0 +1,98 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     SyntheticSource.h
+    \brief    Deterministic synthetic test content (header)
+*/
+
+#ifndef __SYNTHETICSOURCE__
+#define __SYNTHETICSOURCE__
+
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//! \ingroup CodecBenchApp
+//! \{
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// procedurally generated 4:2:0 video, bit-exact on every platform as it only uses integer arithmetic
+class SyntheticSource
+{
+public:
+  enum ContentType
+  {
+    CONTENT_GRADIENT = 0,   ///< slowly moving smooth luma and chroma ramps
+    CONTENT_TEXTURE,        ///< panning value noise background with a textured object moving against it
+    CONTENT_SCROLL,         ///< screen content: vertically scrolling text next to a static side panel
+    CONTENT_NOISE,          ///< temporally uncorrelated noise
+    CONTENT_FADE,           ///< cross-fade from the gradient to the texture content
+    NUM_CONTENT_TYPES
+  };
+
+  SyntheticSource( ContentType type, int width, int height, int bitDepth, int numFrames );
+
+  static const char* getName     ( ContentType type );
+  static bool        parseType   ( const std::string& name, ContentType& type );
+
+  /// write all frames as planar 4:2:0, one byte per sample for 8 bit, little endian 16 bit otherwise
+  bool               writeFile   ( const std::string& fileName ) const;
+
+private:
+  void               generateFrame( int frame, std::vector<int>& luma, std::vector<int>& cb, std::vector<int>& cr ) const;
+
+  int                gradientSample  ( int x, int y, int frame ) const;
+  int                gradientSampleCb( int x, int frame ) const;
+  int                gradientSampleCr( int y, int frame ) const;
+  int                crossFade       ( int from, int to, int frame ) const;
+  int                textureSample   ( int x, int y, int frame ) const;
+  int                scrollSample    ( int x, int y, int frame, bool& inPanel ) const;
+
+  ContentType        m_type;
+  int                m_width;
+  int                m_height;
+  int                m_bitDepth;
+  int                m_numFrames;
+};
+
+//! \}
+
+#endif // __SYNTHETICSOURCE__
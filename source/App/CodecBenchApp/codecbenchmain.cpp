@@ -0,0 +1,103 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     codecbenchmain.cpp
+    \brief    Codec benchmark application main
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <chrono>
+#include "CodecBenchApp.h"
+
+//! \ingroup CodecBenchApp
+//! \{
+
+// ====================================================================================================================
+// Main function
+// ====================================================================================================================
+
+int main(int argc, char* argv[])
+{
+  int returnCode = EXIT_SUCCESS;
+
+  // print information
+  fprintf( stderr, "\n" );
+  fprintf( stderr, "VVCSoftware: VTM Codec Benchmark Version %s ", VTM_VERSION );
+  fprintf( stderr, NVM_ONOS );
+  fprintf( stderr, NVM_COMPILEDBY );
+  fprintf( stderr, NVM_BITS );
+  fprintf( stderr, "\n" );
+
+  CodecBenchApp *pcBenchApp = new CodecBenchApp;
+  // parse configuration
+  if( !pcBenchApp->parseCfg( argc, argv ) )
+  {
+    delete pcBenchApp;
+    return EXIT_FAILURE;
+  }
+
+  // starting time
+  auto startTime = std::chrono::steady_clock::now();
+
+  try
+  {
+    if( 0 != pcBenchApp->run() )
+    {
+      fprintf( stderr, "\n\n***ERROR*** Performance regression against the baseline\n" );
+      returnCode = EXIT_FAILURE;
+    }
+  }
+  catch( Exception &e )
+  {
+    std::cerr << e.what() << std::endl;
+    returnCode = EXIT_FAILURE;
+  }
+  catch( ... )
+  {
+    std::cerr << "Unspecified error occurred" << std::endl;
+    returnCode = EXIT_FAILURE;
+  }
+
+  // ending time
+  auto endTime = std::chrono::steady_clock::now();
+  fprintf( stderr, "\n Total Time: %12.3f sec.\n", std::chrono::duration<double>( endTime - startTime ).count() );
+
+  delete pcBenchApp;
+
+  return returnCode;
+}
+
+//! \}
@@ -46,6 +46,9 @@
 #if RExt__DECODER_DEBUG_STATISTICS
 #include "CommonLib/CodingStatistics.h"
 #endif
+#if DECODER_STAGE_PROFILE
+#include "CommonLib/StageProfile.h"
+#endif
 #include "CommonLib/dtrace_codingstruct.h"
 
 
@@ -288,6 +291,13 @@ uint32_t DecApp::decode()
 #if RExt__DECODER_DEBUG_STATISTICS
   CodingStatistics::DestroyInstance();
 #endif
+#if DECODER_STAGE_PROFILE
+  if( !m_stageProfileFileName.empty() && !StageProfile::writeReport( m_stageProfileFileName ) )
+  {
+    msg( WARNING, "\nWarning: could not write stage profile to %s\n", m_stageProfileFileName.c_str() );
+  }
+  StageProfile::DestroyInstance();
+#endif
 
   destroyROM();
 
@@ -312,6 +322,10 @@ void DecApp::xCreateDecLib()
 #endif
   );
   m_cDecLib.setDecodedPictureHashSEIEnabled(m_decodedPictureHashSEIEnabled);
+  m_cDecLib.setNumWppThreads(m_numWppThreads);
+  m_cDecLib.setNumBrickThreads(m_numBrickThreads);
+  m_cDecLib.setNumReconThreads(m_numReconThreads);
+  m_cDecLib.setNumFrameThreads(m_numFrameThreads);
 
 #if JVET_N0278_HLS
   m_cDecLib.setTargetDecLayer(m_iTargetLayer);
@@ -427,6 +441,8 @@ void DecApp::xWriteOutput( PicList* pcListPic, uint32_t tId )
 
           if (display)
           {
+            pcPicTop->waitForReconstruction();
+            pcPicBottom->waitForReconstruction();
             m_cVideoIOYuvReconFile.write( pcPicTop->getRecoBuf(), pcPicBottom->getRecoBuf(),
                                           m_outputColourSpaceConvert,
                                           false, // TODO: m_packedYUVMode,
@@ -488,6 +504,7 @@ void DecApp::xWriteOutput( PicList* pcListPic, uint32_t tId )
           const Window  defDisp = (m_respectDefDispWindow && pcPic->cs->sps->getVuiParametersPresentFlag()) ? pcPic->cs->sps->getVuiParameters()->getDefaultDisplayWindow() : Window();
 #endif
 
+          pcPic->waitForReconstruction();
           m_cVideoIOYuvReconFile.write( pcPic->getRecoBuf(),
                                         m_outputColourSpaceConvert,
                                         m_packedYUVMode,
@@ -530,6 +547,9 @@ void DecApp::xWriteOutput( PicList* pcListPic, uint32_t tId )
  */
 void DecApp::xFlushOutput( PicList* pcListPic )
 {
+  // the pictures are destroyed below, so all of them have to be reconstructed
+  m_cDecLib.waitForFrameJobs();
+
   if(!pcListPic || pcListPic->empty())
   {
     return;
@@ -78,7 +78,7 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
   ("ReconFile,o",               m_reconFileName,                       string(""), "reconstructed YUV output file name\n")
 
 #if ENABLE_SIMD_OPT
-  ("SIMD",                      ignore,                                string(""), "SIMD extension to use (SCALAR, SSE41, SSE42, AVX, AVX2, AVX512), default: the highest supported extension\n")
+  ("SIMD",                      ignore,                                string(""), "SIMD extension to use (SCALAR, SSE41, SSE42, AVX, AVX2, AVX512, VEC for the portable vector kernels), default: the highest supported extension\n")
 #endif
 
   ("WarnUnknowParameter,w",     warnUnknowParameter,                   0,          "warn for unknown configuration parameters instead of failing")
@@ -114,8 +114,15 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
                                                                                    "\t1: enable bit statistic\n"
                                                                                    "\t2: enable tool statistic\n"
                                                                                    "\t3: enable bit and tool statistic\n")
+#endif
+#if DECODER_STAGE_PROFILE
+  ("StageProfile",              m_stageProfileFileName,               string( "" ), "Stage profile output file (per picture, per temporal layer and total stage times and counters), JSON if the name ends with .json, CSV otherwise")
 #endif
   ("MCTSCheck",                m_mctsCheck,                           false,       "If enabled, the decoder checks for violations of mc_exact_sample_value_match_flag in Temporal MCTS ")
+  ("NumWppThreads",            m_numWppThreads,                       1,           "Number of threads decoding CTU rows in parallel for streams with entropy coding sync (wavefronts) enabled")
+  ("NumBrickThreads",          m_numBrickThreads,                     1,           "Number of threads decoding the tiles/bricks of a slice in parallel")
+  ("NumReconThreads",          m_numReconThreads,                     0,           "Number of threads reconstructing the CTUs while the decoding thread parses ahead (0: parse and reconstruct in the decoding thread)")
+  ("NumFrameThreads",          m_numFrameThreads,                     1,           "Number of pictures reconstructed in parallel, each by its own frame decoder thread")
   ;
 
   po::setDefaults(opts);
@@ -153,6 +160,32 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
 #endif
 
   g_mctsDecCheckEnabled = m_mctsCheck;
+
+  if( m_numWppThreads < 1 || m_numBrickThreads < 1 || m_numFrameThreads < 1 )
+  {
+    msg( ERROR, "NumWppThreads, NumBrickThreads and NumFrameThreads must be at least 1\n" );
+    return false;
+  }
+  if( m_numReconThreads < 0 )
+  {
+    msg( ERROR, "NumReconThreads must not be negative\n" );
+    return false;
+  }
+#if DECODER_STAGE_PROFILE
+  if( m_numWppThreads > 1 || m_numBrickThreads > 1 || m_numFrameThreads > 1 || m_numReconThreads > 0 )
+  {
+    msg( ERROR, "NumWppThreads, NumBrickThreads or NumFrameThreads > 1 and NumReconThreads > 0 are not supported with the decoder stage profiling enabled\n" );
+    return false;
+  }
+#endif
+#if ENABLE_TRACING
+  if( m_numFrameThreads > 1 )
+  {
+    msg( ERROR, "NumFrameThreads > 1 is not supported with tracing enabled\n" );
+    return false;
+  }
+#endif
+
   // Chroma output bit-depth
   if( m_outputBitDepth[CHANNEL_TYPE_LUMA] != 0 && m_outputBitDepth[CHANNEL_TYPE_CHROMA] == 0 )
   {
@@ -238,7 +271,14 @@ DecAppCfg::DecAppCfg()
 , m_bClipOutputVideoToRec709Range(false)
 , m_packedYUVMode(false)
 , m_statMode(0)
+#if DECODER_STAGE_PROFILE
+, m_stageProfileFileName()
+#endif
 , m_mctsCheck(false)
+, m_numWppThreads(1)
+, m_numBrickThreads(1)
+, m_numReconThreads(0)
+, m_numFrameThreads(1)
 {
   for (uint32_t channelTypeIndex = 0; channelTypeIndex < MAX_NUM_CHANNEL_TYPE; channelTypeIndex++)
   {
@@ -76,7 +76,14 @@ protected:
   bool          m_packedYUVMode;                      ///< If true, output 10-bit and 12-bit YUV data as 5-byte and 3-byte (respectively) packed YUV data
   std::string   m_cacheCfgFile;                       ///< Config file of cache model
   int           m_statMode;                           ///< Config statistic mode (0 - bit stat, 1 - tool stat, 3 - both)
+#if DECODER_STAGE_PROFILE
+  std::string   m_stageProfileFileName;               ///< stage profile output file name, no profile is written if empty
+#endif
   bool          m_mctsCheck;
+  int           m_numWppThreads;                      ///< number of threads decoding CTU rows in parallel when entropy coding sync is enabled
+  int           m_numBrickThreads;                    ///< number of threads decoding the bricks of a slice in parallel
+  int           m_numReconThreads;                    ///< number of threads reconstructing the CTUs behind the parsing, 0: no parsing/reconstruction pipeline
+  int           m_numFrameThreads;                    ///< number of pictures reconstructed in parallel
 
 public:
   DecAppCfg();
@@ -64,7 +64,7 @@ int main(int argc, char* argv[])
   optsSimd.addOptions()( "SIMD", SIMD, string( "" ), "" );
   df::program_options_lite::SilentReporter err;
   df::program_options_lite::scanArgv( optsSimd, argc, ( const char** ) argv, err );
-  fprintf( stdout, "[SIMD=%s] ", read_x86_extension( SIMD ) );
+  fprintf( stdout, "[SIMD=%s] ", read_simd_extension( SIMD ) );
 #endif
 #if ENABLE_TRACING
   fprintf( stdout, "[ENABLE_TRACING] " );
@@ -667,6 +667,9 @@ void EncApp::xInitLibCfg()
   m_cEncLib.setSummaryOutFilename                                ( m_summaryOutFilename );
   m_cEncLib.setSummaryPicFilenameBase                            ( m_summaryPicFilenameBase );
   m_cEncLib.setSummaryVerboseness                                ( m_summaryVerboseness );
+#if ENCODER_MODE_PROFILE
+  m_cEncLib.setModeProfileFilename                               ( m_modeProfileFilename );
+#endif
   m_cEncLib.setIMV                                               ( m_ImvMode );
   m_cEncLib.setIMV4PelFast                                       ( m_Imv4PelFast );
   m_cEncLib.setDecodeBitstream                                   ( 0, m_decodeBitstreams[0] );
@@ -854,6 +857,9 @@ void EncApp::encode()
   }
 
   m_cEncLib.printSummary(m_isField);
+#if ENCODER_MODE_PROFILE
+  m_cEncLib.printModeProfile();
+#endif
 
 
   // delete used buffers in encoder class
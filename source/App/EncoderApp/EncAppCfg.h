@@ -651,6 +651,9 @@ protected:
   std::string m_summaryOutFilename;                           ///< filename to use for producing summary output file.
   std::string m_summaryPicFilenameBase;                       ///< Base filename to use for producing summary picture output files. The actual filenames used will have I.txt, P.txt and B.txt appended.
   uint32_t        m_summaryVerboseness;                           ///< Specifies the level of the verboseness of the text output.
+#if ENCODER_MODE_PROFILE
+  std::string m_modeProfileFilename;                          ///< filename to use for the mode decision profile
+#endif
 
   int         m_verbosity;
 
@@ -96,7 +96,7 @@ int main(int argc, char* argv[])
     ( "c", df::program_options_lite::parseConfigFile, "" );
   df::program_options_lite::SilentReporter err;
   df::program_options_lite::scanArgv( opts, argc, ( const char** ) argv, err );
-  fprintf( stdout, "[SIMD=%s] ", read_x86_extension( SIMD ) );
+  fprintf( stdout, "[SIMD=%s] ", read_simd_extension( SIMD ) );
 #endif
 #if ENABLE_TRACING
   fprintf( stdout, "[ENABLE_TRACING] " );
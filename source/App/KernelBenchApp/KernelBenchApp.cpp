@@ -0,0 +1,1172 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     KernelBenchApp.cpp
+    \brief    Kernel benchmark application class
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "KernelBenchApp.h"
+
+#include "CommonLib/AdaptiveLoopFilter.h"
+#include "CommonLib/AffineGradientSearch.h"
+#include "CommonLib/Buffer.h"
+#include "CommonLib/CodingStructure.h"
+#include "CommonLib/IbcHashMap.h"
+#include "CommonLib/InterpolationFilter.h"
+#include "CommonLib/RdCost.h"
+#include "CommonLib/Rom.h"
+#include "CommonLib/Slice.h"
+
+#ifdef TARGET_SIMD_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+//! \ingroup KernelBenchApp
+//! \{
+
+// ====================================================================================================================
+// Benchmark data
+// ====================================================================================================================
+
+enum BenchPlane
+{
+  PEL_SRC0 = 0,
+  PEL_SRC1,
+  PEL_DST,
+  PEL_GRAD_X0,
+  PEL_GRAD_X1,
+  PEL_GRAD_Y0,
+  PEL_GRAD_Y1,
+  NUM_PEL_PLANES
+};
+
+enum BenchOutput
+{
+  OUT_DST         = 1 << 0,   ///< PEL_DST
+  OUT_GRAD        = 1 << 1,   ///< PEL_GRAD_X0 .. PEL_GRAD_Y1
+  OUT_INT         = 1 << 2,   ///< all int planes
+  OUT_EQUAL_COEFF = 1 << 3,   ///< affine equation coefficients
+  OUT_RESULT      = 1 << 4,   ///< scalar results (distortions, sums, CRCs)
+  OUT_CLASSIFIER  = 1 << 5    ///< ALF classification
+};
+
+static const int NUM_INT_PLANES     = 5;
+static const int NUM_BENCH_RESULTS  = 128;
+static const int NUM_BENCH_PARAMS   = 16;
+static const int BENCH_MARGIN       = 16;
+static const int BENCH_STRIDE       = MAX_CU_SIZE + 2 * BENCH_MARGIN;
+static const int BENCH_PLANE_SIZE   = BENCH_STRIDE * BENCH_STRIDE;
+static const int ALF_LAPLACIAN_SIZE = AdaptiveLoopFilter::m_CLASSIFICATION_BLK_SIZE + 5;
+
+/// block size and sample range of one benchmark case
+struct BenchBlock
+{
+  int    width;
+  int    height;
+  int    bitDepth;
+  ClpRng clpRng;
+};
+
+/// input and output memory of the kernels, reset and refilled for every case
+struct BenchBuffers
+{
+  std::vector<Pel>           pelStore[NUM_PEL_PLANES];
+  std::vector<int>           intStore[NUM_INT_PLANES];
+  Pel*                       pel     [NUM_PEL_PLANES];   ///< top left sample, BENCH_MARGIN samples inside the allocation
+  int*                       ints    [NUM_INT_PLANES];
+  int64_t                    equalCoeff[7][7];
+  uint64_t                   result[NUM_BENCH_RESULTS];
+  int                        param [NUM_BENCH_PARAMS];   ///< random kernel parameters drawn by the prepare step
+
+  std::vector<AlfClassifier> classifierStore;
+  AlfClassifier*             classifier[MAX_CU_SIZE];
+  std::vector<int>           laplacianStore;
+  std::vector<int*>          laplacianRows;
+  int**                      laplacian[NUM_DIRECTIONS];
+  short                      alfCoeff[MAX_NUM_ALF_CLASSES * MAX_NUM_ALF_LUMA_COEFF];
+  short                      alfClip [MAX_NUM_ALF_CLASSES * MAX_NUM_ALF_LUMA_COEFF];
+  LumaMapPWL                 lumaMap;
+
+  uint32_t                   rngState;
+
+  BenchBuffers()
+  {
+    for( int i = 0; i < NUM_PEL_PLANES; i++ )
+    {
+      pelStore[i].resize( BENCH_PLANE_SIZE );
+      pel[i] = pelStore[i].data() + BENCH_MARGIN * BENCH_STRIDE + BENCH_MARGIN;
+    }
+    for( int i = 0; i < NUM_INT_PLANES; i++ )
+    {
+      intStore[i].resize( BENCH_PLANE_SIZE );
+      ints[i] = intStore[i].data();
+    }
+
+    classifierStore.resize( MAX_CU_SIZE * MAX_CU_SIZE );
+    for( int y = 0; y < MAX_CU_SIZE; y++ )
+    {
+      classifier[y] = classifierStore.data() + y * MAX_CU_SIZE;
+    }
+
+    laplacianStore.resize( NUM_DIRECTIONS * ALF_LAPLACIAN_SIZE * ALF_LAPLACIAN_SIZE );
+    laplacianRows .resize( NUM_DIRECTIONS * ALF_LAPLACIAN_SIZE );
+    for( int dir = 0; dir < NUM_DIRECTIONS; dir++ )
+    {
+      for( int y = 0; y < ALF_LAPLACIAN_SIZE; y++ )
+      {
+        laplacianRows[dir * ALF_LAPLACIAN_SIZE + y] = laplacianStore.data() + ( dir * ALF_LAPLACIAN_SIZE + y ) * ALF_LAPLACIAN_SIZE;
+      }
+      laplacian[dir] = laplacianRows.data() + dir * ALF_LAPLACIAN_SIZE;
+    }
+
+    rngState = 1;
+  }
+
+  void reset( uint32_t seed )
+  {
+    for( int i = 0; i < NUM_PEL_PLANES; i++ )
+    {
+      std::fill( pelStore[i].begin(), pelStore[i].end(), 0 );
+    }
+    for( int i = 0; i < NUM_INT_PLANES; i++ )
+    {
+      std::fill( intStore[i].begin(), intStore[i].end(), 0 );
+    }
+    std::fill( classifierStore.begin(), classifierStore.end(), AlfClassifier( 0, 0 ) );
+    memset( equalCoeff, 0, sizeof( equalCoeff ) );
+    memset( result,     0, sizeof( result ) );
+    memset( param,      0, sizeof( param ) );
+
+    rngState = seed ? seed : 1;
+  }
+
+  /// xorshift32, the same sequence on every platform and tier
+  uint32_t next()
+  {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+  }
+
+  /// uniform integer in [lo, hi]
+  int uniform( int lo, int hi )
+  {
+    return lo + int( next() % uint32_t( hi - lo + 1 ) );
+  }
+
+  void fillRange( int plane, int lo, int hi )
+  {
+    for( Pel& v : pelStore[plane] )
+    {
+      v = Pel( uniform( lo, hi ) );
+    }
+  }
+
+  void fillPel( int plane, int bitDepth )
+  {
+    fillRange( plane, 0, ( 1 << bitDepth ) - 1 );
+  }
+
+  /// samples as produced by the first interpolation stage
+  void fillIntermediate( int plane, int bitDepth )
+  {
+    const int shift = IF_INTERNAL_PREC - bitDepth;
+
+    for( Pel& v : pelStore[plane] )
+    {
+      v = Pel( ( uniform( 0, ( 1 << bitDepth ) - 1 ) << shift ) - IF_INTERNAL_OFFS );
+    }
+  }
+
+  void fillInt( int plane, int lo, int hi )
+  {
+    for( int& v : intStore[plane] )
+    {
+      v = uniform( lo, hi );
+    }
+  }
+
+  /// FNV-1a over the selected outputs, margins included so that writes outside the block are caught as well
+  uint64_t hash( int outputs ) const
+  {
+    uint64_t h = 1469598103934665603ULL;
+
+    auto mix = [&h]( const void* data, size_t size )
+    {
+      const uint8_t* bytes = ( const uint8_t* ) data;
+      for( size_t i = 0; i < size; i++ )
+      {
+        h ^= bytes[i];
+        h *= 1099511628211ULL;
+      }
+    };
+
+    if( outputs & OUT_DST )
+    {
+      mix( pelStore[PEL_DST].data(), pelStore[PEL_DST].size() * sizeof( Pel ) );
+    }
+    if( outputs & OUT_GRAD )
+    {
+      for( int i = PEL_GRAD_X0; i <= PEL_GRAD_Y1; i++ )
+      {
+        mix( pelStore[i].data(), pelStore[i].size() * sizeof( Pel ) );
+      }
+    }
+    if( outputs & OUT_INT )
+    {
+      for( int i = 0; i < NUM_INT_PLANES; i++ )
+      {
+        mix( intStore[i].data(), intStore[i].size() * sizeof( int ) );
+      }
+    }
+    if( outputs & OUT_EQUAL_COEFF )
+    {
+      mix( equalCoeff, sizeof( equalCoeff ) );
+    }
+    if( outputs & OUT_RESULT )
+    {
+      mix( result, sizeof( result ) );
+    }
+    if( outputs & OUT_CLASSIFIER )
+    {
+      for( const AlfClassifier& c : classifierStore )
+      {
+        mix( &c.classIdx,     sizeof( c.classIdx ) );
+        mix( &c.transposeIdx, sizeof( c.transposeIdx ) );
+      }
+    }
+
+    return h;
+  }
+};
+
+/// owners of the kernel tables, constructed after the tier has been selected so that they pick up its kernels
+struct KernelSet
+{
+  PelBufferOps         bufferOps;
+  RdCost               rdCost;
+  InterpolationFilter  interpolationFilter;
+  AdaptiveLoopFilter   adaptiveLoopFilter;
+  AffineGradientSearch affineGradientSearch;
+  IbcHashMap           ibcHashMap;
+
+  CUCache              cuCache;
+  PUCache              puCache;
+  TUCache              tuCache;
+  SPS                  sps;
+  Slice                slice;
+  CodingStructure      cs;
+
+  KernelSet()
+    : cs( cuCache, puCache, tuCache )
+  {
+#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+    bufferOps.initPelBufOpsX86();
+#endif
+#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_VEC)
+    bufferOps.initPelBufOpsVec();
+#endif
+    interpolationFilter.initInterpolationFilter( true );
+
+    // the ALF block filters only look at the slice type and the PCM settings
+    slice.setSliceType( B_SLICE );
+    slice.setSPS( &sps );
+    cs.slice = &slice;
+    cs.sps   = &sps;
+  }
+};
+
+typedef std::function<bool( int width, int height )>                          KernelFits;
+typedef std::function<void( BenchBuffers&, const BenchBlock& )>               KernelPrepare;
+typedef std::function<void( KernelSet&, BenchBuffers&, const BenchBlock& )>   KernelRun;
+
+/// one kernel, the block sizes it supports and how to feed it
+struct KernelDef
+{
+  std::string   module;
+  std::string   kernel;
+  int           outputs;
+  KernelFits    fits;
+  KernelPrepare prepare;
+  KernelRun     run;
+};
+
+// ====================================================================================================================
+// Kernel definitions
+// ====================================================================================================================
+
+static const int S = BENCH_STRIDE;
+
+static bool isPow2Block( int width, int height )
+{
+  return isPowerOf2( width ) && isPowerOf2( height );
+}
+
+static void addKernel( std::vector<KernelDef>& defs, const char* module, const std::string& kernel, int outputs, KernelFits fits, KernelPrepare prepare, KernelRun run )
+{
+  defs.push_back( KernelDef{ module, kernel, outputs, fits, prepare, run } );
+}
+
+static void addBufferKernels( std::vector<KernelDef>& defs )
+{
+  const KernelFits anyBlock  = []( int w, int h ) { return isPow2Block( w, h ); };
+  const KernelFits width8    = []( int w, int h ) { return isPow2Block( w, h ) && ( w & 7 ) == 0; };
+  // the GBI kernels for narrow blocks are only called with a width of 4
+  const KernelFits width4    = []( int w, int h ) { return w == 4 && isPowerOf2( h ); };
+  const KernelFits bdofBlock = []( int w, int h ) { return ( w == 8 || w == 16 ) && ( h == 8 || h == 16 ); };
+  const KernelFits dmvrBlock = bdofBlock;
+
+  for( int w8 = 0; w8 < 2; w8++ )
+  {
+    const std::string suffix = w8 ? "8" : "4";
+
+    addKernel( defs, "Buffer", "addAvg" + suffix, OUT_DST, w8 ? width8 : anyBlock,
+      []( BenchBuffers& b, const BenchBlock& blk )
+      {
+        b.fillIntermediate( PEL_SRC0, blk.bitDepth );
+        b.fillIntermediate( PEL_SRC1, blk.bitDepth );
+      },
+      [w8]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+      {
+        const int shift  = IF_INTERNAL_PREC + 1 - blk.bitDepth;
+        const int offset = ( 1 << ( shift - 1 ) ) + 2 * IF_INTERNAL_OFFS;
+        ( w8 ? k.bufferOps.addAvg8 : k.bufferOps.addAvg4 )( b.pel[PEL_SRC0], S, b.pel[PEL_SRC1], S, b.pel[PEL_DST], S, blk.width, blk.height, shift, offset, blk.clpRng );
+      } );
+
+    addKernel( defs, "Buffer", "reco" + suffix, OUT_DST, w8 ? width8 : anyBlock,
+      []( BenchBuffers& b, const BenchBlock& blk )
+      {
+        b.fillPel  ( PEL_SRC0, blk.bitDepth );
+        b.fillRange( PEL_SRC1, -blk.clpRng.max, blk.clpRng.max );
+      },
+      [w8]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+      {
+        ( w8 ? k.bufferOps.reco8 : k.bufferOps.reco4 )( b.pel[PEL_SRC0], S, b.pel[PEL_SRC1], S, b.pel[PEL_DST], S, blk.width, blk.height, blk.clpRng );
+      } );
+
+    // CCLM style parameters, small enough to stay inside 16 bits before the clip
+    addKernel( defs, "Buffer", "linTf" + suffix, OUT_DST, w8 ? width8 : anyBlock,
+      []( BenchBuffers& b, const BenchBlock& blk )
+      {
+        b.fillPel( PEL_SRC0, blk.bitDepth );
+        b.param[0] = b.uniform( -64, 63 );
+        b.param[1] = b.uniform( 4, 6 );
+        b.param[2] = b.uniform( -( 1 << blk.bitDepth ), 1 << blk.bitDepth );
+      },
+      [w8]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+      {
+        ( w8 ? k.bufferOps.linTf8 : k.bufferOps.linTf4 )( b.pel[PEL_SRC0], S, b.pel[PEL_DST], S, blk.width, blk.height, b.param[0], b.param[1], b.param[2], blk.clpRng, true );
+      } );
+
+#if ENABLE_SIMD_OPT_GBI
+    addKernel( defs, "Buffer", "removeWeightHighFreq" + suffix, OUT_DST, w8 ? width8 : width4,
+      []( BenchBuffers& b, const BenchBlock& blk )
+      {
+        static const int gbiWeights[] = { -2, 3, 5, 10 };
+        b.fillPel( PEL_DST,  blk.bitDepth );
+        b.fillPel( PEL_SRC1, blk.bitDepth );
+        b.param[0] = gbiWeights[b.uniform( 0, 3 )];
+      },
+      [w8]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+      {
+        ( w8 ? k.bufferOps.removeWeightHighFreq8 : k.bufferOps.removeWeightHighFreq4 )( b.pel[PEL_DST], S, b.pel[PEL_SRC1], S, blk.width, blk.height, 16, b.param[0] );
+      } );
+
+    addKernel( defs, "Buffer", "removeHighFreq" + suffix, OUT_DST, w8 ? width8 : width4,
+      []( BenchBuffers& b, const BenchBlock& blk )
+      {
+        b.fillPel( PEL_DST,  blk.bitDepth );
+        b.fillPel( PEL_SRC1, blk.bitDepth );
+      },
+      [w8]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+      {
+        ( w8 ? k.bufferOps.removeHighFreq8 : k.bufferOps.removeHighFreq4 )( b.pel[PEL_DST], S, b.pel[PEL_SRC1], S, blk.width, blk.height );
+      } );
+#endif
+  }
+
+  // BDOF, every stage is fed with the range the previous stage produces
+  addKernel( defs, "Buffer", "bioGradFilter", OUT_GRAD, bdofBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillIntermediate( PEL_SRC0, blk.bitDepth );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      const int widthG  = blk.width  + 2 * BIO_EXTEND_SIZE;
+      const int heightG = blk.height + 2 * BIO_EXTEND_SIZE;
+      k.bufferOps.bioGradFilter( b.pel[PEL_SRC0] - S - 1, S, widthG, heightG, widthG, b.pel[PEL_GRAD_X0], b.pel[PEL_GRAD_Y0], blk.bitDepth );
+    } );
+
+  addKernel( defs, "Buffer", "calcBIOPar", OUT_INT, bdofBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillIntermediate( PEL_SRC0, blk.bitDepth );
+      b.fillIntermediate( PEL_SRC1, blk.bitDepth );
+      for( int i = PEL_GRAD_X0; i <= PEL_GRAD_Y1; i++ )
+      {
+        b.fillRange( i, -256, 255 );
+      }
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      const int widthG  = blk.width  + 2 * BIO_EXTEND_SIZE;
+      const int heightG = blk.height + 2 * BIO_EXTEND_SIZE;
+      k.bufferOps.calcBIOPar( b.pel[PEL_SRC0] - S - 1, b.pel[PEL_SRC1] - S - 1, b.pel[PEL_GRAD_X0], b.pel[PEL_GRAD_X1], b.pel[PEL_GRAD_Y0], b.pel[PEL_GRAD_Y1],
+                              b.ints[0], b.ints[1], b.ints[2], b.ints[3], b.ints[4], S, S, widthG, widthG, heightG, blk.bitDepth );
+    } );
+
+  addKernel( defs, "Buffer", "calcBlkGradient", OUT_RESULT, bdofBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      for( int i = 0; i < NUM_INT_PLANES; i++ )
+      {
+        b.fillInt( i, -65536, 65536 );
+      }
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      const int widthG    = blk.width  + 2 * BIO_EXTEND_SIZE;
+      const int heightG   = blk.height + 2 * BIO_EXTEND_SIZE;
+      const int offsetPos = widthG * BIO_EXTEND_SIZE + BIO_EXTEND_SIZE;
+      int       unit      = 0;
+
+      for( int yu = 0; yu < ( blk.height >> 2 ); yu++ )
+      {
+        for( int xu = 0; xu < ( blk.width >> 2 ); xu++, unit++ )
+        {
+          const int offset = offsetPos + ( ( yu * widthG + xu ) << 2 );
+          int sGx2 = 0, sGy2 = 0, sGxGy = 0, sGxdI = 0, sGydI = 0;
+          k.bufferOps.calcBlkGradient( xu << 2, yu << 2, b.ints[0] + offset, b.ints[1] + offset, b.ints[2] + offset, b.ints[3] + offset, b.ints[4] + offset,
+                                       sGx2, sGy2, sGxGy, sGxdI, sGydI, widthG, heightG, 1 << 2 );
+          uint64_t* res = b.result + unit * 5;
+          res[0] = sGx2; res[1] = sGy2; res[2] = sGxGy; res[3] = sGxdI; res[4] = sGydI;
+        }
+      }
+    } );
+
+  addKernel( defs, "Buffer", "addBIOAvg4", OUT_DST, bdofBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      const int limit = 1 << std::max<int>( 5, blk.bitDepth - 7 );
+      b.fillIntermediate( PEL_SRC0, blk.bitDepth );
+      b.fillIntermediate( PEL_SRC1, blk.bitDepth );
+      for( int i = PEL_GRAD_X0; i <= PEL_GRAD_Y1; i++ )
+      {
+        b.fillRange( i, -256, 255 );
+      }
+      b.fillInt( 0, -limit, limit );
+      b.fillInt( 1, -limit, limit );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      const int widthG    = blk.width + 2 * BIO_EXTEND_SIZE;
+      const int offsetPos = widthG * BIO_EXTEND_SIZE + BIO_EXTEND_SIZE;
+      const int shift     = IF_INTERNAL_PREC + 1 - blk.bitDepth;
+      const int offset    = ( 1 << ( shift - 1 ) ) + 2 * IF_INTERNAL_OFFS;
+      int       unit      = 0;
+
+      for( int yu = 0; yu < ( blk.height >> 2 ); yu++ )
+      {
+        for( int xu = 0; xu < ( blk.width >> 2 ); xu++, unit++ )
+        {
+          const int gradOffset = offsetPos + ( ( yu * widthG + xu ) << 2 );
+          const int pelOffset  = ( yu * S + xu ) << 2;
+          k.bufferOps.addBIOAvg4( b.pel[PEL_SRC0] + pelOffset, S, b.pel[PEL_SRC1] + pelOffset, S, b.pel[PEL_DST] + pelOffset, S,
+                                  b.pel[PEL_GRAD_X0] + gradOffset, b.pel[PEL_GRAD_X1] + gradOffset, b.pel[PEL_GRAD_Y0] + gradOffset, b.pel[PEL_GRAD_Y1] + gradOffset,
+                                  widthG, 4, 4, b.ints[0][unit], b.ints[1][unit], shift, offset, blk.clpRng );
+        }
+      }
+    } );
+
+  // DMVR
+  addKernel( defs, "Buffer", "copyBuffer", OUT_DST, anyBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillPel( PEL_SRC0, blk.bitDepth );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      k.bufferOps.copyBuffer( b.pel[PEL_SRC0], S, b.pel[PEL_DST], S, blk.width, blk.height );
+    } );
+
+  addKernel( defs, "Buffer", "padding", OUT_DST, anyBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillPel( PEL_DST, blk.bitDepth );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      k.bufferOps.padding( b.pel[PEL_DST], S, blk.width, blk.height, DMVR_NUM_ITERATION );
+    } );
+
+  addKernel( defs, "Buffer", "dmvrSads", OUT_RESULT, dmvrBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillPel( PEL_SRC0, blk.bitDepth );
+      b.fillPel( PEL_SRC1, blk.bitDepth );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      k.bufferOps.dmvrSads( b.pel[PEL_SRC0], b.pel[PEL_SRC1], S, blk.width, blk.height, b.result );
+    } );
+
+  // weighted and triangle prediction
+  addKernel( defs, "Buffer", "weightBi", OUT_DST, anyBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillIntermediate( PEL_SRC0, blk.bitDepth );
+      b.fillIntermediate( PEL_SRC1, blk.bitDepth );
+      b.param[0] = b.uniform( -128, 127 );
+      b.param[1] = b.uniform( -128, 127 );
+      b.param[2] = b.uniform( 0, 7 );
+      b.param[3] = b.uniform( -128, 127 ) << ( blk.bitDepth - 8 );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      const int shift = b.param[2] + 1 + IF_INTERNAL_PREC - blk.bitDepth;
+      k.bufferOps.weightBi( b.pel[PEL_SRC0], S, b.pel[PEL_SRC1], S, b.pel[PEL_DST], S, blk.width, blk.height, b.param[0], b.param[1], 1 << ( shift - 1 ), shift, b.param[3], blk.clpRng );
+    } );
+
+  addKernel( defs, "Buffer", "weightUni", OUT_DST, anyBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillIntermediate( PEL_SRC0, blk.bitDepth );
+      b.param[0] = b.uniform( -128, 127 );
+      b.param[2] = b.uniform( 0, 7 );
+      b.param[3] = b.uniform( -128, 127 ) << ( blk.bitDepth - 8 );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      const int shift = b.param[2] + IF_INTERNAL_PREC - blk.bitDepth;
+      k.bufferOps.weightUni( b.pel[PEL_SRC0], S, b.pel[PEL_DST], S, blk.width, blk.height, b.param[0], 1 << ( shift - 1 ), shift, b.param[3], blk.clpRng );
+    } );
+
+  addKernel( defs, "Buffer", "weightTriangle", OUT_DST, anyBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillIntermediate( PEL_SRC0, blk.bitDepth );
+      b.fillIntermediate( PEL_SRC1, blk.bitDepth );
+      b.param[0] = b.uniform( 0, 1 );
+      b.param[1] = b.uniform( 0, 1 );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      const int      shift   = std::max<int>( 2, IF_INTERNAL_PREC - blk.bitDepth ) + 3;
+      const int      offset  = ( 1 << ( shift - 1 ) ) + ( IF_INTERNAL_OFFS << 3 );
+      const uint8_t* weights = g_triangleWeights[b.param[0]][b.param[1]][g_aucLog2[blk.width]][g_aucLog2[blk.height]];
+      k.bufferOps.weightTriangle( b.pel[PEL_SRC0], S, b.pel[PEL_SRC1], S, b.pel[PEL_DST], S, blk.width, blk.height, weights, shift, offset, blk.clpRng );
+    } );
+
+  // LMCS
+  addKernel( defs, "Buffer", "rspFwd", OUT_DST, anyBlock,
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      const int initCW = ( 1 << blk.bitDepth ) / PIC_CODE_CW_BINS;
+      LumaMapPWL& pwl  = b.lumaMap;
+      pwl.log2BinLen   = floorLog2( initCW );
+      pwl.maxVal       = ( 1 << blk.bitDepth ) - 1;
+      int y1           = 0;
+      for( int i = 0; i < PIC_CODE_CW_BINS; i++ )
+      {
+        const int y2 = y1 + b.uniform( initCW / 2, 2 * initCW - 1 );
+        pwl.base [i] = Pel( y1 );
+        pwl.scale[i] = ( ( y2 - y1 ) * ( 1 << FP_PREC ) + ( 1 << ( pwl.log2BinLen - 1 ) ) ) >> pwl.log2BinLen;
+        y1           = y2;
+      }
+      b.fillPel( PEL_DST, blk.bitDepth );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      k.bufferOps.rspFwd( b.pel[PEL_DST], S, blk.width, blk.height, b.lumaMap );
+    } );
+
+  for( int dir = 0; dir < 2; dir++ )
+  {
+    addKernel( defs, "Buffer", dir ? "scaleSignalFwd" : "scaleSignalInv", OUT_DST, anyBlock,
+      []( BenchBuffers& b, const BenchBlock& blk )
+      {
+        b.fillRange( PEL_DST, -blk.clpRng.max, blk.clpRng.max );
+        b.param[0] = b.uniform( 1 << ( CSCALE_FP_PREC - 1 ), 1 << ( CSCALE_FP_PREC + 2 ) );
+      },
+      [dir]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+      {
+        k.bufferOps.scaleSignal( b.pel[PEL_DST], S, blk.width, blk.height, b.param[0], dir != 0, blk.clpRng.max );
+      } );
+  }
+}
+
+static void addRdCostKernels( std::vector<KernelDef>& defs )
+{
+  struct DistFamily
+  {
+    const char* name;
+    int         dFunc;
+    bool        useMR;
+    bool        subsampled;
+    bool        intermediate;
+  };
+
+  static const DistFamily families[] =
+  {
+    { "SSE",             DF_SSE,                       false, false, false },
+    { "SAD",             DF_SAD,                       false, false, false },
+    { "SADSubsampled",   DF_SAD,                       false, true,  false },
+    { "HAD",             DF_HAD,                       false, false, false },
+    { "MRSAD",           DF_MRSAD,                     true,  false, false },
+    { "MRHAD",           DF_MRHAD,                     true,  false, false },
+    { "SADFullNBit",     DF_SAD_FULL_NBIT,             false, false, false },
+#if WCG_EXT
+    { "SSEWTD",          DF_SSE_WTD,                   false, false, false },
+#endif
+    { "SADIntermediate", DF_SAD_INTERMEDIATE_BITDEPTH, false, false, true  },
+  };
+
+  for( const DistFamily& family : families )
+  {
+    // SAD and MR-SAD have dedicated kernels for the widths of the asymmetric partitions
+    const bool sadWidths  = family.dFunc == DF_SAD || family.dFunc == DF_MRSAD;
+    const bool singleFunc = family.dFunc == DF_SAD_INTERMEDIATE_BITDEPTH;
+
+    addKernel( defs, "RdCost", family.name, OUT_RESULT,
+      [sadWidths]( int w, int h )
+      {
+        return isPow2Block( w, h ) || ( sadWidths && isPowerOf2( h ) && ( w == 12 || w == 24 || w == 48 ) );
+      },
+      [family]( BenchBuffers& b, const BenchBlock& blk )
+      {
+        if( family.intermediate )
+        {
+          b.fillIntermediate( PEL_SRC0, blk.bitDepth );
+          b.fillIntermediate( PEL_SRC1, blk.bitDepth );
+        }
+        else
+        {
+          b.fillPel( PEL_SRC0, blk.bitDepth );
+          b.fillPel( PEL_SRC1, blk.bitDepth );
+        }
+      },
+      [family, singleFunc]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+      {
+        const int mrOffset = family.useMR ? DF_MRSAD - DF_SAD : 0;
+        int       dFunc    = family.dFunc;
+
+        if( singleFunc )
+        {
+        }
+        else if( blk.width == 12 || blk.width == 24 || blk.width == 48 )
+        {
+          dFunc = ( blk.width == 12 ? DF_SAD12 : blk.width == 24 ? DF_SAD24 : DF_SAD48 ) + mrOffset;
+        }
+        else
+        {
+          dFunc += g_aucLog2[blk.width];
+        }
+
+        DistParam dp;
+        dp.org      = CPelBuf( b.pel[PEL_SRC0], S, blk.width, blk.height );
+        dp.cur      = CPelBuf( b.pel[PEL_SRC1], S, blk.width, blk.height );
+        dp.bitDepth = blk.bitDepth;
+        dp.compID   = COMPONENT_Y;
+        dp.useMR    = family.useMR;
+        dp.subShift = family.subsampled ? 1 : 0;
+#if WCG_EXT
+        dp.orgLuma  = dp.org;
+#endif
+#if JVET_N0671_RDCOST_FIX
+        dp.cShiftX  = 0;
+        dp.cShiftY  = 0;
+#endif
+        b.result[0] = RdCost::getDistFunc( DFunc( dFunc ) )( dp );
+      } );
+  }
+}
+
+static void addInterpolationFilterKernels( std::vector<KernelDef>& defs )
+{
+  struct McFilter
+  {
+    const char* name;
+    ComponentID compID;
+    int         nFilterIdx;
+    int         numFracs;
+  };
+
+  static const McFilter filters[] =
+  {
+    { "8", COMPONENT_Y,  0, LUMA_INTERPOLATION_FILTER_SUB_SAMPLE_POSITIONS   },
+    { "4", COMPONENT_Cb, 0, CHROMA_INTERPOLATION_FILTER_SUB_SAMPLE_POSITIONS },
+    { "2", COMPONENT_Y,  1, LUMA_INTERPOLATION_FILTER_SUB_SAMPLE_POSITIONS   },
+    { "0", COMPONENT_Y,  0, 1                                                },
+  };
+
+  const KernelFits anyBlock = []( int w, int h ) { return isPow2Block( w, h ); };
+
+  for( const McFilter& filter : filters )
+  {
+    const bool  isCopy = filter.numFracs == 1;
+    const std::string base = isCopy ? "Copy" : filter.name;
+
+    for( int pass = 0; pass < 6; pass++ )
+    {
+      // passes 0 and 1 are horizontal, the others vertical with every isFirst / isLast combination
+      const bool isVer   = pass >= 2;
+      const bool isFirst = isVer ? ( pass - 2 ) >= 2 : true;
+      const bool isLast  = ( pass & 1 ) != 0;
+
+      if( isCopy && !isVer )
+      {
+        continue;
+      }
+
+      const std::string kernel = std::string( isCopy ? "filter" : isVer ? "filterVer" : "filterHor" ) + base + ( isVer && isFirst ? "First" : "" ) + ( isLast ? "Last" : "" );
+
+      addKernel( defs, "InterpolationFilter", kernel, OUT_DST, anyBlock,
+        [filter, isFirst]( BenchBuffers& b, const BenchBlock& blk )
+        {
+          if( isFirst )
+          {
+            b.fillPel( PEL_SRC0, blk.bitDepth );
+          }
+          else
+          {
+            b.fillIntermediate( PEL_SRC0, blk.bitDepth );
+          }
+          b.param[0] = filter.numFracs == 1 ? 0 : b.uniform( 1, filter.numFracs - 1 );
+        },
+        [filter, isVer, isFirst, isLast]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+        {
+          if( isVer )
+          {
+            k.interpolationFilter.filterVer( filter.compID, b.pel[PEL_SRC0], S, b.pel[PEL_DST], S, blk.width, blk.height, b.param[0], isFirst, isLast, CHROMA_420, blk.clpRng, filter.nFilterIdx );
+          }
+          else
+          {
+            k.interpolationFilter.filterHor( filter.compID, b.pel[PEL_SRC0], S, b.pel[PEL_DST], S, blk.width, blk.height, b.param[0], isLast, CHROMA_420, blk.clpRng, filter.nFilterIdx );
+          }
+        } );
+    }
+  }
+}
+
+#if JVET_N0180_ALF_LINE_BUFFER_REDUCTION && JVET_N0242_NON_LINEAR_ALF && JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
+/** random ALF filter set with the normative clipping values, the last coefficient of every class is the fixed center tap
+ */
+static void prepareAlfFilter( BenchBuffers& b, const BenchBlock& blk, bool isLuma )
+{
+  const int numClasses = isLuma ? MAX_NUM_ALF_CLASSES : 1;
+  const int numCoeff   = isLuma ? MAX_NUM_ALF_LUMA_COEFF : MAX_NUM_ALF_CHROMA_COEFF;
+  const int numClip    = AdaptiveLoopFilter::AlfNumClippingValues[isLuma ? CHANNEL_TYPE_LUMA : CHANNEL_TYPE_CHROMA];
+  short     clipValues[AdaptiveLoopFilter::MaxAlfNumClippingValues];
+
+  for( int i = 0; i < numClip; i++ )
+  {
+    const double exponent = isLuma ? double( blk.bitDepth * ( numClip - i ) ) / numClip
+                                   : i == 0 ? blk.bitDepth : blk.bitDepth - 8 + 8. * ( numClip - i - 1 ) / ( numClip - 1 );
+    clipValues[i] = ( short ) std::round( std::pow( 2., exponent ) );
+  }
+
+  for( int classIdx = 0; classIdx < numClasses; classIdx++ )
+  {
+    short* coeff = b.alfCoeff + classIdx * numCoeff;
+    short* clip  = b.alfClip  + classIdx * numCoeff;
+
+    for( int i = 0; i < numCoeff - 1; i++ )
+    {
+      coeff[i] = ( short ) b.uniform( -64, 63 );
+      clip [i] = clipValues[b.uniform( 0, numClip - 1 )];
+    }
+    coeff[numCoeff - 1] = 1 << ( AdaptiveLoopFilter::m_NUM_BITS - 1 );
+    clip [numCoeff - 1] = clipValues[0];
+  }
+
+  b.fillPel( PEL_SRC0, blk.bitDepth );
+}
+
+static void addAlfKernels( std::vector<KernelDef>& defs )
+{
+  const int lumaVbPos   = MAX_CU_SIZE - ALF_VB_POS_ABOVE_CTUROW_LUMA;
+  const int chromaCtu   = MAX_CU_SIZE >> 1;
+  const int chromaVbPos = chromaCtu - ALF_VB_POS_ABOVE_CTUROW_CHMA;
+
+  // blocks are placed at the bottom of the CTU so that the virtual boundary handling is exercised
+  addKernel( defs, "AdaptiveLoopFilter", "deriveClassificationBlk", OUT_CLASSIFIER,
+    []( int w, int h ) { return isPow2Block( w, h ) && w >= 8 && h >= 8 && w <= AdaptiveLoopFilter::m_CLASSIFICATION_BLK_SIZE && h <= AdaptiveLoopFilter::m_CLASSIFICATION_BLK_SIZE; },
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillPel( PEL_SRC0, blk.bitDepth );
+    },
+    [lumaVbPos]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      k.adaptiveLoopFilter.m_deriveClassificationBlk( b.classifier, b.laplacian, CPelBuf( b.pel[PEL_SRC0], S, blk.width, blk.height ),
+                                                      Area( 0, MAX_CU_SIZE - blk.height, blk.width, blk.height ), Area( 0, 0, blk.width, blk.height ),
+                                                      blk.bitDepth + 4, MAX_CU_SIZE, lumaVbPos );
+    } );
+
+  addKernel( defs, "AdaptiveLoopFilter", "filter7x7Blk", OUT_DST,
+    []( int w, int h ) { return isPow2Block( w, h ) && ( w & 7 ) == 0; },
+    [lumaVbPos]( BenchBuffers& b, const BenchBlock& blk )
+    {
+      prepareAlfFilter( b, blk, true );
+
+      const int   blkSize = AdaptiveLoopFilter::m_CLASSIFICATION_BLK_SIZE;
+      const CPelBuf src( b.pel[PEL_SRC0], S, blk.width, blk.height );
+      for( int y = 0; y < blk.height; y += blkSize )
+      {
+        for( int x = 0; x < blk.width; x += blkSize )
+        {
+          const int w = std::min( blkSize, blk.width - x );
+          const int h = std::min( blkSize, blk.height - y );
+          AdaptiveLoopFilter::deriveClassificationBlk( b.classifier, b.laplacian, src, Area( x, MAX_CU_SIZE - blk.height + y, w, h ), Area( x, y, w, h ),
+                                                       blk.bitDepth + 4, MAX_CU_SIZE, lumaVbPos );
+        }
+      }
+    },
+    [lumaVbPos]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      const PelBuf     dst( b.pel[PEL_DST],  S, MAX_CU_SIZE, MAX_CU_SIZE );
+      const CPelBuf    src( b.pel[PEL_SRC0], S, blk.width,   blk.height );
+      const PelUnitBuf recDst( CHROMA_420, dst, dst, dst );
+      const CPelUnitBuf recSrc( CHROMA_420, src, src, src );
+      k.adaptiveLoopFilter.m_filter7x7Blk( b.classifier, recDst, recSrc, Area( 0, MAX_CU_SIZE - blk.height, blk.width, blk.height ), Area( 0, 0, blk.width, blk.height ),
+                                           COMPONENT_Y, b.alfCoeff, b.alfClip, blk.clpRng, k.cs, MAX_CU_SIZE, lumaVbPos );
+    } );
+
+  addKernel( defs, "AdaptiveLoopFilter", "filter5x5Blk", OUT_DST,
+    [chromaCtu]( int w, int h ) { return isPow2Block( w, h ) && ( w & 7 ) == 0 && w <= chromaCtu && h <= chromaCtu; },
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      prepareAlfFilter( b, blk, false );
+    },
+    [chromaCtu, chromaVbPos]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      const PelBuf     dst( b.pel[PEL_DST],  S, MAX_CU_SIZE, MAX_CU_SIZE );
+      const CPelBuf    src( b.pel[PEL_SRC0], S, blk.width,   blk.height );
+      const PelUnitBuf recDst( CHROMA_420, dst, dst, dst );
+      const CPelUnitBuf recSrc( CHROMA_420, src, src, src );
+      k.adaptiveLoopFilter.m_filter5x5Blk( b.classifier, recDst, recSrc, Area( 0, chromaCtu - blk.height, blk.width, blk.height ), Area( 0, 0, blk.width, blk.height ),
+                                           COMPONENT_Cb, b.alfCoeff, b.alfClip, blk.clpRng, k.cs, chromaCtu, chromaVbPos );
+    } );
+}
+#endif
+
+static void addAffineGradientSearchKernels( std::vector<KernelDef>& defs )
+{
+  const KernelFits anyBlock = []( int w, int h ) { return isPow2Block( w, h ); };
+
+  for( int vertical = 0; vertical < 2; vertical++ )
+  {
+    addKernel( defs, "AffineGradientSearch", vertical ? "verticalSobelFilter" : "horizontalSobelFilter", OUT_INT, anyBlock,
+      []( BenchBuffers& b, const BenchBlock& blk )
+      {
+        b.fillPel( PEL_SRC0, blk.bitDepth );
+      },
+      [vertical]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+      {
+        ( vertical ? k.affineGradientSearch.m_VerticalSobelFilter : k.affineGradientSearch.m_HorizontalSobelFilter )( b.pel[PEL_SRC0], S, b.ints[0], S, blk.width, blk.height );
+      } );
+  }
+
+  for( int b6Param = 0; b6Param < 2; b6Param++ )
+  {
+    addKernel( defs, "AffineGradientSearch", b6Param ? "equalCoeffComputer6" : "equalCoeffComputer4", OUT_EQUAL_COEFF, anyBlock,
+      []( BenchBuffers& b, const BenchBlock& blk )
+      {
+        // the derivatives are Sobel outputs of prediction samples
+        b.fillRange( PEL_SRC0, -blk.clpRng.max, blk.clpRng.max );
+        b.fillInt( 0, -4 * blk.clpRng.max, 4 * blk.clpRng.max );
+        b.fillInt( 1, -4 * blk.clpRng.max, 4 * blk.clpRng.max );
+      },
+      [b6Param]( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+      {
+        int* derivate[2] = { b.ints[0], b.ints[1] };
+        memset( b.equalCoeff, 0, sizeof( b.equalCoeff ) );
+        k.affineGradientSearch.m_EqualCoeffComputer( b.pel[PEL_SRC0], S, derivate, S, b.equalCoeff, blk.width, blk.height, b6Param != 0 );
+      } );
+  }
+}
+
+static void addIbcHashMapKernels( std::vector<KernelDef>& defs )
+{
+  addKernel( defs, "IbcHashMap", "computeCrc32c", OUT_RESULT,
+    []( int w, int h ) { return isPow2Block( w, h ); },
+    []( BenchBuffers& b, const BenchBlock& blk )
+    {
+      b.fillPel( PEL_SRC0, blk.bitDepth );
+    },
+    []( KernelSet& k, BenchBuffers& b, const BenchBlock& blk )
+    {
+      uint32_t crc = 0;
+      for( int y = 0; y < blk.height; y++ )
+      {
+        const Pel* src = b.pel[PEL_SRC0] + y * S;
+        for( int x = 0; x < blk.width; x++ )
+        {
+          crc = k.ibcHashMap.m_computeCrc32c( crc, src[x] );
+        }
+      }
+      b.result[0] = crc;
+    } );
+}
+
+// ====================================================================================================================
+// Timing
+// ====================================================================================================================
+
+static uint64_t readCycleCounter()
+{
+#ifdef TARGET_SIMD_X86
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+/** run the kernel with a doubling number of iterations until one batch takes at least minTimeMs
+ */
+static void timeKernel( const std::function<void()>& call, int minTimeMs, double& nsPerCall, double& cyclesPerCall )
+{
+  typedef std::chrono::steady_clock Clock;
+
+  const double minTimeNs  = minTimeMs * 1e6;
+  uint64_t     iterations = 1;
+
+  while( true )
+  {
+    const uint64_t          cyclesStart = readCycleCounter();
+    const Clock::time_point start       = Clock::now();
+
+    for( uint64_t i = 0; i < iterations; i++ )
+    {
+      call();
+    }
+
+    const double   ns     = std::chrono::duration<double, std::nano>( Clock::now() - start ).count();
+    const uint64_t cycles = readCycleCounter() - cyclesStart;
+
+    if( ns >= minTimeNs || iterations >= ( uint64_t( 1 ) << 30 ) )
+    {
+      nsPerCall     = ns / iterations;
+      cyclesPerCall = double( cycles ) / iterations;
+      return;
+    }
+    iterations <<= 1;
+  }
+}
+
+// ====================================================================================================================
+// Constructor / destructor / initialization / destroy
+// ====================================================================================================================
+
+KernelBenchApp::KernelBenchApp()
+{
+}
+
+// ====================================================================================================================
+// Public member functions
+// ====================================================================================================================
+
+/**
+ - run every kernel of every selected tier on the same random inputs
+ - compare the outputs of the SIMD tiers against the SCALAR tier
+ - time each kernel, block size and tier and write one CSV row per measurement
+ */
+uint32_t KernelBenchApp::run()
+{
+  static const int blockWidths [] = { 4, 8, 12, 16, 24, 32, 48, 64, 128 };
+  static const int blockHeights[] = { 4, 8, 16, 32, 64, 128 };
+
+  std::vector<KernelDef> defs;
+  addBufferKernels             ( defs );
+  addRdCostKernels             ( defs );
+  addInterpolationFilterKernels( defs );
+#if JVET_N0180_ALF_LINE_BUFFER_REDUCTION && JVET_N0242_NON_LINEAR_ALF && JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
+  addAlfKernels                ( defs );
+#endif
+  addAffineGradientSearchKernels( defs );
+  addIbcHashMapKernels         ( defs );
+
+  struct BenchCase
+  {
+    const KernelDef* def;
+    BenchBlock       block;
+  };
+
+  std::vector<BenchCase> cases;
+  for( int bitDepth : m_bitDepths )
+  {
+    for( const KernelDef& def : defs )
+    {
+      if( !m_kernelFilter.empty() && ( def.module + "." + def.kernel ).find( m_kernelFilter ) == std::string::npos )
+      {
+        continue;
+      }
+      for( int width : blockWidths )
+      {
+        for( int height : blockHeights )
+        {
+          if( def.fits( width, height ) )
+          {
+            BenchCase benchCase;
+            benchCase.def                = &def;
+            benchCase.block.width        = width;
+            benchCase.block.height       = height;
+            benchCase.block.bitDepth     = bitDepth;
+            benchCase.block.clpRng.min   = 0;
+            benchCase.block.clpRng.max   = ( 1 << bitDepth ) - 1;
+            benchCase.block.clpRng.bd    = bitDepth;
+            benchCase.block.clpRng.n     = 0;
+            cases.push_back( benchCase );
+          }
+        }
+      }
+    }
+  }
+
+#if WCG_EXT
+  // the luma weight table of the WTD distortion is static and only sized once, so size it for the largest bit depth
+  {
+    RdCost rdCost;
+    rdCost.setReshapeInfo( RESHAPE_SIGNAL_PQ, *std::max_element( m_bitDepths.begin(), m_bitDepths.end() ) );
+    rdCost.initLumaLevelToWeightTableReshape();
+  }
+#endif
+
+  std::ofstream outFile;
+  std::ostream* out = &std::cout;
+  if( !m_outputFileName.empty() )
+  {
+    outFile.open( m_outputFileName.c_str(), std::ios::out );
+    if( !outFile.is_open() )
+    {
+      EXIT( "Failed to open output file " << m_outputFileName );
+    }
+    out = &outFile;
+  }
+
+  *out << "module,kernel,width,height,bitdepth,tier,bitexact,ns_per_call,samples_per_cycle\n";
+
+  std::vector<uint64_t> reference ( cases.size(), 0 );
+  std::vector<uint32_t> mismatches( m_tiers.size(), 0 );
+  BenchBuffers          buffers;
+
+  for( size_t tier = 0; tier < m_tiers.size(); tier++ )
+  {
+#if ENABLE_SIMD_OPT
+    select_simd_extension( m_tiers[tier] );
+#endif
+    std::unique_ptr<KernelSet> kernels( new KernelSet );
+
+    for( size_t c = 0; c < cases.size(); c++ )
+    {
+      const KernelDef&  def = *cases[c].def;
+      const BenchBlock& blk = cases[c].block;
+
+      buffers.reset( m_seed + uint32_t( c ) * 0x9E3779B9u );
+      def.prepare( buffers, blk );
+      def.run( *kernels, buffers, blk );
+
+      const uint64_t hash     = buffers.hash( def.outputs );
+      bool           bitExact = true;
+
+      if( tier == 0 )
+      {
+        reference[c] = hash;
+      }
+      else if( hash != reference[c] )
+      {
+        bitExact = false;
+        mismatches[tier]++;
+        std::cerr << "Mismatch: " << def.module << "." << def.kernel << " " << blk.width << "x" << blk.height
+                  << " bitdepth " << blk.bitDepth << " tier " << m_tiers[tier] << std::endl;
+      }
+
+      *out << def.module << "," << def.kernel << "," << blk.width << "," << blk.height << "," << blk.bitDepth << ","
+           << m_tiers[tier] << "," << ( bitExact ? 1 : 0 ) << ",";
+
+      if( !m_checkOnly )
+      {
+        double nsPerCall, cyclesPerCall;
+        timeKernel( [&]() { def.run( *kernels, buffers, blk ); }, m_minTimeMs, nsPerCall, cyclesPerCall );
+
+        *out << nsPerCall << ",";
+        if( cyclesPerCall > 0 )
+        {
+          *out << blk.width * blk.height / cyclesPerCall;
+        }
+      }
+      else
+      {
+        *out << ",";
+      }
+      *out << "\n";
+    }
+  }
+
+#if ENABLE_SIMD_OPT
+  select_simd_extension( "" );
+#endif
+
+  uint32_t numMismatches = 0;
+  std::cerr << "\nChecked " << cases.size() << " cases per tier against " << m_tiers[0] << std::endl;
+  for( size_t tier = 1; tier < m_tiers.size(); tier++ )
+  {
+    std::cerr << "  " << m_tiers[tier] << ": " << ( mismatches[tier] ? "" : "bit-exact" );
+    if( mismatches[tier] )
+    {
+      std::cerr << mismatches[tier] << " mismatches";
+    }
+    std::cerr << std::endl;
+    numMismatches += mismatches[tier];
+  }
+
+  return numMismatches;
+}
+
+//! \}
@@ -0,0 +1,203 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     KernelBenchAppCfg.cpp
+    \brief    Kernel benchmark configuration class
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "KernelBenchAppCfg.h"
+#include "Utilities/program_options_lite.h"
+
+using namespace std;
+namespace po = df::program_options_lite;
+
+//! \ingroup KernelBenchApp
+//! \{
+
+// ====================================================================================================================
+// Local functions
+// ====================================================================================================================
+
+static vector<string> splitList( const string& list )
+{
+  vector<string> items;
+  size_t         start = 0;
+
+  while( start <= list.size() )
+  {
+    size_t end = list.find( ',', start );
+    if( end == string::npos )
+    {
+      end = list.size();
+    }
+    if( end > start )
+    {
+      items.push_back( list.substr( start, end - start ) );
+    }
+    start = end + 1;
+  }
+
+  return items;
+}
+
+/** the scalar reference followed by every SIMD tier this build and machine can run
+ */
+static vector<string> availableTiers()
+{
+  vector<string> tiers( 1, "SCALAR" );
+
+#if ENABLE_SIMD_OPT
+#ifdef TARGET_SIMD_X86
+  static const char* x86Tiers[] = { "SSE41", "SSE42", "AVX", "AVX2", "AVX512" };
+
+  select_simd_extension( "" );
+  const X86_VEXT detected = read_x86_extension_flags();
+
+  for( int ext = SSE41; ext <= detected; ext++ )
+  {
+    tiers.push_back( x86Tiers[ext - SSE41] );
+  }
+#endif
+#ifdef TARGET_SIMD_VEC
+  tiers.push_back( "VEC" );
+#endif
+#endif
+
+  return tiers;
+}
+
+// ====================================================================================================================
+// Public member functions
+// ====================================================================================================================
+
+/** \param argc number of arguments
+    \param argv array of arguments
+ */
+bool KernelBenchAppCfg::parseCfg( int argc, char* argv[] )
+{
+  bool   do_help = false;
+  string tiers;
+  string bitDepths;
+  int    seed;
+
+  po::Options opts;
+  opts.addOptions()
+
+  ("help",                      do_help,                               false,      "this help text")
+  ("SIMD",                      tiers,                                 string(""), "comma separated list of kernel tiers: SCALAR, SSE41, SSE42, AVX, AVX2, AVX512, VEC (default: all tiers available on this machine)")
+  ("BitDepths",                 bitDepths,                             string("8,10"), "comma separated list of internal bit depths")
+  ("Kernels,k",                 m_kernelFilter,                        string(""), "only run kernels whose module.kernel name contains this string")
+  ("Output,o",                  m_outputFileName,                      string(""), "CSV output file name (default: stdout)")
+  ("MinTime",                   m_minTimeMs,                           2,          "minimum measurement time in ms per kernel, block size and tier")
+  ("CheckOnly,c",               m_checkOnly,                           false,      "only check the SIMD tiers for bit-exactness against SCALAR, no timing")
+  ("Seed",                      seed,                                  1,          "seed of the random input data")
+  ;
+
+  po::setDefaults(opts);
+  po::ErrorReporter err;
+  const list<const char*>& argv_unhandled = po::scanArgv(opts, argc, (const char**) argv, err);
+
+  for (list<const char*>::const_iterator it = argv_unhandled.begin(); it != argv_unhandled.end(); it++)
+  {
+    std::cerr << "Unhandled argument ignored: "<< *it << std::endl;
+  }
+
+  if (do_help)
+  {
+    po::doHelp(cout, opts);
+    return false;
+  }
+
+  if (err.is_errored)
+  {
+    /* errors have already been reported to stderr */
+    return false;
+  }
+
+  const vector<string> available = availableTiers();
+
+  m_tiers = tiers.empty() ? available : splitList( tiers );
+  for( const string& tier : m_tiers )
+  {
+    if( std::find( available.begin(), available.end(), tier ) == available.end() )
+    {
+      std::cerr << "Kernel tier " << tier << " is not available on this machine, aborting" << std::endl;
+      return false;
+    }
+  }
+  m_tiers.erase( std::remove( m_tiers.begin(), m_tiers.end(), string( "SCALAR" ) ), m_tiers.end() );
+  m_tiers.insert( m_tiers.begin(), "SCALAR" );
+
+  m_bitDepths.clear();
+  for( const string& bitDepth : splitList( bitDepths ) )
+  {
+    const int bd = atoi( bitDepth.c_str() );
+    if( bd < 8 || bd > 12 )
+    {
+      std::cerr << "Bit depth " << bitDepth << " is outside of 8..12, aborting" << std::endl;
+      return false;
+    }
+    m_bitDepths.push_back( bd );
+  }
+  if( m_bitDepths.empty() )
+  {
+    std::cerr << "No bit depth specified, aborting" << std::endl;
+    return false;
+  }
+
+  m_minTimeMs = std::max( m_minTimeMs, 0 );
+  m_seed      = ( uint32_t ) seed;
+
+  return true;
+}
+
+KernelBenchAppCfg::KernelBenchAppCfg()
+: m_kernelFilter()
+, m_outputFileName()
+, m_minTimeMs( 2 )
+, m_checkOnly( false )
+, m_seed( 1 )
+{
+}
+
+KernelBenchAppCfg::~KernelBenchAppCfg()
+{
+}
+
+//! \}
@@ -88,6 +88,9 @@ public:
   void reconstructCoeffAPSs(CodingStructure& cs, bool luma, bool chroma, bool isRdo);
   void reconstructCoeff(AlfSliceParam& alfSliceParam, ChannelType channel, const bool isRdo, const bool isRedo = false);
   void ALFProcess(CodingStructure& cs);
+  // CTU row based ALFProcess: ALFInitCtuRows() returns whether ALF is enabled, the rows are then filtered in order once the rows up to ctuRow + 1 are final
+  bool ALFInitCtuRows(CodingStructure& cs);
+  void ALFProcessCtuRow(CodingStructure& cs, const int ctuRow);
 #else
   void reconstructCoeff(AlfSliceParam& alfSliceParam, ChannelType channel, const bool isRedo = false);
   void ALFProcess( CodingStructure& cs, AlfSliceParam& alfSliceParam );
@@ -204,6 +207,11 @@ public:
 #endif
 
 protected:
+#if JVET_N0415_CTB_ALF
+  void xFilterCtuRow( CodingStructure& cs, const int yPos, PelUnitBuf& recYuv, PelUnitBuf& tmpYuv );
+#else
+  void xFilterCtuRow( CodingStructure& cs, const int yPos, PelUnitBuf& recYuv, PelUnitBuf& tmpYuv, AlfSliceParam& alfSliceParam );
+#endif
 #if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
   bool isCrossedByVirtualBoundaries( const int xPos, const int yPos, const int width, const int height, bool& clipTop, bool& clipBottom, bool& clipLeft, bool& clipRight, int& numHorVirBndry, int& numVerVirBndry, int horVirBndryPos[], int verVirBndryPos[], const PPS* pps );
 #endif
@@ -264,6 +264,66 @@ void linTfCore( const T* src, int srcStride, Pel *dst, int dstStride, int width,
 #undef LINTF_CORE_INC
 }
 
+void rspFwdCore( Pel *ptr, int stride, int width, int height, const LumaMapPWL& pwl )
+{
+  const int binMask = ( 1 << pwl.log2BinLen ) - 1;
+
+  for( int y = 0; y < height; y++ )
+  {
+    for( int x = 0; x < width; x++ )
+    {
+      const int bin     = ptr[x] >> pwl.log2BinLen;
+      const int tempVal = pwl.base[bin] + ( ( pwl.scale[bin] * ( ptr[x] & binMask ) + ( 1 << ( FP_PREC - 1 ) ) ) >> FP_PREC );
+      ptr[x] = Clip3( ( Pel ) 0, pwl.maxVal, ( Pel ) tempVal );
+    }
+    ptr += stride;
+  }
+}
+
+void scaleSignalCore( Pel *ptr, int stride, int width, int height, int scale, bool dir, int maxAbsClip )
+{
+  Pel* dst = ptr;
+  Pel* src = ptr;
+  int sign, absval;
+
+  if (dir) // forward
+  {
+    for (int y = 0; y < height; y++)
+    {
+      for (int x = 0; x < width; x++)
+      {
+        sign = src[x] >= 0 ? 1 : -1;
+        absval = sign * src[x];
+        dst[x] = (Pel)Clip3(-maxAbsClip, maxAbsClip, sign * (((absval << CSCALE_FP_PREC) + (scale >> 1)) / scale));
+      }
+      dst += stride;
+      src += stride;
+    }
+  }
+  else // inverse
+  {
+    for (int y = 0; y < height; y++)
+    {
+      for (int x = 0; x < width; x++)
+      {
+#if JVET_N0220_LMCS_SIMPLIFICATION
+        src[x] = (Pel)Clip3((Pel)(-maxAbsClip - 1), (Pel)maxAbsClip, src[x]);
+#endif
+        sign = src[x] >= 0 ? 1 : -1;
+        absval = sign * src[x];
+        int val = sign * ((absval * scale + (1 << (CSCALE_FP_PREC - 1))) >> CSCALE_FP_PREC);
+        if (sizeof(Pel) == 2) // avoid overflow when storing data
+        {
+           val = Clip3<int>(-32768, 32767, val);
+        }
+        dst[x] = (Pel)val;
+      }
+      dst += stride;
+      src += stride;
+    }
+  }
+}
+
 PelBufferOps::PelBufferOps()
 {
   addAvg4 = addAvgCore<Pel>;
@@ -282,6 +342,12 @@ PelBufferOps::PelBufferOps()
 
   copyBuffer = copyBufferCore;
   padding = paddingCore;
+  dmvrSads = dmvrSadsCore;
+  weightBi       = weightBiCore;
+  weightUni      = weightUniCore;
+  weightTriangle = weightTriangleCore;
+  rspFwd = rspFwdCore;
+  scaleSignal = scaleSignalCore;
 #if ENABLE_SIMD_OPT_GBI
   removeWeightHighFreq8 = removeWeightHighFreq;
   removeWeightHighFreq4 = removeWeightHighFreq;
@@ -327,6 +393,76 @@ void paddingCore(Pel *ptr, int stride, int width, int height, int padSize)
     memcpy(ptrTemp2 + (i * stride), (ptrTemp2), numBytes);
   }
 }
+/*row subsampled SADs of the DMVR integer search: src0 moves by +(dx,dy) and src1 by -(dx,dy),
+  sads[] holds the whole (2 * DMVR_NUM_ITERATION + 1)^2 window in raster order*/
+void dmvrSadsCore(const Pel* src0, const Pel* src1, int stride, int width, int height, uint64_t* sads)
+{
+  for (int dy = -DMVR_NUM_ITERATION; dy <= DMVR_NUM_ITERATION; dy++)
+  {
+    for (int dx = -DMVR_NUM_ITERATION; dx <= DMVR_NUM_ITERATION; dx++)
+    {
+      const Pel* pSrc0 = src0 + dx + dy * stride;
+      const Pel* pSrc1 = src1 - dx - dy * stride;
+      uint64_t   sum   = 0;
+      for (int y = 0; y < height; y += 2)
+      {
+        for (int x = 0; x < width; x++)
+        {
+          sum += abs(pSrc0[x] - pSrc1[x]);
+        }
+        pSrc0 += 2 * stride;
+        pSrc1 += 2 * stride;
+      }
+      *sads++ = sum << 1;
+    }
+  }
+}
+
+/*explicit weighted prediction, bi-directional*/
+void weightBiCore(const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int round, int shift, int offset, const ClpRng& clpRng)
+{
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      dst[x] = ClipPel(((w0 * (src0[x] + IF_INTERNAL_OFFS) + w1 * (src1[x] + IF_INTERNAL_OFFS) + round + (offset << (shift - 1))) >> shift), clpRng);
+    }
+    src0 += src0Stride;
+    src1 += src1Stride;
+    dst  += dstStride;
+  }
+}
+
+/*explicit weighted prediction, uni-directional (w0 = 1 covers the offset only case)*/
+void weightUniCore(const Pel* src0, int src0Stride, Pel *dst, int dstStride, int width, int height, int w0, int round, int shift, int offset, const ClpRng& clpRng)
+{
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      dst[x] = ClipPel(((w0 * (src0[x] + IF_INTERNAL_OFFS) + round) >> shift) + offset, clpRng);
+    }
+    src0 += src0Stride;
+    dst  += dstStride;
+  }
+}
+
+/*triangle blending with a per sample weight of src0 out of 8, see g_triangleWeights*/
+void weightTriangleCore(const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, const uint8_t* weights, int shift, int offset, const ClpRng& clpRng)
+{
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      dst[x] = ClipPel(rightShift(weights[x] * src0[x] + (8 - weights[x]) * src1[x] + offset, shift), clpRng);
+    }
+    weights += width;
+    src0    += src0Stride;
+    src1    += src1Stride;
+    dst     += dstStride;
+  }
+}
+
 template<>
 void AreaBuf<Pel>::addWeightedAvg(const AreaBuf<const Pel> &other1, const AreaBuf<const Pel> &other2, const ClpRng& clpRng, const int8_t gbiIdx)
 {
@@ -374,56 +510,20 @@ void AreaBuf<Pel>::rspSignal(std::vector<Pel>& pLUT)
 }
 
 template<>
-void AreaBuf<Pel>::scaleSignal(const int scale, const bool dir, const ClpRng& clpRng)
+void AreaBuf<Pel>::rspSignal( const LumaMapPWL& pwl )
 {
-  Pel* dst = buf;
-  Pel* src = buf;
-  int sign, absval;
-  int maxAbsclipBD = (1<<clpRng.bd) - 1;
+  g_pelBufOP.rspFwd( buf, stride, width, height, pwl );
+}
 
-  if (dir) // forward
-  {
-    if (width == 1)
-    {
-      THROW("Blocks of width = 1 not supported");
-    }
-    else
-    {
-      for (unsigned y = 0; y < height; y++)
-      {
-        for (unsigned x = 0; x < width; x++)
-        {
-          sign = src[x] >= 0 ? 1 : -1;
-          absval = sign * src[x];
-          dst[x] = (Pel)Clip3(-maxAbsclipBD, maxAbsclipBD, sign * (((absval << CSCALE_FP_PREC) + (scale >> 1)) / scale));
-        }
-        dst += stride;
-        src += stride;
-      }
-    }
-  }
-  else // inverse
+template<>
+void AreaBuf<Pel>::scaleSignal(const int scale, const bool dir, const ClpRng& clpRng)
+{
+  if( dir && width == 1 )
   {
-    for (unsigned y = 0; y < height; y++)
-    {
-      for (unsigned x = 0; x < width; x++)
-      {
-#if JVET_N0220_LMCS_SIMPLIFICATION
-        src[x] = (Pel)Clip3((Pel)(-maxAbsclipBD - 1), (Pel)maxAbsclipBD, src[x]);
-#endif
-        sign = src[x] >= 0 ? 1 : -1;
-        absval = sign * src[x];
-        int val = sign * ((absval * scale + (1 << (CSCALE_FP_PREC - 1))) >> CSCALE_FP_PREC);
-        if (sizeof(Pel) == 2) // avoid overflow when storing data
-        {
-           val = Clip3<int>(-32768, 32767, val);
-        }
-        dst[x] = (Pel)val;
-      }
-      dst += stride;
-      src += stride;
-    }
+    THROW("Blocks of width = 1 not supported");
   }
+
+  g_pelBufOP.scaleSignal( buf, stride, width, height, scale, dir, ( 1 << clpRng.bd ) - 1 );
 }
 
 template<>
@@ -440,7 +540,7 @@ void AreaBuf<Pel>::addAvg( const AreaBuf<const Pel> &other1, const AreaBuf<const
   const int     shiftNum    = std::max<int>(2, (IF_INTERNAL_PREC - clipbd)) + 1;
   const int     offset      = (1 << (shiftNum - 1)) + 2 * IF_INTERNAL_OFFS;
 
-#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+#if ENABLE_SIMD_OPT_BUFFER && ( defined(TARGET_SIMD_X86) || defined(TARGET_SIMD_VEC) )
   if( ( width & 7 ) == 0 )
   {
     g_pelBufOP.addAvg8( src0, src1Stride, src2, src2Stride, dest, destStride, width, height, shiftNum, offset, clpRng );
@@ -548,7 +648,7 @@ void AreaBuf<Pel>::reconstruct( const AreaBuf<const Pel> &pred, const AreaBuf<co
   const unsigned src2Stride = resi.stride;
   const unsigned destStride =      stride;
 
-#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+#if ENABLE_SIMD_OPT_BUFFER && ( defined(TARGET_SIMD_X86) || defined(TARGET_SIMD_VEC) )
   if( ( width & 7 ) == 0 )
   {
     g_pelBufOP.reco8( src1, src1Stride, src2, src2Stride, dest, destStride, width, height, clpRng );
@@ -576,28 +676,36 @@ void AreaBuf<Pel>::reconstruct( const AreaBuf<const Pel> &pred, const AreaBuf<co
 template<>
 void AreaBuf<Pel>::linearTransform( const int scale, const int shift, const int offset, bool bClip, const ClpRng& clpRng )
 {
-  const Pel* src = buf;
+  linearTransform( *this, scale, shift, offset, bClip, clpRng );
+}
+
+template<>
+void AreaBuf<Pel>::linearTransform( const AreaBuf<const Pel> &other, const int scale, const int shift, const int offset, bool bClip, const ClpRng& clpRng )
+{
+  const Pel* src = other.buf;
         Pel* dst = buf;
 
+  const int srcStride = other.stride;
+
   if( width == 1 )
   {
     THROW( "Blocks of width = 1 not supported" );
   }
-#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+#if ENABLE_SIMD_OPT_BUFFER && ( defined(TARGET_SIMD_X86) || defined(TARGET_SIMD_VEC) )
   else if( ( width & 7 ) == 0 )
   {
-    g_pelBufOP.linTf8( src, stride, dst, stride, width, height, scale, shift, offset, clpRng, bClip );
+    g_pelBufOP.linTf8( src, srcStride, dst, stride, width, height, scale, shift, offset, clpRng, bClip );
   }
   else if( ( width & 3 ) == 0 )
   {
-    g_pelBufOP.linTf4( src, stride, dst, stride, width, height, scale, shift, offset, clpRng, bClip );
+    g_pelBufOP.linTf4( src, srcStride, dst, stride, width, height, scale, shift, offset, clpRng, bClip );
   }
 #endif
   else
   {
 #define LINTF_OP( ADDR ) dst[ADDR] = ( Pel ) bClip ? ClipPel( rightShift( scale * src[ADDR], shift ) + offset, clpRng ) : ( rightShift( scale * src[ADDR], shift ) + offset )
 #define LINTF_INC        \
-    src += stride;       \
+    src += srcStride;    \
     dst += stride;       \
 
     SIZE_AWARE_PER_EL_OP( LINTF_OP, LINTF_INC );
@@ -607,7 +715,7 @@ void AreaBuf<Pel>::linearTransform( const int scale, const int shift, const int
   }
 }
 
-#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+#if ENABLE_SIMD_OPT_BUFFER && ( defined(TARGET_SIMD_X86) || defined(TARGET_SIMD_VEC) )
 template<>
 void AreaBuf<Pel>::subtract( const Pel val )
 {
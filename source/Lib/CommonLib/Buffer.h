@@ -51,6 +51,15 @@
 // AreaBuf struct
 // ---------------------------------------------------------------------------
 
+/// forward luma mapping of the reshaper, PIC_CODE_CW_BINS linear pieces over input bins of equal size
+struct LumaMapPWL
+{
+  int  log2BinLen;
+  Pel  maxVal;
+  Pel  base [PIC_CODE_CW_BINS];    ///< mapped value at the start of each bin (before clipping)
+  int  scale[PIC_CODE_CW_BINS];    ///< slope of each bin in FP_PREC precision
+};
+
 struct PelBufferOps
 {
   PelBufferOps();
@@ -60,6 +69,9 @@ struct PelBufferOps
   template<X86_VEXT vext>
   void _initPelBufOpsX86();
 #endif
+#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_VEC)
+  void initPelBufOpsVec();
+#endif
 
   void ( *addAvg4 )       ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,            int shift, int offset, const ClpRng& clpRng );
   void ( *addAvg8 )       ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,            int shift, int offset, const ClpRng& clpRng );
@@ -73,6 +85,12 @@ struct PelBufferOps
   void(*calcBlkGradient)(int sx, int sy, int    *arraysGx2, int     *arraysGxGy, int     *arraysGxdI, int     *arraysGy2, int     *arraysGydI, int     &sGx2, int     &sGy2, int     &sGxGy, int     &sGxdI, int     &sGydI, int width, int height, int unitSize);
   void(*copyBuffer)(Pel *src, int srcStride, Pel *dst, int dstStride, int width, int height);
   void(*padding)(Pel *dst, int stride, int width, int height, int padSize);
+  void(*dmvrSads)(const Pel* src0, const Pel* src1, int stride, int width, int height, uint64_t* sads);
+  void ( *weightBi )      ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int round, int shift, int offset, const ClpRng& clpRng );
+  void ( *weightUni )     ( const Pel* src0, int src0Stride,                                  Pel *dst, int dstStride, int width, int height, int w0,         int round, int shift, int offset, const ClpRng& clpRng );
+  void ( *weightTriangle )( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, const uint8_t* weights,     int shift, int offset, const ClpRng& clpRng );
+  void ( *rspFwd )        ( Pel* ptr, int stride, int width, int height, const LumaMapPWL& pwl );
+  void ( *scaleSignal )   ( Pel* ptr, int stride, int width, int height, int scale, bool dir, int maxAbsClip );
 #if ENABLE_SIMD_OPT_GBI
   void ( *removeWeightHighFreq8)  ( Pel* src0, int src0Stride, const Pel* src1, int src1Stride, int width, int height, int shift, int gbiWeight);
   void ( *removeWeightHighFreq4)  ( Pel* src0, int src0Stride, const Pel* src1, int src1Stride, int width, int height, int shift, int gbiWeight);
@@ -84,6 +102,12 @@ struct PelBufferOps
 extern PelBufferOps g_pelBufOP;
 
 void paddingCore(Pel *ptr, int stride, int width, int height, int padSize);
+void dmvrSadsCore(const Pel* src0, const Pel* src1, int stride, int width, int height, uint64_t* sads);
+void weightBiCore(const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int round, int shift, int offset, const ClpRng& clpRng);
+void weightUniCore(const Pel* src0, int src0Stride, Pel *dst, int dstStride, int width, int height, int w0, int round, int shift, int offset, const ClpRng& clpRng);
+void weightTriangleCore(const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, const uint8_t* weights, int shift, int offset, const ClpRng& clpRng);
+void rspFwdCore(Pel *ptr, int stride, int width, int height, const LumaMapPWL& pwl);
+void scaleSignalCore(Pel *ptr, int stride, int width, int height, int scale, bool dir, int maxAbsClip);
 void copyBufferCore(Pel *src, int srcStride, Pel *Dst, int dstStride, int width, int height);
 
 template<typename T>
@@ -117,6 +141,7 @@ struct AreaBuf : public Size
 #endif
   void extendSingleBorderPel();
   void extendBorderPel      (  unsigned margin );
+  void extendBorderPel      (  unsigned margin, bool top, bool bottom );
   void addWeightedAvg       ( const AreaBuf<const T> &other1, const AreaBuf<const T> &other2, const ClpRng& clpRng, const int8_t gbiIdx);
   void removeWeightHighFreq ( const AreaBuf<T>& other, const bool bClip, const ClpRng& clpRng, const int8_t iGbiWeight);
   void addAvg               ( const AreaBuf<const T> &other1, const AreaBuf<const T> &other2, const ClpRng& clpRng );
@@ -127,12 +152,14 @@ struct AreaBuf : public Size
   void subtract             ( const T val );
 
   void linearTransform      ( const int scale, const int shift, const int offset, bool bClip, const ClpRng& clpRng );
+  void linearTransform      ( const AreaBuf<const T> &src, const int scale, const int shift, const int offset, bool bClip, const ClpRng& clpRng );
 
   void transposedFrom       ( const AreaBuf<const T> &other );
 
   void toLast               ( const ClpRng& clpRng );
 
   void rspSignal            ( std::vector<Pel>& pLUT );
+  void rspSignal            ( const LumaMapPWL& pwl );
   void scaleSignal          ( const int scale, const bool dir , const ClpRng& clpRng);
   T    computeAvg           ( ) const;
 
@@ -440,6 +467,15 @@ void AreaBuf<T>::linearTransform( const int scale, const int shift, const int of
 template<>
 void AreaBuf<Pel>::linearTransform( const int scale, const int shift, const int offset, bool bClip, const ClpRng& clpRng );
 
+template<typename T>
+void AreaBuf<T>::linearTransform( const AreaBuf<const T> &src, const int scale, const int shift, const int offset, bool bClip, const ClpRng& clpRng )
+{
+  THROW( "Type not supported" );
+}
+
+template<>
+void AreaBuf<Pel>::linearTransform( const AreaBuf<const Pel> &src, const int scale, const int shift, const int offset, bool bClip, const ClpRng& clpRng );
+
 template<typename T>
 void AreaBuf<T>::toLast( const ClpRng& clpRng )
 {
@@ -565,6 +601,12 @@ void AreaBuf<T>::updateHistogram( std::vector<int32_t>& hist ) const
 
 template<typename T>
 void AreaBuf<T>::extendBorderPel( unsigned margin )
+{
+  extendBorderPel( margin, true, true );
+}
+
+template<typename T>
+void AreaBuf<T>::extendBorderPel( unsigned margin, bool top, bool bottom )
 {
   T*  p = buf;
   int h = height;
@@ -586,7 +628,7 @@ void AreaBuf<T>::extendBorderPel( unsigned margin )
   // p is now the (0,height) (bottom left of image within bigger picture
   p -= ( s + margin );
   // p is now the (-margin, height-1)
-  for( int y = 0; y < margin; y++ )
+  for( int y = 0; bottom && y < margin; y++ )
   {
     ::memcpy( p + ( y + 1 ) * s, p, sizeof( T ) * ( w + ( margin << 1 ) ) );
   }
@@ -594,7 +636,7 @@ void AreaBuf<T>::extendBorderPel( unsigned margin )
   // pi is still (-marginX, height-1)
   p -= ( ( h - 1 ) * s );
   // pi is now (-marginX, 0)
-  for( int y = 0; y < margin; y++ )
+  for( int y = 0; top && y < margin; y++ )
   {
     ::memcpy( p - ( y + 1 ) * s, p, sizeof( T ) * ( w + ( margin << 1 ) ) );
   }
@@ -625,7 +667,7 @@ T AreaBuf<T>::meanDiff( const AreaBuf<const T> &other ) const
   return T( acc / area() );
 }
 
-#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+#if ENABLE_SIMD_OPT_BUFFER && ( defined(TARGET_SIMD_X86) || defined(TARGET_SIMD_VEC) )
 template<> void AreaBuf<Pel>::subtract( const Pel val );
 #endif
 
@@ -731,6 +773,7 @@ struct UnitBuf
   void addAvg               ( const UnitBuf<const T> &other1, const UnitBuf<const T> &other2, const ClpRngs& clpRngs, const bool chromaOnly = false, const bool lumaOnly = false);
   void extendSingleBorderPel();
   void extendBorderPel      ( unsigned margin );
+  void extendBorderPel      ( unsigned margin, bool top, bool bottom );
   void removeHighFreq       ( const UnitBuf<T>& other, const bool bClip, const ClpRngs& clpRngs
                             , const int8_t gbiWeight = g_GbiWeights[GBI_DEFAULT]
                             );
@@ -848,6 +891,15 @@ void UnitBuf<T>::extendBorderPel( unsigned margin )
   }
 }
 
+template<typename T>
+void UnitBuf<T>::extendBorderPel( unsigned margin, bool top, bool bottom )
+{
+  for( unsigned i = 0; i < bufs.size(); i++ )
+  {
+    bufs[i].extendBorderPel( margin, top, bottom );
+  }
+}
+
 template<typename T>
 void UnitBuf<T>::removeHighFreq( const UnitBuf<T>& other, const bool bClip, const ClpRngs& clpRngs
                                , const int8_t gbiWeight
@@ -64,6 +64,7 @@ CodingStructure::CodingStructure(CUCache& cuCache, PUCache& puCache, TUCache& tu
   , parent    ( nullptr )
   , bestCS    ( nullptr )
   , m_isTuEnc ( false )
+  , m_ctuParallel( false )
   , m_cuCache ( cuCache )
   , m_puCache ( puCache )
   , m_tuCache ( tuCache )
@@ -347,6 +348,13 @@ const TransformUnit * CodingStructure::getTU( const Position &pos, const Channel
 
 CodingUnit& CodingStructure::addCU( const UnitArea &unit, const ChannelType chType )
 {
+  std::unique_lock<std::mutex> lock( m_unitMutex, std::defer_lock );
+  if( m_ctuParallel )
+  {
+    lock.lock();
+    CHECK( cus.size() == cus.capacity(), "Reserved CU storage exceeded" );
+  }
+
   CodingUnit *cu = m_cuCache.get();
 
   cu->UnitArea::operator=( unit );
@@ -360,7 +368,28 @@ CodingUnit& CodingStructure::addCU( const UnitArea &unit, const ChannelType chTy
   cu->lastTU    = nullptr;
   cu->chType    = chType;
 
-  CodingUnit *prevCU = m_numCUs > 0 ? cus.back() : nullptr;
+  CodingUnit *prevCU = nullptr;
+
+  if( m_ctuParallel )
+  {
+    // CTUs are decoded concurrently, chain the CU to the last one of its own CTU
+    const Position lumaPos = getLumaPos( *cu );
+    CodingUnit *&ctuLastCU = m_ctuLastCU[getCtuAddr( lumaPos, *pcv )];
+    prevCU    = ctuLastCU;
+    ctuLastCU = cu;
+
+    // other CTUs may look the CU up as soon as it is indexed, so it has to be attributed to its slice and brick first
+    cu->slice   = slice;
+#if JVET_N0857_TILES_BRICKS
+    cu->tileIdx = picture->brickMap->getBrickIdxRsMap( lumaPos );
+#else
+    cu->tileIdx = picture->tileMap->getTileIdxMap( lumaPos );
+#endif
+  }
+  else if( m_numCUs > 0 )
+  {
+    prevCU = cus.back();
+  }
 
   if( prevCU )
   {
@@ -401,6 +430,13 @@ CodingUnit& CodingStructure::addCU( const UnitArea &unit, const ChannelType chTy
 
 PredictionUnit& CodingStructure::addPU( const UnitArea &unit, const ChannelType chType )
 {
+  std::unique_lock<std::mutex> lock( m_unitMutex, std::defer_lock );
+  if( m_ctuParallel )
+  {
+    lock.lock();
+    CHECK( pus.size() == pus.capacity(), "Reserved PU storage exceeded" );
+  }
+
   PredictionUnit *pu = m_puCache.get();
 
   pu->UnitArea::operator=( unit );
@@ -415,7 +451,7 @@ PredictionUnit& CodingStructure::addPU( const UnitArea &unit, const ChannelType
   CHECK( pu->cu->firstPU != nullptr, "Without an RQT the firstPU should be null" );
 #endif
 
-  PredictionUnit *prevPU = m_numPUs > 0 ? pus.back() : nullptr;
+  PredictionUnit *prevPU = m_ctuParallel ? pu->cu->lastPU : ( m_numPUs > 0 ? pus.back() : nullptr );
 
   if( prevPU && prevPU->cu == pu->cu )
   {
@@ -461,6 +497,13 @@ PredictionUnit& CodingStructure::addPU( const UnitArea &unit, const ChannelType
 
 TransformUnit& CodingStructure::addTU( const UnitArea &unit, const ChannelType chType )
 {
+  std::unique_lock<std::mutex> lock( m_unitMutex, std::defer_lock );
+  if( m_ctuParallel )
+  {
+    lock.lock();
+    CHECK( tus.size() == tus.capacity(), "Reserved TU storage exceeded" );
+  }
+
   TransformUnit *tu = m_tuCache.get();
 
   tu->UnitArea::operator=( unit );
@@ -477,7 +520,7 @@ TransformUnit& CodingStructure::addTU( const UnitArea &unit, const ChannelType c
 #endif
 
 
-  TransformUnit *prevTU = m_numTUs > 0 ? tus.back() : nullptr;
+  TransformUnit *prevTU = m_ctuParallel && tu->cu ? tu->cu->lastTU : ( m_numTUs > 0 ? tus.back() : nullptr );
 
   if( prevTU && prevTU->cu == tu->cu )
   {
@@ -623,6 +666,32 @@ void CodingStructure::allocateVectorsAtPicLevel()
   tus.reserve( allocSize );
 }
 
+void CodingStructure::setCtuParallel( const bool ctuParallel )
+{
+  if( ctuParallel )
+  {
+    // the unit vectors must not be reallocated while other CTUs access them,
+    // reserve for the worst case of dual tree and ISP/SBT transform splits
+    const size_t allocSize = 3 * unitScale[COMPONENT_Y].scale( area.blocks[COMPONENT_Y].size() ).area();
+
+    cus.reserve( allocSize );
+    pus.reserve( allocSize );
+    tus.reserve( allocSize );
+
+    m_ctuLastCU      .assign( pcv->sizeInCtus, nullptr );
+    m_ctuRowMotionLut.resize( pcv->heightInCtus );
+  }
+
+  m_ctuParallel = ctuParallel;
+}
+
+Position CodingStructure::getLumaPos( const UnitArea& unit ) const
+{
+  const CompArea &blk = unit.Y().valid() ? unit.Y() : unit.Cb();
+
+  return recalcPosition( unit.chromaFormat, toChannelType( blk.compID ), CHANNEL_TYPE_LUMA, blk.pos() );
+}
+
 
 
 void CodingStructure::create(const ChromaFormat &_chromaFormat, const Area& _area, const bool isTopLayer)
@@ -1287,7 +1356,6 @@ PelBuf CodingStructure::getBuf( const CompArea &blk, const PictureType &type )
   if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) )
   {
     cFinal.x &= ( pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
-    cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
   }
 #endif
 
@@ -1321,7 +1389,6 @@ const CPelBuf CodingStructure::getBuf( const CompArea &blk, const PictureType &t
   if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) )
   {
     cFinal.x &= ( pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
-    cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
   }
 #endif
 
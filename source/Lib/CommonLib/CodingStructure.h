@@ -44,6 +44,7 @@
 #include "UnitPartitioner.h"
 #include "Slice.h"
 #include <vector>
+#include <mutex>
 
 
 struct Picture;
@@ -125,6 +126,8 @@ public:
   void destroyCoeffs();
 
   void allocateVectorsAtPicLevel();
+  void setCtuParallel( const bool ctuParallel );
+  bool isCtuParallel() const { return m_ctuParallel; }
 
   // ---------------------------------------------------------------------------
   // global accessors
@@ -209,6 +212,9 @@ public:
 
   LutMotionCand motionLut;
 
+  LutMotionCand&       getMotionLut( const UnitArea& unit )       { return m_ctuParallel ? m_ctuRowMotionLut[getCtuRow( unit )] : motionLut; }
+  const LutMotionCand& getMotionLut( const UnitArea& unit ) const { return m_ctuParallel ? m_ctuRowMotionLut[getCtuRow( unit )] : motionLut; }
+
   void addMiToLut(static_vector<MotionInfo, MAX_NUM_HMVP_CANDS>& lut, const MotionInfo &mi);
 
 private:
@@ -216,6 +222,16 @@ private:
   // needed for TU encoding
   bool m_isTuEnc;
 
+  // units of different CTUs are added concurrently (wavefront and brick parallel decoding),
+  // the history based motion candidates are kept per CTU row
+  bool                       m_ctuParallel;
+  std::mutex                 m_unitMutex;
+  std::vector<CodingUnit*>   m_ctuLastCU;
+  std::vector<LutMotionCand> m_ctuRowMotionLut;
+
+  Position getLumaPos( const UnitArea& unit ) const;
+  int      getCtuRow ( const UnitArea& unit ) const { return ( getLumaPos( unit ).y - area.ly() ) >> pcv->maxCUHeightLog2; }
+
   unsigned *m_cuIdx   [MAX_NUM_CHANNEL_TYPE];
   unsigned *m_puIdx   [MAX_NUM_CHANNEL_TYPE];
   unsigned *m_tuIdx   [MAX_NUM_CHANNEL_TYPE];
@@ -614,6 +614,10 @@ T* aligned_malloc(size_t len, size_t alignement) {
 
 #if ENABLE_SIMD_OPT
 
+#if defined( __clang__ ) || GCC_VERSION_AT_LEAST( 9, 0 )
+#define TARGET_SIMD_VEC
+#endif
+
 #if defined(__i386__) || defined(i386) || defined(__x86_64__) || defined(_M_X64) || defined (_WIN32) || defined (_MSC_VER)
 #define TARGET_SIMD_X86
 typedef enum{
@@ -626,14 +630,21 @@ typedef enum{
 } X86_VEXT;
 #elif defined (__ARM_NEON__)
 #define TARGET_SIMD_ARM 1
-#else
+#elif !defined( TARGET_SIMD_VEC )
 #error no simd target
 #endif
 
 #ifdef TARGET_SIMD_X86
 X86_VEXT read_x86_extension_flags(const std::string &extStrId = std::string());
 const char* read_x86_extension(const std::string &extStrId);
+void reset_x86_extension_flags();
+#endif
+#ifdef TARGET_SIMD_VEC
+bool read_vec_extension_flag(const std::string &extStrId = std::string());
+void reset_vec_extension_flag();
 #endif
+const char* read_simd_extension(const std::string &extStrId);
+const char* select_simd_extension(const std::string &extStrId);
 
 #endif //ENABLE_SIMD_OPT
 
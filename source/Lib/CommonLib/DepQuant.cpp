@@ -62,14 +62,6 @@ namespace DQIntern
     uint16_t  num;
     uint16_t  outPos[5];
   };
-  struct CoeffFracBits
-  {
-    int32_t   bits[6];
-  };
-
-
-  enum ScanPosType { SCAN_ISCSBB = 0, SCAN_SOCSBB = 1, SCAN_EOCSBB = 2 };
-
   struct ScanInfo
   {
     ScanInfo() {}
@@ -675,23 +667,6 @@ namespace DQIntern
   /*================================================================================*/
 
 
-  struct PQData
-  {
-    TCoeff  absLevel;
-    int64_t deltaDist;
-  };
-
-
-  struct Decision
-  {
-    int64_t rdCost;
-    TCoeff  absLevel;
-    int     prevId;
-  };
-
-
-
-
   /*================================================================================*/
   /*=====                                                                      =====*/
   /*=====   P R E - Q U A N T I Z E R                                          =====*/
@@ -1018,7 +993,6 @@ namespace DQIntern
     uint8_t                     m_memory[ 8 * ( MAX_TB_SIZEY * MAX_TB_SIZEY + MLS_GRP_NUM ) ];
   };
 
-#define RICEMAX 32
   const int32_t g_goRiceBits[4][RICEMAX] =
   {
       { 32768,	65536,	98304,	131072,	163840,	196608,	262144,	262144,	327680,	327680,	327680,	327680,	393216,	393216,	393216,	393216,	393216,	393216,	393216,	393216,	458752,	458752,	458752,	458752,	458752,	458752,	458752,	458752,	458752,	458752,	458752,	458752},
@@ -1031,7 +1005,7 @@ namespace DQIntern
   {
     friend class CommonCtx;
   public:
-    State( const RateEstimator& rateEst, CommonCtx& commonCtx, const int stateId );
+    State( const RateEstimator& rateEst, CommonCtx& commonCtx, StateMem& stateMem, const int stateId );
 
     template<uint8_t numIPos>
     inline void updateState(const ScanInfo &scanInfo, const State *prevStates, const Decision &decision);
@@ -1044,138 +1018,25 @@ namespace DQIntern
       m_numSigSbb     = 0;
       m_remRegBins    = 4;  // just large enough for last scan pos
       m_refSbbCtxId   = -1;
-      m_sigFracBits   = m_sigFracBitsArray[ 0 ];
-      m_coeffFracBits = m_gtxFracBitsArray[ 0 ];
+      setSigFracBits  ( m_sigFracBitsArray[ 0 ] );
+      setCoeffFracBits( m_gtxFracBitsArray[ 0 ] );
       m_goRicePar     = 0;
       m_goRiceZero    = 0;
     }
 
-#if JVET_N0193_LFNST
-    void checkRdCosts( const ScanPosType spt, const PQData& pqDataA, const PQData& pqDataB, Decision& decisionA, Decision& decisionB, bool zeroOut ) const
-#else
-    void checkRdCosts( const ScanPosType spt, const PQData& pqDataA, const PQData& pqDataB, Decision& decisionA, Decision& decisionB) const
-#endif
-    {
-      const int32_t*  goRiceTab = g_goRiceBits[m_goRicePar];
-      int64_t         rdCostA   = m_rdCost + pqDataA.deltaDist;
-      int64_t         rdCostB   = m_rdCost + pqDataB.deltaDist;
-      int64_t         rdCostZ   = m_rdCost;
-#if JVET_N0193_LFNST
-      if( zeroOut )
-      {
-        rdCostZ = m_rdCost;
-        if( m_remRegBins >= 4 )
-        {
-          if( spt == SCAN_ISCSBB )
-          {
-            rdCostZ += m_sigFracBits.intBits[ 0 ];
-          }
-          else if( spt == SCAN_SOCSBB )
-          {
-            rdCostZ += m_sbbFracBits.intBits[ 1 ] + m_sigFracBits.intBits[ 0 ];
-          }
-          else if( m_numSigSbb )
-          {
-            rdCostZ += m_sigFracBits.intBits[ 0 ];
-          }
-          else
-          {
-            rdCostZ = decisionA.rdCost;
-          }
-        }
-        else
-        {
-          rdCostZ += goRiceTab[ m_goRiceZero ];
-        }
-        if( rdCostZ < decisionA.rdCost )
-        {
-          decisionA.rdCost = rdCostZ;
-          decisionA.absLevel = 0;
-          decisionA.prevId = m_stateId;
-        }
-      }
-      else
-      {
-#endif
-        if( m_remRegBins >= 4 )
-        {
-          if( pqDataA.absLevel < 4 )
-            rdCostA += m_coeffFracBits.bits[ pqDataA.absLevel ];
-          else
-          {
-            const unsigned value = ( pqDataA.absLevel - 4 ) >> 1;
-            rdCostA += m_coeffFracBits.bits[ pqDataA.absLevel - ( value << 1 ) ] + goRiceTab[ value < RICEMAX ? value : RICEMAX - 1 ];
-          }
-          if( pqDataB.absLevel < 4 )
-            rdCostB += m_coeffFracBits.bits[ pqDataB.absLevel ];
-          else
-          {
-            const unsigned value = ( pqDataB.absLevel - 4 ) >> 1;
-            rdCostB += m_coeffFracBits.bits[ pqDataB.absLevel - ( value << 1 ) ] + goRiceTab[ value < RICEMAX ? value : RICEMAX - 1 ];
-          }
-          if( spt == SCAN_ISCSBB )
-          {
-            rdCostA += m_sigFracBits.intBits[ 1 ];
-            rdCostB += m_sigFracBits.intBits[ 1 ];
-            rdCostZ += m_sigFracBits.intBits[ 0 ];
-          }
-          else if( spt == SCAN_SOCSBB )
-          {
-            rdCostA += m_sbbFracBits.intBits[ 1 ] + m_sigFracBits.intBits[ 1 ];
-            rdCostB += m_sbbFracBits.intBits[ 1 ] + m_sigFracBits.intBits[ 1 ];
-            rdCostZ += m_sbbFracBits.intBits[ 1 ] + m_sigFracBits.intBits[ 0 ];
-          }
-          else if( m_numSigSbb )
-          {
-            rdCostA += m_sigFracBits.intBits[ 1 ];
-            rdCostB += m_sigFracBits.intBits[ 1 ];
-            rdCostZ += m_sigFracBits.intBits[ 0 ];
-          }
-          else
-          {
-            rdCostZ = decisionA.rdCost;
-          }
-        }
-        else
-        {
-          rdCostA += ( 1 << SCALE_BITS ) + goRiceTab[ pqDataA.absLevel <= m_goRiceZero ? pqDataA.absLevel - 1 : ( pqDataA.absLevel < RICEMAX ? pqDataA.absLevel : RICEMAX - 1 ) ];
-          rdCostB += ( 1 << SCALE_BITS ) + goRiceTab[ pqDataB.absLevel <= m_goRiceZero ? pqDataB.absLevel - 1 : ( pqDataB.absLevel < RICEMAX ? pqDataB.absLevel : RICEMAX - 1 ) ];
-          rdCostZ += goRiceTab[ m_goRiceZero ];
-        }
-        if( rdCostA < decisionA.rdCost )
-        {
-          decisionA.rdCost = rdCostA;
-          decisionA.absLevel = pqDataA.absLevel;
-          decisionA.prevId = m_stateId;
-        }
-        if( rdCostZ < decisionA.rdCost )
-        {
-          decisionA.rdCost = rdCostZ;
-          decisionA.absLevel = 0;
-          decisionA.prevId = m_stateId;
-        }
-        if( rdCostB < decisionB.rdCost )
-        {
-          decisionB.rdCost = rdCostB;
-          decisionB.absLevel = pqDataB.absLevel;
-          decisionB.prevId = m_stateId;
-        }
-#if JVET_N0193_LFNST
-      }
-#endif
-    }
+    inline const StateMem& stateMem() const { return m_mem; }
 
     inline void checkRdCostStart(int32_t lastOffset, const PQData &pqData, Decision &decision) const
     {
       int64_t rdCost = pqData.deltaDist + lastOffset;
       if (pqData.absLevel < 4)
       {
-        rdCost += m_coeffFracBits.bits[pqData.absLevel];
+        rdCost += m_mem.coeffBits[pqData.absLevel][m_stateId];
       }
       else
       {
         const unsigned value = (pqData.absLevel - 4) >> 1;
-        rdCost += m_coeffFracBits.bits[pqData.absLevel - (value << 1)] + g_goRiceBits[m_goRicePar][value < RICEMAX ? value : RICEMAX-1];
+        rdCost += m_mem.coeffBits[pqData.absLevel - (value << 1)][m_stateId] + g_goRiceBits[m_goRicePar][value < RICEMAX ? value : RICEMAX-1];
       }
       if( rdCost < decision.rdCost )
       {
@@ -1187,7 +1048,7 @@ namespace DQIntern
 
     inline void checkRdCostSkipSbb(Decision &decision) const
     {
-      int64_t rdCost = m_rdCost + m_sbbFracBits.intBits[0];
+      int64_t rdCost = m_rdCost + m_mem.sbbBits[0][m_stateId];
       if( rdCost < decision.rdCost )
       {
         decision.rdCost   = rdCost;
@@ -1198,23 +1059,41 @@ namespace DQIntern
 
     inline void checkRdCostSkipSbbZeroOut(Decision &decision) const
     {
-      int64_t rdCost = m_rdCost + m_sbbFracBits.intBits[0];
+      int64_t rdCost = m_rdCost + m_mem.sbbBits[0][m_stateId];
       decision.rdCost = rdCost;
       decision.absLevel = 0;
       decision.prevId = 4 + m_stateId;
     }
 
   private:
-    int64_t                   m_rdCost;
+    inline void setSbbFracBits( const BinFracBits& fracBits )
+    {
+      m_mem.sbbBits[0][m_stateId] = fracBits.intBits[0];
+      m_mem.sbbBits[1][m_stateId] = fracBits.intBits[1];
+    }
+    inline void setSigFracBits( const BinFracBits& fracBits )
+    {
+      m_mem.sigBits[0][m_stateId] = fracBits.intBits[0];
+      m_mem.sigBits[1][m_stateId] = fracBits.intBits[1];
+    }
+    inline void setCoeffFracBits( const CoeffFracBits& fracBits )
+    {
+      for( int k = 0; k < 6; k++ )
+      {
+        m_mem.coeffBits[k][m_stateId] = fracBits.bits[k];
+      }
+    }
+
+  private:
+    // the rate-distortion data is kept in the structure of arrays shared by the four states of a stage
+    StateMem&                 m_mem;
+    int64_t&                  m_rdCost;
     uint16_t                  m_absLevelsAndCtxInit[24];  // 16x8bit for abs levels + 16x16bit for ctx init id
-    int8_t                    m_numSigSbb;
-    int8_t                    m_remRegBins;
+    int32_t&                  m_numSigSbb;
+    int32_t&                  m_remRegBins;
     int8_t                    m_refSbbCtxId;
-    BinFracBits               m_sbbFracBits;
-    BinFracBits               m_sigFracBits;
-    CoeffFracBits             m_coeffFracBits;
-    int8_t                    m_goRicePar;
-    int8_t                    m_goRiceZero;
+    int32_t&                  m_goRicePar;
+    int32_t&                  m_goRiceZero;
     const int8_t              m_stateId;
     const BinFracBits*const   m_sigFracBitsArray;
     const CoeffFracBits*const m_gtxFracBitsArray;
@@ -1223,14 +1102,20 @@ namespace DQIntern
   };
 
 
-  State::State( const RateEstimator& rateEst, CommonCtx& commonCtx, const int stateId )
-    : m_sbbFracBits     { { 0, 0 } }
+  State::State( const RateEstimator& rateEst, CommonCtx& commonCtx, StateMem& stateMem, const int stateId )
+    : m_mem             ( stateMem )
+    , m_rdCost          ( stateMem.rdCost    [stateId] )
+    , m_numSigSbb       ( stateMem.numSigSbb [stateId] )
+    , m_remRegBins      ( stateMem.remRegBins[stateId] )
+    , m_goRicePar       ( stateMem.goRicePar [stateId] )
+    , m_goRiceZero      ( stateMem.goRiceZero[stateId] )
     , m_stateId         ( stateId )
     , m_sigFracBitsArray( rateEst.sigFlagBits(stateId) )
     , m_gtxFracBitsArray( rateEst.gtxFracBits(stateId) )
     , m_goRiceZeroArray ( g_auiGoRicePosCoeff0[std::max(0,stateId-1)] )
     , m_commonCtx       ( commonCtx )
   {
+    setSbbFracBits( { { 0, 0 } } );
   }
 
   template<uint8_t numIPos>
@@ -1244,7 +1129,8 @@ namespace DQIntern
         const State*  prvState  = prevStates            +   decision.prevId;
         m_numSigSbb             = prvState->m_numSigSbb + !!decision.absLevel;
         m_refSbbCtxId           = prvState->m_refSbbCtxId;
-        m_sbbFracBits           = prvState->m_sbbFracBits;
+        m_mem.sbbBits[0][m_stateId] = prvState->m_mem.sbbBits[0][prvState->m_stateId];
+        m_mem.sbbBits[1][m_stateId] = prvState->m_mem.sbbBits[1][prvState->m_stateId];
         m_remRegBins            = prvState->m_remRegBins - 1;
         m_goRicePar             = prvState->m_goRicePar;
         if( m_remRegBins >= 4 )
@@ -1319,8 +1205,8 @@ namespace DQIntern
         }
 #undef UPDATE
         TCoeff sumGt1 = sumAbs1 - sumNum;
-        m_sigFracBits = m_sigFracBitsArray[scanInfo.sigCtxOffsetNext + (sumAbs1 < 5 ? sumAbs1 : 5)];
-        m_coeffFracBits = m_gtxFracBitsArray[scanInfo.gtxCtxOffsetNext + (sumGt1 < 4 ? sumGt1 : 4)];
+        setSigFracBits  ( m_sigFracBitsArray[scanInfo.sigCtxOffsetNext + (sumAbs1 < 5 ? sumAbs1 : 5)] );
+        setCoeffFracBits( m_gtxFracBitsArray[scanInfo.gtxCtxOffsetNext + (sumGt1 < 4 ? sumGt1 : 4)] );
 
 #if JVET_N0188_UNIFY_RICEPARA
         TCoeff  sumAbs = m_absLevelsAndCtxInit[8 + scanInfo.nextInsidePos] >> 8;
@@ -1435,8 +1321,8 @@ namespace DQIntern
       TCoeff  sumNum  =   tinit        & 7;
       TCoeff  sumAbs1 = ( tinit >> 3 ) & 31;
       TCoeff  sumGt1  = sumAbs1        - sumNum;
-      m_sigFracBits   = m_sigFracBitsArray[ scanInfo.sigCtxOffsetNext + ( sumAbs1 < 5 ? sumAbs1 : 5 ) ];
-      m_coeffFracBits = m_gtxFracBitsArray[ scanInfo.gtxCtxOffsetNext + ( sumGt1  < 4 ? sumGt1  : 4 ) ];
+      setSigFracBits  ( m_sigFracBitsArray[ scanInfo.sigCtxOffsetNext + ( sumAbs1 < 5 ? sumAbs1 : 5 ) ] );
+      setCoeffFracBits( m_gtxFracBitsArray[ scanInfo.gtxCtxOffsetNext + ( sumGt1  < 4 ? sumGt1  : 4 ) ] );
     }
   }
 
@@ -1470,7 +1356,7 @@ namespace DQIntern
     }
     currState.m_goRicePar     = 0;
     currState.m_refSbbCtxId   = currState.m_stateId;
-    currState.m_sbbFracBits   = m_sbbFlagBits[ sigNSbb ];
+    currState.setSbbFracBits( m_sbbFlagBits[ sigNSbb ] );
 
     uint16_t          templateCtxInit[16];
     const int         scanBeg   = scanInfo.scanIdx - scanInfo.sbbSize;
@@ -1521,7 +1407,7 @@ namespace DQIntern
   class DepQuant : private RateEstimator
   {
   public:
-    DepQuant();
+    DepQuant( void ( *checkRdCosts )( const StateMem&, const PQData*, const ScanPosType, const bool, Decision* ) );
 
 #if JVET_N0847_SCALING_LISTS
     void    quant   ( TransformUnit& tu, const CCoeffBuf& srcCoeff, const ComponentID compID, const QpParam& cQP, const double lambda, const Ctx& ctx, TCoeff& absSum, bool enableScalingLists, int* quantCoeff );
@@ -1541,7 +1427,10 @@ namespace DQIntern
 #endif
 
   private:
+    void      ( *m_checkRdCosts )( const StateMem&, const PQData*, const ScanPosType, const bool, Decision* );
     CommonCtx   m_commonCtx;
+    StateMem    m_stateMem [ 3 ];
+    StateMem    m_startMem;
     State       m_allStates[ 12 ];
     State*      m_currStates;
     State*      m_prevStates;
@@ -1552,15 +1441,18 @@ namespace DQIntern
   };
 
 
-#define TINIT(x) {*this,m_commonCtx,x}
-  DepQuant::DepQuant()
+#define TINIT(m,x) {*this,m_commonCtx,m,x}
+  DepQuant::DepQuant( void ( *checkRdCosts )( const StateMem&, const PQData*, const ScanPosType, const bool, Decision* ) )
     : RateEstimator ()
+    , m_checkRdCosts( checkRdCosts )
     , m_commonCtx   ()
-    , m_allStates   {TINIT(0),TINIT(1),TINIT(2),TINIT(3),TINIT(0),TINIT(1),TINIT(2),TINIT(3),TINIT(0),TINIT(1),TINIT(2),TINIT(3)}
+    , m_allStates   {TINIT(m_stateMem[0],0),TINIT(m_stateMem[0],1),TINIT(m_stateMem[0],2),TINIT(m_stateMem[0],3),
+                     TINIT(m_stateMem[1],0),TINIT(m_stateMem[1],1),TINIT(m_stateMem[1],2),TINIT(m_stateMem[1],3),
+                     TINIT(m_stateMem[2],0),TINIT(m_stateMem[2],1),TINIT(m_stateMem[2],2),TINIT(m_stateMem[2],3)}
     , m_currStates  (  m_allStates      )
     , m_prevStates  (  m_currStates + 4 )
     , m_skipStates  (  m_prevStates + 4 )
-    , m_startState  TINIT(0)
+    , m_startState  TINIT(m_startMem,0)
   {}
 #undef TINIT
 
@@ -1612,17 +1504,7 @@ namespace DQIntern
 #else
     m_quant.preQuantCoeff( absCoeff, pqData );
 #endif
-#if JVET_N0193_LFNST
-    m_prevStates[0].checkRdCosts( spt, pqData[0], pqData[2], decisions[0], decisions[2], zeroOut );
-    m_prevStates[1].checkRdCosts( spt, pqData[0], pqData[2], decisions[2], decisions[0], zeroOut );
-    m_prevStates[2].checkRdCosts( spt, pqData[3], pqData[1], decisions[1], decisions[3], zeroOut );
-    m_prevStates[3].checkRdCosts( spt, pqData[3], pqData[1], decisions[3], decisions[1], zeroOut );
-#else
-    m_prevStates[0].checkRdCosts( spt, pqData[0], pqData[2], decisions[0], decisions[2]);
-    m_prevStates[1].checkRdCosts( spt, pqData[0], pqData[2], decisions[2], decisions[0]);
-    m_prevStates[2].checkRdCosts( spt, pqData[3], pqData[1], decisions[1], decisions[3]);
-    m_prevStates[3].checkRdCosts( spt, pqData[3], pqData[1], decisions[3], decisions[1]);
-#endif
+    m_checkRdCosts( m_prevStates[0].stateMem(), pqData, spt, zeroOut, decisions );
     if( spt==SCAN_EOCSBB )
     {
 #if JVET_N0193_LFNST
@@ -1888,7 +1770,16 @@ DepQuant::DepQuant( const Quant* other, bool enc ) : QuantRDOQ( other )
 {
   const DepQuant* dq = dynamic_cast<const DepQuant*>( other );
   CHECK( other && !dq, "The DepQuant cast must be successfull!" );
-  p = new DQIntern::DepQuant();
+
+  m_checkRdCosts = xCheckRdCosts;
+
+#if ENABLE_SIMD_OPT_DEPQUANT
+#ifdef TARGET_SIMD_X86
+  initDepQuantX86();
+#endif
+#endif
+
+  p = new DQIntern::DepQuant( m_checkRdCosts );
   if( enc )
   {
     DQIntern::g_Rom.init();
@@ -1900,6 +1791,135 @@ DepQuant::~DepQuant()
   delete static_cast<DQIntern::DepQuant*>(p);
 }
 
+void DepQuant::xCheckRdCosts( const DQIntern::StateMem& states, const DQIntern::PQData* pqData, const DQIntern::ScanPosType spt, const bool zeroOut, DQIntern::Decision* decisions )
+{
+  using namespace DQIntern;
+
+  // states 0 and 1 test the levels of quantizer Q0 (pqData[0] and pqData[2]), states 2 and 3 those of quantizer Q1 (pqData[3] and pqData[1])
+  static const int pqIdA [4] = { 0, 0, 3, 3 };
+  static const int pqIdB [4] = { 2, 2, 1, 1 };
+  static const int decIdA[4] = { 0, 2, 1, 3 };
+  static const int decIdB[4] = { 2, 0, 3, 1 };
+
+  for( int stateId = 0; stateId < 4; stateId++ )
+  {
+    const PQData&   pqDataA   = pqData   [ pqIdA [stateId] ];
+    const PQData&   pqDataB   = pqData   [ pqIdB [stateId] ];
+    Decision&       decisionA = decisions[ decIdA[stateId] ];
+    Decision&       decisionB = decisions[ decIdB[stateId] ];
+    const int32_t*  goRiceTab = g_goRiceBits[ states.goRicePar[stateId] ];
+    const int32_t   sig0      = states.sigBits[0][stateId];
+    const int32_t   sig1      = states.sigBits[1][stateId];
+    const int32_t   sbb1      = states.sbbBits[1][stateId];
+    int64_t         rdCostA   = states.rdCost[stateId] + pqDataA.deltaDist;
+    int64_t         rdCostB   = states.rdCost[stateId] + pqDataB.deltaDist;
+    int64_t         rdCostZ   = states.rdCost[stateId];
+#if JVET_N0193_LFNST
+    if( zeroOut )
+    {
+      if( states.remRegBins[stateId] >= 4 )
+      {
+        if( spt == SCAN_ISCSBB )
+        {
+          rdCostZ += sig0;
+        }
+        else if( spt == SCAN_SOCSBB )
+        {
+          rdCostZ += sbb1 + sig0;
+        }
+        else if( states.numSigSbb[stateId] )
+        {
+          rdCostZ += sig0;
+        }
+        else
+        {
+          rdCostZ = decisionA.rdCost;
+        }
+      }
+      else
+      {
+        rdCostZ += goRiceTab[ states.goRiceZero[stateId] ];
+      }
+      if( rdCostZ < decisionA.rdCost )
+      {
+        decisionA.rdCost   = rdCostZ;
+        decisionA.absLevel = 0;
+        decisionA.prevId   = stateId;
+      }
+      continue;
+    }
+#endif
+    if( states.remRegBins[stateId] >= 4 )
+    {
+      if( pqDataA.absLevel < 4 )
+      {
+        rdCostA += states.coeffBits[ pqDataA.absLevel ][stateId];
+      }
+      else
+      {
+        const unsigned value = ( pqDataA.absLevel - 4 ) >> 1;
+        rdCostA += states.coeffBits[ pqDataA.absLevel - ( value << 1 ) ][stateId] + goRiceTab[ value < RICEMAX ? value : RICEMAX - 1 ];
+      }
+      if( pqDataB.absLevel < 4 )
+      {
+        rdCostB += states.coeffBits[ pqDataB.absLevel ][stateId];
+      }
+      else
+      {
+        const unsigned value = ( pqDataB.absLevel - 4 ) >> 1;
+        rdCostB += states.coeffBits[ pqDataB.absLevel - ( value << 1 ) ][stateId] + goRiceTab[ value < RICEMAX ? value : RICEMAX - 1 ];
+      }
+      if( spt == SCAN_ISCSBB )
+      {
+        rdCostA += sig1;
+        rdCostB += sig1;
+        rdCostZ += sig0;
+      }
+      else if( spt == SCAN_SOCSBB )
+      {
+        rdCostA += sbb1 + sig1;
+        rdCostB += sbb1 + sig1;
+        rdCostZ += sbb1 + sig0;
+      }
+      else if( states.numSigSbb[stateId] )
+      {
+        rdCostA += sig1;
+        rdCostB += sig1;
+        rdCostZ += sig0;
+      }
+      else
+      {
+        rdCostZ = decisionA.rdCost;
+      }
+    }
+    else
+    {
+      const int goRiceZero = states.goRiceZero[stateId];
+      rdCostA += ( 1 << SCALE_BITS ) + goRiceTab[ pqDataA.absLevel <= goRiceZero ? pqDataA.absLevel - 1 : ( pqDataA.absLevel < RICEMAX ? pqDataA.absLevel : RICEMAX - 1 ) ];
+      rdCostB += ( 1 << SCALE_BITS ) + goRiceTab[ pqDataB.absLevel <= goRiceZero ? pqDataB.absLevel - 1 : ( pqDataB.absLevel < RICEMAX ? pqDataB.absLevel : RICEMAX - 1 ) ];
+      rdCostZ += goRiceTab[ goRiceZero ];
+    }
+    if( rdCostA < decisionA.rdCost )
+    {
+      decisionA.rdCost   = rdCostA;
+      decisionA.absLevel = pqDataA.absLevel;
+      decisionA.prevId   = stateId;
+    }
+    if( rdCostZ < decisionA.rdCost )
+    {
+      decisionA.rdCost   = rdCostZ;
+      decisionA.absLevel = 0;
+      decisionA.prevId   = stateId;
+    }
+    if( rdCostB < decisionB.rdCost )
+    {
+      decisionB.rdCost   = rdCostB;
+      decisionB.absLevel = pqDataB.absLevel;
+      decisionB.prevId   = stateId;
+    }
+  }
+}
+
 void DepQuant::quant( TransformUnit &tu, const ComponentID &compID, const CCoeffBuf &pSrc, TCoeff &uiAbsSum, const QpParam &cQP, const Ctx& ctx )
 {
 #if JVET_N0280_RESIDUAL_CODING_TS
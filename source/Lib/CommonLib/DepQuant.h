@@ -44,7 +44,45 @@
 #include "QuantRDOQ.h"
 
 
+namespace DQIntern
+{
+  enum ScanPosType { SCAN_ISCSBB = 0, SCAN_SOCSBB = 1, SCAN_EOCSBB = 2 };
+
+  struct CoeffFracBits
+  {
+    int32_t   bits[6];
+  };
+
+  struct PQData
+  {
+    TCoeff  absLevel;
+    int64_t deltaDist;
+  };
+
+  struct Decision
+  {
+    int64_t rdCost;
+    TCoeff  absLevel;
+    int     prevId;
+  };
 
+  // rate-distortion data of the four states of one trellis stage, stored as structure of arrays
+  // (index is the state id) so that the decisions for all states can be derived in parallel
+  struct StateMem
+  {
+    int64_t   rdCost     [4];
+    int32_t   sigBits    [2][4];
+    int32_t   sbbBits    [2][4];
+    int32_t   coeffBits  [6][4];
+    int32_t   numSigSbb  [4];
+    int32_t   remRegBins [4];
+    int32_t   goRicePar  [4];
+    int32_t   goRiceZero [4];
+  };
+
+#define RICEMAX 32
+  extern const int32_t g_goRiceBits[4][RICEMAX];
+}
 
 
 class DepQuant : public QuantRDOQ
@@ -56,7 +94,20 @@ public:
   virtual void quant  ( TransformUnit &tu, const ComponentID &compID, const CCoeffBuf &pSrc, TCoeff &uiAbsSum, const QpParam &cQP, const Ctx& ctx );
   virtual void dequant( const TransformUnit &tu, CoeffBuf &dstCoeff, const ComponentID &compID, const QpParam &cQP );
 
+  // checks the level candidates of a scan position for the four previous states and updates the decisions
+  static void xCheckRdCosts( const DQIntern::StateMem& states, const DQIntern::PQData* pqData, const DQIntern::ScanPosType spt, const bool zeroOut, DQIntern::Decision* decisions );
+
 private:
+  void ( *m_checkRdCosts )( const DQIntern::StateMem& states, const DQIntern::PQData* pqData, const DQIntern::ScanPosType spt, const bool zeroOut, DQIntern::Decision* decisions );
+
+#if ENABLE_SIMD_OPT_DEPQUANT
+#ifdef TARGET_SIMD_X86
+  void initDepQuantX86();
+  template <X86_VEXT vext>
+  void _initDepQuantX86();
+#endif
+#endif
+
   void* p;
 };
 
@@ -676,6 +676,12 @@ void InterPrediction::xPredInterBlk ( const ComponentID& compID, const Predictio
 #else
     Position offset = pu.blocks[compID].pos().offset( _mv.getHor() >> shiftHor, _mv.getVer() >> shiftVer );
 #endif
+    if( !isIBC )
+    {
+      // the reference picture might still be reconstructed by another frame decoder
+      const int refHeight = dmvrWidth ? dmvrHeight : pu.blocks[compID].height;
+      refPic->waitForReconstruction( ( ( offset.y + refHeight ) << ::getComponentScaleY( compID, chFmt ) ) + NTAPS_LUMA );
+    }
     if (dmvrWidth)
     {
 #if JVET_N0070_WRAPAROUND
@@ -1014,6 +1020,7 @@ void InterPrediction::xPredAffineBlk( const ComponentID& compID, const Predictio
         yFrac = iMvScaleTmpVer & 31;
       }
 
+      refPic->waitForReconstruction( ( ( pu.blocks[compID].y + yInt + h + blockHeight ) << ::getComponentScaleY( compID, chFmt ) ) + NTAPS_LUMA );
 #if JVET_N0070_WRAPAROUND
       const CPelBuf refBuf = refPic->getRecoBuf( CompArea( compID, chFmt, pu.blocks[compID].offset(xInt + w, yInt + h), pu.blocks[compID] ), wrapRef );
 #else
@@ -1536,78 +1543,26 @@ void InterPrediction::xWeightedTriangleBlk( const PredictionUnit &pu, const uint
   Pel*    dst        = predDst .get(compIdx).buf;
   Pel*    src0       = predSrc0.get(compIdx).buf;
   Pel*    src1       = predSrc1.get(compIdx).buf;
-  int32_t strideDst  = predDst .get(compIdx).stride  - width;
-  int32_t strideSrc0 = predSrc0.get(compIdx).stride  - width;
-  int32_t strideSrc1 = predSrc1.get(compIdx).stride  - width;
+  int32_t strideDst  = predDst .get(compIdx).stride;
+  int32_t strideSrc0 = predSrc0.get(compIdx).stride;
+  int32_t strideSrc1 = predSrc1.get(compIdx).stride;
 
   const char    log2WeightBase    = 3;
   const ClpRng  clipRng           = pu.cu->slice->clpRngs().comp[compIdx];
   const int32_t clipbd            = clipRng.bd;
-  const int32_t shiftDefault      = std::max<int>(2, (IF_INTERNAL_PREC - clipbd));
-  const int32_t offsetDefault     = (1<<(shiftDefault-1)) + IF_INTERNAL_OFFS;
   const int32_t shiftWeighted     = std::max<int>(2, (IF_INTERNAL_PREC - clipbd)) + log2WeightBase;
   const int32_t offsetWeighted    = (1 << (shiftWeighted - 1)) + (IF_INTERNAL_OFFS << log2WeightBase);
 
-  const int32_t ratioWH           = (width > height) ? (width / height) : 1;
-  const int32_t ratioHW           = (width > height) ? 1 : (height / width);
-
 #if JVET_N0671_INTRA_TPM_ALIGNWITH420
   const bool    longWeight        = (compIdx == COMPONENT_Y);
 #else
   const bool    longWeight        = (compIdx == COMPONENT_Y) || ( predDst.chromaFormat == CHROMA_444 );
 #endif
-  const int32_t weightedLength    = longWeight ? 7 : 3;
-        int32_t weightedStartPos  = ( splitDir == 0 ) ? ( 0 - (weightedLength >> 1) * ratioWH ) : ( width - ((weightedLength + 1) >> 1) * ratioWH );
-        int32_t weightedEndPos    = weightedStartPos + weightedLength * ratioWH - 1;
-        int32_t weightedPosoffset =( splitDir == 0 ) ? ratioWH : -ratioWH;
-
-        Pel     tmpPelWeighted;
-        int32_t weightIdx;
-        int32_t x, y, tmpX, tmpY, tmpWeightedStart, tmpWeightedEnd;
-
-  for( y = 0; y < height; y+= ratioHW )
-  {
-    for( tmpY = ratioHW; tmpY > 0; tmpY-- )
-    {
-      for( x = 0; x < weightedStartPos; x++ )
-      {
-        *dst++ = ClipPel( rightShift( (splitDir == 0 ? *src1 : *src0) + offsetDefault, shiftDefault), clipRng );
-        src0++;
-        src1++;
-      }
-
-      tmpWeightedStart = std::max((int32_t)0, weightedStartPos);
-      tmpWeightedEnd   = std::min(weightedEndPos, (int32_t)(width - 1));
-      weightIdx        = 1;
-      if( weightedStartPos < 0 )
-      {
-        weightIdx     += abs(weightedStartPos) / ratioWH;
-      }
-      for( x = tmpWeightedStart; x <= tmpWeightedEnd; x+= ratioWH )
-      {
-        for( tmpX = ratioWH; tmpX > 0; tmpX-- )
-        {
-          tmpPelWeighted = Clip3( 1, 7, longWeight ? weightIdx : (weightIdx * 2));
-          tmpPelWeighted = splitDir ? ( 8 - tmpPelWeighted ) : tmpPelWeighted;
-          *dst++         = ClipPel( rightShift( (tmpPelWeighted*(*src0++) + ((8 - tmpPelWeighted) * (*src1++)) + offsetWeighted), shiftWeighted ), clipRng );
-        }
-        weightIdx ++;
-      }
 
-      for( x = weightedEndPos + 1; x < width; x++ )
-      {
-        *dst++ = ClipPel( rightShift( (splitDir == 0 ? *src0 : *src1) + offsetDefault, shiftDefault ), clipRng );
-        src0++;
-        src1++;
-      }
+  // the samples outside of the weighted band have the full weight, which gives the same result as the default rounding
+  const uint8_t* weights = g_triangleWeights[splitDir ? 1 : 0][longWeight ? 1 : 0][g_aucLog2[width]][g_aucLog2[height]];
 
-      dst  += strideDst;
-      src0 += strideSrc0;
-      src1 += strideSrc1;
-    }
-    weightedStartPos += weightedPosoffset;
-    weightedEndPos   += weightedPosoffset;
-  }
+  g_pelBufOP.weightTriangle( src0, strideSrc0, src1, strideSrc1, dst, strideDst, width, height, weights, shiftWeighted, offsetWeighted, clipRng );
 }
 
 void InterPrediction::xPrefetchPad(PredictionUnit& pu, PelUnitBuf &pcPad, RefPicList refId)
@@ -1647,6 +1602,7 @@ void InterPrediction::xPrefetchPad(PredictionUnit& pu, PelUnitBuf &pcPad, RefPic
     {
       CPelBuf refBuf;
       Position Rec_offset = pu.blocks[compID].pos().offset(cMv.getHor() >> mvshiftTemp, cMv.getVer() >> mvshiftTemp);
+      refPic->waitForReconstruction( ( Rec_offset.y + height ) << getComponentScaleY( (ComponentID)compID, pu.chromaFormat ) );
 #if JVET_N0070_WRAPAROUND
       refBuf = refPic->getRecoBuf(CompArea((ComponentID)compID, pu.chromaFormat, Rec_offset, pu.blocks[compID].size()), wrapRef);
 #else
@@ -1762,19 +1718,16 @@ void xSubPelErrorSrfc(uint64_t *sadBuffer, int32_t *deltaMv)
 
 void InterPrediction::xBIPMVRefine(int bd, Pel *pRefL0, Pel *pRefL1, uint64_t& minCost, int16_t *deltaMV, uint64_t *pSADsArray, int width, int height)
 {
-  const int32_t refStrideL0 = m_biLinearBufStride;
-  const int32_t refStrideL1 = m_biLinearBufStride;
-  Pel *pRefL0Orig = pRefL0;
-  Pel *pRefL1Orig = pRefL1;
+  const uint32_t distortionShift = DISTORTION_PRECISION_ADJUSTMENT(bd);
+  /*all integer offsets of the search window are evaluated in one pass, same cost as xDMVRCost*/
+  uint64_t sads[((2 * DMVR_NUM_ITERATION) + 1) * ((2 * DMVR_NUM_ITERATION) + 1)];
+  g_pelBufOP.dmvrSads(pRefL0, pRefL1, m_biLinearBufStride, width, height, sads);
   for (int nIdx = 0; (nIdx < 25); ++nIdx)
   {
     int32_t sadOffset = ((m_pSearchOffset[nIdx].getVer() * ((2 * DMVR_NUM_ITERATION) + 1)) + m_pSearchOffset[nIdx].getHor());
-    pRefL0 = pRefL0Orig + m_pSearchOffset[nIdx].hor + (m_pSearchOffset[nIdx].ver * refStrideL0);
-    pRefL1 = pRefL1Orig - m_pSearchOffset[nIdx].hor - (m_pSearchOffset[nIdx].ver * refStrideL1);
     if (*(pSADsArray + sadOffset) == MAX_UINT64)
     {
-      const uint64_t cost = xDMVRCost(bd, pRefL0, refStrideL0, pRefL1, refStrideL1, width, height);
-      *(pSADsArray + sadOffset) = cost;
+      *(pSADsArray + sadOffset) = sads[nIdx] >> distortionShift;
     }
     if (*(pSADsArray + sadOffset) < minCost)
     {
@@ -679,12 +679,15 @@ void InterpolationFilter::filterVer( const ComponentID compID, Pel const *src, i
 void InterpolationFilter::initInterpolationFilter( bool enable )
 {
 #if ENABLE_SIMD_OPT_MCIF
-#ifdef TARGET_SIMD_X86
   if ( enable )
   {
+#ifdef TARGET_SIMD_X86
     initInterpolationFilterX86();
-  }
 #endif
+#ifdef TARGET_SIMD_VEC
+    initInterpolationFilterVec();
+#endif
+  }
 #endif
 }
 
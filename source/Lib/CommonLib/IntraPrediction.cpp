@@ -139,6 +139,25 @@ IntraPrediction::IntraPrediction()
 
   m_piTemp = nullptr;
   m_pMdlmTemp = nullptr;
+
+  m_xPredIntraPlanar                    = xPredIntraPlanar;
+  m_xPredIntraDc                        = xPredIntraDc;
+  m_xPredIntraAng[INTRA_ANG_INT_SLOPE]  = xPredIntraAngIntSlope;
+  m_xPredIntraAng[INTRA_ANG_LINEAR]     = xPredIntraAngLinear;
+  m_xPredIntraAng[INTRA_ANG_CUBIC]      = xPredIntraAngLuma<true>;
+  m_xPredIntraAng[INTRA_ANG_GAUSS]      = xPredIntraAngLuma<false>;
+  m_xIntraPdpc                          = xIntraPdpc;
+  m_xIntraPdpcDiagonal                  = xIntraPdpcDiagonal;
+  m_xIntraPdpcAngular                   = xIntraPdpcAngular;
+  m_xCclmDownsample[CCLM_DOWN_420]        = xCclmDownsample<CCLM_DOWN_420>;
+  m_xCclmDownsample[CCLM_DOWN_420_COLLOC] = xCclmDownsample<CCLM_DOWN_420_COLLOC>;
+  m_xCclmDownsample[CCLM_DOWN_422]        = xCclmDownsample<CCLM_DOWN_422>;
+
+#if ENABLE_SIMD_OPT_INTRAPRED
+#ifdef TARGET_SIMD_X86
+  initIntraPredictionX86();
+#endif
+#endif
 }
 
 IntraPrediction::~IntraPrediction()
@@ -315,76 +334,83 @@ void IntraPrediction::predIntraAng( const ComponentID compId, PelBuf &piPred, co
 
   switch (uiDirMode)
   {
-    case(PLANAR_IDX): xPredIntraPlanar(srcBuf, piPred); break;
-    case(DC_IDX):     xPredIntraDc(srcBuf, piPred, channelType, false); break;
+    case(PLANAR_IDX): m_xPredIntraPlanar(srcBuf, piPred); break;
+    case(DC_IDX):     m_xPredIntraDc(srcBuf, piPred); break;
 #if JVET_N0413_RDPCM
     case(BDPCM_IDX):  xPredIntraBDPCM(srcBuf, piPred, pu.cu->bdpcmMode, clpRng); break;
 #endif
     default:          xPredIntraAng(srcBuf, piPred, channelType, clpRng); break;
   }
 
-  if (m_ipaParam.applyPDPC)
+  if (m_ipaParam.applyPDPC && (uiDirMode == PLANAR_IDX || uiDirMode == DC_IDX || uiDirMode == HOR_IDX || uiDirMode == VER_IDX))
   {
-    PelBuf dstBuf = piPred;
     const int scale = ((g_aucLog2[iWidth] - 2 + g_aucLog2[iHeight] - 2 + 2) >> 2);
     CHECK(scale < 0 || scale > 31, "PDPC: scale < 0 || scale > 31");
 
-    if (uiDirMode == PLANAR_IDX)
+    m_xIntraPdpc(srcBuf, piPred, uiDirMode, scale, clpRng);
+  }
+}
+
+void IntraPrediction::xIntraPdpc(const CPelBuf &srcBuf, PelBuf &dstBuf, const uint32_t dirMode, const int scale, const ClpRng& clpRng)
+{
+  const int iWidth  = dstBuf.width;
+  const int iHeight = dstBuf.height;
+
+  if (dirMode == PLANAR_IDX)
+  {
+    for (int y = 0; y < iHeight; y++)
     {
-      for (int y = 0; y < iHeight; y++)
+      int wT = 32 >> std::min(31, ((y << 1) >> scale));
+      const Pel left = srcBuf.at(0, y + 1);
+      for (int x = 0; x < iWidth; x++)
       {
-        int wT = 32 >> std::min(31, ((y << 1) >> scale));
-        const Pel left = srcBuf.at(0, y + 1);
-        for (int x = 0; x < iWidth; x++)
-        {
-          const Pel top = srcBuf.at(x + 1, 0);
-          int wL = 32 >> std::min(31, ((x << 1) >> scale));
-          dstBuf.at(x, y) = ClipPel((wL * left + wT * top + (64 - wL - wT) * dstBuf.at(x, y) + 32) >> 6, clpRng);
-        }
+        const Pel top = srcBuf.at(x + 1, 0);
+        int wL = 32 >> std::min(31, ((x << 1) >> scale));
+        dstBuf.at(x, y) = ClipPel((wL * left + wT * top + (64 - wL - wT) * dstBuf.at(x, y) + 32) >> 6, clpRng);
       }
     }
-    else if (uiDirMode == DC_IDX)
+  }
+  else if (dirMode == DC_IDX)
+  {
+    const Pel topLeft = srcBuf.at(0, 0);
+    for (int y = 0; y < iHeight; y++)
     {
-      const Pel topLeft = srcBuf.at(0, 0);
-      for (int y = 0; y < iHeight; y++)
+      int wT = 32 >> std::min(31, ((y << 1) >> scale));
+      const Pel left = srcBuf.at(0, y + 1);
+      for (int x = 0; x < iWidth; x++)
       {
-        int wT = 32 >> std::min(31, ((y << 1) >> scale));
-        const Pel left = srcBuf.at(0, y + 1);
-        for (int x = 0; x < iWidth; x++)
-        {
-          const Pel top = srcBuf.at(x + 1, 0);
-          int wL = 32 >> std::min(31, ((x << 1) >> scale));
-          int wTL = (wL >> 4) + (wT >> 4);
-          dstBuf.at(x, y) = ClipPel((wL * left + wT * top - wTL * topLeft + (64 - wL - wT + wTL) * dstBuf.at(x, y) + 32) >> 6, clpRng);
-        }
+        const Pel top = srcBuf.at(x + 1, 0);
+        int wL = 32 >> std::min(31, ((x << 1) >> scale));
+        int wTL = (wL >> 4) + (wT >> 4);
+        dstBuf.at(x, y) = ClipPel((wL * left + wT * top - wTL * topLeft + (64 - wL - wT + wTL) * dstBuf.at(x, y) + 32) >> 6, clpRng);
       }
     }
-    else if (uiDirMode == HOR_IDX)
+  }
+  else if (dirMode == HOR_IDX)
+  {
+    const Pel topLeft = srcBuf.at(0, 0);
+    for (int y = 0; y < iHeight; y++)
     {
-      const Pel topLeft = srcBuf.at(0, 0);
-      for (int y = 0; y < iHeight; y++)
+      int wT = 32 >> std::min(31, ((y << 1) >> scale));
+      for (int x = 0; x < iWidth; x++)
       {
-        int wT = 32 >> std::min(31, ((y << 1) >> scale));
-        for (int x = 0; x < iWidth; x++)
-        {
-          const Pel top = srcBuf.at(x + 1, 0);
-          int wTL = wT;
-          dstBuf.at(x, y) = ClipPel((wT * top - wTL * topLeft + (64 - wT + wTL) * dstBuf.at(x, y) + 32) >> 6, clpRng);
-        }
+        const Pel top = srcBuf.at(x + 1, 0);
+        int wTL = wT;
+        dstBuf.at(x, y) = ClipPel((wT * top - wTL * topLeft + (64 - wT + wTL) * dstBuf.at(x, y) + 32) >> 6, clpRng);
       }
     }
-    else if (uiDirMode == VER_IDX)
+  }
+  else if (dirMode == VER_IDX)
+  {
+    const Pel topLeft = srcBuf.at(0, 0);
+    for (int y = 0; y < iHeight; y++)
     {
-      const Pel topLeft = srcBuf.at(0, 0);
-      for (int y = 0; y < iHeight; y++)
+      const Pel left = srcBuf.at(0, y + 1);
+      for (int x = 0; x < iWidth; x++)
       {
-        const Pel left = srcBuf.at(0, y + 1);
-        for (int x = 0; x < iWidth; x++)
-        {
-          int wL = 32 >> std::min(31, ((x << 1) >> scale));
-          int wTL = wL;
-          dstBuf.at(x, y) = ClipPel((wL * left - wTL * topLeft + (64 - wL + wTL) * dstBuf.at(x, y) + 32) >> 6, clpRng);
-        }
+        int wL = 32 >> std::min(31, ((x << 1) >> scale));
+        int wTL = wL;
+        dstBuf.at(x, y) = ClipPel((wL * left - wTL * topLeft + (64 - wL + wTL) * dstBuf.at(x, y) + 32) >> 6, clpRng);
       }
     }
   }
@@ -408,8 +434,7 @@ void IntraPrediction::predIntraChromaLM(const ComponentID compID, PelBuf &piPred
   xGetLMParameters(pu, compID, chromaArea, a, b, iShift);
 
   ////// final prediction
-  piPred.copyFrom(Temp);
-  piPred.linearTransform(a, iShift, b, true, pu.cs->slice->clpRng(compID));
+  piPred.linearTransform(Temp, a, iShift, b, true, pu.cs->slice->clpRng(compID));
 }
 
 /** Function for deriving planar intra prediction. This function derives the prediction samples for planar mode (intra coding).
@@ -471,7 +496,7 @@ void IntraPrediction::xPredIntraPlanar( const CPelBuf &pSrc, PelBuf &pDst )
   }
 }
 
-void IntraPrediction::xPredIntraDc( const CPelBuf &pSrc, PelBuf &pDst, const ChannelType channelType, const bool enableBoundaryFilter )
+void IntraPrediction::xPredIntraDc( const CPelBuf &pSrc, PelBuf &pDst )
 {
   const Pel dcval = xGetPredValDc( pSrc, pDst );
   pDst.fill( dcval );
@@ -667,127 +692,149 @@ void IntraPrediction::xPredIntraAng( const CPelBuf &pSrc, PelBuf &pDst, const Ch
   refMain += multiRefIdx;
   refSide += multiRefIdx;
 
-  if( intraPredAngle == 0 )  // pure vertical or pure horizontal
+  // select the interpolation kernel, pure vertical and pure horizontal are handled as integer slopes
+  const IntraAngKernel kernel = isIntegerSlope( abs( intraPredAngle ) ) ? INTRA_ANG_INT_SLOPE
+                              : !isLuma( channelType )                  ? INTRA_ANG_LINEAR
+                              : m_ipaParam.interpolationFlag            ? INTRA_ANG_GAUSS
+                              :                                           INTRA_ANG_CUBIC;
+
+  m_xPredIntraAng[kernel]( pDstBuf, dstStride, refMain, width, height, intraPredAngle * ( 1 + multiRefIdx ), intraPredAngle, clpRng );
+
+  if( intraPredAngle != 0 && m_ipaParam.applyPDPC )
+  {
+    const int scale = ((g_aucLog2[width] - 2 + g_aucLog2[height] - 2 + 2) >> 2);
+    CHECK(scale < 0 || scale > 31, "PDPC: scale < 0 || scale > 31");
+
+    if (intraPredAngle == 32) // intra prediction modes: 2 and VDIA
+    {
+      m_xIntraPdpcDiagonal( pDstBuf, dstStride, refMain, refSide, width, height, scale, clpRng );
+    }
+    else
+    {
+      m_xIntraPdpcAngular( pDstBuf, dstStride, refSide, width, height, scale, invAngle, bIsModeVer ? m_leftRefLength : m_topRefLength, clpRng );
+    }
+  }
+
+  // Flip the block if this is the horizontal mode
+  if( !bIsModeVer )
   {
     for( int y = 0; y < height; y++ )
     {
       for( int x = 0; x < width; x++ )
       {
-        pDstBuf[y*dstStride + x] = refMain[x + 1];
+        pDst.at( y, x ) = pDstBuf[x];
       }
+      pDstBuf += dstStride;
     }
   }
-  else
+}
+
+void IntraPrediction::xPredIntraAngIntSlope( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng )
+{
+  for( int y = 0; y < height; y++, deltaPos += intraPredAngle, pDst += dstStride )
   {
-    Pel *pDsty=pDstBuf;
-    for (int y = 0, deltaPos = intraPredAngle * (1 + multiRefIdx); y<height; y++, deltaPos += intraPredAngle, pDsty += dstStride)
+    const int deltaInt = deltaPos >> 5;
+
+    // Just copy the integer samples
+    for( int x = 0; x < width; x++ )
     {
-      const int deltaInt   = deltaPos >> 5;
-      const int deltaFract = deltaPos & (32 - 1);
+      pDst[x] = refMain[x + deltaInt + 1];
+    }
+  }
+}
 
-      if ( !isIntegerSlope( abs(intraPredAngle) ) )
-      {
-        if( isLuma(channelType) )
-        {
-          Pel                        p[4];
-          const bool                 useCubicFilter = !m_ipaParam.interpolationFlag;
-          TFilterCoeff const * const f              = (useCubicFilter) ? InterpolationFilter::getChromaFilterTable(deltaFract) : g_intraGaussFilter[deltaFract];
+void IntraPrediction::xPredIntraAngLinear( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng )
+{
+  for( int y = 0; y < height; y++, deltaPos += intraPredAngle, pDst += dstStride )
+  {
+    const int deltaInt   = deltaPos >> 5;
+    const int deltaFract = deltaPos & (32 - 1);
 
-          int         refMainIndex   = deltaInt + 1;
+    // Do linear filtering
+    const Pel *pRM = refMain + deltaInt + 1;
+    int lastRefMainPel = *pRM++;
+    for( int x = 0; x < width; pRM++, x++ )
+    {
+      int thisRefMainPel = *pRM;
+      pDst[x + 0] = ( Pel ) ( ( ( 32 - deltaFract )*lastRefMainPel + deltaFract*thisRefMainPel + 16 ) >> 5 );
+      lastRefMainPel = thisRefMainPel;
+    }
+  }
+}
 
-          for( int x = 0; x < width; x++, refMainIndex++ )
-          {
-            p[0] = refMain[refMainIndex - 1];
-            p[1] = refMain[refMainIndex];
-            p[2] = refMain[refMainIndex + 1];
-            p[3] = f[3] != 0 ? refMain[refMainIndex + 2] : 0;
+template<bool useCubicFilter>
+void IntraPrediction::xPredIntraAngLuma( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng )
+{
+  for( int y = 0; y < height; y++, deltaPos += intraPredAngle, pDst += dstStride )
+  {
+    const int deltaInt   = deltaPos >> 5;
+    const int deltaFract = deltaPos & (32 - 1);
 
-            pDstBuf[y*dstStride + x] = static_cast<Pel>((static_cast<int>(f[0] * p[0]) + static_cast<int>(f[1] * p[1]) + static_cast<int>(f[2] * p[2]) + static_cast<int>(f[3] * p[3]) + 32) >> 6);
+    Pel                        p[4];
+    TFilterCoeff const * const f              = (useCubicFilter) ? InterpolationFilter::getChromaFilterTable(deltaFract) : g_intraGaussFilter[deltaFract];
 
-            if( useCubicFilter ) // only cubic filter has negative coefficients and requires clipping
-            {
-              pDstBuf[y*dstStride + x] = ClipPel( pDstBuf[y*dstStride + x], clpRng );
-            }
-          }
-        }
-        else
-        {
-          // Do linear filtering
-          const Pel *pRM = refMain + deltaInt + 1;
-          int lastRefMainPel = *pRM++;
-          for( int x = 0; x < width; pRM++, x++ )
-          {
-            int thisRefMainPel = *pRM;
-            pDsty[x + 0] = ( Pel ) ( ( ( 32 - deltaFract )*lastRefMainPel + deltaFract*thisRefMainPel + 16 ) >> 5 );
-            lastRefMainPel = thisRefMainPel;
-          }
-        }
-      }
-      else
-      {
-        // Just copy the integer samples
-        for( int x = 0; x < width; x++ )
-        {
-          pDsty[x] = refMain[x + deltaInt + 1];
-        }
-      }
-      const int scale = ((g_aucLog2[width] - 2 + g_aucLog2[height] - 2 + 2) >> 2);
-      CHECK(scale < 0 || scale > 31, "PDPC: scale < 0 || scale > 31");
-      if (m_ipaParam.applyPDPC)
-      {
-        if (m_ipaParam.intraPredAngle == 32) // intra prediction modes: 2 and VDIA
-        {
-          int wT = 16 >> std::min(31, ((y << 1) >> scale));
+    int         refMainIndex   = deltaInt + 1;
 
-          for (int x = 0; x < width; x++)
-          {
-            int wL = 16 >> std::min(31, ((x << 1) >> scale));
-            if (wT + wL == 0) break;
+    for( int x = 0; x < width; x++, refMainIndex++ )
+    {
+      p[0] = refMain[refMainIndex - 1];
+      p[1] = refMain[refMainIndex];
+      p[2] = refMain[refMainIndex + 1];
+      p[3] = f[3] != 0 ? refMain[refMainIndex + 2] : 0;
 
-            int c = x + y + 1;
-            if (c >= 2 * height) { wL = 0; }
-            if (c >= 2 * width)  { wT = 0; }
-            const Pel left = (wL != 0) ? refSide[c + 1] : 0;
-            const Pel top  = (wT != 0) ? refMain[c + 1] : 0;
+      pDst[x] = static_cast<Pel>((static_cast<int>(f[0] * p[0]) + static_cast<int>(f[1] * p[1]) + static_cast<int>(f[2] * p[2]) + static_cast<int>(f[3] * p[3]) + 32) >> 6);
 
-            pDsty[x] = ClipPel((wL * left + wT * top + (64 - wL - wT) * pDsty[x] + 32) >> 6, clpRng);
-          }
-        }
-        else
-        {
-          int invAngleSum0 = 2;
-          for (int x = 0; x < width; x++)
-          {
-            invAngleSum0 += invAngle;
-            int deltaPos0 = invAngleSum0 >> 2;
-            int deltaFrac0 = deltaPos0 & 63;
-            int deltaInt0 = deltaPos0 >> 6;
+      if( useCubicFilter ) // only cubic filter has negative coefficients and requires clipping
+      {
+        pDst[x] = ClipPel( pDst[x], clpRng );
+      }
+    }
+  }
+}
+
+void IntraPrediction::xIntraPdpcDiagonal( Pel* pDst, const int dstStride, const Pel* refMain, const Pel* refSide, const int width, const int height, const int scale, const ClpRng& clpRng )
+{
+  for( int y = 0; y < height; y++, pDst += dstStride )
+  {
+    int wT = 16 >> std::min(31, ((y << 1) >> scale));
 
-            int deltay = y + deltaInt0 + 1;
-            if (deltay >(bIsModeVer ? m_leftRefLength : m_topRefLength) - 1) break;
+    for (int x = 0; x < width; x++)
+    {
+      int wL = 16 >> std::min(31, ((x << 1) >> scale));
+      if (wT + wL == 0) break;
 
-            int wL = 32 >> std::min(31, ((x << 1) >> scale));
-            if (wL == 0) break;
-            Pel *p = refSide + deltay;
+      int c = x + y + 1;
+      if (c >= 2 * height) { wL = 0; }
+      if (c >= 2 * width)  { wT = 0; }
+      const Pel left = (wL != 0) ? refSide[c + 1] : 0;
+      const Pel top  = (wT != 0) ? refMain[c + 1] : 0;
 
-            Pel left = p[deltaFrac0 >> 5];
-            pDsty[x] = ClipPel((wL * left + (64 - wL) * pDsty[x] + 32) >> 6, clpRng);
-          }
-        }
-      }
+      pDst[x] = ClipPel((wL * left + wT * top + (64 - wL - wT) * pDst[x] + 32) >> 6, clpRng);
     }
   }
+}
 
-  // Flip the block if this is the horizontal mode
-  if( !bIsModeVer )
+void IntraPrediction::xIntraPdpcAngular( Pel* pDst, const int dstStride, const Pel* refSide, const int width, const int height, const int scale, const int invAngle, const int refSideLength, const ClpRng& clpRng )
+{
+  for( int y = 0; y < height; y++, pDst += dstStride )
   {
-    for( int y = 0; y < height; y++ )
+    int invAngleSum0 = 2;
+    for (int x = 0; x < width; x++)
     {
-      for( int x = 0; x < width; x++ )
-      {
-        pDst.at( y, x ) = pDstBuf[x];
-      }
-      pDstBuf += dstStride;
+      invAngleSum0 += invAngle;
+      int deltaPos0 = invAngleSum0 >> 2;
+      int deltaFrac0 = deltaPos0 & 63;
+      int deltaInt0 = deltaPos0 >> 6;
+
+      int deltay = y + deltaInt0 + 1;
+      if (deltay > refSideLength - 1) break;
+
+      int wL = 32 >> std::min(31, ((x << 1) >> scale));
+      if (wL == 0) break;
+      const Pel *p = refSide + deltay;
+
+      Pel left = p[deltaFrac0 >> 5];
+      pDst[x] = ClipPel((wL * left + (64 - wL) * pDst[x] + 32) >> 6, clpRng);
     }
   }
 }
@@ -1498,6 +1545,40 @@ int isBelowLeftAvailable(const CodingUnit &cu, const ChannelType &chType, const
 }
 
 // LumaRecPixels
+template<CclmDownsampleKernel kernel>
+void IntraPrediction::xCclmDownsample( const Pel* pRec, const int recStride, Pel* pDst, const int dstStride, const int width, const int height )
+{
+  const int recStride2 = kernel == CCLM_DOWN_422 ? recStride : recStride << 1;
+
+  for( int y = 0; y < height; y++ )
+  {
+    for( int x = 0; x < width; x++ )
+    {
+      const Pel* piSrc = pRec + 2 * x;
+
+      if( kernel == CCLM_DOWN_420 )
+      {
+        pDst[x] = ( piSrc[0]             * 2 + piSrc[1]             + piSrc[-1]
+                  + piSrc[recStride]     * 2 + piSrc[1 + recStride] + piSrc[-1 + recStride]
+                  + 4 ) >> 3;
+      }
+      else if( kernel == CCLM_DOWN_420_COLLOC )
+      {
+        pDst[x] = ( piSrc[-recStride]
+                  + piSrc[0] * 4 + piSrc[-1] + piSrc[1]
+                  + piSrc[recStride]
+                  + 4 ) >> 3;
+      }
+      else
+      {
+        pDst[x] = ( piSrc[0] * 2 + piSrc[-1] + piSrc[1] + 2 ) >> 2;
+      }
+    }
+    pDst += dstStride;
+    pRec += recStride2;
+  }
+}
+
 void IntraPrediction::xGetLumaRecPixels(const PredictionUnit &pu, CompArea chromaArea)
 {
   int iDstStride = 0;
@@ -1800,6 +1881,53 @@ void IntraPrediction::xGetLumaRecPixels(const PredictionUnit &pu, CompArea chrom
   }
 
   // inner part from reconstructed picture buffer
+#if JVET_N0671_CCLM
+  const bool isCollocated = pu.cs->sps->getCclmCollocatedChromaFlag();
+
+  if( CHROMA_420 == pu.chromaFormat || ( CHROMA_422 == pu.chromaFormat && !isCollocated ) )
+  {
+    const CclmDownsampleKernel kernel = CHROMA_422 == pu.chromaFormat ? CCLM_DOWN_422 : isCollocated ? CCLM_DOWN_420_COLLOC : CCLM_DOWN_420;
+
+    m_xCclmDownsample[kernel]( pRecSrc0, iRecStride, pDst0, iDstStride, uiCWidth, uiCHeight );
+
+    // samples at the block boundary without available neighbours use the shorter filters
+    if( isCollocated )
+    {
+      if( !bAboveAvaillable )
+      {
+        for( int i = bLeftAvaillable ? 0 : 1; i < uiCWidth; i++ )
+        {
+          pDst0[i] = (pRecSrc0[mult * i] * c0_3tap + pRecSrc0[mult * i - 1] * c1_3tap + pRecSrc0[mult * i + 1] * c2_3tap + offset_3tap) >> shift_3tap;
+        }
+      }
+      if( !bLeftAvaillable )
+      {
+        for( int j = 0; j < uiCHeight; j++ )
+        {
+          const Pel* piRec = pRecSrc0 + j * iRecStride2;
+          if( j == 0 && !bAboveAvaillable )
+          {
+            pDst0[0] = piRec[0];
+          }
+          else
+          {
+            pDst0[j * iDstStride] = (piRec[0] * c0_3tap + piRec[-strOffset] * c1_3tap + piRec[strOffset] * c2_3tap + offset_3tap) >> shift_3tap;
+          }
+        }
+      }
+    }
+    else if( !bLeftAvaillable )
+    {
+      for( int j = 0; j < uiCHeight; j++ )
+      {
+        const Pel* piRec = pRecSrc0 + j * iRecStride2;
+        pDst0[j * iDstStride] = (piRec[0] * c0_2tap + piRec[strOffset] * c1_2tap + offset_2tap) >> shift_2tap;
+      }
+    }
+    return;
+  }
+#endif //JVET_N0671_CCLM
+
   for( int j = 0; j < uiCHeight; j++ )
   {
     for( int i = 0; i < uiCWidth; i++ )
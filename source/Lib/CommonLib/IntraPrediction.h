@@ -65,6 +65,27 @@ enum PredBuf
 
 static const uint32_t MAX_INTRA_FILTER_DEPTHS=8;
 
+extern const TFilterCoeff g_intraGaussFilter[32][4];
+
+/// interpolation kernels of the angular intra prediction
+enum IntraAngKernel
+{
+  INTRA_ANG_INT_SLOPE = 0,  ///< integer slope, the reference samples are copied
+  INTRA_ANG_LINEAR,         ///< 2-tap linear interpolation (chroma)
+  INTRA_ANG_CUBIC,          ///< 4-tap cubic interpolation (luma)
+  INTRA_ANG_GAUSS,          ///< 4-tap Gaussian interpolation (luma, interpolationFlag)
+  NUM_INTRA_ANG_KERNELS
+};
+
+/// luma downsampling filters of the cross-component linear model (inner samples of the block)
+enum CclmDownsampleKernel
+{
+  CCLM_DOWN_420 = 0,        ///< 4:2:0, 6-tap over two luma rows
+  CCLM_DOWN_420_COLLOC,     ///< 4:2:0 with collocated chroma, 5-tap cross
+  CCLM_DOWN_422,            ///< 4:2:2, horizontal 3-tap
+  NUM_CCLM_DOWN_KERNELS
+};
+
 class IntraPrediction
 {
 private:
@@ -116,10 +137,41 @@ protected:
   int m_topRefLength;
   int m_leftRefLength;
   // prediction
-  void xPredIntraPlanar           ( const CPelBuf &pSrc, PelBuf &pDst );
-  void xPredIntraDc               ( const CPelBuf &pSrc, PelBuf &pDst, const ChannelType channelType, const bool enableBoundaryFilter = true );
+  static void xPredIntraPlanar    ( const CPelBuf &pSrc, PelBuf &pDst );
+  static void xPredIntraDc        ( const CPelBuf &pSrc, PelBuf &pDst );
   void xPredIntraAng              ( const CPelBuf &pSrc, PelBuf &pDst, const ChannelType channelType, const ClpRng& clpRng);
 
+  // angular interpolation, one kernel per IntraAngKernel
+  static void xPredIntraAngIntSlope( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng );
+  static void xPredIntraAngLinear  ( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng );
+  template<bool useCubicFilter>
+  static void xPredIntraAngLuma    ( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng );
+
+  // position dependent prediction combination
+  static void xIntraPdpc          ( const CPelBuf &pSrc, PelBuf &pDst, const uint32_t dirMode, const int scale, const ClpRng& clpRng );
+  static void xIntraPdpcDiagonal  ( Pel* pDst, const int dstStride, const Pel* refMain, const Pel* refSide, const int width, const int height, const int scale, const ClpRng& clpRng );
+  static void xIntraPdpcAngular   ( Pel* pDst, const int dstStride, const Pel* refSide, const int width, const int height, const int scale, const int invAngle, const int refSideLength, const ClpRng& clpRng );
+
+  // cross-component luma downsampling, one kernel per CclmDownsampleKernel
+  template<CclmDownsampleKernel kernel>
+  static void xCclmDownsample     ( const Pel* pRec, const int recStride, Pel* pDst, const int dstStride, const int width, const int height );
+
+  void ( *m_xPredIntraPlanar )    ( const CPelBuf &pSrc, PelBuf &pDst );
+  void ( *m_xPredIntraDc )        ( const CPelBuf &pSrc, PelBuf &pDst );
+  void ( *m_xPredIntraAng[NUM_INTRA_ANG_KERNELS] )( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng );
+  void ( *m_xIntraPdpc )          ( const CPelBuf &pSrc, PelBuf &pDst, const uint32_t dirMode, const int scale, const ClpRng& clpRng );
+  void ( *m_xIntraPdpcDiagonal )  ( Pel* pDst, const int dstStride, const Pel* refMain, const Pel* refSide, const int width, const int height, const int scale, const ClpRng& clpRng );
+  void ( *m_xIntraPdpcAngular )   ( Pel* pDst, const int dstStride, const Pel* refSide, const int width, const int height, const int scale, const int invAngle, const int refSideLength, const ClpRng& clpRng );
+  void ( *m_xCclmDownsample[NUM_CCLM_DOWN_KERNELS] )( const Pel* pRec, const int recStride, Pel* pDst, const int dstStride, const int width, const int height );
+
+#if ENABLE_SIMD_OPT_INTRAPRED
+#ifdef TARGET_SIMD_X86
+  void initIntraPredictionX86();
+  template <X86_VEXT vext>
+  void _initIntraPredictionX86();
+#endif
+#endif
+
   void initPredIntraParams        ( const PredictionUnit & pu,  const CompArea compArea, const SPS& sps );
 
 #if JVET_N0435_WAIP_HARMONIZATION
@@ -131,7 +183,7 @@ protected:
 #if JVET_N0413_RDPCM
   void xPredIntraBDPCM            ( const CPelBuf &pSrc, PelBuf &pDst, const uint32_t dirMode, const ClpRng& clpRng );
 #endif
-  Pel  xGetPredValDc              ( const CPelBuf &pSrc, const Size &dstSize );
+  static Pel xGetPredValDc        ( const CPelBuf &pSrc, const Size &dstSize );
 
   void xFillReferenceSamples      ( const CPelBuf &recoBuf,      Pel* refBufUnfiltered, const CompArea &area, const CodingUnit &cu );
   void xFilterReferenceSamples    ( const Pel* refBufUnfiltered, Pel* refBufFiltered, const CompArea &area, const SPS &sps
@@ -101,6 +101,14 @@ static bool isAvailableAbove( const CodingUnit& cu, const CodingUnit& cu2, const
 
 LoopFilter::LoopFilter()
 {
+  m_filterLumaSegment   = xFilterLumaSegment;
+  m_filterChromaSegment = xFilterChromaSegment;
+
+#if ENABLE_SIMD_DBLF
+#ifdef TARGET_SIMD_X86
+  initLoopFilterX86();
+#endif
+#endif
 }
 
 LoopFilter::~LoopFilter()
@@ -168,91 +176,74 @@ void LoopFilter::loopFilterPic( CodingStructure& cs
 
   for( int y = 0; y < pcv.heightInCtus; y++ )
   {
-    for( int x = 0; x < pcv.widthInCtus; x++ )
-    {
-      memset( m_aapucBS       [EDGE_VER].data(), 0,     m_aapucBS       [EDGE_VER].byte_size() );
-      memset( m_aapbEdgeFilter[EDGE_VER].data(), false, m_aapbEdgeFilter[EDGE_VER].byte_size() );
-#if JVET_N0473_DEBLOCK_INTERNAL_TRANSFORM_BOUNDARIES
-      memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
-      memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
-      memset( m_transformEdge, false, sizeof(m_transformEdge) );
-      m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
-      m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
-#endif
+    loopFilterCtuRow( cs, y, EDGE_VER );
+  }
 
-      const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
+  // Vertical filtering
+  for( int y = 0; y < pcv.heightInCtus; y++ )
+  {
+    loopFilterCtuRow( cs, y, EDGE_HOR );
+  }
 
-      // CU-based deblocking
-      for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_L ), CH_L ) )
-      {
-        xDeblockCU( currCU, EDGE_VER );
-      }
+  DTRACE_PIC_COMP(D_REC_CB_LUMA_LF,   cs, cs.getRecoBuf(), COMPONENT_Y);
+  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cb);
+  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cr);
 
-      if( CS::isDualITree( cs ) )
-      {
-        memset( m_aapucBS       [EDGE_VER].data(), 0,     m_aapucBS       [EDGE_VER].byte_size() );
-        memset( m_aapbEdgeFilter[EDGE_VER].data(), false, m_aapbEdgeFilter[EDGE_VER].byte_size() );
+  DTRACE    ( g_trace_ctx, D_CRC, "LoopFilter" );
+  DTRACE_CRC( g_trace_ctx, D_CRC, cs, cs.getRecoBuf() );
+}
+
+/**
+ - call deblocking function for every CU of a CTU row, for the edges of one direction
+ .
+ \param  cs       coding structure of the picture
+ \param  ctuRow   CTU row to be deblocked
+ \param  edgeDir  direction of the edges to be filtered
+ */
+void LoopFilter::loopFilterCtuRow( CodingStructure& cs, const int ctuRow, const DeblockEdgeDir edgeDir )
+{
+  const PreCalcValues& pcv = *cs.pcv;
 #if JVET_N0473_DEBLOCK_INTERNAL_TRANSFORM_BOUNDARIES
-        memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
-        memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
-        memset( m_transformEdge, false, sizeof(m_transformEdge) );
+  m_shiftHor = ::getComponentScaleX( COMPONENT_Cb, cs.pcv->chrFormat );
+  m_shiftVer = ::getComponentScaleY( COMPONENT_Cb, cs.pcv->chrFormat );
 #endif
 
-        for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_C ), CH_C ) )
-        {
-          xDeblockCU( currCU, EDGE_VER );
-        }
-      }
+  for( int x = 0; x < pcv.widthInCtus; x++ )
+  {
+    memset( m_aapucBS       [edgeDir].data(), 0,     m_aapucBS       [edgeDir].byte_size() );
+    memset( m_aapbEdgeFilter[edgeDir].data(), false, m_aapbEdgeFilter[edgeDir].byte_size() );
+#if JVET_N0473_DEBLOCK_INTERNAL_TRANSFORM_BOUNDARIES
+    memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
+    memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
+    memset( m_transformEdge, false, sizeof(m_transformEdge) );
+    m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
+    m_ctuYLumaSamples = ctuRow << pcv.maxCUHeightLog2;
+#endif
+
+    const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, ctuRow << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
+
+    // CU-based deblocking
+    for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_L ), CH_L ) )
+    {
+      xDeblockCU( currCU, edgeDir );
     }
-  }
 
-  // Vertical filtering
-  for( int y = 0; y < pcv.heightInCtus; y++ )
-  {
-    for( int x = 0; x < pcv.widthInCtus; x++ )
+    if( CS::isDualITree( cs ) )
     {
-      memset( m_aapucBS       [EDGE_HOR].data(), 0,     m_aapucBS       [EDGE_HOR].byte_size() );
-      memset( m_aapbEdgeFilter[EDGE_HOR].data(), false, m_aapbEdgeFilter[EDGE_HOR].byte_size() );
+      memset( m_aapucBS       [edgeDir].data(), 0,     m_aapucBS       [edgeDir].byte_size() );
+      memset( m_aapbEdgeFilter[edgeDir].data(), false, m_aapbEdgeFilter[edgeDir].byte_size() );
 #if JVET_N0473_DEBLOCK_INTERNAL_TRANSFORM_BOUNDARIES
       memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
       memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
       memset( m_transformEdge, false, sizeof(m_transformEdge) );
-      m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
-      m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
 #endif
 
-      const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
-
-      // CU-based deblocking
-      for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_L ), CH_L ) )
+      for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_C ), CH_C ) )
       {
-        xDeblockCU( currCU, EDGE_HOR );
-      }
-
-      if( CS::isDualITree( cs ) )
-      {
-        memset( m_aapucBS       [EDGE_HOR].data(), 0,     m_aapucBS       [EDGE_HOR].byte_size() );
-        memset( m_aapbEdgeFilter[EDGE_HOR].data(), false, m_aapbEdgeFilter[EDGE_HOR].byte_size() );
-#if JVET_N0473_DEBLOCK_INTERNAL_TRANSFORM_BOUNDARIES
-        memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
-        memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
-        memset( m_transformEdge, false, sizeof(m_transformEdge) );
-#endif
-
-        for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_C ), CH_C ) )
-        {
-          xDeblockCU( currCU, EDGE_HOR );
-        }
+        xDeblockCU( currCU, edgeDir );
       }
     }
   }
-
-  DTRACE_PIC_COMP(D_REC_CB_LUMA_LF,   cs, cs.getRecoBuf(), COMPONENT_Y);
-  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cb);
-  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cr);
-
-  DTRACE    ( g_trace_ctx, D_CRC, "LoopFilter" );
-  DTRACE_CRC( g_trace_ctx, D_CRC, cs, cs.getRecoBuf() );
 }
 
 
@@ -1187,118 +1178,26 @@ void LoopFilter::xEdgeFilterLuma(const CodingUnit& cu, const DeblockEdgeDir edge
 
       const int iTc       = sm_tcTable  [iIndexTC] * iBitdepthScale;
       const int iBeta     = sm_betaTable[iIndexB ] * iBitdepthScale;
-      const int iSideThreshold = ( iBeta + ( iBeta >> 1 ) ) >> 3;
-      const int iThrCut   = iTc * 10;
+
+      bPartPNoFilter = bPartQNoFilter = false;
+      if( bPCMFilter )
+      {
+        // Check if each of PUs is I_PCM with LF disabling
+        bPartPNoFilter = cuP.ipcm;
+        bPartQNoFilter = cuQ.ipcm;
+      }
+      if( ppsTransquantBypassEnabledFlag )
+      {
+        // check if each of PUs is lossless coded
+        bPartPNoFilter = bPartPNoFilter || cuP.transQuantBypass;
+        bPartQNoFilter = bPartQNoFilter || cuQ.transQuantBypass;
+      }
 
       const unsigned uiBlocksInPart = pelsInPart / 4 ? pelsInPart / 4 : 1;
 
       for( int iBlkIdx = 0; iBlkIdx < uiBlocksInPart; iBlkIdx++ )
       {
-        const int dp0 = xCalcDP(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 0), iOffset);
-        const int dq0 = xCalcDQ(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 0), iOffset);
-        const int dp3 = xCalcDP(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 3), iOffset);
-        const int dq3 = xCalcDQ(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 3), iOffset);
-        int dp0L = dp0;
-        int dq0L = dq0;
-        int dp3L = dp3;
-        int dq3L = dq3;
-
-        if (sidePisLarge)
-        {
-          dp0L = (dp0L + xCalcDP(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 0) - 3 * iOffset, iOffset) + 1) >> 1;
-          dp3L = (dp3L + xCalcDP(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 3) - 3 * iOffset, iOffset) + 1) >> 1;
-        }
-        if (sideQisLarge)
-        {
-          dq0L = (dq0L + xCalcDQ(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 0) + 3 * iOffset, iOffset) + 1) >> 1;
-          dq3L = (dq3L + xCalcDQ(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 3) + 3 * iOffset, iOffset) + 1) >> 1;
-        }
-        bool useLongtapFilter = false;
-        if (sidePisLarge || sideQisLarge)
-        {
-          int d0L = dp0L + dq0L;
-          int d3L = dp3L + dq3L;
-
-          int dpL = dp0L + dp3L;
-          int dqL = dq0L + dq3L;
-
-          int dL = d0L + d3L;
-
-          bPartPNoFilter = bPartQNoFilter = false;
-          if (bPCMFilter)
-          {
-            // Check if each of PUs is I_PCM with LF disabling
-            bPartPNoFilter = cuP.ipcm;
-            bPartQNoFilter = cuQ.ipcm;
-          }
-          if (ppsTransquantBypassEnabledFlag)
-          {
-            // check if each of PUs is lossless coded
-            bPartPNoFilter = bPartPNoFilter || cuP.transQuantBypass;
-            bPartQNoFilter = bPartQNoFilter || cuQ.transQuantBypass;
-          }
-
-          if (dL < iBeta)
-          {
-            const bool filterP = (dpL < iSideThreshold);
-            const bool filterQ = (dqL < iSideThreshold);
-
-            Pel* src0 = piTmpSrc + iSrcStep * (iIdx*pelsInPart + iBlkIdx * 4 + 0);
-            Pel* src3 = piTmpSrc + iSrcStep * (iIdx*pelsInPart + iBlkIdx * 4 + 3);
-
-            // adjust decision so that it is not read beyond p5 is maxFilterLengthP is 5 and q5 if maxFilterLengthQ is 5
-            const bool swL = xUseStrongFiltering(src0, iOffset, 2 * d0L, iBeta, iTc, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ)
-              && xUseStrongFiltering(src3, iOffset, 2 * d3L, iBeta, iTc, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ);
-            if (swL)
-            {
-              useLongtapFilter = true;
-              for (int i = 0; i < DEBLOCK_SMALLEST_BLOCK / 2; i++)
-              {
-                xPelFilterLuma(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + i), iOffset, iTc, swL, bPartPNoFilter, bPartQNoFilter, iThrCut, filterP, filterQ, clpRng, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ);
-              }
-            }
-
-          }
-        }
-        if (!useLongtapFilter)
-        {
-        const int d0 = dp0 + dq0;
-        const int d3 = dp3 + dq3;
-
-        const int dp = dp0 + dp3;
-        const int dq = dq0 + dq3;
-        const int d  = d0  + d3;
-
-        bPartPNoFilter = bPartQNoFilter = false;
-        if( bPCMFilter )
-        {
-          // Check if each of PUs is I_PCM with LF disabling
-          bPartPNoFilter = cuP.ipcm;
-          bPartQNoFilter = cuQ.ipcm;
-        }
-        if( ppsTransquantBypassEnabledFlag )
-        {
-          // check if each of PUs is lossless coded
-          bPartPNoFilter = bPartPNoFilter || cuP.transQuantBypass;
-          bPartQNoFilter = bPartQNoFilter || cuQ.transQuantBypass;
-        }
-
-        if( d < iBeta )
-        {
-          const bool bFilterP = (dp < iSideThreshold);
-          const bool bFilterQ = (dq < iSideThreshold);
-          bool sw = false;
-          if (maxFilterLengthP > 2 && maxFilterLengthQ > 2)
-          {
-            sw = xUseStrongFiltering(piTmpSrc + iSrcStep * (iIdx*pelsInPart + iBlkIdx * 4 + 0), iOffset, 2 * d0, iBeta, iTc)
-              && xUseStrongFiltering(piTmpSrc + iSrcStep * (iIdx*pelsInPart + iBlkIdx * 4 + 3), iOffset, 2 * d3, iBeta, iTc);
-          }
-          for( int i = 0; i < DEBLOCK_SMALLEST_BLOCK / 2; i++ )
-          {
-            xPelFilterLuma( piTmpSrc + iSrcStep*( iIdx*pelsInPart + iBlkIdx * 4 + i ), iOffset, iTc, sw, bPartPNoFilter, bPartQNoFilter, iThrCut, bFilterP, bFilterQ, clpRng );
-          }
-        }
-        }
+        m_filterLumaSegment( piTmpSrc + iSrcStep*( iIdx*pelsInPart + iBlkIdx * 4 ), iSrcStep, iOffset, iTc, iBeta, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ, bPartPNoFilter, bPartQNoFilter, clpRng );
       }
     }
   }
@@ -1472,47 +1371,153 @@ void LoopFilter::xEdgeFilterChroma(const CodingUnit& cu, const DeblockEdgeDir ed
         const int iIndexTC = Clip3<int>(0, MAX_QP + DEFAULT_INTRA_TC_OFFSET, iQP + DEFAULT_INTRA_TC_OFFSET * (bS[chromaIdx] - 1) + (tcOffsetDiv2 << 1));
         const int iTc      = sm_tcTable[iIndexTC] * iBitdepthScale;
 
-        bool useLongFilter = false;
+        int beta = 0;
         if (largeBoundary)
         {
-        const int indexB = Clip3<int>(0, MAX_QP, iQP + (betaOffsetDiv2 << 1));
-        const int beta = sm_betaTable[indexB] * iBitdepthScale;
+          const int indexB = Clip3<int>(0, MAX_QP, iQP + (betaOffsetDiv2 << 1));
+          beta = sm_betaTable[indexB] * iBitdepthScale;
+        }
 
-        const int dp0 = xCalcDP(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 0), iOffset);
-        const int dq0 = xCalcDQ(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 0), iOffset);
-        const int dp1 = xCalcDP(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 1), iOffset);
-        const int dq1 = xCalcDQ(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 1), iOffset);
+        m_filterChromaSegment( piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength), iSrcStep, iOffset, uiLoopLength, iTc, beta, largeBoundary, bPartPNoFilter, bPartQNoFilter, clpRng );
+        }
+      }
+    }
+  }
+}
 
-        const int d0 = dp0 + dq0;
-        const int d1 = dp1 + dq1;
-        const int d = d0 + d1;
 
-          if (d < beta)
-          {
-            useLongFilter = true;
-            const bool sw = xUseStrongFiltering(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 0), iOffset, 2 * d0, beta, iTc)
-                && xUseStrongFiltering(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 1), iOffset, 2 * d1, beta, iTc);
 
-            for (unsigned step = 0; step < uiLoopLength; step++)
-            {
-              xPelFilterChroma(piTmpSrcChroma + iSrcStep*(step + iIdx*uiLoopLength), iOffset, iTc, sw, bPartPNoFilter, bPartQNoFilter, clpRng, largeBoundary);
-            }
-          }
-        }
-        if ( !useLongFilter )
+/**
+ - Deblocking of one 4-line luma edge segment: filter decisions and filtering
+ .
+ \param piSrc           pointer to the first Q sample of the segment
+ \param iSrcStep        step between the lines of the segment
+ \param iOffset         offset across the edge
+ \param iTc             tc value
+ \param iBeta           beta value
+*/
+void LoopFilter::xFilterLumaSegment( Pel* piSrc, const int iSrcStep, const int iOffset, const int iTc, const int iBeta, const bool sidePisLarge, const bool sideQisLarge, const int maxFilterLengthP, const int maxFilterLengthQ, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng )
+{
+  const int iSideThreshold = ( iBeta + ( iBeta >> 1 ) ) >> 3;
+  const int iThrCut        = iTc * 10;
+
+  Pel* src0 = piSrc;
+  Pel* src3 = piSrc + iSrcStep * 3;
+
+  const int dp0 = xCalcDP( src0, iOffset );
+  const int dq0 = xCalcDQ( src0, iOffset );
+  const int dp3 = xCalcDP( src3, iOffset );
+  const int dq3 = xCalcDQ( src3, iOffset );
+  int dp0L = dp0;
+  int dq0L = dq0;
+  int dp3L = dp3;
+  int dq3L = dq3;
+
+  if( sidePisLarge )
+  {
+    dp0L = ( dp0L + xCalcDP( src0 - 3 * iOffset, iOffset ) + 1 ) >> 1;
+    dp3L = ( dp3L + xCalcDP( src3 - 3 * iOffset, iOffset ) + 1 ) >> 1;
+  }
+  if( sideQisLarge )
+  {
+    dq0L = ( dq0L + xCalcDQ( src0 + 3 * iOffset, iOffset ) + 1 ) >> 1;
+    dq3L = ( dq3L + xCalcDQ( src3 + 3 * iOffset, iOffset ) + 1 ) >> 1;
+  }
+
+  if( sidePisLarge || sideQisLarge )
+  {
+    const int d0L = dp0L + dq0L;
+    const int d3L = dp3L + dq3L;
+
+    const int dpL = dp0L + dp3L;
+    const int dqL = dq0L + dq3L;
+
+    const int dL = d0L + d3L;
+
+    if( dL < iBeta )
+    {
+      const bool filterP = ( dpL < iSideThreshold );
+      const bool filterQ = ( dqL < iSideThreshold );
+
+      // adjust decision so that it is not read beyond p5 is maxFilterLengthP is 5 and q5 if maxFilterLengthQ is 5
+      const bool swL = xUseStrongFiltering( src0, iOffset, 2 * d0L, iBeta, iTc, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ )
+                    && xUseStrongFiltering( src3, iOffset, 2 * d3L, iBeta, iTc, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ );
+      if( swL )
+      {
+        for( int i = 0; i < DEBLOCK_SMALLEST_BLOCK / 2; i++ )
         {
-          for (unsigned step = 0; step < uiLoopLength; step++)
-          {
-            xPelFilterChroma(piTmpSrcChroma + iSrcStep*(step + iIdx*uiLoopLength), iOffset, iTc, false, bPartPNoFilter, bPartQNoFilter, clpRng, largeBoundary);
-          }
-        }
+          xPelFilterLuma( piSrc + iSrcStep * i, iOffset, iTc, swL, bPartPNoFilter, bPartQNoFilter, iThrCut, filterP, filterQ, clpRng, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ );
         }
+        return;
       }
     }
   }
+
+  const int d0 = dp0 + dq0;
+  const int d3 = dp3 + dq3;
+
+  const int dp = dp0 + dp3;
+  const int dq = dq0 + dq3;
+  const int d  = d0  + d3;
+
+  if( d < iBeta )
+  {
+    const bool bFilterP = ( dp < iSideThreshold );
+    const bool bFilterQ = ( dq < iSideThreshold );
+    bool sw = false;
+    if( maxFilterLengthP > 2 && maxFilterLengthQ > 2 )
+    {
+      sw = xUseStrongFiltering( src0, iOffset, 2 * d0, iBeta, iTc )
+        && xUseStrongFiltering( src3, iOffset, 2 * d3, iBeta, iTc );
+    }
+    for( int i = 0; i < DEBLOCK_SMALLEST_BLOCK / 2; i++ )
+    {
+      xPelFilterLuma( piSrc + iSrcStep * i, iOffset, iTc, sw, bPartPNoFilter, bPartQNoFilter, iThrCut, bFilterP, bFilterQ, clpRng );
+    }
+  }
 }
 
+/**
+ - Deblocking of one chroma edge segment of numLines lines: filter decisions and filtering
+ .
+ \param piSrc           pointer to the first Q sample of the segment
+ \param iSrcStep        step between the lines of the segment
+ \param iOffset         offset across the edge
+ \param numLines        number of lines in the segment
+ \param iTc             tc value
+ \param iBeta           beta value, only used for large boundaries
+*/
+void LoopFilter::xFilterChromaSegment( Pel* piSrc, const int iSrcStep, const int iOffset, const int numLines, const int iTc, const int iBeta, const bool largeBoundary, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng )
+{
+  if( largeBoundary )
+  {
+    const int dp0 = xCalcDP( piSrc, iOffset );
+    const int dq0 = xCalcDQ( piSrc, iOffset );
+    const int dp1 = xCalcDP( piSrc + iSrcStep, iOffset );
+    const int dq1 = xCalcDQ( piSrc + iSrcStep, iOffset );
 
+    const int d0 = dp0 + dq0;
+    const int d1 = dp1 + dq1;
+    const int d  = d0 + d1;
+
+    if( d < iBeta )
+    {
+      const bool sw = xUseStrongFiltering( piSrc, iOffset, 2 * d0, iBeta, iTc )
+                   && xUseStrongFiltering( piSrc + iSrcStep, iOffset, 2 * d1, iBeta, iTc );
+
+      for( int step = 0; step < numLines; step++ )
+      {
+        xPelFilterChroma( piSrc + iSrcStep * step, iOffset, iTc, sw, bPartPNoFilter, bPartQNoFilter, clpRng, largeBoundary );
+      }
+      return;
+    }
+  }
+
+  for( int step = 0; step < numLines; step++ )
+  {
+    xPelFilterChroma( piSrc + iSrcStep * step, iOffset, iTc, false, bPartPNoFilter, bPartQNoFilter, clpRng, largeBoundary );
+  }
+}
 
 /**
  - Deblocking for the luminance component with strong or weak filter
@@ -1528,7 +1533,7 @@ void LoopFilter::xEdgeFilterChroma(const CodingUnit& cu, const DeblockEdgeDir ed
  \param bFilterSecondQ  decision weak filter/no filter for partQ
  \param bitDepthLuma    luma bit depth
 */
-inline void LoopFilter::xBilinearFilter(Pel* srcP, Pel* srcQ, int offset, int refMiddle, int refP, int refQ, int numberPSide, int numberQSide, const int* dbCoeffsP, const int* dbCoeffsQ, int tc) const
+inline void LoopFilter::xBilinearFilter(Pel* srcP, Pel* srcQ, int offset, int refMiddle, int refP, int refQ, int numberPSide, int numberQSide, const int* dbCoeffsP, const int* dbCoeffsQ, int tc)
 {
     int src;
     const char tc7[7] = { 6, 5, 4, 3, 2, 1, 1};
@@ -1549,7 +1554,7 @@ inline void LoopFilter::xBilinearFilter(Pel* srcP, Pel* srcQ, int offset, int re
     }
 }
 
-inline void LoopFilter::xFilteringPandQ(Pel* src, int offset, int numberPSide, int numberQSide, int tc) const
+inline void LoopFilter::xFilteringPandQ(Pel* src, int offset, int numberPSide, int numberQSide, int tc)
 {
   CHECK(numberPSide <= 3 && numberQSide <= 3, "Short filtering in long filtering function");
   Pel* srcP = src-offset;
@@ -1623,7 +1628,7 @@ inline void LoopFilter::xFilteringPandQ(Pel* src, int offset, int numberPSide, i
   xBilinearFilter(srcP,srcQ,offset,refMiddle,refP,refQ,numberPSide,numberQSide,dbCoeffsP,dbCoeffsQ,tc);
 }
 
-inline void LoopFilter::xPelFilterLuma(Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const int iThrCut, const bool bFilterSecondP, const bool bFilterSecondQ, const ClpRng& clpRng, bool sidePisLarge, bool sideQisLarge, int maxFilterLengthP, int maxFilterLengthQ) const
+inline void LoopFilter::xPelFilterLuma(Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const int iThrCut, const bool bFilterSecondP, const bool bFilterSecondQ, const ClpRng& clpRng, bool sidePisLarge, bool sideQisLarge, int maxFilterLengthP, int maxFilterLengthQ)
 {
   int delta;
 
@@ -1723,7 +1728,7 @@ inline void LoopFilter::xPelFilterLuma(Pel* piSrc, const int iOffset, const int
  \param bPartQNoFilter  indicator to disable filtering on partQ
  \param bitDepthChroma  chroma bit depth
  */
-inline void LoopFilter::xPelFilterChroma( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng, const bool largeBoundary ) const
+inline void LoopFilter::xPelFilterChroma( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng, const bool largeBoundary )
 {
   int delta;
 
@@ -1782,7 +1787,7 @@ inline void LoopFilter::xPelFilterChroma( Pel* piSrc, const int iOffset, const i
  \param tc              tc value
  \param piSrc           pointer to picture data
  */
-inline bool LoopFilter::xUseStrongFiltering( Pel* piSrc, const int iOffset, const int d, const int beta, const int tc, bool sidePisLarge, bool sideQisLarge, int maxFilterLengthP, int maxFilterLengthQ ) const
+inline bool LoopFilter::xUseStrongFiltering( Pel* piSrc, const int iOffset, const int d, const int beta, const int tc, bool sidePisLarge, bool sideQisLarge, int maxFilterLengthP, int maxFilterLengthQ )
 {
   const Pel m4 = piSrc[ 0          ];
   const Pel m3 = piSrc[-iOffset    ];
@@ -1827,12 +1832,12 @@ inline bool LoopFilter::xUseStrongFiltering( Pel* piSrc, const int iOffset, cons
   return ( ( d_strong < ( beta >> 3 ) ) && ( d < ( beta >> 2 ) ) && ( abs( m3 - m4 ) < ( ( tc * 5 + 1 ) >> 1 ) ) );
 }
 
-inline int LoopFilter::xCalcDP( Pel* piSrc, const int iOffset ) const
+inline int LoopFilter::xCalcDP( Pel* piSrc, const int iOffset )
 {
   return abs( piSrc[-iOffset * 3] - 2 * piSrc[-iOffset * 2] + piSrc[-iOffset] );
 }
 
-inline int LoopFilter::xCalcDQ( Pel* piSrc, const int iOffset ) const
+inline int LoopFilter::xCalcDQ( Pel* piSrc, const int iOffset )
 {
   return abs( piSrc[0] - 2 * piSrc[iOffset] + piSrc[iOffset * 2] );
 }
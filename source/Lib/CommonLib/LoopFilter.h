@@ -96,11 +96,14 @@ private:
   void xSetMaxFilterLengthPQForCodingSubBlocks( const DeblockEdgeDir edgeDir, const CodingUnit& cu, const PredictionUnit& currPU, const bool& mvSubBlocks, const int& subBlockSize, const Area& areaPu );
 #endif
 
-  inline void xBilinearFilter     ( Pel* srcP, Pel* srcQ, int offset, int refMiddle, int refP, int refQ, int numberPSide, int numberQSide, const int* dbCoeffsP, const int* dbCoeffsQ, int tc ) const;
-  inline void xFilteringPandQ     ( Pel* src, int offset, int numberPSide, int numberQSide, int tc ) const;
-  inline void xPelFilterLuma      ( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const int iThrCut, const bool bFilterSecondP, const bool bFilterSecondQ, const ClpRng& clpRng, bool sidePisLarge = false, bool sideQisLarge = false, int maxFilterLengthP = 7, int maxFilterLengthQ = 7 ) const;
-  inline void xPelFilterChroma    ( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng, const bool largeBoundary ) const;
-  inline bool xUseStrongFiltering ( Pel* piSrc, const int iOffset, const int d, const int beta, const int tc, bool sidePisLarge = false, bool sideQisLarge = false, int maxFilterLengthP = 7, int maxFilterLengthQ = 7 ) const;//move the computation outside the function
+  static void xFilterLumaSegment  ( Pel* piSrc, const int iSrcStep, const int iOffset, const int iTc, const int iBeta, const bool sidePisLarge, const bool sideQisLarge, const int maxFilterLengthP, const int maxFilterLengthQ, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng );
+  static void xFilterChromaSegment( Pel* piSrc, const int iSrcStep, const int iOffset, const int numLines, const int iTc, const int iBeta, const bool largeBoundary, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng );
+
+  static inline void xBilinearFilter     ( Pel* srcP, Pel* srcQ, int offset, int refMiddle, int refP, int refQ, int numberPSide, int numberQSide, const int* dbCoeffsP, const int* dbCoeffsQ, int tc );
+  static inline void xFilteringPandQ     ( Pel* src, int offset, int numberPSide, int numberQSide, int tc );
+  static inline void xPelFilterLuma      ( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const int iThrCut, const bool bFilterSecondP, const bool bFilterSecondQ, const ClpRng& clpRng, bool sidePisLarge = false, bool sideQisLarge = false, int maxFilterLengthP = 7, int maxFilterLengthQ = 7 );
+  static inline void xPelFilterChroma    ( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng, const bool largeBoundary );
+  static inline bool xUseStrongFiltering ( Pel* piSrc, const int iOffset, const int d, const int beta, const int tc, bool sidePisLarge = false, bool sideQisLarge = false, int maxFilterLengthP = 7, int maxFilterLengthQ = 7 );//move the computation outside the function
   inline unsigned BsSet(unsigned val, const ComponentID compIdx) const;
   inline unsigned BsGet(unsigned val, const ComponentID compIdx) const;
 
@@ -109,11 +112,22 @@ private:
   inline void xDeriveEdgefilterParam       ( const int xPos, const int yPos, const int numVerVirBndry, const int numHorVirBndry, const int verVirBndryPos[], const int horVirBndryPos[], bool &verEdgeFilter, bool &horEdgeFilter );
 #endif
 
-  inline int xCalcDP              ( Pel* piSrc, const int iOffset ) const;
-  inline int xCalcDQ              ( Pel* piSrc, const int iOffset ) const;
+  static inline int xCalcDP       ( Pel* piSrc, const int iOffset );
+  static inline int xCalcDQ       ( Pel* piSrc, const int iOffset );
   static const uint8_t sm_tcTable[MAX_QP + 3];
   static const uint8_t sm_betaTable[MAX_QP + 1];
 
+  void ( *m_filterLumaSegment )  ( Pel* piSrc, const int iSrcStep, const int iOffset, const int iTc, const int iBeta, const bool sidePisLarge, const bool sideQisLarge, const int maxFilterLengthP, const int maxFilterLengthQ, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng );
+  void ( *m_filterChromaSegment )( Pel* piSrc, const int iSrcStep, const int iOffset, const int numLines, const int iTc, const int iBeta, const bool largeBoundary, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng );
+
+#if ENABLE_SIMD_DBLF
+#ifdef TARGET_SIMD_X86
+  void initLoopFilterX86();
+  template <X86_VEXT vext>
+  void _initLoopFilterX86();
+#endif
+#endif
+
 public:
 
   LoopFilter();
@@ -131,6 +145,8 @@ public:
   /// picture-level deblocking filter
   void loopFilterPic              ( CodingStructure& cs
                                     );
+  /// deblocking of the edges of one direction of a CTU row, the vertical edges of a row are filtered before its horizontal ones
+  void loopFilterCtuRow           ( CodingStructure& cs, const int ctuRow, const DeblockEdgeDir edgeDir );
 
   static int getBeta              ( const int qp )
   {
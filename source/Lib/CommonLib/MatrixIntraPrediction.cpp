@@ -58,6 +58,14 @@ namespace Mip
     m_upsmpFactorHor( 0 ),
     m_upsmpFactorVer( 0 )
   {
+    m_matrixTimesRedBndryPlusBias = xMatrixTimesRedBndryPlusBias;
+    m_predictionUpsampling1D      = predictionUpsampling1D;
+
+#if ENABLE_SIMD_OPT_MIP
+#ifdef TARGET_SIMD_X86
+    initPredictorMIPX86();
+#endif
+#endif
   }
 
 
@@ -357,7 +365,7 @@ namespace Mip
         int* const     horDst       = dst + ( m_upsmpFactorVer - 1 ) * m_blockSize.width;
         const SizeType horDstStride = m_upsmpFactorVer * m_blockSize.width;
 
-        predictionUpsampling1D( horDst, src, m_boundaryForUpsamplingLeft.data(),
+        m_predictionUpsampling1D( horDst, src, m_boundaryForUpsamplingLeft.data(),
                                 m_reducedPredictionSize.width, m_reducedPredictionSize.height,
                                 horSrcStep, horSrcStride, 1, horDstStride,
                                 m_upsmpFactorHor );
@@ -372,7 +380,7 @@ namespace Mip
         verSrcStep   = transpose ? 1 : m_blockSize.width;
         verSrcStride = transpose ? m_reducedPredictionSize.height : 1;
       }
-      predictionUpsampling1D( dst, verSrc, m_boundaryForUpsamplingTop.data(),
+      m_predictionUpsampling1D( dst, verSrc, m_boundaryForUpsamplingTop.data(),
                               m_reducedPredictionSize.height, m_blockSize.width,
                               verSrcStep, verSrcStride, m_blockSize.width, 1,
                               m_upsmpFactorVer );
@@ -391,7 +399,7 @@ namespace Mip
         const SizeType verDstStep   = m_blockSize.width;
         const SizeType verDstStride = m_upsmpFactorHor;
 
-        predictionUpsampling1D( verDst, src, m_boundaryForUpsamplingTop.data(),
+        m_predictionUpsampling1D( verDst, src, m_boundaryForUpsamplingTop.data(),
                                 m_reducedPredictionSize.height, m_reducedPredictionSize.width,
                                 verSrcStep, verSrcStride, verDstStep, verDstStride,
                                 m_upsmpFactorVer );
@@ -406,7 +414,7 @@ namespace Mip
         horSrcStep   = transpose ? m_blockSize.height : 1;
         horSrcStride = transpose ? 1 : m_reducedPredictionSize.width;
       }
-      predictionUpsampling1D( dst, horSrc, m_boundaryForUpsamplingLeft.data(),
+      m_predictionUpsampling1D( dst, horSrc, m_boundaryForUpsamplingLeft.data(),
                               m_reducedPredictionSize.width, m_blockSize.height,
                               horSrcStep, horSrcStride, 1, m_blockSize.width,
                               m_upsmpFactorHor );
@@ -467,21 +475,43 @@ namespace Mip
     static_vector<int, MIP_MAX_REDUCED_OUTPUT_SAMPLES> resBufTransposed( m_reducedPredictionSize.area() );
     int*const resPtr = (transpose && !needUpsampling) ? resBufTransposed.data() : result;
 
-    const int offset = 1 << (shiftMatrix - 1);
     CHECK(inputSize != 4 * (inputSize >> 2), "Error, input size not divisible by four");
 
-    const short *weight = matrix;
-
     const int intermediateWidth  = transpose ? m_reducedPredictionSize.height : m_reducedPredictionSize.width;
     const int intermediateHeight = transpose ? m_reducedPredictionSize.width : m_reducedPredictionSize.height;
     const int xStep = leaveHorOut ? 2 : 1;
     const int yStep = leaveVerOut ? intermediateWidth : 0;
 
+    m_matrixTimesRedBndryPlusBias( resPtr, input, matrix, bias, inputSize, intermediateWidth, intermediateHeight, xStep, yStep, shiftMatrix, shiftBias );
+
+    // Re-transpose if no upsampling will be done.
+    if( transpose && !needUpsampling )
+    {
+      for( int y = 0; y < m_reducedPredictionSize.height; y++ )
+      {
+        for( int x = 0; x < m_reducedPredictionSize.width; x++ )
+        {
+          CHECKD( x * m_reducedPredictionSize.height + y >= m_reducedPredictionSize.area(), "error" );
+          result[ y * m_reducedPredictionSize.width + x ] = resPtr[ x * m_reducedPredictionSize.height + y ];
+        }
+      }
+    }
+  }
+
+  void PredictorMIP::xMatrixTimesRedBndryPlusBias( int* const result, const int* const input,
+                                                   const short* matrix, const short* bias, const int inputSize,
+                                                   const int outputWidth, const int outputHeight, const int xStep, const int yStep,
+                                                   const int shiftMatrix, const int shiftBias )
+  {
+    const int offset = 1 << (shiftMatrix - 1);
+
+    const short *weight = matrix;
+
     int posRes  = 0;
     int posBias = 0;
-    for (int y = 0; y < intermediateHeight; y++)
+    for (int y = 0; y < outputHeight; y++)
     {
-      for (int x = 0; x < intermediateWidth; x++)
+      for (int x = 0; x < outputWidth; x++)
       {
         int tmp0 = 0;
         int tmp1 = 0;
@@ -494,7 +524,7 @@ namespace Mip
           tmp2 += input[i + 2] * weight[i + 2];
           tmp3 += input[i + 3] * weight[i + 3];
         }
-        resPtr[posRes++] = ((tmp0 + tmp1 + tmp2 + tmp3) + (bias[posBias] << shiftBias) + offset) >> shiftMatrix;
+        result[posRes++] = ((tmp0 + tmp1 + tmp2 + tmp3) + (bias[posBias] << shiftBias) + offset) >> shiftMatrix;
 
         weight  += xStep * inputSize;
         posBias += xStep;
@@ -502,22 +532,8 @@ namespace Mip
       weight  += yStep * inputSize;
       posBias += yStep;
     }
-
-    // Re-transpose if no upsampling will be done.
-    if( transpose && !needUpsampling )
-    {
-      for( int y = 0; y < m_reducedPredictionSize.height; y++ )
-      {
-        for( int x = 0; x < m_reducedPredictionSize.width; x++ )
-        {
-          CHECKD( x * m_reducedPredictionSize.height + y >= m_reducedPredictionSize.area(), "error" );
-          result[ y * m_reducedPredictionSize.width + x ] = resPtr[ x * m_reducedPredictionSize.height + y ];
-        }
-      }
-    }
   }
 
-
 } // namespace Mip
 
 MatrixIntraPrediction::MatrixIntraPrediction()
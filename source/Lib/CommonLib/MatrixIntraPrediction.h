@@ -92,6 +92,28 @@ namespace Mip
                                               const bool leaveHorOut, const bool leaveVerOut,
                                               const int shiftMatrix, const int shiftBias,
                                               const bool transpose, const bool needUpsampling );
+    static void xMatrixTimesRedBndryPlusBias( int* const result, const int* const input,
+                                              const short* matrix, const short* bias, const int inputSize,
+                                              const int outputWidth, const int outputHeight, const int xStep, const int yStep,
+                                              const int shiftMatrix, const int shiftBias );
+
+    void ( *m_matrixTimesRedBndryPlusBias )( int* const result, const int* const input,
+                                             const short* matrix, const short* bias, const int inputSize,
+                                             const int outputWidth, const int outputHeight, const int xStep, const int yStep,
+                                             const int shiftMatrix, const int shiftBias );
+    void ( *m_predictionUpsampling1D )( int* const dst, const int* const src, const int* const bndry,
+                                        const SizeType srcSizeUpsmpDim, const SizeType srcSizeOrthDim,
+                                        const SizeType srcStep, const SizeType srcStride,
+                                        const SizeType dstStep, const SizeType dstStride,
+                                        const unsigned int upsmpFactor );
+
+#if ENABLE_SIMD_OPT_MIP
+#ifdef TARGET_SIMD_X86
+    void initPredictorMIPX86();
+    template <X86_VEXT vext>
+    void _initPredictorMIPX86();
+#endif
+#endif
   };
 }
 
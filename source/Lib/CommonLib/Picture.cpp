@@ -1024,6 +1024,7 @@ Picture::Picture()
   }
   m_spliceIdx = NULL;
   m_ctuNums = 0;
+  m_finishedCtuRows    = MAX_INT;
 }
 
 void Picture::create(const ChromaFormat &_chromaFormat, const Size &size, const unsigned _maxCUSize, const unsigned _margin, const bool _decoder)
@@ -1043,7 +1044,8 @@ void Picture::create(const ChromaFormat &_chromaFormat, const Size &size, const
   }
 #if !KEEP_PRED_AND_RESI_SIGNALS
 
-  m_ctuArea = UnitArea( _chromaFormat, Area( Position{ 0, 0 }, Size( _maxCUSize, _maxCUSize ) ) );
+  // one CTU wide column, so that CTU rows decoded in parallel do not share prediction and residual samples
+  m_ctuArea = UnitArea( _chromaFormat, Area( Position{ 0, 0 }, Size( _maxCUSize, ( ( size.height + _maxCUSize - 1 ) / _maxCUSize ) * _maxCUSize ) ) );
 #endif
   m_hashMap.clearAll();
 }
@@ -1231,7 +1233,7 @@ void Picture::finalInit(const SPS& sps, const PPS& pps, APS& aps)
   }
   else
   {
-    cs = new CodingStructure( g_globalUnitCache.cuCache, g_globalUnitCache.puCache, g_globalUnitCache.tuCache );
+    cs = new CodingStructure( m_unitCache.cuCache, m_unitCache.puCache, m_unitCache.tuCache );
     cs->sps = &sps;
     cs->create( chromaFormatIDC, Area( 0, 0, iWidth, iHeight ), true );
   }
@@ -1380,9 +1382,9 @@ void Picture::finishCtuPart( const UnitArea& ctuArea )
 
 #endif
 
-void Picture::extendPicBorder()
+void Picture::extendPicBorder( const bool force )
 {
-  if ( m_bIsBorderExtended )
+  if ( m_bIsBorderExtended && !force )
   {
     return;
   }
@@ -1486,6 +1488,82 @@ void Picture::extendPicBorder()
   m_bIsBorderExtended = true;
 }
 
+void Picture::extendPicBorderCtuRow( const int ctuRow )
+{
+  CHECK( cs->sps->getWrapAroundEnabledFlag(), "The border of wrap-around reference pictures is extended for the whole picture" );
+
+  const PreCalcValues& pcv        = *cs->pcv;
+  const bool           isFirstRow = ctuRow == 0;
+  const bool           isLastRow  = ctuRow + 1 == pcv.heightInCtus;
+
+  for( int comp = 0; comp < getNumberValidComponents( cs->area.chromaFormat ); comp++ )
+  {
+    ComponentID compID = ComponentID( comp );
+    PelBuf p = M_BUFS( 0, PIC_RECONSTRUCTION ).get( compID );
+    int xmargin = margin >> getComponentScaleX( compID, cs->area.chromaFormat );
+    int ymargin = margin >> getComponentScaleY( compID, cs->area.chromaFormat );
+    int yStart  = ( ctuRow * pcv.maxCUHeight ) >> getComponentScaleY( compID, cs->area.chromaFormat );
+    int yEnd    = std::min<int>( ( ( ctuRow + 1 ) * pcv.maxCUHeight ) >> getComponentScaleY( compID, cs->area.chromaFormat ), p.height );
+
+    // do left and right margins of the lines of the CTU row
+    Pel* pi = p.bufAt( 0, yStart );
+    for( int y = yStart; y < yEnd; y++ )
+    {
+      for( int x = 0; x < xmargin; x++ )
+      {
+        pi[ -xmargin + x ] = pi[0];
+        pi[  p.width + x ] = pi[p.width-1];
+      }
+      pi += p.stride;
+    }
+
+    if( isLastRow )
+    {
+      pi = p.bufAt( 0, p.height - 1 ) - xmargin;
+      for( int y = 0; y < ymargin; y++ )
+      {
+        ::memcpy( pi + (y+1)*p.stride, pi, sizeof(Pel)*(p.width + (xmargin << 1)));
+      }
+    }
+
+    if( isFirstRow )
+    {
+      pi = p.bufAt( 0, 0 ) - xmargin;
+      for( int y = 0; y < ymargin; y++ )
+      {
+        ::memcpy( pi - (y+1)*p.stride, pi, sizeof(Pel)*(p.width + (xmargin<<1)) );
+      }
+    }
+  }
+}
+
+void Picture::setCtuRowProgress( const int numCtuRows )
+{
+  std::lock_guard<std::mutex> lock( m_progressMutex );
+  m_finishedCtuRows.store( numCtuRows, std::memory_order_release );
+  m_progressCond.notify_all();
+}
+
+void Picture::waitForReconstruction( const int lumaY ) const
+{
+  if( m_finishedCtuRows.load( std::memory_order_acquire ) == MAX_INT )
+  {
+    return;
+  }
+
+  // the picture is in flight, so its parameter sets do not change
+  const PreCalcValues& pcv        = *cs->pcv;
+  const int            numCtuRows = ( Clip3<int>( 0, pcv.lumaHeight - 1, lumaY ) >> pcv.maxCUHeightLog2 ) + 1;
+
+  if( m_finishedCtuRows.load( std::memory_order_acquire ) >= numCtuRows )
+  {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock( m_progressMutex );
+  m_progressCond.wait( lock, [&]{ return m_finishedCtuRows.load( std::memory_order_acquire ) >= numCtuRows; } );
+}
+
 PelBuf Picture::getBuf( const ComponentID compID, const PictureType &type )
 {
   return M_BUFS( ( type == PIC_ORIGINAL || type == PIC_TRUE_ORIGINAL ) ? 0 : scheduler.getSplitPicId(), type ).getBuf( compID );
@@ -1512,7 +1590,6 @@ PelBuf Picture::getBuf( const CompArea &blk, const PictureType &type )
   {
     CompArea localBlk = blk;
     localBlk.x &= ( cs->pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
-    localBlk.y &= ( cs->pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
 
     return M_BUFS( jId, type ).getBuf( localBlk );
   }
@@ -1537,7 +1614,6 @@ const CPelBuf Picture::getBuf( const CompArea &blk, const PictureType &type ) co
   {
     CompArea localBlk = blk;
     localBlk.x &= ( cs->pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
-    localBlk.y &= ( cs->pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
 
     return M_BUFS( jId, type ).getBuf( localBlk );
   }
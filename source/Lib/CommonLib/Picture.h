@@ -49,6 +49,9 @@
 #include "Hash.h"
 #include "MCTS.h"
 #include <deque>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 #if ENABLE_WPP_PARALLELISM || ENABLE_SPLIT_PARALLELISM
 #if ENABLE_WPP_PARALLELISM
@@ -300,7 +303,8 @@ struct Picture : public UnitArea
          PelUnitBuf getBuf(const UnitArea &unit,     const PictureType &type);
   const CPelUnitBuf getBuf(const UnitArea &unit,     const PictureType &type) const;
 
-  void extendPicBorder();
+  void extendPicBorder( const bool force = false );   ///< force: extend also if the border is marked as extended
+  void extendPicBorderCtuRow( const int ctuRow );
 #if JVET_N0415_CTB_ALF
 #if JVET_N0805_APS_LMCS  
   void finalInit(const SPS& sps, const PPS& pps, APS** alfApss, APS& lmcsAps);
@@ -369,6 +373,20 @@ public:
   MCTSInfo     mctsInfo;
   std::vector<AQpLayer*> aqlayer;
 
+public:
+  // reconstruction progress of the frame-level parallel decoding, a picture that is not reconstructed in parallel is always complete
+  void startCtuRowProgress   ()                          { m_finishedCtuRows = 0; }
+  void setCtuRowProgress     ( const int numCtuRows );
+  void finishCtuRowProgress  ()                          { setCtuRowProgress( MAX_INT ); }
+  bool isCtuRowProgressFinished() const                  { return m_finishedCtuRows.load( std::memory_order_acquire ) == MAX_INT; }
+  void waitForReconstruction ( const int lumaY = MAX_INT ) const;
+
+private:
+  std::atomic<int>                m_finishedCtuRows;       ///< number of CTU rows that are final, including the in-loop filters and the border extension
+  mutable std::mutex              m_progressMutex;
+  mutable std::condition_variable m_progressCond;
+  XUCache                         m_unitCache;             ///< units of cs, pictures reconstructed in parallel must not share a unit cache
+
 #if !KEEP_PRED_AND_RESI_SIGNALS
 private:
   UnitArea m_ctuArea;
@@ -131,6 +131,16 @@ Quant::Quant( const Quant* other )
 {
 #if HEVC_USE_SCALING_LISTS
   xInitScalingList( other );
+#endif
+
+  m_quantCore       = xQuantCore;
+  m_deQuantCore     = xDeQuantCore;
+  m_quantLevelsCore = xQuantLevelsCore;
+
+#if ENABLE_SIMD_OPT_QUANT
+#ifdef TARGET_SIMD_X86
+  initQuantX86();
+#endif
 #endif
 }
 
@@ -359,6 +369,74 @@ void Quant::xSignBitHidingHDQ( TCoeff* pQCoef, const TCoeff* pCoef, TCoeff* delt
 }
 #endif
 
+TCoeff Quant::xQuantCore( const TCoeff* src, TCoeff* dst, TCoeff* deltaU, const int* quantCoeff, const int defaultQuantCoeff, const int64_t add, const int qBits,
+                          const TCoeff outputMinimum, const TCoeff outputMaximum, const int numCoeff )
+{
+  const int qBits8 = qBits - 8;
+  TCoeff    absSum = 0;
+
+  for( int n = 0; n < numCoeff; n++ )
+  {
+    const TCoeff  level    = src[n];
+    const TCoeff  sign     = ( level < 0 ? -1 : 1 );
+    const int64_t tmpLevel = ( int64_t ) abs( level ) * ( quantCoeff ? quantCoeff[n] : defaultQuantCoeff );
+
+    const TCoeff quantisedMagnitude = TCoeff( ( tmpLevel + add ) >> qBits );
+    if( deltaU )
+    {
+      deltaU[n] = ( TCoeff ) ( ( tmpLevel - ( ( int64_t ) quantisedMagnitude << qBits ) ) >> qBits8 );
+    }
+
+    absSum += quantisedMagnitude;
+    dst[n]  = Clip3<TCoeff>( outputMinimum, outputMaximum, quantisedMagnitude * sign );
+  }
+
+  return absSum;
+}
+
+void Quant::xDeQuantCore( const TCoeff* src, TCoeff* dst, const int* dequantCoeff, const int defaultScale, const int rightShift,
+                          const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff outputMinimum, const TCoeff outputMaximum, const int numCoeff )
+{
+  if( rightShift > 0 )
+  {
+    const Intermediate_Int iAdd = ( Intermediate_Int ) 1 << ( rightShift - 1 );
+
+    for( int n = 0; n < numCoeff; n++ )
+    {
+      const TCoeff           clipQCoef = TCoeff( Clip3<Intermediate_Int>( inputMinimum, inputMaximum, src[n] ) );
+      const Intermediate_Int iCoeffQ   = ( Intermediate_Int( clipQCoef ) * ( dequantCoeff ? dequantCoeff[n] : defaultScale ) + iAdd ) >> rightShift;
+
+      dst[n] = TCoeff( Clip3<Intermediate_Int>( outputMinimum, outputMaximum, iCoeffQ ) );
+    }
+  }
+  else
+  {
+    const int leftShift = -rightShift;
+
+    for( int n = 0; n < numCoeff; n++ )
+    {
+      const TCoeff           clipQCoef = TCoeff( Clip3<Intermediate_Int>( inputMinimum, inputMaximum, src[n] ) );
+      const Intermediate_Int iCoeffQ   = ( Intermediate_Int( clipQCoef ) * ( dequantCoeff ? dequantCoeff[n] : defaultScale ) ) << leftShift;
+
+      dst[n] = TCoeff( Clip3<Intermediate_Int>( outputMinimum, outputMaximum, iCoeffQ ) );
+    }
+  }
+}
+
+void Quant::xQuantLevelsCore( const TCoeff* src, Intermediate_Int* levelDouble, uint32_t* maxAbsLevel, const int* quantCoeff, const int defaultQuantCoeff, const int qBits,
+                              const TCoeff maxLevel, const int numCoeff )
+{
+  const Intermediate_Int rnd = Intermediate_Int( 1 ) << ( qBits - 1 );
+
+  for( int n = 0; n < numCoeff; n++ )
+  {
+    const int64_t tmpLevel = int64_t( abs( src[n] ) ) * ( quantCoeff ? quantCoeff[n] : defaultQuantCoeff );
+
+    levelDouble[n] = ( Intermediate_Int ) std::min<int64_t>( tmpLevel, std::numeric_limits<Intermediate_Int>::max() - rnd );
+    maxAbsLevel[n] = std::min<uint32_t>( uint32_t( maxLevel ), uint32_t( ( levelDouble[n] + rnd ) >> qBits ) );
+  }
+}
+
 void Quant::dequant(const TransformUnit &tu,
                              CoeffBuf      &dstCoeff,
                        const ComponentID   &compID,
@@ -454,6 +532,7 @@ void Quant::dequant(const TransformUnit &tu,
     const uint32_t uiLog2TrHeight = g_aucLog2[uiHeight];
     int *piDequantCoef        = getDequantCoeff(scalingListType, QP_rem, uiLog2TrWidth - 1, uiLog2TrHeight - 1);
 
+#if HM_QTBT_AS_IN_JEM_QUANT && !JVET_N0246_MODIFIED_QUANTSCALES
     if(rightShift > 0)
     {
       const Intermediate_Int iAdd = (Intermediate_Int) 1 << (rightShift - 1);
@@ -461,11 +540,7 @@ void Quant::dequant(const TransformUnit &tu,
       for( int n = 0; n < numSamplesInBlock; n++ )
       {
         const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-#if HM_QTBT_AS_IN_JEM_QUANT && !JVET_N0246_MODIFIED_QUANTSCALES
         const Intermediate_Int iCoeffQ   = ((Intermediate_Int(clipQCoef) * piDequantCoef[n] * NEScale) + iAdd ) >> rightShift;
-#else
-        const Intermediate_Int iCoeffQ   = ((Intermediate_Int(clipQCoef) * piDequantCoef[n]) + iAdd ) >> rightShift;
-#endif
 
         piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
       }
@@ -477,15 +552,14 @@ void Quant::dequant(const TransformUnit &tu,
       for( int n = 0; n < numSamplesInBlock; n++ )
       {
         const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-#if HM_QTBT_AS_IN_JEM_QUANT && !JVET_N0246_MODIFIED_QUANTSCALES
         const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * piDequantCoef[n] * NEScale) << leftShift;
-#else
-        const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * piDequantCoef[n]) << leftShift;
-#endif
 
         piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
       }
     }
+#else
+    m_deQuantCore( piQCoef, piCoef, piDequantCoef, 0, rightShift, inputMinimum, inputMaximum, transformMinimum, transformMaximum, numSamplesInBlock );
+#endif
   }
   else
   {
@@ -508,30 +582,7 @@ void Quant::dequant(const TransformUnit &tu,
     const Intermediate_Int inputMinimum        = -(1 << (targetInputBitDepth - 1));
     const Intermediate_Int inputMaximum        =  (1 << (targetInputBitDepth - 1)) - 1;
 
-    if (rightShift > 0)
-    {
-      const Intermediate_Int iAdd = (Intermediate_Int) 1 << (rightShift - 1);
-
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * scale + iAdd) >> rightShift;
-
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
-    }
-    else
-    {
-      const int leftShift = -rightShift;
-
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * scale) << leftShift;
-
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
-    }
+    m_deQuantCore( piQCoef, piCoef, nullptr, scale, rightShift, inputMinimum, inputMaximum, transformMinimum, transformMaximum, numSamplesInBlock );
 #if HEVC_USE_SCALING_LISTS
   }
 #endif
@@ -1089,10 +1140,24 @@ void Quant::quant(TransformUnit &tu, const ComponentID &compID, const CCoeffBuf
     // QBits will be OK for any internal bit depth as the reduction in transform shift is balanced by an increase in Qp_per due to QpBDOffset
 
     const int64_t iAdd = int64_t(tu.cs->slice->isIRAP() ? 171 : 85) << int64_t(iQBits - 9);
-#if HEVC_USE_SIGN_HIDING
+#if HEVC_USE_SIGN_HIDING && !JVET_N0246_MODIFIED_QUANTSCALES
     const int qBits8 = iQBits - 8;
 #endif
 
+#if JVET_N0246_MODIFIED_QUANTSCALES
+#if HEVC_USE_SIGN_HIDING
+    TCoeff* deltaUBuf = deltaU;
+#else
+    TCoeff* deltaUBuf = nullptr;
+#endif
+#if HEVC_USE_SCALING_LISTS
+    const int* quantCoeff = enableScalingLists ? piQuantCoeff : nullptr;
+#else
+    const int* quantCoeff = nullptr;
+#endif
+    uiAbsSum += m_quantCore( piCoef.buf, piQCoef.buf, deltaUBuf, quantCoeff, defaultQuantisationCoefficient, iAdd, iQBits,
+                             entropyCodingMinimum, entropyCodingMaximum, piQCoef.area() );
+#else
     for (int uiBlockPos = 0; uiBlockPos < piQCoef.area(); uiBlockPos++)
     {
       const TCoeff iLevel   = piCoef.buf[uiBlockPos];
@@ -1104,16 +1169,9 @@ void Quant::quant(TransformUnit &tu, const ComponentID &compID, const CCoeffBuf
       const int64_t  tmpLevel = (int64_t)abs(iLevel) * defaultQuantisationCoefficient;
 #endif
 
-#if JVET_N0246_MODIFIED_QUANTSCALES
-      const TCoeff quantisedMagnitude = TCoeff((tmpLevel + iAdd ) >> iQBits);
-#if HEVC_USE_SIGN_HIDING
-      deltaU[uiBlockPos] = (TCoeff)((tmpLevel - ((int64_t)quantisedMagnitude<<iQBits) )>> qBits8);
-#endif
-#else
       const TCoeff quantisedMagnitude = TCoeff((tmpLevel * iWHScale + iAdd ) >> iQBits);
 #if HEVC_USE_SIGN_HIDING
       deltaU[uiBlockPos] = (TCoeff)((tmpLevel * iWHScale - ((int64_t)quantisedMagnitude<<iQBits) )>> qBits8);
-#endif
 #endif
 
       uiAbsSum += quantisedMagnitude;
@@ -1121,6 +1179,7 @@ void Quant::quant(TransformUnit &tu, const ComponentID &compID, const CCoeffBuf
 
       piQCoef.buf[uiBlockPos] = Clip3<TCoeff>( entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient );
     } // for n
+#endif
 #if JVET_N0413_RDPCM
     if( tu.cu->bdpcmMode && isLuma(compID) )
     {
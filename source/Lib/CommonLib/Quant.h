@@ -153,12 +153,35 @@ public:
   virtual void copyState         ( const Quant& other );
 #endif
 
+  // quantization kernels, the quantization / de-quantization coefficient arrays are nullptr for flat scaling
+  static TCoeff xQuantCore       ( const TCoeff* src, TCoeff* dst, TCoeff* deltaU, const int* quantCoeff, const int defaultQuantCoeff, const int64_t add, const int qBits,
+                                   const TCoeff outputMinimum, const TCoeff outputMaximum, const int numCoeff );
+  static void   xDeQuantCore     ( const TCoeff* src, TCoeff* dst, const int* dequantCoeff, const int defaultScale, const int rightShift,
+                                   const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff outputMinimum, const TCoeff outputMaximum, const int numCoeff );
+  static void   xQuantLevelsCore ( const TCoeff* src, Intermediate_Int* levelDouble, uint32_t* maxAbsLevel, const int* quantCoeff, const int defaultQuantCoeff, const int qBits,
+                                   const TCoeff maxLevel, const int numCoeff );
+
 protected:
 
 #if T0196_SELECTIVE_RDOQ
   bool xNeedRDOQ                 ( TransformUnit &tu, const ComponentID &compID, const CCoeffBuf &pSrc, const QpParam &cQP );
 #endif
 
+  TCoeff ( *m_quantCore )        ( const TCoeff* src, TCoeff* dst, TCoeff* deltaU, const int* quantCoeff, const int defaultQuantCoeff, const int64_t add, const int qBits,
+                                   const TCoeff outputMinimum, const TCoeff outputMaximum, const int numCoeff );
+  void   ( *m_deQuantCore )      ( const TCoeff* src, TCoeff* dst, const int* dequantCoeff, const int defaultScale, const int rightShift,
+                                   const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff outputMinimum, const TCoeff outputMaximum, const int numCoeff );
+  void   ( *m_quantLevelsCore )  ( const TCoeff* src, Intermediate_Int* levelDouble, uint32_t* maxAbsLevel, const int* quantCoeff, const int defaultQuantCoeff, const int qBits,
+                                   const TCoeff maxLevel, const int numCoeff );
+
+#if ENABLE_SIMD_OPT_QUANT
+#ifdef TARGET_SIMD_X86
+  void initQuantX86();
+  template <X86_VEXT vext>
+  void _initQuantX86();
+#endif
+#endif
+
   double   m_dLambda;
   uint32_t     m_uiMaxTrSize;
   bool     m_useRDOQ;
@@ -783,6 +783,12 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
   const uint32_t lfnstIdx = tu.cu->lfnstIdx;
 #endif
 
+  // level candidates of the non-RDOQ quantizer for all coefficients
+#if HEVC_USE_SCALING_LISTS
+  m_quantLevelsCore( plSrcCoeff, m_levelDouble, m_maxAbsLevel, enableScalingLists ? piQCoef : nullptr, defaultQuantisationCoefficient, iQBits, entropyCodingMaximum, uiMaxNumCoeff );
+#else
+  m_quantLevelsCore( plSrcCoeff, m_levelDouble, m_maxAbsLevel, nullptr, quantisationCoefficient, iQBits, entropyCodingMaximum, uiMaxNumCoeff );
+#endif
 
   for (int subSetId = iCGNum - 1; subSetId >= 0; subSetId--)
   {
@@ -816,18 +822,15 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
 
       // set coeff
 #if HEVC_USE_SCALING_LISTS
-      const int    quantisationCoefficient = (enableScalingLists) ? piQCoef   [uiBlkPos]               : defaultQuantisationCoefficient;
 #if HM_QTBT_AS_IN_JEM_QUANT
       const double errorScale              = (enableScalingLists) ? pdErrScale[uiBlkPos]               : defaultErrorScale;
 #else
       const double errorScale              = (enableScalingLists) ? pdErrScale[uiBlkPos] * blkErrScale : defaultErrorScale;
 #endif
 #endif
-      const int64_t  tmpLevel                = int64_t(abs(plSrcCoeff[ uiBlkPos ])) * quantisationCoefficient;
-
-      const Intermediate_Int lLevelDouble  = (Intermediate_Int)std::min<int64_t>(tmpLevel, std::numeric_limits<Intermediate_Int>::max() - (Intermediate_Int(1) << (iQBits - 1)));
+      const Intermediate_Int lLevelDouble  = m_levelDouble[ uiBlkPos ];
 
-      uint32_t uiMaxAbsLevel        = std::min<uint32_t>(uint32_t(entropyCodingMaximum), uint32_t((lLevelDouble + (Intermediate_Int(1) << (iQBits - 1))) >> iQBits));
+      uint32_t uiMaxAbsLevel        = m_maxAbsLevel[ uiBlkPos ];
 
       const double dErr         = double( lLevelDouble );
       pdCostCoeff0[ iScanPos ]  = dErr * dErr * errorScale;
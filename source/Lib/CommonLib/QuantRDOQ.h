@@ -173,6 +173,8 @@ private:
   double m_pdCostSig          [MAX_TB_SIZEY * MAX_TB_SIZEY];
   double m_pdCostCoeff0       [MAX_TB_SIZEY * MAX_TB_SIZEY];
   double m_pdCostCoeffGroupSig[(MAX_TB_SIZEY * MAX_TB_SIZEY) >> MLS_CG_SIZE]; // even if CG size is 2 (if one of the sides is 2) instead of 4, there should be enough space
+  Intermediate_Int m_levelDouble [MAX_TB_SIZEY * MAX_TB_SIZEY];
+  uint32_t         m_maxAbsLevel [MAX_TB_SIZEY * MAX_TB_SIZEY];
 #if HEVC_USE_SIGN_HIDING
   int    m_rateIncUp          [MAX_TB_SIZEY * MAX_TB_SIZEY];
   int    m_rateIncDown        [MAX_TB_SIZEY * MAX_TB_SIZEY];
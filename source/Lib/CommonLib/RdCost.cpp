@@ -170,6 +170,9 @@ void RdCost::init()
 #ifdef TARGET_SIMD_X86
   initRdCostX86();
 #endif
+#ifdef TARGET_SIMD_VEC
+  initRdCostVec();
+#endif
 #endif
 
   m_costMode                   = COST_STANDARD_LOSSY;
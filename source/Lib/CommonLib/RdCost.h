@@ -159,11 +159,15 @@ public:
 
   // Distortion Functions
   void          init();
+  static FpDistFunc getDistFunc       ( DFunc eDFunc )  { return m_afpDistortFunc[eDFunc]; }
 #ifdef TARGET_SIMD_X86
   void          initRdCostX86();
   template <X86_VEXT vext>
   void          _initRdCostX86();
 #endif
+#ifdef TARGET_SIMD_VEC
+  void          initRdCostVec();
+#endif
 
   void           setDistParam( DistParam &rcDP, const CPelBuf &org, const Pel* piRefY , int iRefStride, int bitDepth, ComponentID compID, int subShiftMode = 0, int step = 1, bool useHadamard = false );
   void           setDistParam( DistParam &rcDP, const CPelBuf &org, const CPelBuf &cur, int bitDepth, ComponentID compID, bool useHadamard = false );
@@ -388,9 +392,26 @@ private:
   static Distortion xGetSAD_NxN_SIMD( const DistParam& pcDtParam );
   template< X86_VEXT vext >
   static Distortion xGetSAD_IBD_SIMD(const DistParam& pcDtParam);
+#if WCG_EXT
+  template< X86_VEXT vext >
+  static Distortion xGetSSE_WTD_SIMD( const DistParam& pcDtParam );
+#endif
 
   template< typename Torg, typename Tcur, X86_VEXT vext >
   static Distortion xGetHADs_SIMD   ( const DistParam& pcDtParam );
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+  template< X86_VEXT vext, bool earlyExit >
+  static Distortion xGetSAD_HBD_SIMD  ( const DistParam& pcDtParam );
+  template< X86_VEXT vext >
+  static Distortion xGetHADs_HBD_SIMD ( const DistParam& pcDtParam );
+#endif
+#endif
+
+#ifdef TARGET_SIMD_VEC
+  template< bool earlyExit >
+  static Distortion xGetSAD_Vec       ( const DistParam& pcDtParam );
+  static Distortion xGetSSE_Vec       ( const DistParam& pcDtParam );
+  static Distortion xGetHADs_Vec      ( const DistParam& pcDtParam );
 #endif
 
 public:
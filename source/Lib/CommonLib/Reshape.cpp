@@ -61,6 +61,9 @@ void  Reshape::createDec(int bitDepth)
   m_lumaBD = bitDepth;
   m_reshapeLUTSize = 1 << m_lumaBD;
   m_initCW = m_reshapeLUTSize / PIC_CODE_CW_BINS;
+  memset( &m_fwdPWL, 0, sizeof( m_fwdPWL ) );
+  m_fwdPWL.log2BinLen = floorLog2( m_initCW );
+  m_fwdPWL.maxVal     = m_reshapeLUTSize - 1;
   if (m_fwdLUT.empty())
     m_fwdLUT.resize(m_reshapeLUTSize, 0);
   if (m_invLUT.empty())
@@ -208,6 +211,8 @@ void Reshape::constructReshaper()
     int log2PwlFwdBinLen = floorLog2(pwlFwdBinLen);
 
     int32_t scale = ((int32_t)(Y2 - Y1) * (1 << FP_PREC) + (1 << (log2PwlFwdBinLen - 1))) >> (log2PwlFwdBinLen);
+    m_fwdPWL.base [i] = Y1;
+    m_fwdPWL.scale[i] = scale;
     for (int j = 1; j < pwlFwdBinLen; j++)
     {
       int tempVal = Y1 + (((int32_t)scale * (int32_t)j + (1 << (FP_PREC - 1))) >> FP_PREC);
@@ -66,6 +66,7 @@ protected:
   std::vector<Pel>        m_reshapePivot;
   int                     m_lumaBD;
   int                     m_reshapeLUTSize;
+  LumaMapPWL              m_fwdPWL;
 public:
   Reshape();
 #if ENABLE_SPLIT_PARALLELISM
@@ -80,6 +81,7 @@ public:
   void reverseLUT(std::vector<Pel>& inputLUT, std::vector<Pel>& outputLUT, uint16_t lutSize);
   std::vector<Pel>&  getFwdLUT() { return m_fwdLUT; }
   std::vector<Pel>&  getInvLUT() { return m_invLUT; }
+  const LumaMapPWL&  getFwdPWL() const { return m_fwdPWL; }
   std::vector<int>&  getChromaAdjHelpLUT() { return m_chromaAdjHelpLUT; }
 
   bool getCTUFlag()              { return m_CTUFlag; }
@@ -332,6 +332,52 @@ uint32_t g_log2SbbSize[2][MAX_CU_DEPTH+1][MAX_CU_DEPTH+1][2] =
 };
 #endif
 // initialize ROM variables
+// same sample walk as the blending in InterPrediction, the samples outside of the weighted band take the full weight
+static void initTriangleWeights( uint8_t* weights, const int width, const int height, const int splitDir, const bool longWeight )
+{
+  const int ratioWH           = ( width > height ) ? ( width / height ) : 1;
+  const int ratioHW           = ( width > height ) ? 1 : ( height / width );
+  const int weightedLength    = longWeight ? 7 : 3;
+        int weightedStartPos  = ( splitDir == 0 ) ? ( 0 - ( weightedLength >> 1 ) * ratioWH ) : ( width - ( ( weightedLength + 1 ) >> 1 ) * ratioWH );
+        int weightedEndPos    = weightedStartPos + weightedLength * ratioWH - 1;
+  const int weightedPosoffset = ( splitDir == 0 ) ? ratioWH : -ratioWH;
+
+  for( int y = 0; y < height; y += ratioHW )
+  {
+    for( int tmpY = ratioHW; tmpY > 0; tmpY-- )
+    {
+      for( int x = 0; x < weightedStartPos; x++ )
+      {
+        *weights++ = splitDir == 0 ? 0 : 8;
+      }
+
+      const int tmpWeightedStart = std::max( 0, weightedStartPos );
+      const int tmpWeightedEnd   = std::min( weightedEndPos, width - 1 );
+      int       weightIdx        = 1;
+      if( weightedStartPos < 0 )
+      {
+        weightIdx += abs( weightedStartPos ) / ratioWH;
+      }
+      for( int x = tmpWeightedStart; x <= tmpWeightedEnd; x += ratioWH )
+      {
+        for( int tmpX = ratioWH; tmpX > 0; tmpX-- )
+        {
+          const int weight = Clip3( 1, 7, longWeight ? weightIdx : ( weightIdx * 2 ) );
+          *weights++ = splitDir ? ( 8 - weight ) : weight;
+        }
+        weightIdx++;
+      }
+
+      for( int x = weightedEndPos + 1; x < width; x++ )
+      {
+        *weights++ = splitDir == 0 ? 8 : 0;
+      }
+    }
+    weightedStartPos += weightedPosoffset;
+    weightedEndPos   += weightedPosoffset;
+  }
+}
+
 void initROM()
 {
   int c;
@@ -536,6 +582,22 @@ void initROM()
       }
     }
   }
+
+  for( int splitDir = 0; splitDir < TRIANGLE_DIR_NUM; splitDir++ )
+  {
+    for( int longWeight = 0; longWeight < 2; longWeight++ )
+    {
+      for( int log2Width = 1; log2Width <= MAX_CU_DEPTH; log2Width++ )
+      {
+        for( int log2Height = 1; log2Height <= MAX_CU_DEPTH; log2Height++ )
+        {
+          uint8_t* weights = new uint8_t[( 1 << log2Width ) << log2Height];
+          initTriangleWeights( weights, 1 << log2Width, 1 << log2Height, splitDir, longWeight != 0 );
+          g_triangleWeights[splitDir][longWeight][log2Width][log2Height] = weights;
+        }
+      }
+    }
+  }
 }
 
 void destroyROM()
@@ -578,6 +640,21 @@ void destroyROM()
   }
 #endif
 
+  for( int splitDir = 0; splitDir < TRIANGLE_DIR_NUM; splitDir++ )
+  {
+    for( int longWeight = 0; longWeight < 2; longWeight++ )
+    {
+      for( int log2Width = 1; log2Width <= MAX_CU_DEPTH; log2Width++ )
+      {
+        for( int log2Height = 1; log2Height <= MAX_CU_DEPTH; log2Height++ )
+        {
+          delete[] g_triangleWeights[splitDir][longWeight][log2Width][log2Height];
+          g_triangleWeights[splitDir][longWeight][log2Width][log2Height] = nullptr;
+        }
+      }
+    }
+  }
+
   delete gp_sizeIdxInfo;
   gp_sizeIdxInfo = nullptr;
 }
@@ -924,5 +1001,6 @@ const uint32_t g_scalingListSizeX[SCALING_LIST_SIZE_NUM] = { 2,  4,  8,  16,   3
 
 
 uint8_t g_triangleMvStorage[TRIANGLE_DIR_NUM][MAX_CU_DEPTH - MIN_CU_LOG2 + 1][MAX_CU_DEPTH - MIN_CU_LOG2 + 1][MAX_CU_SIZE >> MIN_CU_LOG2][MAX_CU_SIZE >> MIN_CU_LOG2];
+uint8_t* g_triangleWeights[TRIANGLE_DIR_NUM][2][MAX_CU_DEPTH + 1][MAX_CU_DEPTH + 1];
 
 //! \}
@@ -234,6 +234,8 @@ constexpr uint8_t g_tbMax[257] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
 //! \}
 
 extern       uint8_t g_triangleMvStorage[TRIANGLE_DIR_NUM][MAX_CU_DEPTH - MIN_CU_LOG2 + 1][MAX_CU_DEPTH - MIN_CU_LOG2 + 1][MAX_CU_SIZE >> MIN_CU_LOG2][MAX_CU_SIZE >> MIN_CU_LOG2];
+// weight of the first prediction (0..8) for every sample of a triangle block, [splitDir][longWeight][log2Width][log2Height]
+extern       uint8_t* g_triangleWeights[TRIANGLE_DIR_NUM][2][MAX_CU_DEPTH + 1][MAX_CU_DEPTH + 1];
 
 extern bool g_mctsDecCheckEnabled;
 
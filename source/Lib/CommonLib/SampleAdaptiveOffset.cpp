@@ -112,6 +112,13 @@ const SAOBlkParam& SAOBlkParam::operator= (const SAOBlkParam& src)
 
 SampleAdaptiveOffset::SampleAdaptiveOffset()
 {
+  m_offsetBlock = offsetBlock;
+
+#if ENABLE_SIMD_OPT_SAO
+#ifdef TARGET_SIMD_X86
+  initSampleAdaptiveOffsetX86();
+#endif
+#endif
 }
 
 
@@ -269,9 +276,14 @@ void SampleAdaptiveOffset::xReconstructBlkSAOParams(CodingStructure& cs, SAOBlkP
     m_picSAOEnabled[compIdx] = false;
   }
 
+  xReconstructBlkSAOParams(cs, saoBlkParams, 0, cs.pcv->sizeInCtus);
+}
+
+void SampleAdaptiveOffset::xReconstructBlkSAOParams(CodingStructure& cs, SAOBlkParam* saoBlkParams, const int startCtuRsAddr, const int endCtuRsAddr)
+{
   const uint32_t numberOfComponents = getNumberValidComponents(cs.pcv->chrFormat);
 
-  for(int ctuRsAddr=0; ctuRsAddr< cs.pcv->sizeInCtus; ctuRsAddr++)
+  for(int ctuRsAddr=startCtuRsAddr; ctuRsAddr< endCtuRsAddr; ctuRsAddr++)
   {
     SAOBlkParam* mergeList[NUM_SAO_MERGE_TYPES] = { NULL };
     getMergeList(cs, ctuRsAddr, saoBlkParams, mergeList);
@@ -295,6 +307,7 @@ void SampleAdaptiveOffset::offsetBlock(const int channelBitDepth, const ClpRng&
 #if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
                                           , bool isCtuCrossedByVirtualBoundaries, int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry, int numVerVirBndry
 #endif
+                                          , int8_t* signLineBuf1, int8_t* signLineBuf2
   )
 {
   int x,y, startX, startY, endX, endY, edgeType;
@@ -338,7 +351,7 @@ void SampleAdaptiveOffset::offsetBlock(const int channelBitDepth, const ClpRng&
   case SAO_TYPE_EO_90:
     {
       offset += 2;
-      int8_t *signUpLine = &m_signLineBuf1[0];
+      int8_t *signUpLine = signLineBuf1;
 
       startY = isAboveAvail ? 0 : 1;
       endY   = isBelowAvail ? height : height-1;
@@ -385,8 +398,8 @@ void SampleAdaptiveOffset::offsetBlock(const int channelBitDepth, const ClpRng&
       offset += 2;
       int8_t *signUpLine, *signDownLine, *signTmpLine;
 
-      signUpLine  = &m_signLineBuf1[0];
-      signDownLine= &m_signLineBuf2[0];
+      signUpLine  = signLineBuf1;
+      signDownLine= signLineBuf2;
 
       startX = isLeftAvail ? 0 : 1 ;
       endX   = isRightAvail ? width : (width-1);
@@ -469,7 +482,7 @@ void SampleAdaptiveOffset::offsetBlock(const int channelBitDepth, const ClpRng&
   case SAO_TYPE_EO_45:
     {
       offset += 2;
-      int8_t *signUpLine = &m_signLineBuf1[1];
+      int8_t *signUpLine = signLineBuf1 + 1;
 
       startX = isLeftAvail ? 0 : 1;
       endX   = isRightAvail ? width : (width -1);
@@ -622,7 +635,7 @@ void SampleAdaptiveOffset::offsetCTU( const UnitArea& area, const CPelUnitBuf& s
       }
 #endif
 
-      offsetBlock( cs.sps->getBitDepth(toChannelType(compID)),
+      m_offsetBlock( cs.sps->getBitDepth(toChannelType(compID)),
                    cs.slice->clpRng(compID),
                    ctbOffset.typeIdc, ctbOffset.offset
                   , srcBlk, resBlk, srcStride, resStride, compArea.width, compArea.height
@@ -633,6 +646,7 @@ void SampleAdaptiveOffset::offsetCTU( const UnitArea& area, const CPelUnitBuf& s
 #if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
                   , isCtuCrossedByVirtualBoundaries, horVirBndryPosComp, verVirBndryPosComp, numHorVirBndry, numVerVirBndry
 #endif
+                  , &m_signLineBuf1[0], &m_signLineBuf2[0]
                   );
     }
   } //compIdx
@@ -688,6 +702,34 @@ void SampleAdaptiveOffset::SAOProcess( CodingStructure& cs, SAOBlkParam* saoBlkP
   xPCMLFDisableProcess(cs);
 }
 
+void SampleAdaptiveOffset::SAOProcessCtuRow( CodingStructure& cs, SAOBlkParam* saoBlkParams, const int ctuRow )
+{
+  CHECK(!saoBlkParams, "No parameters present");
+
+  const PreCalcValues& pcv = *cs.pcv;
+  xReconstructBlkSAOParams(cs, saoBlkParams, ctuRow * pcv.widthInCtus, (ctuRow + 1) * pcv.widthInCtus);
+
+  // the deblocked samples are saved one CTU row ahead, as the filtering of a row reads the samples of the rows above and below
+  for( int row = ( ctuRow == 0 ? 0 : ctuRow + 1 ); row <= ctuRow + 1 && row < (int) pcv.heightInCtus; row++ )
+  {
+    const UnitArea rowArea = clipArea( UnitArea( cs.area.chromaFormat, Area( 0, row * pcv.maxCUHeight, pcv.lumaWidth, pcv.maxCUHeight ) ), cs.area );
+    m_tempBuf.getBuf( rowArea ).copyFrom( cs.getRecoBuf( rowArea ) );
+  }
+
+  PelUnitBuf rec = cs.getRecoBuf();
+  const uint32_t yPos = ctuRow * pcv.maxCUHeight;
+  int ctuRsAddr = ctuRow * pcv.widthInCtus;
+  for( uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth )
+  {
+    const uint32_t width  = (xPos + pcv.maxCUWidth  > pcv.lumaWidth)  ? (pcv.lumaWidth - xPos)  : pcv.maxCUWidth;
+    const uint32_t height = (yPos + pcv.maxCUHeight > pcv.lumaHeight) ? (pcv.lumaHeight - yPos) : pcv.maxCUHeight;
+    const UnitArea area( cs.area.chromaFormat, Area(xPos , yPos, width, height) );
+
+    offsetCTU( area, m_tempBuf, rec, saoBlkParams[ctuRsAddr], cs);
+    ctuRsAddr++;
+  }
+}
+
 void SampleAdaptiveOffset::xPCMLFDisableProcess(CodingStructure& cs)
 {
   const PreCalcValues& pcv = *cs.pcv;
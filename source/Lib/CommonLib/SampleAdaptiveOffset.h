@@ -67,6 +67,8 @@ public:
   virtual ~SampleAdaptiveOffset();
   void SAOProcess( CodingStructure& cs, SAOBlkParam* saoBlkParams
                    );
+  // CTU row of SAOProcess without the PCM and lossless sample restoration, called in row order once the rows up to ctuRow + 1 are deblocked
+  void SAOProcessCtuRow( CodingStructure& cs, SAOBlkParam* saoBlkParams, const int ctuRow );
   void create( int picWidth, int picHeight, ChromaFormat format, uint32_t maxCUWidth, uint32_t maxCUHeight, uint32_t maxCUDepth, uint32_t lumaBitShift, uint32_t chromaBitShift );
   void destroy();
   static int getMaxOffsetQVal(const int channelBitDepth) { return (1<<(std::min<int>(channelBitDepth,MAX_SAO_TRUNCATED_BITDEPTH)-5))-1; } //Table 9-32, inclusive
@@ -83,11 +85,19 @@ protected:
     bool& isBelowRightAvail
     ) const;
 
-  void offsetBlock(const int channelBitDepth, const ClpRng& clpRng, int typeIdx, int* offset, const Pel* srcBlk, Pel* resBlk, int srcStride, int resStride,  int width, int height
+  static void offsetBlock(const int channelBitDepth, const ClpRng& clpRng, int typeIdx, int* offset, const Pel* srcBlk, Pel* resBlk, int srcStride, int resStride,  int width, int height
                   , bool isLeftAvail, bool isRightAvail, bool isAboveAvail, bool isBelowAvail, bool isAboveLeftAvail, bool isAboveRightAvail, bool isBelowLeftAvail, bool isBelowRightAvail
 #if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
                   , bool isCtuCrossedByVirtualBoundaries, int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry, int numVerVirBndry
 #endif
+                  , int8_t* signLineBuf1, int8_t* signLineBuf2
+    );
+  void (*m_offsetBlock)(const int channelBitDepth, const ClpRng& clpRng, int typeIdx, int* offset, const Pel* srcBlk, Pel* resBlk, int srcStride, int resStride,  int width, int height
+                  , bool isLeftAvail, bool isRightAvail, bool isAboveAvail, bool isBelowAvail, bool isAboveLeftAvail, bool isAboveRightAvail, bool isBelowLeftAvail, bool isBelowRightAvail
+#if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
+                  , bool isCtuCrossedByVirtualBoundaries, int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry, int numVerVirBndry
+#endif
+                  , int8_t* signLineBuf1, int8_t* signLineBuf2
     );
   void invertQuantOffsets(ComponentID compIdx, int typeIdc, int typeAuxInfo, int* dstOffsets, int* srcOffsets);
   void reconstructBlkSAOParam(SAOBlkParam& recParam, SAOBlkParam* mergeList[NUM_SAO_MERGE_TYPES]);
@@ -97,9 +107,10 @@ protected:
   void xPCMCURestoration(CodingStructure& cs, const UnitArea &ctuArea);
   void xPCMSampleRestoration(CodingUnit& cu, const ComponentID compID);
   void xReconstructBlkSAOParams(CodingStructure& cs, SAOBlkParam* saoBlkParams);
+  void xReconstructBlkSAOParams(CodingStructure& cs, SAOBlkParam* saoBlkParams, const int startCtuRsAddr, const int endCtuRsAddr);
 #if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
   bool isCrossedByVirtualBoundaries(const int xPos, const int yPos, const int width, const int height, int& numHorVirBndry, int& numVerVirBndry, int horVirBndryPos[], int verVirBndryPos[], const PPS* pps);
-  inline bool isProcessDisabled(int xPos, int yPos, int numVerVirBndry, int numHorVirBndry, int verVirBndryPos[], int horVirBndryPos[])
+  static inline bool isProcessDisabled(int xPos, int yPos, int numVerVirBndry, int numHorVirBndry, int verVirBndryPos[], int horVirBndryPos[])
   {
     bool bDisabledFlag = false;
     for (int i = 0; i < numVerVirBndry; i++)
@@ -122,6 +133,14 @@ protected:
   }
 #endif
   Reshape* m_pcReshape;
+
+#if ENABLE_SIMD_OPT_SAO
+#ifdef TARGET_SIMD_X86
+  void initSampleAdaptiveOffsetX86();
+  template <X86_VEXT vext>
+  void _initSampleAdaptiveOffsetX86();
+#endif
+#endif
 protected:
   uint32_t m_offsetStepLog2[MAX_NUM_COMPONENT]; //offset step
   PelStorage m_tempBuf;
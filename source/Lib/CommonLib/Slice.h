@@ -2775,6 +2775,19 @@ public:
     return false;
   }
 
+  //! returns true, if storing the parameter set NAL unit data would replace the stored parameter set object
+  bool isReplacedBy(int psId, const std::vector<uint8_t> *pNaluData) const
+  {
+    const typename std::map<int,MapData<T> >::const_iterator constit=m_paramsetMap.find(psId);
+    if ( constit == m_paramsetMap.end() )
+    {
+      return false;
+    }
+    bool bChanged = constit->second.bChanged;
+    calculateParameterSetChangedFlag(bChanged, constit->second.pNaluData, pNaluData);
+    return bChanged;
+  }
+
   T* getPS(int psId)
   {
     typename std::map<int,MapData<T> >::iterator it=m_paramsetMap.find(psId);
@@ -2842,6 +2855,7 @@ public:
   bool           getSPSChangedFlag(int spsId) const                          { return m_spsMap.getChangedFlag(spsId); }
   void           clearSPSChangedFlag(int spsId)                              { m_spsMap.clearChangedFlag(spsId); }
   SPS*           getFirstSPS()                                               { return m_spsMap.getFirstPS(); };
+  bool           isSPSReplacedBy(int spsId, const std::vector<uint8_t> &naluData) const { return m_spsMap.isReplacedBy(spsId, &naluData); }
 
   //! store picture parameter set and take ownership of it
   void           storePPS(PPS *pps, const std::vector<uint8_t> &naluData) { m_ppsMap.storePS( pps->getPPSId(), pps, &naluData); };
@@ -2850,6 +2864,7 @@ public:
   bool           getPPSChangedFlag(int ppsId) const                          { return m_ppsMap.getChangedFlag(ppsId); }
   void           clearPPSChangedFlag(int ppsId)                              { m_ppsMap.clearChangedFlag(ppsId); }
   PPS*           getFirstPPS()                                               { return m_ppsMap.getFirstPS(); };
+  bool           isPPSReplacedBy(int ppsId, const std::vector<uint8_t> &naluData) const { return m_ppsMap.isReplacedBy(ppsId, &naluData); }
 
   //! activate a SPS from a active parameter sets SEI message
   //! \returns true, if activation is successful
@@ -2872,6 +2887,7 @@ public:
   bool           getAPSChangedFlag(int apsId, int apsType) const             { return m_apsMap.getChangedFlag((apsId << NUM_APS_TYPE_LEN) + apsType); }
   void           clearAPSChangedFlag(int apsId, int apsType)                 { m_apsMap.clearChangedFlag((apsId << NUM_APS_TYPE_LEN) + apsType); }
   APS*           getFirstAPS()                                               { return m_apsMap.getFirstPS(); };
+  bool           isAPSReplacedBy(int apsId, int apsType, const std::vector<uint8_t> &naluData) const { return m_apsMap.isReplacedBy((apsId << NUM_APS_TYPE_LEN) + apsType, &naluData); }
   bool           activateAPS(int apsId, int apsType);
 #else
   void           storeAPS(APS *aps, const std::vector<uint8_t> &naluData)    { m_apsMap.storePS(aps->getAPSId(), aps, &naluData); };
@@ -2879,6 +2895,7 @@ public:
   bool           getAPSChangedFlag(int apsId) const                          { return m_apsMap.getChangedFlag(apsId);             }
   void           clearAPSChangedFlag(int apsId)                              { m_apsMap.clearChangedFlag(apsId);                  }
   APS*           getFirstAPS()                                               { return m_apsMap.getFirstPS();                      };
+  bool           isAPSReplacedBy(int apsId, const std::vector<uint8_t> &naluData) const { return m_apsMap.isReplacedBy(apsId, &naluData); }
   bool           activateAPS(int apsId);
 #endif
 #if HEVC_VPS
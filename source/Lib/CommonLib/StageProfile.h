@@ -0,0 +1,440 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     StageProfile.h
+ *  \brief    Decoder per-stage timing and workload counters (header)
+ */
+
+#ifndef __STAGEPROFILE__
+#define __STAGEPROFILE__
+
+#include "CommonDef.h"
+
+#if DECODER_STAGE_PROFILE
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Rom.h"
+#include "Unit.h"
+
+//! \ingroup CommonLib
+//! \{
+
+// ====================================================================================================================
+// Enumerations
+// ====================================================================================================================
+
+/// decoder stages that are timed; time spent in a nested stage is not counted for the enclosing one
+enum StageProfileStage
+{
+  PROF_STAGE_OTHER = 0,         ///< picture level work outside of the stages below (slice setup, buffer handling, ...)
+  PROF_STAGE_PARSE,             ///< CTU syntax parsing (CABACReader)
+  PROF_STAGE_INTRA,             ///< intra prediction and reconstruction
+  PROF_STAGE_INTER,             ///< motion derivation, motion compensation and reconstruction
+  PROF_STAGE_INV_TRANSFORM,     ///< dequantisation and inverse transform
+  PROF_STAGE_LMCS,              ///< inverse luma mapping of the reconstructed picture
+  PROF_STAGE_DEBLOCK,
+  PROF_STAGE_SAO,
+  PROF_STAGE_ALF,
+  NUM_PROF_STAGES
+};
+
+enum StageProfileCounter
+{
+  PROF_COUNT_BINS_CTX = 0,      ///< context coded bins
+  PROF_COUNT_BINS_EP,           ///< bypass coded bins
+  PROF_COUNT_BINS_TRM,          ///< terminating bins
+  PROF_COUNT_CU_INTRA,
+  PROF_COUNT_CU_INTER,
+  PROF_COUNT_CU_IBC,
+  PROF_COUNT_CU_SKIP,
+  PROF_COUNT_CU_MERGE,
+  PROF_COUNT_CU_AFFINE,
+  PROF_COUNT_CU_TRIANGLE,
+  PROF_COUNT_CU_MH_INTRA,
+  PROF_COUNT_CU_ISP,
+  PROF_COUNT_CU_MIP,
+  PROF_COUNT_CU_BDPCM,
+  NUM_PROF_COUNTERS
+};
+
+static const int PROF_NUM_LOG2_SIZES = MAX_CU_DEPTH + 1;
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// collects stage times and workload counters per picture and aggregates them per temporal layer
+class StageProfile
+{
+public:
+  struct Record
+  {
+    int      poc;
+    int      temporalId;
+    int      numPictures;
+    uint64_t lumaSamples;
+    double   totalTime;                                             ///< seconds
+    double   stageTime  [NUM_PROF_STAGES];                          ///< seconds
+    uint64_t counters   [NUM_PROF_COUNTERS];
+    uint64_t cuSizes    [PROF_NUM_LOG2_SIZES][PROF_NUM_LOG2_SIZES]; ///< [log2 width][log2 height]
+
+    Record() { reset(); }
+
+    void reset()
+    {
+      poc         = 0;
+      temporalId  = 0;
+      numPictures = 0;
+      lumaSamples = 0;
+      totalTime   = 0;
+      std::fill_n( stageTime, NUM_PROF_STAGES,   0.0 );
+      std::fill_n( counters,  NUM_PROF_COUNTERS, uint64_t( 0 ) );
+      std::fill_n( &cuSizes[0][0], PROF_NUM_LOG2_SIZES * PROF_NUM_LOG2_SIZES, uint64_t( 0 ) );
+    }
+
+    void add( const Record& other )
+    {
+      numPictures += other.numPictures;
+      lumaSamples += other.lumaSamples;
+      totalTime   += other.totalTime;
+      for( int i = 0; i < NUM_PROF_STAGES;   i++ ) { stageTime[i] += other.stageTime[i]; }
+      for( int i = 0; i < NUM_PROF_COUNTERS; i++ ) { counters [i] += other.counters [i]; }
+      for( int w = 0; w < PROF_NUM_LOG2_SIZES; w++ )
+      {
+        for( int h = 0; h < PROF_NUM_LOG2_SIZES; h++ )
+        {
+          cuSizes[w][h] += other.cuSizes[w][h];
+        }
+      }
+    }
+
+    uint64_t numBins() const { return counters[PROF_COUNT_BINS_CTX] + counters[PROF_COUNT_BINS_EP] + counters[PROF_COUNT_BINS_TRM]; }
+  };
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  Record                          m_current;
+  std::vector<Record>             m_pictures;
+  std::vector<Record>             m_layers;
+  std::vector<StageProfileStage>  m_stack;
+  Clock::time_point               m_pictureStart;
+  Clock::time_point               m_lastSwitch;
+  bool                            m_pictureActive;
+
+  StageProfile()
+  : m_layers        ( MAX_TLAYER )
+  , m_stack         ( 1, PROF_STAGE_OTHER )
+  , m_pictureActive ( false )
+  {
+    for( int i = 0; i < MAX_TLAYER; i++ )
+    {
+      m_layers[i].poc        = -1;
+      m_layers[i].temporalId = i;
+    }
+  }
+
+  void xSwitch()
+  {
+    const Clock::time_point now = Clock::now();
+    if( m_pictureActive )
+    {
+      m_current.stageTime[m_stack.back()] += std::chrono::duration<double>( now - m_lastSwitch ).count();
+    }
+    m_lastSwitch = now;
+  }
+
+  static const char* xStageName( int stage )
+  {
+    static const char* names[NUM_PROF_STAGES] = { "other", "parse", "intra", "inter", "inv_transform", "lmcs", "deblock", "sao", "alf" };
+    return names[stage];
+  }
+
+  static const char* xCounterName( int counter )
+  {
+    static const char* names[NUM_PROF_COUNTERS] = { "bins_ctx", "bins_ep", "bins_trm", "cu_intra", "cu_inter", "cu_ibc", "cu_skip", "cu_merge",
+                                                    "cu_affine", "cu_triangle", "cu_mh_intra", "cu_isp", "cu_mip", "cu_bdpcm" };
+    return names[counter];
+  }
+
+  static void xWriteCsvLine( FILE* fp, const char* level, const Record& r )
+  {
+    fprintf( fp, "%s,%d,%d,%d,%" PRIu64 ",%.3f", level, r.poc, r.temporalId, r.numPictures, r.lumaSamples, r.totalTime * 1000.0 );
+    for( int i = 0; i < NUM_PROF_STAGES; i++ )
+    {
+      fprintf( fp, ",%.3f", r.stageTime[i] * 1000.0 );
+    }
+    for( int i = 0; i < NUM_PROF_COUNTERS; i++ )
+    {
+      fprintf( fp, ",%" PRIu64, r.counters[i] );
+    }
+    for( int w = 1; w < PROF_NUM_LOG2_SIZES; w++ )
+    {
+      for( int h = 1; h < PROF_NUM_LOG2_SIZES; h++ )
+      {
+        fprintf( fp, ",%" PRIu64, r.cuSizes[w][h] );
+      }
+    }
+    const uint64_t bins = r.numBins();
+    fprintf( fp, ",%.3f,%.3f\n", bins ? r.stageTime[PROF_STAGE_PARSE] * 1e9 / bins : 0.0, r.lumaSamples ? r.totalTime * 1e9 / r.lumaSamples : 0.0 );
+  }
+
+  static void xWriteJsonRecord( FILE* fp, const Record& r, const char* indent )
+  {
+    const uint64_t bins = r.numBins();
+    fprintf( fp, "%s{ \"poc\": %d, \"temporalId\": %d, \"pictures\": %d, \"lumaSamples\": %" PRIu64 ", \"totalMs\": %.3f,\n", indent, r.poc, r.temporalId, r.numPictures, r.lumaSamples, r.totalTime * 1000.0 );
+    fprintf( fp, "%s  \"stagesMs\": {", indent );
+    for( int i = 0; i < NUM_PROF_STAGES; i++ )
+    {
+      fprintf( fp, "%s \"%s\": %.3f", i ? "," : "", xStageName( i ), r.stageTime[i] * 1000.0 );
+    }
+    fprintf( fp, " },\n%s  \"counters\": {", indent );
+    for( int i = 0; i < NUM_PROF_COUNTERS; i++ )
+    {
+      fprintf( fp, "%s \"%s\": %" PRIu64, i ? "," : "", xCounterName( i ), r.counters[i] );
+    }
+    fprintf( fp, " },\n%s  \"cuSizes\": {", indent );
+    bool first = true;
+    for( int w = 0; w < PROF_NUM_LOG2_SIZES; w++ )
+    {
+      for( int h = 0; h < PROF_NUM_LOG2_SIZES; h++ )
+      {
+        if( r.cuSizes[w][h] )
+        {
+          fprintf( fp, "%s \"%dx%d\": %" PRIu64, first ? "" : ",", 1 << w, 1 << h, r.cuSizes[w][h] );
+          first = false;
+        }
+      }
+    }
+    fprintf( fp, " },\n%s  \"parseNsPerBin\": %.3f, \"nsPerSample\": %.3f }", indent,
+             bins ? r.stageTime[PROF_STAGE_PARSE] * 1e9 / bins : 0.0, r.lumaSamples ? r.totalTime * 1e9 / r.lumaSamples : 0.0 );
+  }
+
+public:
+  static StageProfile& GetSingletonInstance()
+  {
+    static StageProfile* inst = nullptr;
+    if( !inst )
+    {
+      inst = new StageProfile;
+    }
+
+    return *inst;
+  }
+
+  static void DestroyInstance()
+  {
+    StageProfile* sp = &GetSingletonInstance();
+    delete sp;
+  }
+
+  /// counters of the picture being decoded; the address stays valid for the lifetime of the instance
+  static uint64_t* getCounters() { return GetSingletonInstance().m_current.counters; }
+
+  static void startPicture( int poc, int temporalId, uint64_t lumaSamples )
+  {
+    StageProfile& sp = GetSingletonInstance();
+    sp.m_current.reset();
+    sp.m_current.poc         = poc;
+    sp.m_current.temporalId  = temporalId;
+    sp.m_current.numPictures = 1;
+    sp.m_current.lumaSamples = lumaSamples;
+    sp.m_pictureStart        = Clock::now();
+    sp.m_lastSwitch          = sp.m_pictureStart;
+    sp.m_pictureActive       = true;
+  }
+
+  static void finishPicture()
+  {
+    StageProfile& sp = GetSingletonInstance();
+    if( !sp.m_pictureActive )
+    {
+      return;
+    }
+    sp.xSwitch();
+    sp.m_current.totalTime = std::chrono::duration<double>( sp.m_lastSwitch - sp.m_pictureStart ).count();
+    sp.m_pictureActive     = false;
+
+    sp.m_pictures.push_back( sp.m_current );
+    sp.m_layers[std::min( sp.m_current.temporalId, MAX_TLAYER - 1 )].add( sp.m_current );
+    sp.m_current.reset();
+  }
+
+  static void enterStage( StageProfileStage stage )
+  {
+    StageProfile& sp = GetSingletonInstance();
+    sp.xSwitch();
+    sp.m_stack.push_back( stage );
+  }
+
+  static void leaveStage()
+  {
+    StageProfile& sp = GetSingletonInstance();
+    sp.xSwitch();
+    sp.m_stack.pop_back();
+  }
+
+  static void countCU( const CodingUnit& cu )
+  {
+    Record& r = GetSingletonInstance().m_current;
+    switch( cu.predMode )
+    {
+    case MODE_INTRA: r.counters[PROF_COUNT_CU_INTRA]++; break;
+    case MODE_INTER: r.counters[PROF_COUNT_CU_INTER]++; break;
+    case MODE_IBC:   r.counters[PROF_COUNT_CU_IBC  ]++; break;
+    default: break;
+    }
+    if( cu.skip )                         { r.counters[PROF_COUNT_CU_SKIP    ]++; }
+    if( cu.firstPU && cu.firstPU->mergeFlag && !cu.skip )
+                                          { r.counters[PROF_COUNT_CU_MERGE   ]++; }
+    if( cu.affine )                       { r.counters[PROF_COUNT_CU_AFFINE  ]++; }
+    if( cu.triangle )                     { r.counters[PROF_COUNT_CU_TRIANGLE]++; }
+    if( cu.firstPU && cu.firstPU->mhIntraFlag )
+                                          { r.counters[PROF_COUNT_CU_MH_INTRA]++; }
+    if( cu.ispMode )                      { r.counters[PROF_COUNT_CU_ISP     ]++; }
+    if( cu.mipFlag )                      { r.counters[PROF_COUNT_CU_MIP     ]++; }
+    if( cu.bdpcmMode )                    { r.counters[PROF_COUNT_CU_BDPCM   ]++; }
+
+    // size of the CU in its own channel, i.e. chroma CUs of a dual tree are counted with their chroma size
+    const CompArea& area = cu.blocks[cu.chType == CHANNEL_TYPE_LUMA ? COMPONENT_Y : COMPONENT_Cb];
+    const int log2W      = std::min<int>( g_aucLog2[area.width ], PROF_NUM_LOG2_SIZES - 1 );
+    const int log2H      = std::min<int>( g_aucLog2[area.height], PROF_NUM_LOG2_SIZES - 1 );
+    r.cuSizes[log2W][log2H]++;
+  }
+
+  /// writes the per picture, per temporal layer and total profile; JSON if the file name ends with ".json", CSV otherwise
+  static bool writeReport( const std::string& fileName )
+  {
+    const StageProfile& sp = GetSingletonInstance();
+    FILE* fp = fopen( fileName.c_str(), "w" );
+    if( !fp )
+    {
+      return false;
+    }
+
+    Record total;
+    total.poc        = -1;
+    total.temporalId = -1;
+    for( const Record& layer : sp.m_layers )
+    {
+      total.add( layer );
+    }
+
+    const bool json = fileName.size() >= 5 && fileName.compare( fileName.size() - 5, 5, ".json" ) == 0;
+    if( json )
+    {
+      fprintf( fp, "{\n  \"pictures\": [\n" );
+      for( size_t i = 0; i < sp.m_pictures.size(); i++ )
+      {
+        xWriteJsonRecord( fp, sp.m_pictures[i], "    " );
+        fprintf( fp, "%s\n", i + 1 < sp.m_pictures.size() ? "," : "" );
+      }
+      fprintf( fp, "  ],\n  \"temporalLayers\": [\n" );
+      bool first = true;
+      for( const Record& layer : sp.m_layers )
+      {
+        if( layer.numPictures )
+        {
+          fprintf( fp, "%s", first ? "" : ",\n" );
+          xWriteJsonRecord( fp, layer, "    " );
+          first = false;
+        }
+      }
+      fprintf( fp, "\n  ],\n  \"total\":\n" );
+      xWriteJsonRecord( fp, total, "    " );
+      fprintf( fp, "\n}\n" );
+    }
+    else
+    {
+      fprintf( fp, "level,poc,temporal_id,pictures,luma_samples,total_ms" );
+      for( int i = 0; i < NUM_PROF_STAGES; i++ )
+      {
+        fprintf( fp, ",%s_ms", xStageName( i ) );
+      }
+      for( int i = 0; i < NUM_PROF_COUNTERS; i++ )
+      {
+        fprintf( fp, ",%s", xCounterName( i ) );
+      }
+      for( int w = 1; w < PROF_NUM_LOG2_SIZES; w++ )
+      {
+        for( int h = 1; h < PROF_NUM_LOG2_SIZES; h++ )
+        {
+          fprintf( fp, ",cu_%dx%d", 1 << w, 1 << h );
+        }
+      }
+      fprintf( fp, ",parse_ns_per_bin,ns_per_sample\n" );
+
+      for( const Record& pic : sp.m_pictures )
+      {
+        xWriteCsvLine( fp, "picture", pic );
+      }
+      for( const Record& layer : sp.m_layers )
+      {
+        if( layer.numPictures )
+        {
+          xWriteCsvLine( fp, "layer", layer );
+        }
+      }
+      xWriteCsvLine( fp, "total", total );
+    }
+
+    fclose( fp );
+    return true;
+  }
+};
+
+/// times the enclosing scope as the given stage
+class StageProfileScope
+{
+public:
+  StageProfileScope( StageProfileStage stage ) { StageProfile::enterStage( stage ); }
+  ~StageProfileScope()                         { StageProfile::leaveStage(); }
+};
+
+#define PROFILE_STAGE( stage ) StageProfileScope stageProfileScope( stage )
+
+//! \}
+
+#else
+
+#define PROFILE_STAGE( stage )
+
+#endif // DECODER_STAGE_PROFILE
+
+#endif // __STAGEPROFILE__
@@ -56,6 +56,9 @@
 typedef void FwdTrans(const TCoeff*, TCoeff*, int, int, int, int);
 typedef void InvTrans(const TCoeff*, TCoeff*, int, int, int, int, const TCoeff, const TCoeff);
 
+extern FwdTrans *fastFwdTrans[NUM_TRANS_TYPE][g_numTransformMatrixSizes];
+extern InvTrans *fastInvTrans[NUM_TRANS_TYPE][g_numTransformMatrixSizes];
+
 // ====================================================================================================================
 // Class definition
 // ====================================================================================================================
@@ -87,11 +90,15 @@ public:
 #endif
 
 #if JVET_N0193_LFNST
-  void fwdLfnstNxN( int* src, int* dst, const uint32_t mode, const uint32_t index, const uint32_t size, int zeroOutSize );
-  void invLfnstNxN( int* src, int* dst, const uint32_t mode, const uint32_t index, const uint32_t size, int zeroOutSize );
+  void fwdLfnstNxN( TCoeff* src, TCoeff* dst, const uint32_t mode, const uint32_t index, const uint32_t size, int zeroOutSize );
+  void invLfnstNxN( TCoeff* src, TCoeff* dst, const uint32_t mode, const uint32_t index, const uint32_t size, int zeroOutSize );
 
   uint32_t getLFNSTIntraMode( int wideAngPredMode );
   bool     getTransposeFlag ( uint32_t intraMode  );
+
+  // LFNST matrix kernels, trMat holds zeroOutSize (or more) basis vectors of length trSize
+  static void xFwdLfnstCore( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize );
+  static void xInvLfnstCore( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize );
 #endif
 
 protected:
@@ -133,7 +140,22 @@ public:
   void    copyState( const TrQuant& other );
 #endif
 
+#if ENABLE_SIMD_TRAFO
+#ifdef TARGET_SIMD_X86
+  void initTrQuantX86();
+  template <X86_VEXT vext>
+  void _initTrQuantX86();
+#endif
+#endif
+
 protected:
+  FwdTrans* m_fwdTrans[NUM_TRANS_TYPE][g_numTransformMatrixSizes];
+  InvTrans* m_invTrans[NUM_TRANS_TYPE][g_numTransformMatrixSizes];
+#if JVET_N0193_LFNST
+  void ( *m_fwdLfnstCore )( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize );
+  void ( *m_invLfnstCore )( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize );
+#endif
+
   TCoeff*  m_plTempCoeff;
   uint32_t     m_uiMaxTrSize;
   bool     m_bEnc;
@@ -359,6 +359,16 @@ typedef std::pair<int, int>  TrCost;
 #define RExt__DECODER_DEBUG_STATISTICS                    1
 #endif
 
+// This can be enabled by the makefile
+#ifndef DECODER_STAGE_PROFILE
+#define DECODER_STAGE_PROFILE                             0 ///< 0 (default) = decoder reports as normal, 1 = decoder times parsing, reconstruction and in-loop filter stages and counts bins and CUs (see --StageProfile)
+#endif
+
+// This can be enabled by the makefile
+#ifndef ENCODER_MODE_PROFILE
+#define ENCODER_MODE_PROFILE                              0 ///< 0 (default) = encoder reports as normal, 1 = encoder records time, pruning and selection statistics per test mode (see --ModeProfile)
+#endif
+
 // ====================================================================================================================
 // Tool Switches - transitory (these macros are likely to be removed in future revisions)
 // ====================================================================================================================
@@ -382,13 +392,20 @@ typedef std::pair<int, int>  TrCost;
 
 // SIMD optimizations
 #define SIMD_ENABLE                                       1
-#define ENABLE_SIMD_OPT                                 ( SIMD_ENABLE && !RExt__HIGH_BIT_DEPTH_SUPPORT )    ///< SIMD optimizations, no impact on RD performance
+#define ENABLE_SIMD_OPT                                 ( SIMD_ENABLE )                                     ///< SIMD optimizations, no impact on RD performance
 #define ENABLE_SIMD_OPT_MCIF                            ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the interpolation filter, no impact on RD performance
 #define ENABLE_SIMD_OPT_BUFFER                          ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the buffer operations, no impact on RD performance
 #define ENABLE_SIMD_OPT_DIST                            ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the distortion calculations(SAD,SSE,HADAMARD), no impact on RD performance
 #define ENABLE_SIMD_OPT_AFFINE_ME                       ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for affine ME, no impact on RD performance
-#define ENABLE_SIMD_OPT_ALF                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for ALF
-#if ENABLE_SIMD_OPT_BUFFER
+#define ENABLE_SIMD_OPT_ALF                             ( 1 && ENABLE_SIMD_OPT && !RExt__HIGH_BIT_DEPTH_SUPPORT )///< SIMD optimization for ALF
+#define ENABLE_SIMD_TRAFO                               ( 1 && ENABLE_SIMD_OPT && !RExt__HIGH_BIT_DEPTH_SUPPORT )///< SIMD optimization for the primary transforms, no impact on RD performance
+#define ENABLE_SIMD_DBLF                                ( 1 && ENABLE_SIMD_OPT && !RExt__HIGH_BIT_DEPTH_SUPPORT )///< SIMD optimization for the deblocking filter, no impact on RD performance
+#define ENABLE_SIMD_OPT_SAO                             ( 1 && ENABLE_SIMD_OPT && !RExt__HIGH_BIT_DEPTH_SUPPORT )///< SIMD optimization for SAO, no impact on RD performance
+#define ENABLE_SIMD_OPT_INTRAPRED                       ( 1 && ENABLE_SIMD_OPT && !RExt__HIGH_BIT_DEPTH_SUPPORT )///< SIMD optimization for intra prediction, no impact on RD performance
+#define ENABLE_SIMD_OPT_MIP                             ( 1 && ENABLE_SIMD_OPT && JVET_N0217_MATRIX_INTRAPRED && !RExt__HIGH_BIT_DEPTH_SUPPORT ) ///< SIMD optimization for matrix-based intra prediction, no impact on RD performance
+#define ENABLE_SIMD_OPT_QUANT                           ( 1 && ENABLE_SIMD_OPT && !RExt__HIGH_BIT_DEPTH_SUPPORT )///< SIMD optimization for quantization and de-quantization, no impact on RD performance
+#define ENABLE_SIMD_OPT_DEPQUANT                        ( 1 && ENABLE_SIMD_OPT && !RExt__HIGH_BIT_DEPTH_SUPPORT )///< SIMD optimization for the dependent quantization trellis, no impact on RD performance
+#if ENABLE_SIMD_OPT_BUFFER && !RExt__HIGH_BIT_DEPTH_SUPPORT
 #define ENABLE_SIMD_OPT_GBI                               1                                                 ///< SIMD optimization for GBi
 #endif
 
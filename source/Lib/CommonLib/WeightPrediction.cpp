@@ -43,27 +43,6 @@
 #include "CodingStructure.h"
 
 
-static inline Pel weightBidir( int w0, Pel P0, int w1, Pel P1, int round, int shift, int offset, const ClpRng& clpRng)
-{
-  return ClipPel( ( (w0*(P0 + IF_INTERNAL_OFFS) + w1*(P1 + IF_INTERNAL_OFFS) + round + (offset << (shift-1))) >> shift ), clpRng );
-}
-
-static inline Pel weightUnidir( int w0, Pel P0, int round, int shift, int offset, const ClpRng& clpRng)
-{
-  return ClipPel( ( (w0*(P0 + IF_INTERNAL_OFFS) + round) >> shift ) + offset, clpRng );
-}
-
-static inline Pel noWeightUnidir( Pel P0, int round, int shift, int offset, const ClpRng& clpRng)
-{
-  return ClipPel( ( ((P0 + IF_INTERNAL_OFFS) + round) >> shift ) + offset, clpRng );
-}
-
-static inline Pel noWeightOffsetUnidir( Pel P0, int round, int shift, const ClpRng& clpRng)
-{
-  return ClipPel( ( ((P0 + IF_INTERNAL_OFFS) + round) >> shift ), clpRng );
-}
-
-
 // ====================================================================================================================
 // Class definition
 // ====================================================================================================================
@@ -191,27 +170,7 @@ void WeightPrediction::addWeightBi(const CPelUnitBuf          &pcYuvSrc0,
     const uint32_t iSrc1Stride = pcYuvSrc1.bufs[compID].stride;
     const uint32_t iDstStride =  rpcYuvDst.bufs[compID].stride;
 
-    for (int y = iHeight - 1; y >= 0; y--)
-    {
-      // do it in batches of 4 (partial unroll)
-      int x = iWidth - 1;
-
-      for (; x >= 3; )
-      {
-        pDst[x] = weightBidir(w0, pSrc0[x], w1, pSrc1[x], round, shift, offset, clpRng ); x--;
-        pDst[x] = weightBidir(w0, pSrc0[x], w1, pSrc1[x], round, shift, offset, clpRng ); x--;
-        pDst[x] = weightBidir(w0, pSrc0[x], w1, pSrc1[x], round, shift, offset, clpRng ); x--;
-        pDst[x] = weightBidir(w0, pSrc0[x], w1, pSrc1[x], round, shift, offset, clpRng ); x--;
-      }
-      for (; x >= 0; x--)
-      {
-        pDst[x] = weightBidir(w0, pSrc0[x], w1, pSrc1[x], round, shift, offset, clpRng );
-      }
-
-      pSrc0 += iSrc0Stride;
-      pSrc1 += iSrc1Stride;
-      pDst += iDstStride;
-    } // y loop
+    g_pelBufOP.weightBi(pSrc0, iSrc0Stride, pSrc1, iSrc1Stride, pDst, iDstStride, iWidth, iHeight, w0, w1, round, shift, offset, clpRng);
   } // compID loop
 }
 
@@ -249,27 +208,7 @@ void WeightPrediction::addWeightBiComponent(const CPelUnitBuf          &pcYuvSrc
   const uint32_t src1Stride = pcYuvSrc1.bufs[compID].stride;
   const uint32_t dstStride =  rpcYuvDst.bufs[compID].stride;
 
-  for (int y = height - 1; y >= 0; y--)
-  {
-    // do it in batches of 4 (partial unroll)
-    int x = width - 1;
-
-    for (; x >= 3; )
-    {
-      dst[x] = weightBidir(w0, src0[x], w1, src1[x], round, shift, offset, clpRng ); x--;
-      dst[x] = weightBidir(w0, src0[x], w1, src1[x], round, shift, offset, clpRng ); x--;
-      dst[x] = weightBidir(w0, src0[x], w1, src1[x], round, shift, offset, clpRng ); x--;
-      dst[x] = weightBidir(w0, src0[x], w1, src1[x], round, shift, offset, clpRng ); x--;
-    }
-    for (; x >= 0; x--)
-    {
-      dst[x] = weightBidir(w0, src0[x], w1, src1[x], round, shift, offset, clpRng );
-    }
-
-    src0 += src0Stride;
-    src1 += src1Stride;
-    dst += dstStride;
-  } // y loop
+  g_pelBufOP.weightBi(src0, src0Stride, src1, src1Stride, dst, dstStride, width, height, w0, w1, round, shift, offset, clpRng);
 }
 #endif
 
@@ -303,67 +242,13 @@ void  WeightPrediction::addWeightUni(const CPelUnitBuf          &pcYuvSrc0,
     if (w0 != 1 << wp0[compID].shift)
     {
       const int  round = (shift > 0) ? (1 << (shift - 1)) : 0;
-      for (int y = iHeight - 1; y >= 0; y--)
-      {
-        int x = iWidth - 1;
-        for (; x >= 3; )
-        {
-          pDst[x] = weightUnidir(w0, pSrc0[x], round, shift, offset, clpRng); x--;
-          pDst[x] = weightUnidir(w0, pSrc0[x], round, shift, offset, clpRng); x--;
-          pDst[x] = weightUnidir(w0, pSrc0[x], round, shift, offset, clpRng); x--;
-          pDst[x] = weightUnidir(w0, pSrc0[x], round, shift, offset, clpRng); x--;
-        }
-        for (; x >= 0; x--)
-        {
-          pDst[x] = weightUnidir(w0, pSrc0[x], round, shift, offset, clpRng);
-        }
-        pSrc0 += iSrc0Stride;
-        pDst += iDstStride;
-      }
+      g_pelBufOP.weightUni(pSrc0, iSrc0Stride, pDst, iDstStride, iWidth, iHeight, w0, round, shift, offset, clpRng);
     }
     else
     {
+      // unit weight, only the offset (if any) is applied on top of the default rounding
       const int  round = (shiftNum > 0) ? (1 << (shiftNum - 1)) : 0;
-      if (offset == 0)
-      {
-        for (int y = iHeight - 1; y >= 0; y--)
-        {
-          int x = iWidth - 1;
-          for (; x >= 3; )
-          {
-            pDst[x] = noWeightOffsetUnidir(pSrc0[x], round, shiftNum, clpRng); x--;
-            pDst[x] = noWeightOffsetUnidir(pSrc0[x], round, shiftNum, clpRng); x--;
-            pDst[x] = noWeightOffsetUnidir(pSrc0[x], round, shiftNum, clpRng); x--;
-            pDst[x] = noWeightOffsetUnidir(pSrc0[x], round, shiftNum, clpRng); x--;
-          }
-          for (; x >= 0; x--)
-          {
-            pDst[x] = noWeightOffsetUnidir(pSrc0[x], round, shiftNum, clpRng);
-          }
-          pSrc0 += iSrc0Stride;
-          pDst += iDstStride;
-        }
-      }
-      else
-      {
-        for (int y = iHeight - 1; y >= 0; y--)
-        {
-          int x = iWidth - 1;
-          for (; x >= 3; )
-          {
-            pDst[x] = noWeightUnidir(pSrc0[x], round, shiftNum, offset, clpRng); x--;
-            pDst[x] = noWeightUnidir(pSrc0[x], round, shiftNum, offset, clpRng); x--;
-            pDst[x] = noWeightUnidir(pSrc0[x], round, shiftNum, offset, clpRng); x--;
-            pDst[x] = noWeightUnidir(pSrc0[x], round, shiftNum, offset, clpRng); x--;
-          }
-          for (; x >= 0; x--)
-          {
-            pDst[x] = noWeightUnidir(pSrc0[x], round, shiftNum, offset, clpRng);
-          }
-          pSrc0 += iSrc0Stride;
-          pDst += iDstStride;
-        }
-      }
+      g_pelBufOP.weightUni(pSrc0, iSrc0Stride, pDst, iDstStride, iWidth, iHeight, 1, round, shiftNum, offset, clpRng);
     }
   }
 }
@@ -0,0 +1,316 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     BufferVec.cpp
+    \brief    PelBufferOps, portable vector kernels
+*/
+
+#include "CommonDefVec.h"
+#include "../Unit.h"
+#include "../Buffer.h"
+#include "../InterpolationFilter.h"
+
+#if ENABLE_SIMD_OPT_BUFFER && defined( TARGET_SIMD_VEC )
+
+static void addAvgVec( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int shift, int offset, const ClpRng& clpRng )
+{
+  const vIntx8 vmin8 = vecSet1<vIntx8>( clpRng.min );
+  const vIntx8 vmax8 = vecSet1<vIntx8>( clpRng.max );
+  const vIntx4 vmin4 = vecSet1<vIntx4>( clpRng.min );
+  const vIntx4 vmax4 = vecSet1<vIntx4>( clpRng.max );
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+
+    for( ; col + 8 <= width; col += 8 )
+    {
+      vIntx8 sum = VEC_CONVERT( vecLoad<vPelx8>( &src0[col] ), vIntx8 ) + VEC_CONVERT( vecLoad<vPelx8>( &src1[col] ), vIntx8 );
+      sum = vecClip( ( sum + offset ) >> shift, vmin8, vmax8 );
+      vecStore( &dst[col], VEC_CONVERT( sum, vPelx8 ) );
+    }
+
+    for( ; col + 4 <= width; col += 4 )
+    {
+      vIntx4 sum = VEC_CONVERT( vecLoad<vPelx4>( &src0[col] ), vIntx4 ) + VEC_CONVERT( vecLoad<vPelx4>( &src1[col] ), vIntx4 );
+      sum = vecClip( ( sum + offset ) >> shift, vmin4, vmax4 );
+      vecStore( &dst[col], VEC_CONVERT( sum, vPelx4 ) );
+    }
+
+    for( ; col < width; col++ )
+    {
+      dst[col] = ClipPel( rightShift( ( src0[col] + src1[col] + offset ), shift ), clpRng );
+    }
+
+    src0 += src0Stride;
+    src1 += src1Stride;
+    dst  +=  dstStride;
+  }
+}
+
+static void recoVec( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, const ClpRng& clpRng )
+{
+  const vIntx8 vmin8 = vecSet1<vIntx8>( clpRng.min );
+  const vIntx8 vmax8 = vecSet1<vIntx8>( clpRng.max );
+  const vIntx4 vmin4 = vecSet1<vIntx4>( clpRng.min );
+  const vIntx4 vmax4 = vecSet1<vIntx4>( clpRng.max );
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+
+    for( ; col + 8 <= width; col += 8 )
+    {
+      vIntx8 sum = VEC_CONVERT( vecLoad<vPelx8>( &src0[col] ), vIntx8 ) + VEC_CONVERT( vecLoad<vPelx8>( &src1[col] ), vIntx8 );
+      vecStore( &dst[col], VEC_CONVERT( vecClip( sum, vmin8, vmax8 ), vPelx8 ) );
+    }
+
+    for( ; col + 4 <= width; col += 4 )
+    {
+      vIntx4 sum = VEC_CONVERT( vecLoad<vPelx4>( &src0[col] ), vIntx4 ) + VEC_CONVERT( vecLoad<vPelx4>( &src1[col] ), vIntx4 );
+      vecStore( &dst[col], VEC_CONVERT( vecClip( sum, vmin4, vmax4 ), vPelx4 ) );
+    }
+
+    for( ; col < width; col++ )
+    {
+      dst[col] = ClipPel( src0[col] + src1[col], clpRng );
+    }
+
+    src0 += src0Stride;
+    src1 += src1Stride;
+    dst  +=  dstStride;
+  }
+}
+
+static void linTfVec( const Pel* src, int srcStride, Pel *dst, int dstStride, int width, int height, int scale, int shift, int offset, const ClpRng& clpRng, bool bClip )
+{
+  // rightShift() turns into a left shift for negative shifts
+  const int shl = shift < 0 ? -shift : 0;
+  const int shr = shift < 0 ? 0 : shift;
+
+  const vIntx8 vmin8 = vecSet1<vIntx8>( clpRng.min );
+  const vIntx8 vmax8 = vecSet1<vIntx8>( clpRng.max );
+  const vIntx4 vmin4 = vecSet1<vIntx4>( clpRng.min );
+  const vIntx4 vmax4 = vecSet1<vIntx4>( clpRng.max );
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+
+    for( ; col + 8 <= width; col += 8 )
+    {
+      vIntx8 val = ( ( ( VEC_CONVERT( vecLoad<vPelx8>( &src[col] ), vIntx8 ) * scale ) << shl ) >> shr ) + offset;
+      if( bClip )
+      {
+        val = vecClip( val, vmin8, vmax8 );
+      }
+      vecStore( &dst[col], VEC_CONVERT( val, vPelx8 ) );
+    }
+
+    for( ; col + 4 <= width; col += 4 )
+    {
+      vIntx4 val = ( ( ( VEC_CONVERT( vecLoad<vPelx4>( &src[col] ), vIntx4 ) * scale ) << shl ) >> shr ) + offset;
+      if( bClip )
+      {
+        val = vecClip( val, vmin4, vmax4 );
+      }
+      vecStore( &dst[col], VEC_CONVERT( val, vPelx4 ) );
+    }
+
+    for( ; col < width; col++ )
+    {
+      const int val = rightShift( scale * src[col], shift ) + offset;
+      dst[col] = ( Pel ) ( bClip ? ClipPel( val, clpRng ) : val );
+    }
+
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
+static void addBIOAvg4Vec( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, const Pel *gradX0, const Pel *gradX1, const Pel *gradY0, const Pel*gradY1, int gradStride, int width, int height, int tmpx, int tmpy, int shift, int offset, const ClpRng& clpRng )
+{
+  // the result is narrowed to int16_t and clipped in int16_t, including the clipping bounds
+  const vInt16x4 vmin = vecSet1<vInt16x4>( ( int16_t ) clpRng.min );
+  const vInt16x4 vmax = vecSet1<vInt16x4>( ( int16_t ) clpRng.max );
+
+  for( int y = 0; y < height; y++ )
+  {
+    for( int x = 0; x < width; x += 4 )
+    {
+      vIntx4 gX = VEC_CONVERT( vecLoad<vPelx4>( &gradX0[x] ), vIntx4 ) - VEC_CONVERT( vecLoad<vPelx4>( &gradX1[x] ), vIntx4 );
+      vIntx4 gY = VEC_CONVERT( vecLoad<vPelx4>( &gradY0[x] ), vIntx4 ) - VEC_CONVERT( vecLoad<vPelx4>( &gradY1[x] ), vIntx4 );
+      vIntx4 b  = ( gX * tmpx + gY * tmpy + 1 ) >> 1;
+      vIntx4 s  = VEC_CONVERT( vecLoad<vPelx4>( &src0[x] ), vIntx4 ) + VEC_CONVERT( vecLoad<vPelx4>( &src1[x] ), vIntx4 );
+      vInt16x4 val = VEC_CONVERT( ( s + b + offset ) >> shift, vInt16x4 );
+      vecStore( &dst[x], VEC_CONVERT( vecClip( val, vmin, vmax ), vPelx4 ) );
+    }
+
+    dst    += dstStride;  src0   += src0Stride; src1   += src1Stride;
+    gradX0 += gradStride; gradX1 += gradStride; gradY0 += gradStride; gradY1 += gradStride;
+  }
+}
+
+static void gradFilterVec( Pel* pSrc, int srcStride, int width, int height, int gradStride, Pel* gradX, Pel* gradY, const int bitDepth )
+{
+  Pel* srcTmp   = pSrc  + srcStride  + 1;
+  Pel* gradXTmp = gradX + gradStride + 1;
+  Pel* gradYTmp = gradY + gradStride + 1;
+#if JVET_N0325_BDOF
+  const int shift1 = std::max<int>( 6, ( bitDepth - 6 ) );
+#else
+  const int shift1 = std::max<int>( 2, ( IF_INTERNAL_PREC - bitDepth ) );
+#endif
+  const int widthInside  = width  - 2 * BIO_EXTEND_SIZE;
+  const int heightInside = height - 2 * BIO_EXTEND_SIZE;
+
+  for( int y = 0; y < heightInside; y++ )
+  {
+    int x = 0;
+
+    for( ; x + 8 <= widthInside; x += 8 )
+    {
+      vIntx8 below = VEC_CONVERT( vecLoad<vPelx8>( &srcTmp[x + srcStride] ), vIntx8 );
+      vIntx8 above = VEC_CONVERT( vecLoad<vPelx8>( &srcTmp[x - srcStride] ), vIntx8 );
+      vIntx8 right = VEC_CONVERT( vecLoad<vPelx8>( &srcTmp[x + 1] ),         vIntx8 );
+      vIntx8 left  = VEC_CONVERT( vecLoad<vPelx8>( &srcTmp[x - 1] ),         vIntx8 );
+      vecStore( &gradYTmp[x], VEC_CONVERT( ( below - above ) >> shift1, vPelx8 ) );
+      vecStore( &gradXTmp[x], VEC_CONVERT( ( right - left  ) >> shift1, vPelx8 ) );
+    }
+
+    for( ; x < widthInside; x++ )
+    {
+      gradYTmp[x] = ( srcTmp[x + srcStride] - srcTmp[x - srcStride] ) >> shift1;
+      gradXTmp[x] = ( srcTmp[x + 1] - srcTmp[x - 1] ) >> shift1;
+    }
+
+    gradXTmp += gradStride;
+    gradYTmp += gradStride;
+    srcTmp   += srcStride;
+  }
+
+  gradXTmp = gradX + gradStride + 1;
+  gradYTmp = gradY + gradStride + 1;
+  for( int y = 0; y < heightInside; y++ )
+  {
+    gradXTmp[-1] = gradXTmp[0];
+    gradXTmp[widthInside] = gradXTmp[widthInside - 1];
+    gradXTmp += gradStride;
+
+    gradYTmp[-1] = gradYTmp[0];
+    gradYTmp[widthInside] = gradYTmp[widthInside - 1];
+    gradYTmp += gradStride;
+  }
+
+  gradXTmp = gradX + gradStride;
+  gradYTmp = gradY + gradStride;
+  ::memcpy( gradXTmp - gradStride, gradXTmp, sizeof( Pel ) * ( width ) );
+  ::memcpy( gradXTmp + heightInside * gradStride, gradXTmp + ( heightInside - 1 ) * gradStride, sizeof( Pel ) * ( width ) );
+  ::memcpy( gradYTmp - gradStride, gradYTmp, sizeof( Pel ) * ( width ) );
+  ::memcpy( gradYTmp + heightInside * gradStride, gradYTmp + ( heightInside - 1 ) * gradStride, sizeof( Pel ) * ( width ) );
+}
+
+static void calcBIOParVec( const Pel* srcY0Temp, const Pel* srcY1Temp, const Pel* gradX0, const Pel* gradX1, const Pel* gradY0, const Pel* gradY1, int* dotProductTemp1, int* dotProductTemp2, int* dotProductTemp3, int* dotProductTemp5, int* dotProductTemp6, const int src0Stride, const int src1Stride, const int gradStride, const int widthG, const int heightG, const int bitDepth )
+{
+#if JVET_N0325_BDOF
+  const int shift4 = std::max<int>( 4, ( bitDepth - 8 ) );
+  const int shift5 = std::max<int>( 1, ( bitDepth - 11 ) );
+#else
+  const int shift4 = std::min<int>( 8, ( bitDepth - 4 ) );
+  const int shift5 = std::min<int>( 5, ( bitDepth - 7 ) );
+#endif
+
+  for( int y = 0; y < heightG; y++ )
+  {
+    int x = 0;
+
+    for( ; x + 8 <= widthG; x += 8 )
+    {
+      vIntx8 temp  = ( VEC_CONVERT( vecLoad<vPelx8>( &srcY0Temp[x] ), vIntx8 ) >> shift4 ) - ( VEC_CONVERT( vecLoad<vPelx8>( &srcY1Temp[x] ), vIntx8 ) >> shift4 );
+      vIntx8 tempX = ( VEC_CONVERT( vecLoad<vPelx8>( &gradX0[x] ),    vIntx8 ) + VEC_CONVERT( vecLoad<vPelx8>( &gradX1[x] ), vIntx8 ) ) >> shift5;
+      vIntx8 tempY = ( VEC_CONVERT( vecLoad<vPelx8>( &gradY0[x] ),    vIntx8 ) + VEC_CONVERT( vecLoad<vPelx8>( &gradY1[x] ), vIntx8 ) ) >> shift5;
+      vecStore( &dotProductTemp1[x],  tempX * tempX );
+      vecStore( &dotProductTemp2[x],  tempX * tempY );
+      vecStore( &dotProductTemp3[x], -tempX * temp  );
+      vecStore( &dotProductTemp5[x],  tempY * tempY );
+      vecStore( &dotProductTemp6[x], -tempY * temp  );
+    }
+
+    for( ; x < widthG; x++ )
+    {
+      int temp  = ( srcY0Temp[x] >> shift4 ) - ( srcY1Temp[x] >> shift4 );
+      int tempX = ( gradX0[x] + gradX1[x] ) >> shift5;
+      int tempY = ( gradY0[x] + gradY1[x] ) >> shift5;
+      dotProductTemp1[x] =  tempX * tempX;
+      dotProductTemp2[x] =  tempX * tempY;
+      dotProductTemp3[x] = -tempX * temp;
+      dotProductTemp5[x] =  tempY * tempY;
+      dotProductTemp6[x] = -tempY * temp;
+    }
+
+    srcY0Temp += src0Stride;
+    srcY1Temp += src1Stride;
+    gradX0    += gradStride;
+    gradX1    += gradStride;
+    gradY0    += gradStride;
+    gradY1    += gradStride;
+    dotProductTemp1 += widthG;
+    dotProductTemp2 += widthG;
+    dotProductTemp3 += widthG;
+    dotProductTemp5 += widthG;
+    dotProductTemp6 += widthG;
+  }
+}
+
+void PelBufferOps::initPelBufOpsVec()
+{
+  if( !read_vec_extension_flag() )
+  {
+    return;
+  }
+
+  addAvg8 = addAvgVec;
+  addAvg4 = addAvgVec;
+
+  reco8 = recoVec;
+  reco4 = recoVec;
+
+  linTf8 = linTfVec;
+  linTf4 = linTfVec;
+
+  addBIOAvg4    = addBIOAvg4Vec;
+  bioGradFilter = gradFilterVec;
+  calcBIOPar    = calcBIOParVec;
+}
+
+#endif
@@ -0,0 +1,124 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * \ingroup CommonLib
+ * \file    CommonDefVec.cpp
+ * \brief   Selection of the SIMD kernel backend (scalar, portable vector or native x86).
+ */
+
+#include <string>
+#include "CommonLib/CommonDef.h"
+
+
+#if ENABLE_SIMD_OPT
+
+#ifdef TARGET_SIMD_VEC
+static bool b_detection_finished( false );
+static bool vec_flag = false;
+
+/**
+ * \brief Decide once whether the portable vector kernels are used.
+ *
+ * "VEC" forces them and keeps the native x86 kernels out, any other mode leaves them off on x86.
+ * Without a native backend they are the default and only "SCALAR" turns them off.
+ */
+bool read_vec_extension_flag( const std::string &extStrId )
+{
+  if( !b_detection_finished )
+  {
+    if( extStrId == "VEC" )
+    {
+      vec_flag = true;
+#ifdef TARGET_SIMD_X86
+      read_x86_extension_flags( "SCALAR" );
+#endif
+    }
+    else
+    {
+#ifdef TARGET_SIMD_X86
+      vec_flag = false;
+#else
+      if( !extStrId.empty() && extStrId != "SCALAR" )
+      {
+        EXIT( "Mode not supported: " << extStrId << "\n" );
+      }
+      vec_flag = extStrId.empty();
+#endif
+    }
+
+    b_detection_finished = true;
+  }
+
+  return vec_flag;
+}
+
+void reset_vec_extension_flag()
+{
+  b_detection_finished = false;
+  vec_flag             = false;
+}
+#endif
+
+const char* read_simd_extension( const std::string &extStrId )
+{
+#ifdef TARGET_SIMD_VEC
+  if( read_vec_extension_flag( extStrId ) )
+  {
+    return "VEC";
+  }
+#endif
+#ifdef TARGET_SIMD_X86
+  return read_x86_extension( extStrId );
+#else
+  return "SCALAR";
+#endif
+}
+
+/**
+ * \brief Drop the cached selection and select the backend again.
+ *
+ * Only objects constructed afterwards pick up the new kernels, those that already exist keep their tables.
+ */
+const char* select_simd_extension( const std::string &extStrId )
+{
+#ifdef TARGET_SIMD_VEC
+  reset_vec_extension_flag();
+#endif
+#ifdef TARGET_SIMD_X86
+  reset_x86_extension_flags();
+#endif
+  return read_simd_extension( extStrId );
+}
+
+#endif // ENABLE_SIMD_OPT
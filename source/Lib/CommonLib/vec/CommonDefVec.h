@@ -0,0 +1,136 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     CommonDefVec.h
+    \brief    Portable vector types and helpers on top of the GCC/clang vector extensions
+*/
+
+#ifndef __COMMONDEFVEC__
+#define __COMMONDEFVEC__
+
+
+#include "CommonLib/CommonDef.h"
+
+#include <string.h>
+#include <type_traits>
+#include <utility>
+
+//! \ingroup CommonLib
+//! \{
+
+#ifdef TARGET_SIMD_VEC
+
+// all vectors hold either 4 or 8 lanes, the register width follows the lane type
+typedef int16_t           vInt16x4  __attribute__( ( vector_size(  4 * sizeof( int16_t           ) ) ) );
+typedef Pel               vPelx4    __attribute__( ( vector_size(  4 * sizeof( Pel               ) ) ) );
+typedef Pel               vPelx8    __attribute__( ( vector_size(  8 * sizeof( Pel               ) ) ) );
+typedef int32_t           vIntx4    __attribute__( ( vector_size(  4 * sizeof( int32_t           ) ) ) );
+typedef int32_t           vIntx8    __attribute__( ( vector_size(  8 * sizeof( int32_t           ) ) ) );
+typedef TCoeff            vCoeffx4  __attribute__( ( vector_size(  4 * sizeof( TCoeff            ) ) ) );
+typedef TCoeff            vCoeffx8  __attribute__( ( vector_size(  8 * sizeof( TCoeff            ) ) ) );
+typedef Intermediate_UInt vUIntx8   __attribute__( ( vector_size(  8 * sizeof( Intermediate_UInt ) ) ) );
+typedef Distortion        vDistx8   __attribute__( ( vector_size(  8 * sizeof( Distortion        ) ) ) );
+
+#define VEC_CONVERT( v, V )       __builtin_convertvector( ( v ), V )
+
+// unaligned loads and stores, memcpy is folded into a single vector move
+template<typename V, typename T>
+static inline V vecLoad( const T* src )
+{
+  V v;
+  memcpy( &v, src, sizeof( V ) );
+  return v;
+}
+
+template<typename V, typename T>
+static inline void vecStore( T* dst, const V& v )
+{
+  memcpy( dst, &v, sizeof( V ) );
+}
+
+// comparisons return a lane mask of the signed type with the same lane width
+template<typename V>
+static inline V vecMin( const V& a, const V& b )
+{
+  const V m = ( V ) ( a < b );
+  return ( a & m ) | ( b & ~m );
+}
+
+template<typename V>
+static inline V vecMax( const V& a, const V& b )
+{
+  const V m = ( V ) ( a > b );
+  return ( a & m ) | ( b & ~m );
+}
+
+template<typename V>
+static inline V vecClip( const V& v, const V& lo, const V& hi )
+{
+  return vecMin( vecMax( v, lo ), hi );
+}
+
+template<typename V>
+static inline V vecAbs( const V& v )
+{
+  return vecMax( v, -v );
+}
+
+template<typename V>
+struct VecLane
+{
+  typedef typename std::remove_cv<typename std::remove_reference<decltype( std::declval<V&>()[0] )>::type>::type type;
+};
+
+template<typename V, typename T>
+static inline V vecSet1( const T val )
+{
+  V v = { };
+  return v + ( typename VecLane<V>::type ) val;
+}
+
+template<typename T, int N, typename V>
+static inline T vecHSum( const V& v )
+{
+  T sum = 0;
+  for( int i = 0; i < N; i++ )
+  {
+    sum += v[i];
+  }
+  return sum;
+}
+
+#endif // TARGET_SIMD_VEC
+
+//! \}
+
+#endif // __COMMONDEFVEC__
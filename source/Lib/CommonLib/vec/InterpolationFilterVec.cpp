@@ -0,0 +1,229 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Implementation of InterpolationFilter class, portable vector kernels
+ */
+
+#include "CommonDefVec.h"
+#include "../InterpolationFilter.h"
+
+#if ENABLE_SIMD_OPT_MCIF && defined( TARGET_SIMD_VEC )
+
+// dst = [clip]( ( ( src << shl ) + add ) >> shr ), covering every full-pel case of filterCopy
+template<bool doClip>
+static void fullPelCopyVec( const ClpRng& clpRng, const Pel* src, int srcStride, Pel* dst, int dstStride, int width, int height, int shl, int add, int shr )
+{
+  const vPelx8 vmin = vecSet1<vPelx8>( clpRng.min );
+  const vPelx8 vmax = vecSet1<vPelx8>( clpRng.max );
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+
+    for( ; col + 8 <= width; col += 8 )
+    {
+      vIntx8 val = VEC_CONVERT( vecLoad<vPelx8>( &src[col] ), vIntx8 );
+      vPelx8 res = VEC_CONVERT( ( ( val << shl ) + add ) >> shr, vPelx8 );
+      if( doClip )
+      {
+        res = vecClip( res, vmin, vmax );
+      }
+      vecStore( &dst[col], res );
+    }
+
+    for( ; col < width; col++ )
+    {
+      Pel res = ( ( src[col] << shl ) + add ) >> shr;
+      dst[col] = doClip ? ClipPel( res, clpRng ) : res;
+    }
+
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
+template<bool isFirst, bool isLast>
+static void filterCopyVec( const ClpRng& clpRng, const Pel* src, int srcStride, Pel* dst, int dstStride, int width, int height, bool biMCForDMVR )
+{
+  if( isFirst == isLast )
+  {
+#if HM_JEM_CLIP_PEL
+    fullPelCopyVec<false>( clpRng, src, srcStride, dst, dstStride, width, height, 0, 0, 0 );
+#else
+    fullPelCopyVec<true >( clpRng, src, srcStride, dst, dstStride, width, height, 0, 0, 0 );
+#endif
+  }
+  else if( biMCForDMVR )
+  {
+    if( ( clpRng.bd - IF_INTERNAL_PREC_BILINEAR ) > 0 )
+    {
+      const int shift10BitOut = ( clpRng.bd - IF_INTERNAL_PREC_BILINEAR );
+      fullPelCopyVec<false>( clpRng, src, srcStride, dst, dstStride, width, height, 0, 1 << ( shift10BitOut - 1 ), shift10BitOut );
+    }
+    else
+    {
+      const int shift10BitOut = ( IF_INTERNAL_PREC_BILINEAR - clpRng.bd );
+      fullPelCopyVec<false>( clpRng, src, srcStride, dst, dstStride, width, height, shift10BitOut, 0, 0 );
+    }
+  }
+  else
+  {
+    const int shift = std::max<int>( 2, ( IF_INTERNAL_PREC - clpRng.bd ) );
+
+    if( isFirst )
+    {
+      fullPelCopyVec<false>( clpRng, src, srcStride, dst, dstStride, width, height, shift, -IF_INTERNAL_OFFS, 0 );
+    }
+    else
+    {
+      fullPelCopyVec<true >( clpRng, src, srcStride, dst, dstStride, width, height, 0, IF_INTERNAL_OFFS + ( 1 << ( shift - 1 ) ), shift );
+    }
+  }
+}
+
+template<int N, bool isVertical, bool isFirst, bool isLast>
+static void filterVec( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR )
+{
+  int c[N];
+  for( int i = 0; i < N; i++ )
+  {
+    c[i] = coeff[i];
+  }
+
+  const int cStride = ( isVertical ) ? srcStride : 1;
+  src -= ( N/2 - 1 ) * cStride;
+
+  int offset;
+  int headRoom = std::max<int>( 2, ( IF_INTERNAL_PREC - clpRng.bd ) );
+  int shift    = IF_FILTER_PREC;
+
+  if( isLast )
+  {
+    shift += ( isFirst ) ? 0 : headRoom;
+    offset = 1 << ( shift - 1 );
+    offset += ( isFirst ) ? 0 : IF_INTERNAL_OFFS << IF_FILTER_PREC;
+  }
+  else
+  {
+    shift -= ( isFirst ) ? headRoom : 0;
+    offset = ( isFirst ) ? -IF_INTERNAL_OFFS << shift : 0;
+  }
+
+  if( biMCForDMVR )
+  {
+    if( isFirst )
+    {
+      shift = IF_FILTER_PREC_BILINEAR - ( IF_INTERNAL_PREC_BILINEAR - clpRng.bd );
+      offset = 1 << ( shift - 1 );
+    }
+    else
+    {
+      shift = 4;
+      offset = 1 << ( shift - 1 );
+    }
+  }
+
+  const vPelx8 vmin = vecSet1<vPelx8>( clpRng.min );
+  const vPelx8 vmax = vecSet1<vPelx8>( clpRng.max );
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+
+    for( ; col + 8 <= width; col += 8 )
+    {
+      vIntx8 sum = VEC_CONVERT( vecLoad<vPelx8>( &src[col] ), vIntx8 ) * c[0];
+      for( int i = 1; i < N; i++ )
+      {
+        sum += VEC_CONVERT( vecLoad<vPelx8>( &src[col + i * cStride] ), vIntx8 ) * c[i];
+      }
+
+      // the sum is narrowed to Pel before clipping, as in the scalar version
+      vPelx8 val = VEC_CONVERT( ( sum + offset ) >> shift, vPelx8 );
+      if( isLast )
+      {
+        val = vecClip( val, vmin, vmax );
+      }
+      vecStore( &dst[col], val );
+    }
+
+    for( ; col < width; col++ )
+    {
+      int sum = src[col] * c[0];
+      for( int i = 1; i < N; i++ )
+      {
+        sum += src[col + i * cStride] * c[i];
+      }
+
+      Pel val = ( sum + offset ) >> shift;
+      dst[col] = isLast ? ClipPel( val, clpRng ) : val;
+    }
+
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
+template<int N, bool isVertical>
+static void initFilterVec( void( *fnc[2][2] )( const ClpRng&, Pel const*, int, Pel*, int, int, int, TFilterCoeff const*, bool ) )
+{
+  fnc[0][0] = filterVec<N, isVertical, false, false>;
+  fnc[0][1] = filterVec<N, isVertical, false, true >;
+  fnc[1][0] = filterVec<N, isVertical, true,  false>;
+  fnc[1][1] = filterVec<N, isVertical, true,  true >;
+}
+
+void InterpolationFilter::initInterpolationFilterVec()
+{
+  if( !read_vec_extension_flag() )
+  {
+    return;
+  }
+
+  initFilterVec<8, false>( m_filterHor[0] );
+  initFilterVec<4, false>( m_filterHor[1] );
+  initFilterVec<2, false>( m_filterHor[2] );
+
+  initFilterVec<8, true >( m_filterVer[0] );
+  initFilterVec<4, true >( m_filterVer[1] );
+  initFilterVec<2, true >( m_filterVer[2] );
+
+  m_filterCopy[0][0] = filterCopyVec<false, false>;
+  m_filterCopy[0][1] = filterCopyVec<false, true >;
+  m_filterCopy[1][0] = filterCopyVec<true,  false>;
+  m_filterCopy[1][1] = filterCopyVec<true,  true >;
+}
+
+#endif
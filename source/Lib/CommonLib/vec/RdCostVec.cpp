@@ -0,0 +1,291 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     RdCostVec.cpp
+    \brief    RD cost computation class, portable vector kernels
+*/
+
+#include "CommonDefVec.h"
+#include "../RdCost.h"
+#include "../RdCostWeightPrediction.h"
+
+#if ENABLE_SIMD_OPT_DIST && defined( TARGET_SIMD_VEC )
+
+template<bool earlyExit>
+Distortion RdCost::xGetSAD_Vec( const DistParam& rcDtParam )
+{
+  if( rcDtParam.applyWeight )
+  {
+    return RdCostWeightPrediction::xGetSADw( rcDtParam );
+  }
+
+  const Pel* piOrg           = rcDtParam.org.buf;
+  const Pel* piCur           = rcDtParam.cur.buf;
+  const int  iCols           = rcDtParam.org.width;
+        int  iRows           = rcDtParam.org.height;
+  const int  iSubShift       = rcDtParam.subShift;
+  const int  iSubStep        = ( 1 << iSubShift );
+  const int  iStrideCur      = rcDtParam.cur.stride * iSubStep;
+  const int  iStrideOrg      = rcDtParam.org.stride * iSubStep;
+  const uint32_t distortionShift = DISTORTION_PRECISION_ADJUSTMENT( rcDtParam.bitDepth );
+
+  Distortion uiSum = 0;
+
+  for( ; iRows != 0; iRows -= iSubStep )
+  {
+    int n = 0;
+
+    vIntx8 vsum8 = { };
+    for( ; n + 8 <= iCols; n += 8 )
+    {
+      vsum8 += vecAbs( VEC_CONVERT( vecLoad<vPelx8>( &piOrg[n] ), vIntx8 ) - VEC_CONVERT( vecLoad<vPelx8>( &piCur[n] ), vIntx8 ) );
+    }
+    int rowSum = vecHSum<int, 8>( vsum8 );
+
+    if( n + 4 <= iCols )
+    {
+      rowSum += vecHSum<int, 4>( vecAbs( VEC_CONVERT( vecLoad<vPelx4>( &piOrg[n] ), vIntx4 ) - VEC_CONVERT( vecLoad<vPelx4>( &piCur[n] ), vIntx4 ) ) );
+      n += 4;
+    }
+
+    for( ; n < iCols; n++ )
+    {
+      rowSum += abs( piOrg[n] - piCur[n] );
+    }
+
+    uiSum += rowSum;
+    if( earlyExit && rcDtParam.maximumDistortionForEarlyExit < ( uiSum >> distortionShift ) )
+    {
+      return ( uiSum >> distortionShift );
+    }
+    piOrg += iStrideOrg;
+    piCur += iStrideCur;
+  }
+
+  uiSum <<= iSubShift;
+  return ( uiSum >> distortionShift );
+}
+
+Distortion RdCost::xGetSSE_Vec( const DistParam& rcDtParam )
+{
+  if( rcDtParam.applyWeight )
+  {
+    return RdCostWeightPrediction::xGetSSEw( rcDtParam );
+  }
+
+  const Pel* piOrg      = rcDtParam.org.buf;
+  const Pel* piCur      = rcDtParam.cur.buf;
+  int  iRows            = rcDtParam.org.height;
+  int  iCols            = rcDtParam.org.width;
+  int  iStrideCur       = rcDtParam.cur.stride;
+  int  iStrideOrg       = rcDtParam.org.stride;
+
+  const uint32_t uiShift = DISTORTION_PRECISION_ADJUSTMENT( rcDtParam.bitDepth ) << 1;
+
+  // the squares are formed modulo the width of Intermediate_UInt and summed in Distortion precision
+  vDistx8    vsum  = { };
+  Distortion uiSum = 0;
+
+  for( ; iRows != 0; iRows-- )
+  {
+    int n = 0;
+
+    for( ; n + 8 <= iCols; n += 8 )
+    {
+      vUIntx8 diff = VEC_CONVERT( vecLoad<vPelx8>( &piOrg[n] ), vUIntx8 ) - VEC_CONVERT( vecLoad<vPelx8>( &piCur[n] ), vUIntx8 );
+      vsum += VEC_CONVERT( ( diff * diff ) >> uiShift, vDistx8 );
+    }
+
+    for( ; n < iCols; n++ )
+    {
+      Intermediate_Int iTemp = piOrg[n] - piCur[n];
+      uiSum += Distortion( ( iTemp * iTemp ) >> uiShift );
+    }
+
+    piOrg += iStrideOrg;
+    piCur += iStrideCur;
+  }
+
+  return uiSum + vecHSum<Distortion, 8>( vsum );
+}
+
+// in-place butterflies across N row vectors, the output order differs from the scalar code but the sum of absolute values does not
+template<typename V, int N>
+static inline void hadamardVec( V m[N] )
+{
+  for( int half = N >> 1; half > 0; half >>= 1 )
+  {
+    for( int i = 0; i < N; i += 2 * half )
+    {
+      for( int j = i; j < i + half; j++ )
+      {
+        const V a = m[j];
+        const V b = m[j + half];
+        m[j]        = a + b;
+        m[j + half] = a - b;
+      }
+    }
+  }
+}
+
+template<typename V, int N>
+static inline void transposeVec( V m[N] )
+{
+  TCoeff tmp[N][N];
+  for( int i = 0; i < N; i++ )
+  {
+    vecStore( tmp[i], m[i] );
+  }
+  for( int i = 0; i < N; i++ )
+  {
+    for( int j = 0; j < N; j++ )
+    {
+      m[i][j] = tmp[j][i];
+    }
+  }
+}
+
+template<typename VPel, typename V, int N>
+static Distortion xCalcHADsNxNVec( const Pel *piOrg, const Pel *piCur, int iStrideOrg, int iStrideCur )
+{
+  V m[N];
+  for( int k = 0; k < N; k++ )
+  {
+    m[k] = VEC_CONVERT( vecLoad<VPel>( piOrg ), V ) - VEC_CONVERT( vecLoad<VPel>( piCur ), V );
+    piOrg += iStrideOrg;
+    piCur += iStrideCur;
+  }
+
+  hadamardVec<V, N>( m );
+  transposeVec<V, N>( m );
+  hadamardVec<V, N>( m );
+
+  V sum = vecAbs( m[0] );
+  for( int k = 1; k < N; k++ )
+  {
+    sum += vecAbs( m[k] );
+  }
+
+  return vecHSum<Distortion, N>( sum );
+}
+
+Distortion RdCost::xGetHADs_Vec( const DistParam& rcDtParam )
+{
+  const int iRows = rcDtParam.org.height;
+  const int iCols = rcDtParam.org.width;
+
+  // non-square blocks use the rectangular transforms, which stay scalar
+  if( rcDtParam.applyWeight || rcDtParam.step != 1 || iRows != iCols || ( iRows & 3 ) )
+  {
+    return xGetHADs( rcDtParam );
+  }
+
+  const Pel* piOrg      = rcDtParam.org.buf;
+  const Pel* piCur      = rcDtParam.cur.buf;
+  const int  iStrideCur = rcDtParam.cur.stride;
+  const int  iStrideOrg = rcDtParam.org.stride;
+
+  Distortion uiSum = 0;
+
+  if( ( iRows & 7 ) == 0 )
+  {
+    for( int y = 0; y < iRows; y += 8 )
+    {
+      for( int x = 0; x < iCols; x += 8 )
+      {
+        Distortion sad = xCalcHADsNxNVec<vPelx8, vCoeffx8, 8>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur );
+        uiSum += ( sad + 2 ) >> 2;
+      }
+      piOrg += iStrideOrg << 3;
+      piCur += iStrideCur << 3;
+    }
+  }
+  else
+  {
+    for( int y = 0; y < iRows; y += 4 )
+    {
+      for( int x = 0; x < iCols; x += 4 )
+      {
+        Distortion satd = xCalcHADsNxNVec<vPelx4, vCoeffx4, 4>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur );
+        uiSum += ( satd + 1 ) >> 1;
+      }
+      piOrg += iStrideOrg << 2;
+      piCur += iStrideCur << 2;
+    }
+  }
+
+  return ( uiSum >> DISTORTION_PRECISION_ADJUSTMENT( rcDtParam.bitDepth ) );
+}
+
+void RdCost::initRdCostVec()
+{
+  if( !read_vec_extension_flag() )
+  {
+    return;
+  }
+
+  m_afpDistortFunc[DF_SSE    ] = RdCost::xGetSSE_Vec;
+  m_afpDistortFunc[DF_SSE2   ] = RdCost::xGetSSE_Vec;
+  m_afpDistortFunc[DF_SSE4   ] = RdCost::xGetSSE_Vec;
+  m_afpDistortFunc[DF_SSE8   ] = RdCost::xGetSSE_Vec;
+  m_afpDistortFunc[DF_SSE16  ] = RdCost::xGetSSE_Vec;
+  m_afpDistortFunc[DF_SSE32  ] = RdCost::xGetSSE_Vec;
+  m_afpDistortFunc[DF_SSE64  ] = RdCost::xGetSSE_Vec;
+  m_afpDistortFunc[DF_SSE16N ] = RdCost::xGetSSE_Vec;
+
+  m_afpDistortFunc[DF_SAD    ] = RdCost::xGetSAD_Vec<true >;
+  m_afpDistortFunc[DF_SAD2   ] = RdCost::xGetSAD_Vec<true >;
+  m_afpDistortFunc[DF_SAD4   ] = RdCost::xGetSAD_Vec<false>;
+  m_afpDistortFunc[DF_SAD8   ] = RdCost::xGetSAD_Vec<false>;
+  m_afpDistortFunc[DF_SAD16  ] = RdCost::xGetSAD_Vec<false>;
+  m_afpDistortFunc[DF_SAD32  ] = RdCost::xGetSAD_Vec<false>;
+  m_afpDistortFunc[DF_SAD64  ] = RdCost::xGetSAD_Vec<false>;
+  m_afpDistortFunc[DF_SAD16N ] = RdCost::xGetSAD_Vec<false>;
+
+  m_afpDistortFunc[DF_SAD12  ] = RdCost::xGetSAD_Vec<false>;
+  m_afpDistortFunc[DF_SAD24  ] = RdCost::xGetSAD_Vec<false>;
+  m_afpDistortFunc[DF_SAD48  ] = RdCost::xGetSAD_Vec<false>;
+
+  m_afpDistortFunc[DF_HAD    ] = RdCost::xGetHADs_Vec;
+  m_afpDistortFunc[DF_HAD2   ] = RdCost::xGetHADs_Vec;
+  m_afpDistortFunc[DF_HAD4   ] = RdCost::xGetHADs_Vec;
+  m_afpDistortFunc[DF_HAD8   ] = RdCost::xGetHADs_Vec;
+  m_afpDistortFunc[DF_HAD16  ] = RdCost::xGetHADs_Vec;
+  m_afpDistortFunc[DF_HAD32  ] = RdCost::xGetHADs_Vec;
+  m_afpDistortFunc[DF_HAD64  ] = RdCost::xGetHADs_Vec;
+  m_afpDistortFunc[DF_HAD16N ] = RdCost::xGetHADs_Vec;
+
+  m_afpDistortFunc[DF_SAD_INTERMEDIATE_BITDEPTH] = RdCost::xGetSAD_Vec<true>;
+}
+
+#endif
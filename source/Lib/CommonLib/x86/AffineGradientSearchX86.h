@@ -69,6 +69,16 @@ inter3 = _mm_add_epi64(inter1, inter3);
 inter3 = _mm_add_epi64(inter0, inter3);                                                                        \
 }
 
+// loads four samples widened to 32 bit, for either Pel type
+static inline __m128i loadPel4( const Pel* src )
+{
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+  return _mm_loadu_si128( reinterpret_cast<const __m128i *>( src ) );
+#else
+  return _mm_cvtepi16_epi32( _mm_loadl_epi64( reinterpret_cast<const __m128i *>( src ) ) );
+#endif
+}
+
 template<X86_VEXT vext>
 static void simdHorizontalSobelFilter( Pel *const pPred, const int predStride, int *const pDerivate, const int derivateBufStride, const int width, const int height )
 {
@@ -84,19 +94,13 @@ static void simdHorizontalSobelFilter( Pel *const pPred, const int predStride, i
   /* The value of col and row indicate the columns and rows for which the derivates have already been computed */
   for ( int col = 1; (col + 2) < width; col += 2 )
   {
-    mmPred[0] = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(&pPred[0 * predStride + col - 1]) );
-    mmPred[1] = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(&pPred[1 * predStride + col - 1]) );
-
-    mmPred[0] = _mm_cvtepi16_epi32( mmPred[0] );
-    mmPred[1] = _mm_cvtepi16_epi32( mmPred[1] );
+    mmPred[0] = loadPel4( &pPred[0 * predStride + col - 1] );
+    mmPred[1] = loadPel4( &pPred[1 * predStride + col - 1] );
 
     for ( int row = 1; row < (height - 1); row += 2 )
     {
-      mmPred[2] = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(&pPred[(row + 1) * predStride + col - 1]) );
-      mmPred[3] = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(&pPred[(row + 2) * predStride + col - 1]) );
-
-      mmPred[2] = _mm_cvtepi16_epi32( mmPred[2] );
-      mmPred[3] = _mm_cvtepi16_epi32( mmPred[3] );
+      mmPred[2] = loadPel4( &pPred[(row + 1) * predStride + col - 1] );
+      mmPred[3] = loadPel4( &pPred[(row + 2) * predStride + col - 1] );
 
       mm2xPred[0] = _mm_slli_epi32( mmPred[1], 1 );
       mm2xPred[1] = _mm_slli_epi32( mmPred[2], 1 );
@@ -146,19 +150,13 @@ static void simdVerticalSobelFilter( Pel *const pPred, const int predStride, int
   /* The value of col and row indicate the columns and rows for which the derivates have already been computed */
   for ( int col = 1; col < (width - 1); col += 2 )
   {
-    mmPred[0] = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(&pPred[0 * predStride + col - 1]) );
-    mmPred[1] = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(&pPred[1 * predStride + col - 1]) );
-
-    mmPred[0] = _mm_cvtepi16_epi32( mmPred[0] );
-    mmPred[1] = _mm_cvtepi16_epi32( mmPred[1] );
+    mmPred[0] = loadPel4( &pPred[0 * predStride + col - 1] );
+    mmPred[1] = loadPel4( &pPred[1 * predStride + col - 1] );
 
     for ( int row = 1; row < (height - 1); row += 2 )
     {
-      mmPred[2] = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(&pPred[(row + 1) * predStride + col - 1]) );
-      mmPred[3] = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(&pPred[(row + 2) * predStride + col - 1]) );
-
-      mmPred[2] = _mm_cvtepi16_epi32( mmPred[2] );
-      mmPred[3] = _mm_cvtepi16_epi32( mmPred[3] );
+      mmPred[2] = loadPel4( &pPred[(row + 1) * predStride + col - 1] );
+      mmPred[3] = loadPel4( &pPred[(row + 2) * predStride + col - 1] );
 
       mmIntermediates[0] = _mm_sub_epi32( mmPred[2], mmPred[0] );
       mmIntermediates[3] = _mm_sub_epi32( mmPred[3], mmPred[1] );
@@ -271,10 +269,8 @@ static void simdEqualCoeffComputer( Pel *pResidue, int residueStride, int **ppDe
       }
 
       // Residue
-      mmResidue[0] = _mm_loadl_epi64( (const __m128i*)&pResidue[idx1] );
-      mmResidue[1] = _mm_loadl_epi64( (const __m128i*)&pResidue[idx2] );
-      mmResidue[0] = _mm_cvtepi16_epi32( mmResidue[0] );
-      mmResidue[1] = _mm_cvtepi16_epi32( mmResidue[1] );
+      mmResidue[0] = loadPel4( &pResidue[idx1] );
+      mmResidue[1] = loadPel4( &pResidue[idx2] );
       mmResidue[0] = _mm_slli_epi32( mmResidue[0], 3 );
       mmResidue[1] = _mm_slli_epi32( mmResidue[1], 3 );
 
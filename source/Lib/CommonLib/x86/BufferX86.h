@@ -43,6 +43,7 @@
 #include "CommonDefX86.h"
 #include "CommonLib/Unit.h"
 #include "CommonLib/Buffer.h"
+#include "CommonLib/InterpolationFilter.h"
 
 
 #if ENABLE_SIMD_OPT_BUFFER
@@ -53,6 +54,38 @@ void addAvg_SSE( const int16_t* src0, int src0Stride, const int16_t* src1, int s
 {
   if( W == 8 )
   {
+#ifdef USE_AVX512
+    if( vext >= AVX512 && ( width & 31 ) == 0 )
+    {
+      __m512i voffset  = _mm512_set1_epi32( offset );
+      __m512i vibdimin = _mm512_set1_epi16( clpRng.min );
+      __m512i vibdimax = _mm512_set1_epi16( clpRng.max );
+
+      for( int row = 0; row < height; row++ )
+      {
+        for( int col = 0; col < width; col += 32 )
+        {
+          __m512i vsrc0 = _mm512_loadu_si512( ( const void * )&src0[col] );
+          __m512i vsrc1 = _mm512_loadu_si512( ( const void * )&src1[col] );
+
+          __m512i vlo = _mm512_add_epi32( _mm512_cvtepi16_epi32( _mm512_castsi512_si256( vsrc0 ) ), _mm512_cvtepi16_epi32( _mm512_castsi512_si256( vsrc1 ) ) );
+          __m512i vhi = _mm512_add_epi32( _mm512_cvtepi16_epi32( _mm512_extracti64x4_epi64( vsrc0, 1 ) ), _mm512_cvtepi16_epi32( _mm512_extracti64x4_epi64( vsrc1, 1 ) ) );
+          vlo = _mm512_srai_epi32( _mm512_add_epi32( vlo, voffset ), shift );
+          vhi = _mm512_srai_epi32( _mm512_add_epi32( vhi, voffset ), shift );
+
+          // saturating narrow keeps the sample order, unlike the in-lane pack
+          __m512i vsum = _mm512_inserti64x4( _mm512_zextsi256_si512( _mm512_cvtsepi32_epi16( vlo ) ), _mm512_cvtsepi32_epi16( vhi ), 1 );
+          vsum = _mm512_min_epi16( vibdimax, _mm512_max_epi16( vibdimin, vsum ) );
+          _mm512_storeu_si512( ( void * )&dst[col], vsum );
+        }
+
+        src0 += src0Stride;
+        src1 += src1Stride;
+        dst  +=  dstStride;
+      }
+      return;
+    }
+#endif
     // TODO: AVX2 impl
     {
       __m128i vzero    = _mm_setzero_si128();
@@ -131,8 +164,12 @@ void addAvg_SSE( const int16_t* src0, int src0Stride, const int16_t* src1, int s
 template<X86_VEXT vext>
 void copyBufferSimd(Pel *src, int srcStride, Pel *dst, int dstStride, int width, int height)
 {
+  // number of samples moved per 256/128/64 bit transfer, so the kernel works for either Pel type
+  static const int step128 = 16 / sizeof( Pel );
+  static const int step64  =  8 / sizeof( Pel );
   __m128i x;
 #ifdef USE_AVX2
+  static const int step256 = 32 / sizeof( Pel );
   __m256i x16;
 #endif
   int j, temp;
@@ -141,27 +178,27 @@ void copyBufferSimd(Pel *src, int srcStride, Pel *dst, int dstStride, int width,
     j = 0;
     temp = width;
 #ifdef USE_AVX2
-    while ((temp >> 4) > 0)
+    while (temp >= step256)
     {
       x16 = _mm256_loadu_si256((const __m256i*)(&src[i * srcStride + j]));
       _mm256_storeu_si256((__m256i*)(&dst[i * dstStride + j]), x16);
-      j += 16;
-      temp -= 16;
+      j += step256;
+      temp -= step256;
     }
 #endif
-    while ((temp >> 3) > 0)
+    while (temp >= step128)
     {
       x = _mm_loadu_si128((const __m128i*)(&src[ i * srcStride + j]));
       _mm_storeu_si128((__m128i*)(&dst[ i * dstStride + j]), x);
-      j += 8;
-      temp -= 8;
+      j += step128;
+      temp -= step128;
     }
-    while ((temp >> 2) > 0)
+    while (temp >= step64)
     {
       x = _mm_loadl_epi64((const __m128i*)(&src[i * srcStride + j]));
       _mm_storel_epi64((__m128i*)(&dst[i*dstStride + j]), x);
-      j += 4;
-      temp -= 4;
+      j += step64;
+      temp -= step64;
     }
     while (temp > 0)
     {
@@ -176,17 +213,35 @@ void copyBufferSimd(Pel *src, int srcStride, Pel *dst, int dstStride, int width,
 template<X86_VEXT vext>
 void paddingSimd(Pel *dst, int stride, int width, int height, int padSize)
 {
+  //Left and Right Padding of the block rows first, so the top and bottom rows can be replicated as a whole
+  Pel* ptr1 = dst;
+  Pel* ptr2 = dst + width - 1;
+  for (int i = 0; i < height; i++)
+  {
+    const int offset = stride * i;
+    for (int j = 1; j <= padSize; j++)
+    {
+      *(ptr1 - j + offset) = *(ptr1 + offset);
+      *(ptr2 + j + offset) = *(ptr2 + offset);
+    }
+  }
+
+  static const int step128 = 16 / sizeof( Pel );
+  static const int step64  =  8 / sizeof( Pel );
   __m128i x;
 #ifdef USE_AVX2
+  static const int step256 = 32 / sizeof( Pel );
   __m256i x16;
 #endif
   int temp, j;
+  dst   -= padSize;
+  width += 2 * padSize;
   for (int i = 1; i <= padSize; i++)
   {
     j = 0;
     temp = width;
 #ifdef USE_AVX2
-    while ((temp >> 4) > 0)
+    while (temp >= step256)
     {
 
       x16 = _mm256_loadu_si256((const __m256i*)(&(dst[j])));
@@ -195,11 +250,11 @@ void paddingSimd(Pel *dst, int stride, int width, int height, int padSize)
       _mm256_storeu_si256((__m256i*)(dst + j + (height - 1 + i)*stride), x16);
 
 
-      j = j + 16;
-      temp = temp - 16;
+      j = j + step256;
+      temp = temp - step256;
     }
 #endif
-    while ((temp >> 3) > 0)
+    while (temp >= step128)
     {
 
       x = _mm_loadu_si128((const __m128i*)(&(dst[j])));
@@ -207,18 +262,18 @@ void paddingSimd(Pel *dst, int stride, int width, int height, int padSize)
       x = _mm_loadu_si128((const __m128i*)(dst + j + (height - 1)*stride));
       _mm_storeu_si128((__m128i*)(dst + j + (height - 1 + i)*stride), x);
 
-      j = j + 8;
-      temp = temp - 8;
+      j = j + step128;
+      temp = temp - step128;
     }
-    while ((temp >> 2) > 0)
+    while (temp >= step64)
     {
       x = _mm_loadl_epi64((const __m128i*)(&dst[j]));
       _mm_storel_epi64((__m128i*)(dst + j - i*stride), x);
       x = _mm_loadl_epi64((const __m128i*)(dst + j + (height - 1)*stride));
       _mm_storel_epi64((__m128i*)(dst + j + (height - 1 + i)*stride), x);
 
-      j = j + 4;
-      temp = temp - 4;
+      j = j + step64;
+      temp = temp - step64;
     }
     while (temp > 0)
     {
@@ -228,23 +283,88 @@ void paddingSimd(Pel *dst, int stride, int width, int height, int padSize)
       temp--;
     }
   }
+}
+
+// DMVR integer search: the SADs of all offsets sharing a vertical displacement are accumulated in one pass over the rows
+template<X86_VEXT vext>
+void dmvrSads_SSE(const Pel* src0, const Pel* src1, int stride, int width, int height, uint64_t* sads)
+{
+  if (width & 7)
+  {
+    dmvrSadsCore(src0, src1, stride, width, height, sads);
+    return;
+  }
 
+  const int numOffsets = (2 * DMVR_NUM_ITERATION) + 1;
+  const __m128i vOne = _mm_set1_epi16(1);
+#ifdef USE_AVX2
+  const __m256i vOne256 = _mm256_set1_epi16(1);
+#endif
 
-  //Left and Right Padding
-  Pel* ptr1 = dst - padSize*stride;
-  Pel* ptr2 = dst - padSize*stride + width - 1;
-  int offset = 0;
-  for (int i = 0; i < height + 2 * padSize; i++)
+  for (int dy = -DMVR_NUM_ITERATION; dy <= DMVR_NUM_ITERATION; dy++)
   {
-    offset = stride * i;
-    for (int j = 1; j <= padSize; j++)
+    __m128i vSum[numOffsets];
+    for (int k = 0; k < numOffsets; k++)
     {
-      *(ptr1 - j + offset) = *(ptr1 + offset);
-      *(ptr2 + j + offset) = *(ptr2 + offset);
+      vSum[k] = _mm_setzero_si128();
+    }
+
+    const Pel* pSrc0 = src0 + dy * stride;
+    const Pel* pSrc1 = src1 - dy * stride;
+
+#ifdef USE_AVX2
+    if (vext >= AVX2 && (width & 15) == 0)
+    {
+      __m256i vSum256[numOffsets];
+      for (int k = 0; k < numOffsets; k++)
+      {
+        vSum256[k] = _mm256_setzero_si256();
+      }
+      for (int y = 0; y < height; y += 2, pSrc0 += 2 * stride, pSrc1 += 2 * stride)
+      {
+        for (int x = 0; x < width; x += 16)
+        {
+          for (int dx = -DMVR_NUM_ITERATION; dx <= DMVR_NUM_ITERATION; dx++)
+          {
+            const __m256i vSrc0 = _mm256_loadu_si256((const __m256i*)(pSrc0 + x + dx));
+            const __m256i vSrc1 = _mm256_loadu_si256((const __m256i*)(pSrc1 + x - dx));
+            const __m256i vAbs  = _mm256_abs_epi16(_mm256_sub_epi16(vSrc0, vSrc1));
+            vSum256[dx + DMVR_NUM_ITERATION] = _mm256_add_epi32(vSum256[dx + DMVR_NUM_ITERATION], _mm256_madd_epi16(vAbs, vOne256));
+          }
+        }
+      }
+      for (int k = 0; k < numOffsets; k++)
+      {
+        vSum[k] = _mm_add_epi32(_mm256_castsi256_si128(vSum256[k]), _mm256_extracti128_si256(vSum256[k], 1));
+      }
+    }
+    else
+#endif
+    {
+      for (int y = 0; y < height; y += 2, pSrc0 += 2 * stride, pSrc1 += 2 * stride)
+      {
+        for (int x = 0; x < width; x += 8)
+        {
+          for (int dx = -DMVR_NUM_ITERATION; dx <= DMVR_NUM_ITERATION; dx++)
+          {
+            const __m128i vSrc0 = _mm_loadu_si128((const __m128i*)(pSrc0 + x + dx));
+            const __m128i vSrc1 = _mm_loadu_si128((const __m128i*)(pSrc1 + x - dx));
+            const __m128i vAbs  = _mm_abs_epi16(_mm_sub_epi16(vSrc0, vSrc1));
+            vSum[dx + DMVR_NUM_ITERATION] = _mm_add_epi32(vSum[dx + DMVR_NUM_ITERATION], _mm_madd_epi16(vAbs, vOne));
+          }
+        }
+      }
     }
 
+    for (int k = 0; k < numOffsets; k++)
+    {
+      __m128i v = _mm_hadd_epi32(vSum[k], vSum[k]);
+      v = _mm_hadd_epi32(v, v);
+      *sads++ = (uint64_t)(uint32_t)_mm_cvtsi128_si32(v) << 1;
+    }
   }
 }
+
 template< X86_VEXT vext >
 void addBIOAvg4_SSE(const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, const Pel *gradX0, const Pel *gradX1, const Pel *gradY0, const Pel*gradY1, int gradStride, int width, int height, int tmpx, int tmpy, int shift, int offset, const ClpRng& clpRng)
 {
@@ -299,6 +419,24 @@ void gradFilter_SSE(Pel* src, int srcStride, int width, int height, int gradStri
   for (int y = 0; y < heightInside; y++)
   {
     int x = 0;
+#ifdef USE_AVX512
+    if (vext >= AVX512)
+    {
+      for (; x + 16 <= widthInside; x += 16)
+      {
+        __m512i mmPixTop = _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i*)(srcTmp + x - srcStride)));
+        __m512i mmPixBottom = _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i*)(srcTmp + x + srcStride)));
+        __m512i mmPixLeft = _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i*)(srcTmp + x - 1)));
+        __m512i mmPixRight = _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i*)(srcTmp + x + 1)));
+
+        __m512i mmGradVer = _mm512_sra_epi32(_mm512_sub_epi32(mmPixBottom, mmPixTop), _mm_cvtsi32_si128(shift1));
+        __m512i mmGradHor = _mm512_sra_epi32(_mm512_sub_epi32(mmPixRight, mmPixLeft), _mm_cvtsi32_si128(shift1));
+
+        _mm256_storeu_si256((__m256i *)(gradYTmp + x), _mm512_cvtsepi32_epi16(mmGradVer));
+        _mm256_storeu_si256((__m256i *)(gradXTmp + x), _mm512_cvtsepi32_epi16(mmGradHor));
+      }
+    }
+#endif
     for (; x < widthInside; x += 4)
     {
       __m128i mmPixTop = _mm_cvtepi16_epi32(_mm_loadl_epi64((__m128i*)(srcTmp + x - srcStride)));
@@ -354,6 +492,29 @@ void calcBIOPar_SSE(const Pel* srcY0Temp, const Pel* srcY1Temp, const Pel* gradX
   for (int y = 0; y < heightG; y++)
   {
     int x = 0;
+#ifdef USE_AVX512
+    if (vext >= AVX512)
+    {
+      for (; x + 16 <= widthG; x += 16)
+      {
+        __m256i mmSrcY0Temp = _mm256_sra_epi16(_mm256_loadu_si256((__m256i*)(srcY0Temp + x)), _mm_cvtsi32_si128(shift4));
+        __m256i mmSrcY1Temp = _mm256_sra_epi16(_mm256_loadu_si256((__m256i*)(srcY1Temp + x)), _mm_cvtsi32_si128(shift4));
+        __m256i mmGradX = _mm256_add_epi16(_mm256_loadu_si256((__m256i*)(gradX0 + x)), _mm256_loadu_si256((__m256i*)(gradX1 + x)));
+        __m256i mmGradY = _mm256_add_epi16(_mm256_loadu_si256((__m256i*)(gradY0 + x)), _mm256_loadu_si256((__m256i*)(gradY1 + x)));
+
+        // the 16-bit products are exact in 32 bits
+        __m512i mmTemp1 = _mm512_cvtepi16_epi32(_mm256_sub_epi16(mmSrcY1Temp, mmSrcY0Temp));
+        __m512i mmTempX = _mm512_cvtepi16_epi32(_mm256_sra_epi16(mmGradX, _mm_cvtsi32_si128(shift5)));
+        __m512i mmTempY = _mm512_cvtepi16_epi32(_mm256_sra_epi16(mmGradY, _mm_cvtsi32_si128(shift5)));
+
+        _mm512_storeu_si512((void *)(dotProductTemp1 + x), _mm512_mullo_epi32(mmTempX, mmTempX));
+        _mm512_storeu_si512((void *)(dotProductTemp2 + x), _mm512_mullo_epi32(mmTempX, mmTempY));
+        _mm512_storeu_si512((void *)(dotProductTemp3 + x), _mm512_mullo_epi32(mmTempX, mmTemp1));
+        _mm512_storeu_si512((void *)(dotProductTemp5 + x), _mm512_mullo_epi32(mmTempY, mmTempY));
+        _mm512_storeu_si512((void *)(dotProductTemp6 + x), _mm512_mullo_epi32(mmTempY, mmTemp1));
+      }
+    }
+#endif
     for (; x < ((widthG >> 3) << 3); x += 8)
     {
       __m128i mmSrcY0Temp = _mm_sra_epi16(_mm_loadu_si128((__m128i*)(srcY0Temp + x)), _mm_cvtsi32_si128(shift4));
@@ -919,9 +1080,731 @@ void linTf_SSE_entry( const Pel* src, int srcStride, Pel *dst, int dstStride, in
   }
 }
 
+// Forward luma mapping: the bin index of every sample selects the linear piece, the piece parameters are looked up
+// from 16 entry tables with byte shuffles (low and high byte plane of each 16 bit entry), so no gathers are needed.
+// The 32 bit slopes are split into two 16 bit tables, the product with the in-bin offset is exact modulo 2^32.
+static inline void rspTable16( const __m128i v0, const __m128i v1, __m128i& lo, __m128i& hi )
+{
+  const __m128i vmask = _mm_set1_epi16( 0xff );
+  lo = _mm_packus_epi16( _mm_and_si128 ( v0, vmask ), _mm_and_si128 ( v1, vmask ) );
+  hi = _mm_packus_epi16( _mm_srli_epi16( v0, 8 ),     _mm_srli_epi16( v1, 8 ) );
+}
+
+struct RspFwdTables
+{
+  __m128i baseLo, baseHi, sclLoLo, sclLoHi, sclHiLo, sclHiHi;
+
+  RspFwdTables( const LumaMapPWL& pwl )
+  {
+    const __m128i vmask = _mm_set1_epi32( 0xffff );
+    const __m128i s0    = _mm_loadu_si128( ( const __m128i* ) &pwl.scale[ 0] );
+    const __m128i s1    = _mm_loadu_si128( ( const __m128i* ) &pwl.scale[ 4] );
+    const __m128i s2    = _mm_loadu_si128( ( const __m128i* ) &pwl.scale[ 8] );
+    const __m128i s3    = _mm_loadu_si128( ( const __m128i* ) &pwl.scale[12] );
+
+    rspTable16( _mm_loadu_si128( ( const __m128i* ) &pwl.base[0] ), _mm_loadu_si128( ( const __m128i* ) &pwl.base[8] ), baseLo, baseHi );
+    rspTable16( _mm_packus_epi32( _mm_and_si128 ( s0, vmask ), _mm_and_si128 ( s1, vmask ) ),
+                _mm_packus_epi32( _mm_and_si128 ( s2, vmask ), _mm_and_si128 ( s3, vmask ) ), sclLoLo, sclLoHi );
+    rspTable16( _mm_packus_epi32( _mm_srli_epi32( s0, 16 ),    _mm_srli_epi32( s1, 16 ) ),
+                _mm_packus_epi32( _mm_srli_epi32( s2, 16 ),    _mm_srli_epi32( s3, 16 ) ),    sclHiLo, sclHiHi );
+  }
+};
+
+static inline __m128i rspFwd8( const __m128i vsrc, const RspFwdTables& tab, const int log2BinLen, const __m128i vbinMask, const __m128i vmax )
+{
+  const __m128i vidx  = _mm_srli_epi16( vsrc, log2BinLen );
+  const __m128i ctrlL = _mm_or_si128( vidx, _mm_set1_epi16( ( short ) 0x8000 ) );
+  const __m128i ctrlH = _mm_or_si128( _mm_slli_epi16( vidx, 8 ), _mm_set1_epi16( 0x0080 ) );
+  const __m128i vbase = _mm_or_si128( _mm_shuffle_epi8( tab.baseLo,  ctrlL ), _mm_shuffle_epi8( tab.baseHi,  ctrlH ) );
+  const __m128i vsclL = _mm_or_si128( _mm_shuffle_epi8( tab.sclLoLo, ctrlL ), _mm_shuffle_epi8( tab.sclLoHi, ctrlH ) );
+  const __m128i vsclH = _mm_or_si128( _mm_shuffle_epi8( tab.sclHiLo, ctrlL ), _mm_shuffle_epi8( tab.sclHiHi, ctrlH ) );
+  const __m128i vdiff = _mm_and_si128( vsrc, vbinMask );
+  const __m128i vround = _mm_set1_epi32( 1 << ( FP_PREC - 1 ) );
+
+  const __m128i prodL = _mm_mullo_epi16( vsclL, vdiff );
+  const __m128i prodH = _mm_add_epi16( _mm_mulhi_epu16( vsclL, vdiff ), _mm_mullo_epi16( vsclH, vdiff ) );
+  const __m128i vlo   = _mm_srai_epi32( _mm_add_epi32( _mm_unpacklo_epi16( prodL, prodH ), vround ), FP_PREC );
+  const __m128i vhi   = _mm_srai_epi32( _mm_add_epi32( _mm_unpackhi_epi16( prodL, prodH ), vround ), FP_PREC );
+
+  const __m128i vdst  = _mm_add_epi16( _mm_packs_epi32( vlo, vhi ), vbase );
+  return _mm_min_epi16( _mm_max_epi16( vdst, _mm_setzero_si128() ), vmax );
+}
+
+#ifdef USE_AVX2
+static inline __m256i rspFwd16( const __m256i vsrc, const RspFwdTables& tab, const int log2BinLen, const __m256i vbinMask, const __m256i vmax )
+{
+  const __m256i baseLo  = _mm256_broadcastsi128_si256( tab.baseLo );
+  const __m256i baseHi  = _mm256_broadcastsi128_si256( tab.baseHi );
+  const __m256i sclLoLo = _mm256_broadcastsi128_si256( tab.sclLoLo );
+  const __m256i sclLoHi = _mm256_broadcastsi128_si256( tab.sclLoHi );
+  const __m256i sclHiLo = _mm256_broadcastsi128_si256( tab.sclHiLo );
+  const __m256i sclHiHi = _mm256_broadcastsi128_si256( tab.sclHiHi );
+
+  const __m256i vidx  = _mm256_srli_epi16( vsrc, log2BinLen );
+  const __m256i ctrlL = _mm256_or_si256( vidx, _mm256_set1_epi16( ( short ) 0x8000 ) );
+  const __m256i ctrlH = _mm256_or_si256( _mm256_slli_epi16( vidx, 8 ), _mm256_set1_epi16( 0x0080 ) );
+  const __m256i vbase = _mm256_or_si256( _mm256_shuffle_epi8( baseLo,  ctrlL ), _mm256_shuffle_epi8( baseHi,  ctrlH ) );
+  const __m256i vsclL = _mm256_or_si256( _mm256_shuffle_epi8( sclLoLo, ctrlL ), _mm256_shuffle_epi8( sclLoHi, ctrlH ) );
+  const __m256i vsclH = _mm256_or_si256( _mm256_shuffle_epi8( sclHiLo, ctrlL ), _mm256_shuffle_epi8( sclHiHi, ctrlH ) );
+  const __m256i vdiff = _mm256_and_si256( vsrc, vbinMask );
+  const __m256i vround = _mm256_set1_epi32( 1 << ( FP_PREC - 1 ) );
+
+  const __m256i prodL = _mm256_mullo_epi16( vsclL, vdiff );
+  const __m256i prodH = _mm256_add_epi16( _mm256_mulhi_epu16( vsclL, vdiff ), _mm256_mullo_epi16( vsclH, vdiff ) );
+  const __m256i vlo   = _mm256_srai_epi32( _mm256_add_epi32( _mm256_unpacklo_epi16( prodL, prodH ), vround ), FP_PREC );
+  const __m256i vhi   = _mm256_srai_epi32( _mm256_add_epi32( _mm256_unpackhi_epi16( prodL, prodH ), vround ), FP_PREC );
+
+  const __m256i vdst  = _mm256_add_epi16( _mm256_packs_epi32( vlo, vhi ), vbase );
+  return _mm256_min_epi16( _mm256_max_epi16( vdst, _mm256_setzero_si256() ), vmax );
+}
+#endif
+
+template<X86_VEXT vext>
+void rspFwd_SSE( Pel* ptr, int stride, int width, int height, const LumaMapPWL& pwl )
+{
+  const RspFwdTables tab( pwl );
+  const __m128i      vbinMask = _mm_set1_epi16( ( 1 << pwl.log2BinLen ) - 1 );
+  const __m128i      vmax     = _mm_set1_epi16( pwl.maxVal );
+#ifdef USE_AVX2
+  const __m256i      vbinMask256 = _mm256_set1_epi16( ( 1 << pwl.log2BinLen ) - 1 );
+  const __m256i      vmax256     = _mm256_set1_epi16( pwl.maxVal );
+#endif
+
+  for( int y = 0; y < height; y++, ptr += stride )
+  {
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      for( ; x + 16 <= width; x += 16 )
+      {
+        __m256i vsrc = _mm256_loadu_si256( ( const __m256i* ) &ptr[x] );
+        _mm256_storeu_si256( ( __m256i* ) &ptr[x], rspFwd16( vsrc, tab, pwl.log2BinLen, vbinMask256, vmax256 ) );
+      }
+    }
+#endif
+    for( ; x + 8 <= width; x += 8 )
+    {
+      __m128i vsrc = _mm_loadu_si128( ( const __m128i* ) &ptr[x] );
+      _mm_storeu_si128( ( __m128i* ) &ptr[x], rspFwd8( vsrc, tab, pwl.log2BinLen, vbinMask, vmax ) );
+    }
+    for( ; x + 4 <= width; x += 4 )
+    {
+      __m128i vsrc = _mm_loadl_epi64( ( const __m128i* ) &ptr[x] );
+      _mm_storel_epi64( ( __m128i* ) &ptr[x], rspFwd8( vsrc, tab, pwl.log2BinLen, vbinMask, vmax ) );
+    }
+    if( x < width )
+    {
+      rspFwdCore( ptr + x, stride, width - x, 1, pwl );
+    }
+  }
+}
+
+// Chroma residual scaling of four 32 bit samples, the forward direction divides in double precision which is
+// exact for the value range of the numerator (< 2^27).
+static inline __m128i scaleSignalFwd4( const __m128i vsrc, const __m128d vscale, const __m128i vhalf, const __m128i vmax )
+{
+  const __m128i vnum = _mm_add_epi32( _mm_slli_epi32( _mm_abs_epi32( vsrc ), CSCALE_FP_PREC ), vhalf );
+  const __m128i vq0  = _mm_cvttpd_epi32( _mm_div_pd( _mm_cvtepi32_pd( vnum ), vscale ) );
+  const __m128i vq1  = _mm_cvttpd_epi32( _mm_div_pd( _mm_cvtepi32_pd( _mm_unpackhi_epi64( vnum, vnum ) ), vscale ) );
+  return _mm_sign_epi32( _mm_min_epi32( _mm_unpacklo_epi64( vq0, vq1 ), vmax ), vsrc );
+}
+
+static inline __m128i scaleSignalInv4( const __m128i vsrc, const __m128i vscale, const __m128i vround )
+{
+  const __m128i vval = _mm_mullo_epi32( _mm_abs_epi32( vsrc ), vscale );
+  return _mm_sign_epi32( _mm_srai_epi32( _mm_add_epi32( vval, vround ), CSCALE_FP_PREC ), vsrc );
+}
+
+template<X86_VEXT vext>
+void scaleSignal_SSE( Pel* ptr, int stride, int width, int height, int scale, bool dir, int maxAbsClip )
+{
+  const __m128i vmin16 = _mm_set1_epi16( -maxAbsClip - 1 );
+  const __m128i vmax16 = _mm_set1_epi16( maxAbsClip );
+  const __m128i vmax   = _mm_set1_epi32( maxAbsClip );
+  const __m128i vhalf  = _mm_set1_epi32( scale >> 1 );
+  const __m128i vround = _mm_set1_epi32( 1 << ( CSCALE_FP_PREC - 1 ) );
+  const __m128i vscale = _mm_set1_epi32( scale );
+  const __m128d vscaleD = _mm_set1_pd( scale );
+#ifdef USE_AVX2
+  const __m256i vmax256    = _mm256_set1_epi32( maxAbsClip );
+  const __m256i vhalf256   = _mm256_set1_epi32( scale >> 1 );
+  const __m256i vround256  = _mm256_set1_epi32( 1 << ( CSCALE_FP_PREC - 1 ) );
+  const __m256i vscale256  = _mm256_set1_epi32( scale );
+  const __m256d vscaleD256 = _mm256_set1_pd( scale );
+#endif
+
+  for( int y = 0; y < height; y++, ptr += stride )
+  {
+    int x = 0;
+    for( ; x + 4 <= width; x += ( x + 8 <= width ? 8 : 4 ) )
+    {
+      const bool full = x + 8 <= width;
+      __m128i    vsrc = full ? _mm_loadu_si128( ( const __m128i* ) &ptr[x] ) : _mm_loadl_epi64( ( const __m128i* ) &ptr[x] );
+      __m128i    vdst;
+
+#if JVET_N0220_LMCS_SIMPLIFICATION
+      if( !dir )
+      {
+        vsrc = _mm_min_epi16( _mm_max_epi16( vsrc, vmin16 ), vmax16 );
+      }
+#endif
+#ifdef USE_AVX2
+      if( vext >= AVX2 )
+      {
+        const __m256i vsrc32 = _mm256_cvtepi16_epi32( vsrc );
+        __m256i       vres;
+        if( dir )
+        {
+          const __m256i vnum = _mm256_add_epi32( _mm256_slli_epi32( _mm256_abs_epi32( vsrc32 ), CSCALE_FP_PREC ), vhalf256 );
+          const __m128i vq0  = _mm256_cvttpd_epi32( _mm256_div_pd( _mm256_cvtepi32_pd( _mm256_castsi256_si128( vnum ) ), vscaleD256 ) );
+          const __m128i vq1  = _mm256_cvttpd_epi32( _mm256_div_pd( _mm256_cvtepi32_pd( _mm256_extracti128_si256( vnum, 1 ) ), vscaleD256 ) );
+          vres = _mm256_inserti128_si256( _mm256_castsi128_si256( vq0 ), vq1, 1 );
+          vres = _mm256_sign_epi32( _mm256_min_epi32( vres, vmax256 ), vsrc32 );
+        }
+        else
+        {
+          vres = _mm256_mullo_epi32( _mm256_abs_epi32( vsrc32 ), vscale256 );
+          vres = _mm256_sign_epi32( _mm256_srai_epi32( _mm256_add_epi32( vres, vround256 ), CSCALE_FP_PREC ), vsrc32 );
+        }
+        vdst = _mm_packs_epi32( _mm256_castsi256_si128( vres ), _mm256_extracti128_si256( vres, 1 ) );
+      }
+      else
+#endif
+      {
+        const __m128i vsrc0 = _mm_cvtepi16_epi32( vsrc );
+        const __m128i vsrc1 = _mm_cvtepi16_epi32( _mm_unpackhi_epi64( vsrc, vsrc ) );
+        if( dir )
+        {
+          vdst = _mm_packs_epi32( scaleSignalFwd4( vsrc0, vscaleD, vhalf, vmax ), scaleSignalFwd4( vsrc1, vscaleD, vhalf, vmax ) );
+        }
+        else
+        {
+          vdst = _mm_packs_epi32( scaleSignalInv4( vsrc0, vscale, vround ), scaleSignalInv4( vsrc1, vscale, vround ) );
+        }
+      }
+
+      if( full )
+      {
+        _mm_storeu_si128( ( __m128i* ) &ptr[x], vdst );
+      }
+      else
+      {
+        _mm_storel_epi64( ( __m128i* ) &ptr[x], vdst );
+      }
+    }
+    if( x < width )
+    {
+      scaleSignalCore( ptr + x, stride, width - x, 1, scale, dir, maxAbsClip );
+    }
+  }
+}
+
+// explicit weighted bi-prediction: the two offset samples are interleaved with their weights and reduced by a single madd
+template<X86_VEXT vext>
+void weightBi_SSE( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int round, int shift, int offset, const ClpRng& clpRng )
+{
+  if( ( width & 3 ) || clpRng.bd > 12 )
+  {
+    weightBiCore( src0, src0Stride, src1, src1Stride, dst, dstStride, width, height, w0, w1, round, shift, offset, clpRng );
+    return;
+  }
+
+  const __m128i vibdimin = _mm_set1_epi16( clpRng.min );
+  const __m128i vibdimax = _mm_set1_epi16( clpRng.max );
+  const __m128i vOffs    = _mm_set1_epi16( IF_INTERNAL_OFFS );
+  const __m128i vW       = _mm_set1_epi32( ( w1 << 16 ) | ( w0 & 0xffff ) );
+  const __m128i vRound   = _mm_set1_epi32( round + ( offset << ( shift - 1 ) ) );
+  const __m128i vShift   = _mm_cvtsi32_si128( shift );
+
+  for( int y = 0; y < height; y++ )
+  {
+    for( int x = 0; x < width; x += 8 )
+    {
+      const int     num = x + 8 <= width ? 8 : 4;
+      const __m128i vs0 = _mm_add_epi16( num == 8 ? _mm_loadu_si128( ( const __m128i* ) &src0[x] ) : _mm_loadl_epi64( ( const __m128i* ) &src0[x] ), vOffs );
+      const __m128i vs1 = _mm_add_epi16( num == 8 ? _mm_loadu_si128( ( const __m128i* ) &src1[x] ) : _mm_loadl_epi64( ( const __m128i* ) &src1[x] ), vOffs );
+
+      __m128i vlo = _mm_madd_epi16( _mm_unpacklo_epi16( vs0, vs1 ), vW );
+      __m128i vhi = _mm_madd_epi16( _mm_unpackhi_epi16( vs0, vs1 ), vW );
+      vlo = _mm_sra_epi32( _mm_add_epi32( vlo, vRound ), vShift );
+      vhi = _mm_sra_epi32( _mm_add_epi32( vhi, vRound ), vShift );
+
+      __m128i vres = _mm_packs_epi32( vlo, vhi );
+      vres = _mm_min_epi16( vibdimax, _mm_max_epi16( vibdimin, vres ) );
+
+      if( num == 8 )
+      {
+        _mm_storeu_si128( ( __m128i* ) &dst[x], vres );
+      }
+      else
+      {
+        _mm_storel_epi64( ( __m128i* ) &dst[x], vres );
+      }
+    }
+    src0 += src0Stride;
+    src1 += src1Stride;
+    dst  += dstStride;
+  }
+}
+
+// explicit weighted uni-prediction: the rounding is folded into the madd by pairing every sample with a one
+template<X86_VEXT vext>
+void weightUni_SSE( const Pel* src0, int src0Stride, Pel *dst, int dstStride, int width, int height, int w0, int round, int shift, int offset, const ClpRng& clpRng )
+{
+  if( ( width & 3 ) || clpRng.bd > 12 || round > 0x7fff )
+  {
+    weightUniCore( src0, src0Stride, dst, dstStride, width, height, w0, round, shift, offset, clpRng );
+    return;
+  }
+
+  const __m128i vibdimin = _mm_set1_epi16( clpRng.min );
+  const __m128i vibdimax = _mm_set1_epi16( clpRng.max );
+  const __m128i vOffs    = _mm_set1_epi16( IF_INTERNAL_OFFS );
+  const __m128i vOne     = _mm_set1_epi16( 1 );
+  const __m128i vW       = _mm_set1_epi32( ( round << 16 ) | ( w0 & 0xffff ) );
+  const __m128i vOffset  = _mm_set1_epi32( offset );
+  const __m128i vShift   = _mm_cvtsi32_si128( shift );
+
+  for( int y = 0; y < height; y++ )
+  {
+    for( int x = 0; x < width; x += 8 )
+    {
+      const int     num = x + 8 <= width ? 8 : 4;
+      const __m128i vs0 = _mm_add_epi16( num == 8 ? _mm_loadu_si128( ( const __m128i* ) &src0[x] ) : _mm_loadl_epi64( ( const __m128i* ) &src0[x] ), vOffs );
+
+      __m128i vlo = _mm_madd_epi16( _mm_unpacklo_epi16( vs0, vOne ), vW );
+      __m128i vhi = _mm_madd_epi16( _mm_unpackhi_epi16( vs0, vOne ), vW );
+      vlo = _mm_add_epi32( _mm_sra_epi32( vlo, vShift ), vOffset );
+      vhi = _mm_add_epi32( _mm_sra_epi32( vhi, vShift ), vOffset );
+
+      __m128i vres = _mm_packs_epi32( vlo, vhi );
+      vres = _mm_min_epi16( vibdimax, _mm_max_epi16( vibdimin, vres ) );
+
+      if( num == 8 )
+      {
+        _mm_storeu_si128( ( __m128i* ) &dst[x], vres );
+      }
+      else
+      {
+        _mm_storel_epi64( ( __m128i* ) &dst[x], vres );
+      }
+    }
+    src0 += src0Stride;
+    dst  += dstStride;
+  }
+}
+
+// triangle blending with the precomputed weight mask, the weights of both predictions are interleaved with the samples
+template<X86_VEXT vext>
+void weightTriangle_SSE( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, const uint8_t* weights, int shift, int offset, const ClpRng& clpRng )
+{
+  if( width & 3 )
+  {
+    weightTriangleCore( src0, src0Stride, src1, src1Stride, dst, dstStride, width, height, weights, shift, offset, clpRng );
+    return;
+  }
+
+  const __m128i vibdimin = _mm_set1_epi16( clpRng.min );
+  const __m128i vibdimax = _mm_set1_epi16( clpRng.max );
+  const __m128i vEight   = _mm_set1_epi16( 8 );
+  const __m128i vOffset  = _mm_set1_epi32( offset );
+  const __m128i vShift   = _mm_cvtsi32_si128( shift );
+#ifdef USE_AVX2
+  const __m256i vibdimin256 = _mm256_set1_epi16( clpRng.min );
+  const __m256i vibdimax256 = _mm256_set1_epi16( clpRng.max );
+  const __m256i vEight256   = _mm256_set1_epi16( 8 );
+  const __m256i vOffset256  = _mm256_set1_epi32( offset );
+#endif
+
+  for( int y = 0; y < height; y++ )
+  {
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      for( ; x + 16 <= width; x += 16 )
+      {
+        const __m256i vw0 = _mm256_cvtepu8_epi16( _mm_loadu_si128( ( const __m128i* ) &weights[x] ) );
+        const __m256i vw1 = _mm256_sub_epi16( vEight256, vw0 );
+        const __m256i vs0 = _mm256_loadu_si256( ( const __m256i* ) &src0[x] );
+        const __m256i vs1 = _mm256_loadu_si256( ( const __m256i* ) &src1[x] );
+
+        __m256i vlo = _mm256_madd_epi16( _mm256_unpacklo_epi16( vs0, vs1 ), _mm256_unpacklo_epi16( vw0, vw1 ) );
+        __m256i vhi = _mm256_madd_epi16( _mm256_unpackhi_epi16( vs0, vs1 ), _mm256_unpackhi_epi16( vw0, vw1 ) );
+        vlo = _mm256_sra_epi32( _mm256_add_epi32( vlo, vOffset256 ), vShift );
+        vhi = _mm256_sra_epi32( _mm256_add_epi32( vhi, vOffset256 ), vShift );
+
+        __m256i vres = _mm256_packs_epi32( vlo, vhi );
+        vres = _mm256_min_epi16( vibdimax256, _mm256_max_epi16( vibdimin256, vres ) );
+        _mm256_storeu_si256( ( __m256i* ) &dst[x], vres );
+      }
+    }
+#endif
+    for( ; x < width; x += 8 )
+    {
+      const int     num = x + 8 <= width ? 8 : 4;
+      const __m128i vw0 = _mm_cvtepu8_epi16( num == 8 ? _mm_loadl_epi64( ( const __m128i* ) &weights[x] ) : _mm_cvtsi32_si128( *( const int32_t* ) &weights[x] ) );
+      const __m128i vw1 = _mm_sub_epi16( vEight, vw0 );
+      const __m128i vs0 = num == 8 ? _mm_loadu_si128( ( const __m128i* ) &src0[x] ) : _mm_loadl_epi64( ( const __m128i* ) &src0[x] );
+      const __m128i vs1 = num == 8 ? _mm_loadu_si128( ( const __m128i* ) &src1[x] ) : _mm_loadl_epi64( ( const __m128i* ) &src1[x] );
+
+      __m128i vlo = _mm_madd_epi16( _mm_unpacklo_epi16( vs0, vs1 ), _mm_unpacklo_epi16( vw0, vw1 ) );
+      __m128i vhi = _mm_madd_epi16( _mm_unpackhi_epi16( vs0, vs1 ), _mm_unpackhi_epi16( vw0, vw1 ) );
+      vlo = _mm_sra_epi32( _mm_add_epi32( vlo, vOffset ), vShift );
+      vhi = _mm_sra_epi32( _mm_add_epi32( vhi, vOffset ), vShift );
+
+      __m128i vres = _mm_packs_epi32( vlo, vhi );
+      vres = _mm_min_epi16( vibdimax, _mm_max_epi16( vibdimin, vres ) );
+
+      if( num == 8 )
+      {
+        _mm_storeu_si128( ( __m128i* ) &dst[x], vres );
+      }
+      else
+      {
+        _mm_storel_epi64( ( __m128i* ) &dst[x], vres );
+      }
+    }
+    weights += width;
+    src0    += src0Stride;
+    src1    += src1Stride;
+    dst     += dstStride;
+  }
+}
+
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+// 32-bit sample variants of the buffer kernels, used when Pel is an int
+
+template< X86_VEXT vext, int W >
+void addAvg_HBD_SIMD( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int shift, int offset, const ClpRng& clpRng )
+{
+  const __m128i vshift = _mm_cvtsi32_si128( shift );
+  const __m128i voffset = _mm_set1_epi32( offset );
+  const __m128i vibdimin = _mm_set1_epi32( clpRng.min );
+  const __m128i vibdimax = _mm_set1_epi32( clpRng.max );
+#ifdef USE_AVX2
+  const __m256i voffset256 = _mm256_set1_epi32( offset );
+  const __m256i vibdimin256 = _mm256_set1_epi32( clpRng.min );
+  const __m256i vibdimax256 = _mm256_set1_epi32( clpRng.max );
+#endif
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 && W == 8 )
+    {
+      for( ; col < width; col += 8 )
+      {
+        __m256i vsum = _mm256_add_epi32( _mm256_loadu_si256( ( const __m256i * )&src0[col] ), _mm256_loadu_si256( ( const __m256i * )&src1[col] ) );
+        vsum = _mm256_sra_epi32( _mm256_add_epi32( vsum, voffset256 ), vshift );
+        vsum = _mm256_min_epi32( vibdimax256, _mm256_max_epi32( vibdimin256, vsum ) );
+        _mm256_storeu_si256( ( __m256i * )&dst[col], vsum );
+      }
+    }
+#endif
+    for( ; col < width; col += 4 )
+    {
+      __m128i vsum = _mm_add_epi32( _mm_loadu_si128( ( const __m128i * )&src0[col] ), _mm_loadu_si128( ( const __m128i * )&src1[col] ) );
+      vsum = _mm_sra_epi32( _mm_add_epi32( vsum, voffset ), vshift );
+      vsum = _mm_min_epi32( vibdimax, _mm_max_epi32( vibdimin, vsum ) );
+      _mm_storeu_si128( ( __m128i * )&dst[col], vsum );
+    }
+
+    src0 += src0Stride;
+    src1 += src1Stride;
+    dst  +=  dstStride;
+  }
+}
+
+template< X86_VEXT vext, int W >
+void reco_HBD_SIMD( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, const ClpRng& clpRng )
+{
+  const __m128i vbdmin = _mm_set1_epi32( clpRng.min );
+  const __m128i vbdmax = _mm_set1_epi32( clpRng.max );
+#ifdef USE_AVX2
+  const __m256i vbdmin256 = _mm256_set1_epi32( clpRng.min );
+  const __m256i vbdmax256 = _mm256_set1_epi32( clpRng.max );
+#endif
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 && W == 8 )
+    {
+      for( ; col < width; col += 8 )
+      {
+        __m256i vdest = _mm256_add_epi32( _mm256_loadu_si256( ( const __m256i * )&src0[col] ), _mm256_loadu_si256( ( const __m256i * )&src1[col] ) );
+        vdest = _mm256_min_epi32( vbdmax256, _mm256_max_epi32( vbdmin256, vdest ) );
+        _mm256_storeu_si256( ( __m256i * )&dst[col], vdest );
+      }
+    }
+#endif
+    for( ; col < width; col += 4 )
+    {
+      __m128i vdest = _mm_add_epi32( _mm_loadu_si128( ( const __m128i * )&src0[col] ), _mm_loadu_si128( ( const __m128i * )&src1[col] ) );
+      vdest = _mm_min_epi32( vbdmax, _mm_max_epi32( vbdmin, vdest ) );
+      _mm_storeu_si128( ( __m128i * )&dst[col], vdest );
+    }
+
+    src0 += src0Stride;
+    src1 += src1Stride;
+    dst  +=  dstStride;
+  }
+}
+
+template< X86_VEXT vext, int W >
+void linTf_HBD_SIMD( const Pel* src, int srcStride, Pel *dst, int dstStride, int width, int height, int scale, int shift, int offset, const ClpRng& clpRng, bool bClip )
+{
+  // rightShift() semantics: a negative shift turns into a left shift
+  const __m128i vshiftR = _mm_cvtsi32_si128( shift >= 0 ? shift : 0 );
+  const __m128i vshiftL = _mm_cvtsi32_si128( shift >= 0 ? 0 : -shift );
+  const __m128i vscale  = _mm_set1_epi32( scale );
+  const __m128i voffset = _mm_set1_epi32( offset );
+  const __m128i vbdmin  = _mm_set1_epi32( bClip ? clpRng.min : INT32_MIN );
+  const __m128i vbdmax  = _mm_set1_epi32( bClip ? clpRng.max : INT32_MAX );
+#ifdef USE_AVX2
+  const __m256i vscale256  = _mm256_set1_epi32( scale );
+  const __m256i voffset256 = _mm256_set1_epi32( offset );
+  const __m256i vbdmin256  = _mm256_set1_epi32( bClip ? clpRng.min : INT32_MIN );
+  const __m256i vbdmax256  = _mm256_set1_epi32( bClip ? clpRng.max : INT32_MAX );
+#endif
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 && W == 8 )
+    {
+      for( ; col < width; col += 8 )
+      {
+        __m256i val = _mm256_mullo_epi32( _mm256_loadu_si256( ( const __m256i * )&src[col] ), vscale256 );
+        val = _mm256_sll_epi32( _mm256_sra_epi32( val, vshiftR ), vshiftL );
+        val = _mm256_add_epi32( val, voffset256 );
+        val = _mm256_min_epi32( vbdmax256, _mm256_max_epi32( vbdmin256, val ) );
+        _mm256_storeu_si256( ( __m256i * )&dst[col], val );
+      }
+    }
+#endif
+    for( ; col < width; col += 4 )
+    {
+      __m128i val = _mm_mullo_epi32( _mm_loadu_si128( ( const __m128i * )&src[col] ), vscale );
+      val = _mm_sll_epi32( _mm_sra_epi32( val, vshiftR ), vshiftL );
+      val = _mm_add_epi32( val, voffset );
+      val = _mm_min_epi32( vbdmax, _mm_max_epi32( vbdmin, val ) );
+      _mm_storeu_si128( ( __m128i * )&dst[col], val );
+    }
+
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
+template< X86_VEXT vext >
+void addBIOAvg4_HBD_SIMD( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, const Pel *gradX0, const Pel *gradX1, const Pel *gradY0, const Pel*gradY1, int gradStride, int width, int height, int tmpx, int tmpy, int shift, int offset, const ClpRng& clpRng )
+{
+  const __m128i vtmpx    = _mm_set1_epi32( tmpx );
+  const __m128i vtmpy    = _mm_set1_epi32( tmpy );
+  const __m128i vboffset = _mm_set1_epi32( 1 );
+  const __m128i voffset  = _mm_set1_epi32( offset );
+  const __m128i vshift   = _mm_cvtsi32_si128( shift );
+  // the reference clips in int16_t, including the clipping bounds
+  const __m128i vibdimin = _mm_set1_epi32( ( int16_t ) clpRng.min );
+  const __m128i vibdimax = _mm_set1_epi32( ( int16_t ) clpRng.max );
+
+  for( int y = 0; y < height; y++ )
+  {
+    for( int x = 0; x < width; x += 4 )
+    {
+      __m128i vgx = _mm_sub_epi32( _mm_loadu_si128( ( const __m128i * )( gradX0 + x ) ), _mm_loadu_si128( ( const __m128i * )( gradX1 + x ) ) );
+      __m128i vgy = _mm_sub_epi32( _mm_loadu_si128( ( const __m128i * )( gradY0 + x ) ), _mm_loadu_si128( ( const __m128i * )( gradY1 + x ) ) );
+      __m128i vb  = _mm_add_epi32( _mm_mullo_epi32( vgx, vtmpx ), _mm_mullo_epi32( vgy, vtmpy ) );
+      vb = _mm_srai_epi32( _mm_add_epi32( vb, vboffset ), 1 );
+
+      __m128i vsum = _mm_add_epi32( _mm_loadu_si128( ( const __m128i * )( src0 + x ) ), _mm_loadu_si128( ( const __m128i * )( src1 + x ) ) );
+      vsum = _mm_sra_epi32( _mm_add_epi32( _mm_add_epi32( vsum, vb ), voffset ), vshift );
+      vsum = _mm_srai_epi32( _mm_slli_epi32( vsum, 16 ), 16 );
+      vsum = _mm_min_epi32( vibdimax, _mm_max_epi32( vibdimin, vsum ) );
+      _mm_storeu_si128( ( __m128i * )( dst + x ), vsum );
+    }
+    dst += dstStride;       src0 += src0Stride;     src1 += src1Stride;
+    gradX0 += gradStride; gradX1 += gradStride; gradY0 += gradStride; gradY1 += gradStride;
+  }
+}
+
+template< X86_VEXT vext >
+void gradFilter_HBD_SIMD( Pel* src, int srcStride, int width, int height, int gradStride, Pel* gradX, Pel* gradY, const int bitDepth )
+{
+  Pel* srcTmp = src + srcStride + 1;
+  Pel* gradXTmp = gradX + gradStride + 1;
+  Pel* gradYTmp = gradY + gradStride + 1;
+
+  int widthInside = width - 2 * BIO_EXTEND_SIZE;
+  int heightInside = height - 2 * BIO_EXTEND_SIZE;
+#if JVET_N0325_BDOF
+  int shift1 = std::max<int>(6, bitDepth - 6);
+#else
+  int shift1 = std::max<int>(2, (14 - bitDepth));
+#endif
+  const __m128i vshift1 = _mm_cvtsi32_si128( shift1 );
+
+  assert((widthInside & 3) == 0);
+
+  for (int y = 0; y < heightInside; y++)
+  {
+    int x = 0;
+#ifdef USE_AVX2
+    if (vext >= AVX2)
+    {
+      for (; x + 8 <= widthInside; x += 8)
+      {
+        __m256i mmPixTop = _mm256_loadu_si256((const __m256i*)(srcTmp + x - srcStride));
+        __m256i mmPixBottom = _mm256_loadu_si256((const __m256i*)(srcTmp + x + srcStride));
+        __m256i mmPixLeft = _mm256_loadu_si256((const __m256i*)(srcTmp + x - 1));
+        __m256i mmPixRight = _mm256_loadu_si256((const __m256i*)(srcTmp + x + 1));
+
+        _mm256_storeu_si256((__m256i *)(gradYTmp + x), _mm256_sra_epi32(_mm256_sub_epi32(mmPixBottom, mmPixTop), vshift1));
+        _mm256_storeu_si256((__m256i *)(gradXTmp + x), _mm256_sra_epi32(_mm256_sub_epi32(mmPixRight, mmPixLeft), vshift1));
+      }
+    }
+#endif
+    for (; x < widthInside; x += 4)
+    {
+      __m128i mmPixTop = _mm_loadu_si128((const __m128i*)(srcTmp + x - srcStride));
+      __m128i mmPixBottom = _mm_loadu_si128((const __m128i*)(srcTmp + x + srcStride));
+      __m128i mmPixLeft = _mm_loadu_si128((const __m128i*)(srcTmp + x - 1));
+      __m128i mmPixRight = _mm_loadu_si128((const __m128i*)(srcTmp + x + 1));
+
+      _mm_storeu_si128((__m128i *)(gradYTmp + x), _mm_sra_epi32(_mm_sub_epi32(mmPixBottom, mmPixTop), vshift1));
+      _mm_storeu_si128((__m128i *)(gradXTmp + x), _mm_sra_epi32(_mm_sub_epi32(mmPixRight, mmPixLeft), vshift1));
+    }
+
+    gradXTmp += gradStride;
+    gradYTmp += gradStride;
+    srcTmp += srcStride;
+  }
+
+  gradXTmp = gradX + gradStride + 1;
+  gradYTmp = gradY + gradStride + 1;
+  for (int y = 0; y < heightInside; y++)
+  {
+    gradXTmp[-1] = gradXTmp[0];
+    gradXTmp[widthInside] = gradXTmp[widthInside - 1];
+    gradXTmp += gradStride;
+
+    gradYTmp[-1] = gradYTmp[0];
+    gradYTmp[widthInside] = gradYTmp[widthInside - 1];
+    gradYTmp += gradStride;
+  }
+
+  gradXTmp = gradX + gradStride;
+  gradYTmp = gradY + gradStride;
+  ::memcpy(gradXTmp - gradStride, gradXTmp, sizeof(Pel)*(width));
+  ::memcpy(gradXTmp + heightInside*gradStride, gradXTmp + (heightInside - 1)*gradStride, sizeof(Pel)*(width));
+  ::memcpy(gradYTmp - gradStride, gradYTmp, sizeof(Pel)*(width));
+  ::memcpy(gradYTmp + heightInside*gradStride, gradYTmp + (heightInside - 1)*gradStride, sizeof(Pel)*(width));
+}
+
+template< X86_VEXT vext >
+void calcBIOPar_HBD_SIMD( const Pel* srcY0Temp, const Pel* srcY1Temp, const Pel* gradX0, const Pel* gradX1, const Pel* gradY0, const Pel* gradY1, int* dotProductTemp1, int* dotProductTemp2, int* dotProductTemp3, int* dotProductTemp5, int* dotProductTemp6, const int src0Stride, const int src1Stride, const int gradStride, const int widthG, const int heightG, const int bitDepth )
+{
+#if JVET_N0325_BDOF
+  int shift4 = std::max<int>(4, (bitDepth - 8));
+  int shift5 = std::max<int>(1, (bitDepth - 11));
+#else
+  int shift4 = std::min<int>(8, (bitDepth - 4));
+  int shift5 = std::min<int>(5, (bitDepth - 7));
+#endif
+  const __m128i vshift4 = _mm_cvtsi32_si128( shift4 );
+  const __m128i vshift5 = _mm_cvtsi32_si128( shift5 );
+
+  for (int y = 0; y < heightG; y++)
+  {
+    int x = 0;
+#ifdef USE_AVX2
+    if (vext >= AVX2)
+    {
+      for (; x + 8 <= widthG; x += 8)
+      {
+        __m256i mmSrcY0Temp = _mm256_sra_epi32(_mm256_loadu_si256((const __m256i*)(srcY0Temp + x)), vshift4);
+        __m256i mmSrcY1Temp = _mm256_sra_epi32(_mm256_loadu_si256((const __m256i*)(srcY1Temp + x)), vshift4);
+        __m256i mmTemp1 = _mm256_sub_epi32(mmSrcY1Temp, mmSrcY0Temp);
+        __m256i mmTempX = _mm256_sra_epi32(_mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(gradX0 + x)), _mm256_loadu_si256((const __m256i*)(gradX1 + x))), vshift5);
+        __m256i mmTempY = _mm256_sra_epi32(_mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(gradY0 + x)), _mm256_loadu_si256((const __m256i*)(gradY1 + x))), vshift5);
+
+        _mm256_storeu_si256((__m256i *)(dotProductTemp1 + x), _mm256_mullo_epi32(mmTempX, mmTempX));
+        _mm256_storeu_si256((__m256i *)(dotProductTemp2 + x), _mm256_mullo_epi32(mmTempX, mmTempY));
+        _mm256_storeu_si256((__m256i *)(dotProductTemp3 + x), _mm256_mullo_epi32(mmTempX, mmTemp1));
+        _mm256_storeu_si256((__m256i *)(dotProductTemp5 + x), _mm256_mullo_epi32(mmTempY, mmTempY));
+        _mm256_storeu_si256((__m256i *)(dotProductTemp6 + x), _mm256_mullo_epi32(mmTempY, mmTemp1));
+      }
+    }
+#endif
+    for (; x + 4 <= widthG; x += 4)
+    {
+      __m128i mmSrcY0Temp = _mm_sra_epi32(_mm_loadu_si128((const __m128i*)(srcY0Temp + x)), vshift4);
+      __m128i mmSrcY1Temp = _mm_sra_epi32(_mm_loadu_si128((const __m128i*)(srcY1Temp + x)), vshift4);
+      __m128i mmTemp1 = _mm_sub_epi32(mmSrcY1Temp, mmSrcY0Temp);
+      __m128i mmTempX = _mm_sra_epi32(_mm_add_epi32(_mm_loadu_si128((const __m128i*)(gradX0 + x)), _mm_loadu_si128((const __m128i*)(gradX1 + x))), vshift5);
+      __m128i mmTempY = _mm_sra_epi32(_mm_add_epi32(_mm_loadu_si128((const __m128i*)(gradY0 + x)), _mm_loadu_si128((const __m128i*)(gradY1 + x))), vshift5);
+
+      _mm_storeu_si128((__m128i *)(dotProductTemp1 + x), _mm_mullo_epi32(mmTempX, mmTempX));
+      _mm_storeu_si128((__m128i *)(dotProductTemp2 + x), _mm_mullo_epi32(mmTempX, mmTempY));
+      _mm_storeu_si128((__m128i *)(dotProductTemp3 + x), _mm_mullo_epi32(mmTempX, mmTemp1));
+      _mm_storeu_si128((__m128i *)(dotProductTemp5 + x), _mm_mullo_epi32(mmTempY, mmTempY));
+      _mm_storeu_si128((__m128i *)(dotProductTemp6 + x), _mm_mullo_epi32(mmTempY, mmTemp1));
+    }
+
+    for (; x < widthG; x++)
+    {
+      int temp = (srcY0Temp[x] >> shift4) - (srcY1Temp[x] >> shift4);
+      int tempX = (gradX0[x] + gradX1[x]) >> shift5;
+      int tempY = (gradY0[x] + gradY1[x]) >> shift5;
+      dotProductTemp1[x] = tempX * tempX;
+      dotProductTemp2[x] = tempX * tempY;
+      dotProductTemp3[x] = -tempX * temp;
+      dotProductTemp5[x] = tempY * tempY;
+      dotProductTemp6[x] = -tempY * temp;
+    }
+
+    srcY0Temp += src0Stride;
+    srcY1Temp += src1Stride;
+    gradX0 += gradStride;
+    gradX1 += gradStride;
+    gradY0 += gradStride;
+    gradY1 += gradStride;
+    dotProductTemp1 += widthG;
+    dotProductTemp2 += widthG;
+    dotProductTemp3 += widthG;
+    dotProductTemp5 += widthG;
+    dotProductTemp6 += widthG;
+  }
+}
+#endif // RExt__HIGH_BIT_DEPTH_SUPPORT
+
 template<X86_VEXT vext>
 void PelBufferOps::_initPelBufOpsX86()
 {
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+  addAvg8 = addAvg_HBD_SIMD<vext, 8>;
+  addAvg4 = addAvg_HBD_SIMD<vext, 4>;
+
+  addBIOAvg4      = addBIOAvg4_HBD_SIMD<vext>;
+  bioGradFilter   = gradFilter_HBD_SIMD<vext>;
+  calcBIOPar      = calcBIOPar_HBD_SIMD<vext>;
+  calcBlkGradient = calcBlkGradient_SSE<vext>;
+
+  copyBuffer = copyBufferSimd<vext>;
+  padding    = paddingSimd<vext>;
+
+  reco8 = reco_HBD_SIMD<vext, 8>;
+  reco4 = reco_HBD_SIMD<vext, 4>;
+
+  linTf8 = linTf_HBD_SIMD<vext, 8>;
+  linTf4 = linTf_HBD_SIMD<vext, 4>;
+#else
   addAvg8 = addAvg_SSE<vext, 8>;
   addAvg4 = addAvg_SSE<vext, 4>;
 
@@ -932,17 +1815,26 @@ void PelBufferOps::_initPelBufOpsX86()
 
   copyBuffer = copyBufferSimd<vext>;
   padding    = paddingSimd<vext>;
+  dmvrSads   = dmvrSads_SSE<vext>;
+
+  weightBi       = weightBi_SSE<vext>;
+  weightUni      = weightUni_SSE<vext>;
+  weightTriangle = weightTriangle_SSE<vext>;
   reco8 = reco_SSE<vext, 8>;
   reco4 = reco_SSE<vext, 4>;
 
   linTf8 = linTf_SSE_entry<vext, 8>;
   linTf4 = linTf_SSE_entry<vext, 4>;
+
+  rspFwd      = rspFwd_SSE<vext>;
+  scaleSignal = scaleSignal_SSE<vext>;
 #if ENABLE_SIMD_OPT_GBI
   removeWeightHighFreq8 = removeWeightHighFreq_SSE<vext, 8>;
   removeWeightHighFreq4 = removeWeightHighFreq_SSE<vext, 4>;
   removeHighFreq8 = removeHighFreq_SSE<vext, 8>;
   removeHighFreq4 = removeHighFreq_SSE<vext, 4>;
 #endif
+#endif
 }
 
 template void PelBufferOps::_initPelBufOpsX86<SIMDX86>();
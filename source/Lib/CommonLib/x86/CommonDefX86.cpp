@@ -155,14 +155,11 @@ X86_VEXT _get_x86_extensions()
     if (!(regs[1] & BIT_HAS_AVX2))  return ext;
     ext = AVX2;
 // #endif
-#ifdef USE_AVX512
     if ((xgetbv(0) & 0xE0) != 0xE0) return ext; // see if OPMASK state and ZMM are availabe and enabled
-    do_cpuidex( regs, 7, 0 );
     if (!(regs[1] & BIT_HAS_AVX512F ))  return ext;
     if (!(regs[1] & BIT_HAS_AVX512DQ))  return ext;
     if (!(regs[1] & BIT_HAS_AVX512BW))  return ext;
     ext = AVX512;
-#endif
 #endif
 
     return ext;
@@ -173,13 +170,13 @@ static translate m
 { { "SCALAR", SCALAR },{ "SSE41", SSE41 },{ "SSE42", SSE42 },
   { "AVX", AVX },{ "AVX2", AVX2 },{ "AVX512", AVX512 } };
 
+//static std::atomic<bool> b_detection_finished(false);
+static bool b_detection_finished( false );
+static X86_VEXT ext_flags = SCALAR;
+
 NO_USE_SIMD
 X86_VEXT read_x86_extension_flags(const std::string &extStrId)
 {
-  //static std::atomic<bool> b_detection_finished(false);
-  static bool b_detection_finished( false );
-  static X86_VEXT ext_flags = SCALAR;
-
   {
     if( !b_detection_finished )
     {
@@ -207,6 +204,12 @@ X86_VEXT read_x86_extension_flags(const std::string &extStrId)
   return ext_flags;
 }
 
+void reset_x86_extension_flags()
+{
+  b_detection_finished = false;
+  ext_flags            = SCALAR;
+}
+
 const char* read_x86_extension(const std::string &extStrId)
 {
   static const char extension_not_available[] = "NA";
@@ -303,7 +303,8 @@ static inline void TRANSPOSE8x8_32b_AVX2(__m256i T[8])
 
 #endif
 
-#ifdef USE_AVX512
+#if defined( USE_AVX512 ) && defined( __GNUC__ ) && !defined( __clang__ ) && !GCC_VERSION_AT_LEAST( 9, 0 )
+// older gcc versions lack the 16-bit element setter
 
 ALWAYS_INLINE inline __m512i
 _mm512_set_epi16( int16_t x31, int16_t x30, int16_t x29, int16_t x28,
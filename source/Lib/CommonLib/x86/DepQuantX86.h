@@ -0,0 +1,184 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     DepQuantX86.h
+    \brief    SIMD dependent quantization trellis
+*/
+
+//! \ingroup CommonLib
+//! \{
+
+#include "CommonLib/CommonDef.h"
+#include "CommonDefX86.h"
+#include "CommonLib/DepQuant.h"
+
+#if ENABLE_SIMD_OPT_DEPQUANT
+#ifdef TARGET_SIMD_X86
+
+#ifdef USE_AVX2
+using namespace DQIntern;
+
+// rate of the level candidates in absLevel for the four states (one per 32 bit lane)
+static inline __m128i dqRateAVX2( const StateMem& states, const __m128i absLevel, const __m128i regBins, const __m128i goRicePar,
+                                  const __m128i goRiceZero, const __m128i sigRate )
+{
+  const __m128i stateIdx = _mm_setr_epi32( 0, 1, 2, 3 );
+  const __m128i four     = _mm_set1_epi32( 4 );
+  const __m128i small    = _mm_cmpgt_epi32( four, absLevel );
+
+  // regular coded bins: coeffBits[ min( absLevel, 4 + ( absLevel & 1 ) ) ] + goRiceBits[ ( absLevel - 4 ) >> 1 ] for absLevel >= 4
+  const __m128i coeffIdx = _mm_blendv_epi8( _mm_add_epi32( four, _mm_and_si128( absLevel, _mm_set1_epi32( 1 ) ) ), absLevel, small );
+  const __m128i coeffBit = _mm_i32gather_epi32( &states.coeffBits[0][0], _mm_add_epi32( _mm_slli_epi32( coeffIdx, 2 ), stateIdx ), 4 );
+  const __m128i regIdx   = _mm_andnot_si128( small, _mm_min_epi32( _mm_srai_epi32( _mm_sub_epi32( absLevel, four ), 1 ), _mm_set1_epi32( RICEMAX - 1 ) ) );
+
+  // bypass coded: goRiceBits[ absLevel <= goRiceZero ? absLevel - 1 : min( absLevel, RICEMAX - 1 ) ]
+  const __m128i bypIdx   = _mm_blendv_epi8( _mm_sub_epi32( absLevel, _mm_set1_epi32( 1 ) ), _mm_min_epi32( absLevel, _mm_set1_epi32( RICEMAX - 1 ) ),
+                                            _mm_cmpgt_epi32( absLevel, goRiceZero ) );
+  const __m128i riceIdx  = _mm_add_epi32( _mm_slli_epi32( goRicePar, 5 ), _mm_blendv_epi8( bypIdx, regIdx, regBins ) );
+  const __m128i riceBit  = _mm_i32gather_epi32( &g_goRiceBits[0][0], riceIdx, 4 );
+
+  const __m128i rateReg  = _mm_add_epi32( _mm_add_epi32( coeffBit, _mm_andnot_si128( small, riceBit ) ), sigRate );
+  const __m128i rateByp  = _mm_add_epi32( _mm_set1_epi32( 1 << SCALE_BITS ), riceBit );
+  return _mm_blendv_epi8( rateByp, rateReg, regBins );
+}
+
+// The costs of the candidates A, B (levels of the respective quantizer) and zero are derived for the four states in parallel.
+// Decisions 0 and 2 are fed by states 0 and 1, decisions 1 and 3 by states 2 and 3, the comparison order of the scalar
+// code is kept so that ties are resolved identically: decision 0 (state 0 A, Z, state 1 B), decision 2 (state 0 B, state 1 A, Z),
+// decision 1 (state 2 A, Z, state 3 B) and decision 3 (state 2 B, state 3 A, Z).
+template<X86_VEXT vext>
+static void simdCheckRdCosts( const StateMem& states, const PQData* pqData, const ScanPosType spt, const bool zeroOut, Decision* decisions )
+{
+  static_assert( sizeof( Decision ) == 16, "Decision is accessed as pair of 64 bit values" );
+
+  const __m128i regBins   = _mm_cmpgt_epi32( _mm_loadu_si128( ( const __m128i* ) states.remRegBins ), _mm_set1_epi32( 3 ) );
+  const __m128i goRicePar = _mm_loadu_si128( ( const __m128i* ) states.goRicePar );
+  const __m128i goRiceZ   = _mm_loadu_si128( ( const __m128i* ) states.goRiceZero );
+  const __m128i sig0      = _mm_loadu_si128( ( const __m128i* ) states.sigBits[0] );
+  const __m128i sig1      = _mm_loadu_si128( ( const __m128i* ) states.sigBits[1] );
+  const __m128i sbb1      = _mm_loadu_si128( ( const __m128i* ) states.sbbBits[1] );
+  const __m256i rdCost    = _mm256_loadu_si256( ( const __m256i* ) states.rdCost );
+
+  // significance related rate for non-zero (sigRate) and zero levels (sigRateZ) in regular coding mode
+  __m128i sigRate, sigRateZ, invalidZ = _mm_setzero_si128();
+  if( spt == SCAN_ISCSBB )
+  {
+    sigRate  = sig1;
+    sigRateZ = sig0;
+  }
+  else if( spt == SCAN_SOCSBB )
+  {
+    sigRate  = _mm_add_epi32( sbb1, sig1 );
+    sigRateZ = _mm_add_epi32( sbb1, sig0 );
+  }
+  else
+  {
+    // without significant coefficients in the sub-block the last significance flag is inferred
+    const __m128i noSig = _mm_cmpeq_epi32( _mm_loadu_si128( ( const __m128i* ) states.numSigSbb ), _mm_setzero_si128() );
+    sigRate  = _mm_andnot_si128( noSig, sig1 );
+    sigRateZ = sig0;
+    invalidZ = _mm_and_si128( noSig, regBins );
+  }
+
+  const __m128i riceZero = _mm_i32gather_epi32( &g_goRiceBits[0][0], _mm_add_epi32( _mm_slli_epi32( goRicePar, 5 ), goRiceZ ), 4 );
+  const __m128i rateZ    = _mm_blendv_epi8( riceZero, sigRateZ, regBins );
+  const __m256i maxCost  = _mm256_set1_epi64x( std::numeric_limits<int64_t>::max() );
+  const __m256i stateId  = _mm256_setr_epi64x( 0ll << 32, 1ll << 32, 2ll << 32, 3ll << 32 );
+
+  __m256i costZ = _mm256_add_epi64( rdCost, _mm256_cvtepi32_epi64( rateZ ) );
+  costZ = _mm256_blendv_epi8( costZ, maxCost, _mm256_cvtepi32_epi64( invalidZ ) );
+
+  __m256i costA = maxCost, costB = maxCost, infoA = stateId, infoB = stateId;
+  if( !zeroOut )
+  {
+    const __m128i absA  = _mm_setr_epi32( pqData[0].absLevel, pqData[0].absLevel, pqData[3].absLevel, pqData[3].absLevel );
+    const __m128i absB  = _mm_setr_epi32( pqData[2].absLevel, pqData[2].absLevel, pqData[1].absLevel, pqData[1].absLevel );
+    const __m256i distA = _mm256_setr_epi64x( pqData[0].deltaDist, pqData[0].deltaDist, pqData[3].deltaDist, pqData[3].deltaDist );
+    const __m256i distB = _mm256_setr_epi64x( pqData[2].deltaDist, pqData[2].deltaDist, pqData[1].deltaDist, pqData[1].deltaDist );
+
+    costA = _mm256_add_epi64( _mm256_add_epi64( rdCost, distA ), _mm256_cvtepi32_epi64( dqRateAVX2( states, absA, regBins, goRicePar, goRiceZ, sigRate ) ) );
+    costB = _mm256_add_epi64( _mm256_add_epi64( rdCost, distB ), _mm256_cvtepi32_epi64( dqRateAVX2( states, absB, regBins, goRicePar, goRiceZ, sigRate ) ) );
+    infoA = _mm256_or_si256( infoA, _mm256_cvtepu32_epi64( absA ) );
+    infoB = _mm256_or_si256( infoB, _mm256_cvtepu32_epi64( absB ) );
+  }
+
+  // decision info is the second 64 bit half of Decision: absLevel (low) and prevId (high)
+  const __m256i zLess  = _mm256_cmpgt_epi64( costA, costZ );
+  const __m256i costAZ = _mm256_blendv_epi8( costA, costZ, zLess );
+  const __m256i infoAZ = _mm256_blendv_epi8( infoA, stateId, zLess );
+
+  // B candidates of the partner state, i.e. lane k holds the B candidate of state k ^ 1
+  const __m256i costY  = _mm256_permute4x64_epi64( costB, 0xB1 );
+  const __m256i infoY  = _mm256_permute4x64_epi64( infoB, 0xB1 );
+  const __m256i oddSt  = _mm256_setr_epi64x( 0, -1, 0, -1 );
+
+  const __m256i costF  = _mm256_blendv_epi8( costAZ, costY, oddSt );
+  const __m256i infoF  = _mm256_blendv_epi8( infoAZ, infoY, oddSt );
+  const __m256i costS  = _mm256_blendv_epi8( costY, costAZ, oddSt );
+  const __m256i infoS  = _mm256_blendv_epi8( infoY, infoAZ, oddSt );
+
+  // lanes hold the decisions 0, 2, 1, 3
+  const __m256i dec01  = _mm256_loadu_si256( ( const __m256i* ) &decisions[0] );
+  const __m256i dec23  = _mm256_loadu_si256( ( const __m256i* ) &decisions[2] );
+  __m256i       cost   = _mm256_unpacklo_epi64( dec01, dec23 );
+  __m256i       info   = _mm256_unpackhi_epi64( dec01, dec23 );
+
+  __m256i       upd    = _mm256_cmpgt_epi64( cost, costF );
+  cost = _mm256_blendv_epi8( cost, costF, upd );
+  info = _mm256_blendv_epi8( info, infoF, upd );
+  upd  = _mm256_cmpgt_epi64( cost, costS );
+  cost = _mm256_blendv_epi8( cost, costS, upd );
+  info = _mm256_blendv_epi8( info, infoS, upd );
+
+  _mm256_storeu_si256( ( __m256i* ) &decisions[0], _mm256_unpacklo_epi64( cost, info ) );
+  _mm256_storeu_si256( ( __m256i* ) &decisions[2], _mm256_unpackhi_epi64( cost, info ) );
+}
+#endif
+
+template <X86_VEXT vext>
+void DepQuant::_initDepQuantX86()
+{
+#ifdef USE_AVX2
+  // the trellis decisions rely on 64 bit compares and gathers, there is no SSE4.1 implementation
+  if( vext >= AVX2 )
+  {
+    m_checkRdCosts = simdCheckRdCosts<vext>;
+  }
+#endif
+}
+
+template void DepQuant::_initDepQuantX86<SIMDX86>();
+
+#endif //#ifdef TARGET_SIMD_X86
+#endif
+//! \}
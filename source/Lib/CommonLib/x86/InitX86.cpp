@@ -47,6 +47,12 @@
 #include "CommonLib/AffineGradientSearch.h"
 
 #include "CommonLib/AdaptiveLoopFilter.h"
+#include "CommonLib/LoopFilter.h"
+#include "CommonLib/SampleAdaptiveOffset.h"
+#include "CommonLib/IntraPrediction.h"
+#include "CommonLib/MatrixIntraPrediction.h"
+#include "CommonLib/Quant.h"
+#include "CommonLib/DepQuant.h"
 
 #include "CommonLib/IbcHashMap.h"
 
@@ -59,6 +65,8 @@ void InterpolationFilter::initInterpolationFilterX86( /*int iBitDepthY, int iBit
   auto vext = read_x86_extension_flags();
   switch (vext){
   case AVX512:
+    _initInterpolationFilterX86<AVX512>(/*iBitDepthY, iBitDepthC*/);
+    break;
   case AVX2:
     _initInterpolationFilterX86<AVX2>(/*iBitDepthY, iBitDepthC*/);
     break;
@@ -81,6 +89,8 @@ void PelBufferOps::initPelBufOpsX86()
   auto vext = read_x86_extension_flags();
   switch (vext){
     case AVX512:
+      _initPelBufOpsX86<AVX512>();
+      break;
     case AVX2:
       _initPelBufOpsX86<AVX2>();
       break;
@@ -106,6 +116,8 @@ void RdCost::initRdCostX86()
   auto vext = read_x86_extension_flags();
   switch (vext){
     case AVX512:
+      _initRdCostX86<AVX512>();
+      break;
     case AVX2:
       _initRdCostX86<AVX2>();
       break;
@@ -151,6 +163,8 @@ void AdaptiveLoopFilter::initAdaptiveLoopFilterX86()
   switch ( vext )
   {
   case AVX512:
+    _initAdaptiveLoopFilterX86<AVX512>();
+    break;
   case AVX2:
     _initAdaptiveLoopFilterX86<AVX2>();
     break;
@@ -167,6 +181,153 @@ void AdaptiveLoopFilter::initAdaptiveLoopFilterX86()
 }
 #endif
 
+#if ENABLE_SIMD_TRAFO
+void TrQuant::initTrQuantX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initTrQuantX86<AVX2>();
+    break;
+  case AVX:
+  case SSE42:
+  case SSE41:
+    _initTrQuantX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_DBLF
+void LoopFilter::initLoopFilterX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initLoopFilterX86<AVX2>();
+    break;
+  case AVX:
+  case SSE42:
+  case SSE41:
+    _initLoopFilterX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_SAO
+void SampleAdaptiveOffset::initSampleAdaptiveOffsetX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initSampleAdaptiveOffsetX86<AVX2>();
+    break;
+  case AVX:
+  case SSE42:
+  case SSE41:
+    _initSampleAdaptiveOffsetX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_INTRAPRED
+void IntraPrediction::initIntraPredictionX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initIntraPredictionX86<AVX2>();
+    break;
+  case AVX:
+  case SSE42:
+  case SSE41:
+    _initIntraPredictionX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_MIP
+void Mip::PredictorMIP::initPredictorMIPX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initPredictorMIPX86<AVX2>();
+    break;
+  case AVX:
+  case SSE42:
+  case SSE41:
+    _initPredictorMIPX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_QUANT
+void Quant::initQuantX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initQuantX86<AVX2>();
+    break;
+  case AVX:
+  case SSE42:
+  case SSE41:
+    _initQuantX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_DEPQUANT
+void DepQuant::initDepQuantX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initDepQuantX86<AVX2>();
+    break;
+  case AVX:
+  case SSE42:
+  case SSE41:
+    _initDepQuantX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
 #if ENABLE_SIMD_OPT_IBC
 void IbcHashMap::initIbcHashMapX86()
 {
@@ -192,9 +192,152 @@ static void fullPelCopyAVX2( const ClpRng& clpRng, const void*_src, int srcStrid
 }
 
 
+// full-pel sample of the DMVR bilinear search, rescaled to the bilinear intermediate precision
+template<X86_VEXT vext>
+static void simdFilterCopyDMVR( const ClpRng& clpRng, const Pel* src, int srcStride, int16_t* dst, int dstStride, int width, int height )
+{
+  const bool    rightShift = clpRng.bd > IF_INTERNAL_PREC_BILINEAR;
+  const int     shift      = rightShift ? clpRng.bd - IF_INTERNAL_PREC_BILINEAR : IF_INTERNAL_PREC_BILINEAR - clpRng.bd;
+  const __m128i mmShift    = _mm_cvtsi32_si128( shift );
+  const __m128i mmOffset   = _mm_set1_epi16( rightShift ? 1 << ( shift - 1 ) : 0 );
+#ifdef USE_AVX2
+  const __m256i mm256Offset = _mm256_set1_epi16( rightShift ? 1 << ( shift - 1 ) : 0 );
+#endif
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      for( ; col + 16 <= width; col += 16 )
+      {
+        __m256i mmPix = _mm256_loadu_si256( ( const __m256i* ) ( src + col ) );
+        mmPix = rightShift ? _mm256_srl_epi16( _mm256_add_epi16( mmPix, mm256Offset ), mmShift ) : _mm256_sll_epi16( mmPix, mmShift );
+        _mm256_storeu_si256( ( __m256i* ) ( dst + col ), mmPix );
+      }
+    }
+#endif
+    for( ; col + 8 <= width; col += 8 )
+    {
+      __m128i mmPix = _mm_loadu_si128( ( const __m128i* ) ( src + col ) );
+      mmPix = rightShift ? _mm_srl_epi16( _mm_add_epi16( mmPix, mmOffset ), mmShift ) : _mm_sll_epi16( mmPix, mmShift );
+      _mm_storeu_si128( ( __m128i* ) ( dst + col ), mmPix );
+    }
+    for( ; col < width; col += 4 )
+    {
+      __m128i mmPix = _mm_loadl_epi64( ( const __m128i* ) ( src + col ) );
+      mmPix = rightShift ? _mm_srl_epi16( _mm_add_epi16( mmPix, mmOffset ), mmShift ) : _mm_sll_epi16( mmPix, mmShift );
+      _mm_storel_epi64( ( __m128i* ) ( dst + col ), mmPix );
+    }
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+// full-pel copy with 32-bit samples: every mode of InterpolationFilter::filterCopy reduces to ( ( src << shl ) + add ) >> shr, optionally clipped
+template<X86_VEXT vext, bool isFirst, bool isLast>
+static void fullPelCopy_HBD( const ClpRng& clpRng, const Pel* src, int srcStride, Pel* dst, int dstStride, int width, int height, bool biMCForDMVR )
+{
+  const int headroom = std::max<int>( 2, IF_INTERNAL_PREC - clpRng.bd );
+  int  shl  = 0;
+  int  shr  = 0;
+  int  add  = 0;
+  bool clip = false;
+
+  if( isFirst == isLast )
+  {
+    clip = !HM_JEM_CLIP_PEL;
+  }
+  else if( biMCForDMVR )
+  {
+    if( clpRng.bd > IF_INTERNAL_PREC_BILINEAR )
+    {
+      shr = clpRng.bd - IF_INTERNAL_PREC_BILINEAR;
+      add = 1 << ( shr - 1 );
+    }
+    else
+    {
+      shl = IF_INTERNAL_PREC_BILINEAR - clpRng.bd;
+    }
+  }
+  else if( isFirst )
+  {
+    shl = headroom;
+    add = -IF_INTERNAL_OFFS;
+  }
+  else
+  {
+    shr  = headroom;
+    add  = IF_INTERNAL_OFFS + ( 1 << ( headroom - 1 ) );
+    clip = true;
+  }
+
+  const __m128i vshl = _mm_cvtsi32_si128( shl );
+  const __m128i vshr = _mm_cvtsi32_si128( shr );
+  const __m128i vadd = _mm_set1_epi32( add );
+  const __m128i vmin = _mm_set1_epi32( clip ? clpRng.min : INT32_MIN );
+  const __m128i vmax = _mm_set1_epi32( clip ? clpRng.max : INT32_MAX );
+#ifdef USE_AVX2
+  const __m256i vadd256 = _mm256_set1_epi32( add );
+  const __m256i vmin256 = _mm256_set1_epi32( clip ? clpRng.min : INT32_MIN );
+  const __m256i vmax256 = _mm256_set1_epi32( clip ? clpRng.max : INT32_MAX );
+#endif
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      for( ; col + 8 <= width; col += 8 )
+      {
+        __m256i vsrc = _mm256_loadu_si256( ( const __m256i* ) ( src + col ) );
+        vsrc = _mm256_sra_epi32( _mm256_add_epi32( _mm256_sll_epi32( vsrc, vshl ), vadd256 ), vshr );
+        vsrc = _mm256_min_epi32( vmax256, _mm256_max_epi32( vmin256, vsrc ) );
+        _mm256_storeu_si256( ( __m256i* ) ( dst + col ), vsrc );
+      }
+    }
+#endif
+    for( ; col < width; col += 4 )
+    {
+      __m128i vsrc = _mm_loadu_si128( ( const __m128i* ) ( src + col ) );
+      vsrc = _mm_sra_epi32( _mm_add_epi32( _mm_sll_epi32( vsrc, vshl ), vadd ), vshr );
+      vsrc = _mm_min_epi32( vmax, _mm_max_epi32( vmin, vsrc ) );
+      _mm_storeu_si128( ( __m128i* ) ( dst + col ), vsrc );
+    }
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+#endif
+
 template<X86_VEXT vext, bool isFirst, bool isLast>
-static void simdFilterCopy( const ClpRng& clpRng, const Pel* src, int srcStride, int16_t* dst, int dstStride, int width, int height, bool biMCForDMVR)
+static void simdFilterCopy( const ClpRng& clpRng, const Pel* src, int srcStride, Pel* dst, int dstStride, int width, int height, bool biMCForDMVR)
 {
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+  if( ( width & 3 ) == 0 )
+  {
+    fullPelCopy_HBD<vext, isFirst, isLast>( clpRng, src, srcStride, dst, dstStride, width, height, biMCForDMVR );
+  }
+  else
+  {
+    InterpolationFilter::filterCopy<isFirst, isLast>( clpRng, src, srcStride, dst, dstStride, width, height, biMCForDMVR );
+  }
+#else
+  if( biMCForDMVR && isFirst != isLast )
+  {
+    if( ( width & 3 ) == 0 && clpRng.bd <= 15 )
+    {
+      simdFilterCopyDMVR<vext>( clpRng, src, srcStride, dst, dstStride, width, height );
+    }
+    else
+    {
+      InterpolationFilter::filterCopy<isFirst, isLast>( clpRng, src, srcStride, dst, dstStride, width, height, biMCForDMVR );
+    }
+    return;
+  }
 #if !HM_JEM_CLIP_PEL
   if( vext >= AVX2 && ( width % 16 ) == 0 )
   {
@@ -213,6 +356,7 @@ static void simdFilterCopy( const ClpRng& clpRng, const Pel* src, int srcStride,
   { //Scalar
     InterpolationFilter::filterCopy<isFirst, isLast>( clpRng, src, srcStride, dst, dstStride, width, height, biMCForDMVR);
   }
+#endif
 }
 
 
@@ -847,6 +991,132 @@ static void simdInterpolateVerM16_AVX2( const int16_t *src, int srcStride, int16
 }
 
 
+template<X86_VEXT vext, int N, bool shiftBack>
+static void simdInterpolateHorM32_AVX512( const int16_t* src, int srcStride, int16_t *dst, int dstStride, int width, int height, int shift, int offset, const ClpRng& clpRng, int16_t const *coeff )
+{
+#ifdef USE_AVX512
+  const int filterSpan = ( N-1 );
+  _mm_prefetch( (const char*)( src+srcStride ), _MM_HINT_T0 );
+  _mm_prefetch( (const char*)( src+width+filterSpan+srcStride ), _MM_HINT_T0 );
+
+  __m512i voffset    = _mm512_set1_epi32( offset );
+  __m512i vibdimin   = _mm512_set1_epi16( clpRng.min );
+  __m512i vibdimax   = _mm512_set1_epi16( clpRng.max );
+  __m512i vsum, vsuma, vsumb;
+
+  // same per 128-bit lane pairing as the AVX2 16 sample kernel
+  __m512i vshuf0 = _mm512_set4_epi32( 0x09080706, 0x07060504, 0x05040302, 0x03020100 );
+  __m512i vshuf1 = _mm512_set4_epi32( 0x0d0c0b0a, 0x0b0a0908, 0x09080706, 0x07060504 );
+  __m512i vcoeff[N/2];
+  for( int i=0; i<N; i+=2 )
+  {
+    vcoeff[i/2] = _mm512_unpacklo_epi16( _mm512_set1_epi16( coeff[i] ), _mm512_set1_epi16( coeff[i+1] ) );
+  }
+
+  for( int row = 0; row < height; row++ )
+  {
+    _mm_prefetch( (const char*)( src+2*srcStride ), _MM_HINT_T0 );
+    _mm_prefetch( (const char*)( src+width+filterSpan + 2*srcStride ), _MM_HINT_T0 );
+
+    for( int col = 0; col < width; col+=32 )
+    {
+      __m512i vsrc[3];
+      for( int i=0; i<( N==8 ? 3 : 2 ); i++ )
+      {
+        vsrc[i] = _mm512_loadu_si512( ( const void * )&src[col+i*4] );
+      }
+      if( N==8 )
+      {
+        vsuma = vsumb = _mm512_setzero_si512();
+        for( int i=0; i<2; i++ )
+        {
+          __m512i vsrca0 = _mm512_shuffle_epi8( vsrc[i], vshuf0 );
+          __m512i vsrca1 = _mm512_shuffle_epi8( vsrc[i], vshuf1 );
+          __m512i vsrcb0 = _mm512_shuffle_epi8( vsrc[i+1], vshuf0 );
+          __m512i vsrcb1 = _mm512_shuffle_epi8( vsrc[i+1], vshuf1 );
+          vsuma  = _mm512_add_epi32( vsuma, _mm512_add_epi32( _mm512_madd_epi16( vsrca0, vcoeff[2*i] ), _mm512_madd_epi16( vsrca1, vcoeff[2*i+1] ) ) );
+          vsumb  = _mm512_add_epi32( vsumb, _mm512_add_epi32( _mm512_madd_epi16( vsrcb0, vcoeff[2*i] ), _mm512_madd_epi16( vsrcb1, vcoeff[2*i+1] ) ) );
+        }
+      }
+      else
+      {
+        vsuma = _mm512_add_epi32( _mm512_madd_epi16( _mm512_shuffle_epi8( vsrc[0], vshuf0 ), vcoeff[0] ), _mm512_madd_epi16( _mm512_shuffle_epi8( vsrc[0], vshuf1 ), vcoeff[1] ) );
+        vsumb = _mm512_add_epi32( _mm512_madd_epi16( _mm512_shuffle_epi8( vsrc[1], vshuf0 ), vcoeff[0] ), _mm512_madd_epi16( _mm512_shuffle_epi8( vsrc[1], vshuf1 ), vcoeff[1] ) );
+      }
+
+      vsuma = _mm512_srai_epi32( _mm512_add_epi32( vsuma, voffset ), shift );
+      vsumb = _mm512_srai_epi32( _mm512_add_epi32( vsumb, voffset ), shift );
+      vsum  = _mm512_packs_epi32( vsuma, vsumb );
+
+      if( shiftBack )
+      { //clip
+        vsum = _mm512_min_epi16( vibdimax, _mm512_max_epi16( vibdimin, vsum ) );
+      }
+      _mm512_storeu_si512( ( void * )&dst[col], vsum );
+    }
+    src += srcStride;
+    dst += dstStride;
+  }
+#endif
+}
+
+template<X86_VEXT vext, int N, bool shiftBack>
+static void simdInterpolateVerM32_AVX512( const int16_t *src, int srcStride, int16_t *dst, int dstStride, int width, int height, int shift, int offset, const ClpRng& clpRng, int16_t const *coeff )
+{
+#ifdef USE_AVX512
+  __m512i voffset    = _mm512_set1_epi32( offset );
+  __m512i vibdimin   = _mm512_set1_epi16( clpRng.min );
+  __m512i vibdimax   = _mm512_set1_epi16( clpRng.max );
+  __m512i vsum, vsuma, vsumb;
+
+  __m512i vsrc[N];
+  __m512i vcoeff[N/2];
+  for( int i=0; i<N; i+=2 )
+  {
+    vcoeff[i/2] = _mm512_unpacklo_epi16( _mm512_set1_epi16( coeff[i] ), _mm512_set1_epi16( coeff[i+1] ) );
+  }
+
+  for( int col = 0; col < width; col+=32 )
+  {
+    const int16_t *srcCol = src + col;
+    int16_t       *dstCol = dst + col;
+
+    for( int i=0; i<N-1; i++ )
+    {
+      vsrc[i] = _mm512_loadu_si512( ( const void * )&srcCol[i * srcStride] );
+    }
+    for( int row = 0; row < height; row++ )
+    {
+      vsrc[N-1] = _mm512_loadu_si512( ( const void * )&srcCol[( N-1 ) * srcStride] );
+      vsuma = vsumb = _mm512_setzero_si512();
+      for( int i=0; i<N; i+=2 )
+      {
+        vsuma = _mm512_add_epi32( vsuma, _mm512_madd_epi16( _mm512_unpacklo_epi16( vsrc[i], vsrc[i+1] ), vcoeff[i/2] ) );
+        vsumb = _mm512_add_epi32( vsumb, _mm512_madd_epi16( _mm512_unpackhi_epi16( vsrc[i], vsrc[i+1] ), vcoeff[i/2] ) );
+      }
+      for( int i=0; i<N-1; i++ )
+      {
+        vsrc[i] = vsrc[i+1];
+      }
+
+      vsuma = _mm512_srai_epi32( _mm512_add_epi32( vsuma, voffset ), shift );
+      vsumb = _mm512_srai_epi32( _mm512_add_epi32( vsumb, voffset ), shift );
+      vsum  = _mm512_packs_epi32( vsuma, vsumb );
+
+      if( shiftBack )
+      { //clip
+        vsum = _mm512_min_epi16( vibdimax, _mm512_max_epi16( vibdimin, vsum ) );
+      }
+      _mm512_storeu_si512( ( void * )dstCol, vsum );
+
+      srcCol += srcStride;
+      dstCol += dstStride;
+    }
+  }
+#endif
+}
+
+
 template<int N, bool isLast>
 inline void interpolate( const int16_t* src, int cStride, int16_t *dst, int width, int shift, int offset, int bitdepth, int maxVal, int16_t const *c )
 {
@@ -1060,12 +1330,85 @@ static void simdInterpolateN2_10BIT_M4(const int16_t* src, int srcStride, int16_
     }
 
     // last 4 samples
-    __m128i mmFiltered = simdInterpolateLuma10Bit2P4(src + col, cStride, mmCoeff, mmOffset, mmShift);
-    _mm_storel_epi64((__m128i *)(dst + col), mmFiltered);
+    if (col < width)
+    {
+      __m128i mmFiltered = simdInterpolateLuma10Bit2P4(src + col, cStride, mmCoeff, mmOffset, mmShift);
+      _mm_storel_epi64((__m128i *)(dst + col), mmFiltered);
+    }
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+// SIMD interpolation with 32-bit samples, horizontal or vertical (cStride), block width modulo 4
+template<X86_VEXT vext, int N, bool isLast>
+static void simdInterpolateM4_HBD( const Pel* src, int srcStride, Pel *dst, int dstStride, int cStride, int width, int height, int shift, int offset, const ClpRng& clpRng, Pel const *c )
+{
+  const __m128i vshift   = _mm_cvtsi32_si128( shift );
+  const __m128i voffset  = _mm_set1_epi32( offset );
+  const __m128i vibdimin = _mm_set1_epi32( clpRng.min );
+  const __m128i vibdimax = _mm_set1_epi32( clpRng.max );
+  __m128i vcoeff[N];
+  for( int i = 0; i < N; i++ )
+  {
+    vcoeff[i] = _mm_set1_epi32( c[i] );
+  }
+#ifdef USE_AVX2
+  const __m256i voffset256  = _mm256_set1_epi32( offset );
+  const __m256i vibdimin256 = _mm256_set1_epi32( clpRng.min );
+  const __m256i vibdimax256 = _mm256_set1_epi32( clpRng.max );
+  __m256i vcoeff256[N];
+  for( int i = 0; i < N; i++ )
+  {
+    vcoeff256[i] = _mm256_set1_epi32( c[i] );
+  }
+#endif
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      for( ; col + 8 <= width; col += 8 )
+      {
+        __m256i vsum = voffset256;
+        for( int i = 0; i < N; i++ )
+        {
+          __m256i vsrc = _mm256_loadu_si256( ( const __m256i * )&src[col + i * cStride] );
+          vsum = _mm256_add_epi32( vsum, _mm256_mullo_epi32( vsrc, vcoeff256[i] ) );
+        }
+        vsum = _mm256_sra_epi32( vsum, vshift );
+        if( isLast )
+        {
+          vsum = _mm256_min_epi32( vibdimax256, _mm256_max_epi32( vibdimin256, vsum ) );
+        }
+        _mm256_storeu_si256( ( __m256i * )&dst[col], vsum );
+      }
+    }
+#endif
+    for( ; col < width; col += 4 )
+    {
+      __m128i vsum = voffset;
+      for( int i = 0; i < N; i++ )
+      {
+        __m128i vsrc = _mm_loadu_si128( ( const __m128i * )&src[col + i * cStride] );
+        vsum = _mm_add_epi32( vsum, _mm_mullo_epi32( vsrc, vcoeff[i] ) );
+      }
+      vsum = _mm_sra_epi32( vsum, vshift );
+      if( isLast )
+      {
+        vsum = _mm_min_epi32( vibdimax, _mm_max_epi32( vibdimin, vsum ) );
+      }
+      _mm_storeu_si128( ( __m128i * )&dst[col], vsum );
+    }
+
     src += srcStride;
     dst += dstStride;
   }
 }
+#endif
 
 template<X86_VEXT vext, int N, bool isVertical, bool isFirst, bool isLast>
 static void simdFilter( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR)
@@ -1127,8 +1470,25 @@ static void simdFilter( const ClpRng& clpRng, Pel const *src, int srcStride, Pel
       offset = 1 << (shift - 1);
     }
   }
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+  if( !( width & 0x03 ) )
+  {
+    simdInterpolateM4_HBD<vext, N, isLast>( src, srcStride, dst, dstStride, cStride, width, height, shift, offset, clpRng, c );
+    return;
+  }
+#else
   if( clpRng.bd <= 10 )
   {
+#ifdef USE_AVX512
+    if( vext >= AVX512 && ( N == 8 || N == 4 ) && !( width & 0x1f ) )
+    {
+      if( !isVertical )
+        simdInterpolateHorM32_AVX512<vext, N, isLast>( src, srcStride, dst, dstStride, width, height, shift, offset, clpRng, c );
+      else
+        simdInterpolateVerM32_AVX512<vext, N, isLast>( src, srcStride, dst, dstStride, width, height, shift, offset, clpRng, c );
+      return;
+    }
+#endif
     if( N == 8 && !( width & 0x07 ) )
     {
       if( !isVertical )
@@ -1195,6 +1555,8 @@ static void simdFilter( const ClpRng& clpRng, Pel const *src, int srcStride, Pel
     }
   }
 
+#endif
+
   for( row = 0; row < height; row++ )
   {
     for( col = 0; col < width; col++ )
@@ -0,0 +1,701 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     IntraPredictionX86.h
+    \brief    SIMD intra prediction
+*/
+
+//! \ingroup CommonLib
+//! \{
+
+#include "CommonLib/CommonDef.h"
+#include "CommonDefX86.h"
+#include "CommonLib/IntraPrediction.h"
+#include "CommonLib/InterpolationFilter.h"
+
+#if ENABLE_SIMD_OPT_INTRAPRED
+#ifdef TARGET_SIMD_X86
+
+// Rows are processed in chunks of 16 (AVX2), 8 and 4 samples, the remaining samples of narrow blocks are
+// handled by scalar code. The interpolation and PDPC weightings are evaluated with pmaddwd on interleaved
+// sample pairs, so all intermediate sums are 32 bit as in the scalar code.
+
+static inline __m128i ipLoad( const Pel* src, const int num )
+{
+  return num == 8 ? _mm_loadu_si128( ( const __m128i* ) src ) : _mm_loadl_epi64( ( const __m128i* ) src );
+}
+
+static inline void ipStore( Pel* dst, const __m128i val, const int num )
+{
+  if( num == 8 )
+  {
+    _mm_storeu_si128( ( __m128i* ) dst, val );
+  }
+  else
+  {
+    _mm_storel_epi64( ( __m128i* ) dst, val );
+  }
+}
+
+// ( c0 * a + c1 * b + c2 * c + c3 * d + offset ) >> shift, c01 and c23 hold the coefficient pairs
+template<int shift>
+static inline __m128i ipFilter4( const __m128i a, const __m128i b, const __m128i c, const __m128i d, const __m128i c01, const __m128i c23, const __m128i offset )
+{
+  __m128i lo = _mm_add_epi32( _mm_madd_epi16( _mm_unpacklo_epi16( a, b ), c01 ), _mm_madd_epi16( _mm_unpacklo_epi16( c, d ), c23 ) );
+  __m128i hi = _mm_add_epi32( _mm_madd_epi16( _mm_unpackhi_epi16( a, b ), c01 ), _mm_madd_epi16( _mm_unpackhi_epi16( c, d ), c23 ) );
+  lo = _mm_srai_epi32( _mm_add_epi32( lo, offset ), shift );
+  hi = _mm_srai_epi32( _mm_add_epi32( hi, offset ), shift );
+  return _mm_packs_epi32( lo, hi );
+}
+
+// ( c0 * a + c1 * b + offset ) >> shift
+template<int shift>
+static inline __m128i ipFilter2( const __m128i a, const __m128i b, const __m128i c01, const __m128i offset )
+{
+  const __m128i lo = _mm_srai_epi32( _mm_add_epi32( _mm_madd_epi16( _mm_unpacklo_epi16( a, b ), c01 ), offset ), shift );
+  const __m128i hi = _mm_srai_epi32( _mm_add_epi32( _mm_madd_epi16( _mm_unpackhi_epi16( a, b ), c01 ), offset ), shift );
+  return _mm_packs_epi32( lo, hi );
+}
+
+#ifdef USE_AVX2
+template<int shift>
+static inline __m256i ipFilter4( const __m256i a, const __m256i b, const __m256i c, const __m256i d, const __m256i c01, const __m256i c23, const __m256i offset )
+{
+  __m256i lo = _mm256_add_epi32( _mm256_madd_epi16( _mm256_unpacklo_epi16( a, b ), c01 ), _mm256_madd_epi16( _mm256_unpacklo_epi16( c, d ), c23 ) );
+  __m256i hi = _mm256_add_epi32( _mm256_madd_epi16( _mm256_unpackhi_epi16( a, b ), c01 ), _mm256_madd_epi16( _mm256_unpackhi_epi16( c, d ), c23 ) );
+  lo = _mm256_srai_epi32( _mm256_add_epi32( lo, offset ), shift );
+  hi = _mm256_srai_epi32( _mm256_add_epi32( hi, offset ), shift );
+  return _mm256_packs_epi32( lo, hi );
+}
+
+template<int shift>
+static inline __m256i ipFilter2( const __m256i a, const __m256i b, const __m256i c01, const __m256i offset )
+{
+  const __m256i lo = _mm256_srai_epi32( _mm256_add_epi32( _mm256_madd_epi16( _mm256_unpacklo_epi16( a, b ), c01 ), offset ), shift );
+  const __m256i hi = _mm256_srai_epi32( _mm256_add_epi32( _mm256_madd_epi16( _mm256_unpackhi_epi16( a, b ), c01 ), offset ), shift );
+  return _mm256_packs_epi32( lo, hi );
+}
+#endif
+
+// p + ( ( wL * ( left - p ) + wT * ( top - p ) - wTL * ( topLeft - p ) + 32 ) >> 6 ), which equals the scalar
+// ( wL * left + wT * top - wTL * topLeft + ( 64 - wL - wT + wTL ) * p + 32 ) >> 6
+static inline __m128i ipPdpcBlend( const __m128i p, const __m128i left, const __m128i top, const __m128i topLeft, const __m128i wL, const __m128i wT, const __m128i wTL, const __m128i vmin, const __m128i vmax )
+{
+  const __m128i dLT  = _mm_sub_epi16( left, p );
+  const __m128i dT   = _mm_sub_epi16( top, p );
+  const __m128i dTL  = _mm_sub_epi16( p, topLeft );
+  const __m128i rnd  = _mm_set1_epi16( 32 );
+  const __m128i one  = _mm_set1_epi16( 1 );
+
+  __m128i lo = _mm_add_epi32( _mm_madd_epi16( _mm_unpacklo_epi16( dLT, dT ), _mm_unpacklo_epi16( wL, wT ) ), _mm_madd_epi16( _mm_unpacklo_epi16( dTL, rnd ), _mm_unpacklo_epi16( wTL, one ) ) );
+  __m128i hi = _mm_add_epi32( _mm_madd_epi16( _mm_unpackhi_epi16( dLT, dT ), _mm_unpackhi_epi16( wL, wT ) ), _mm_madd_epi16( _mm_unpackhi_epi16( dTL, rnd ), _mm_unpackhi_epi16( wTL, one ) ) );
+  lo = _mm_srai_epi32( lo, 6 );
+  hi = _mm_srai_epi32( hi, 6 );
+  return _mm_min_epi16( _mm_max_epi16( _mm_add_epi16( p, _mm_packs_epi32( lo, hi ) ), vmin ), vmax );
+}
+
+static inline Pel ipPdpcSample( const Pel p, const Pel left, const Pel top, const Pel topLeft, const int wL, const int wT, const int wTL, const ClpRng& clpRng )
+{
+  return ClipPel( ( wL * left + wT * top - wTL * topLeft + ( 64 - wL - wT + wTL ) * p + 32 ) >> 6, clpRng );
+}
+
+template<X86_VEXT vext>
+static void simdPredIntraAngIntSlope( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng )
+{
+  for( int y = 0; y < height; y++, deltaPos += intraPredAngle, pDst += dstStride )
+  {
+    const Pel* ref = refMain + ( deltaPos >> 5 ) + 1;
+
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      for( ; x + 16 <= width; x += 16 )
+      {
+        _mm256_storeu_si256( ( __m256i* ) &pDst[x], _mm256_loadu_si256( ( const __m256i* ) &ref[x] ) );
+      }
+    }
+#endif
+    for( ; x + 8 <= width; x += 8 )
+    {
+      _mm_storeu_si128( ( __m128i* ) &pDst[x], _mm_loadu_si128( ( const __m128i* ) &ref[x] ) );
+    }
+    if( x + 4 <= width )
+    {
+      _mm_storel_epi64( ( __m128i* ) &pDst[x], _mm_loadl_epi64( ( const __m128i* ) &ref[x] ) );
+      x += 4;
+    }
+    for( ; x < width; x++ )
+    {
+      pDst[x] = ref[x];
+    }
+  }
+}
+
+template<X86_VEXT vext>
+static void simdPredIntraAngLinear( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng )
+{
+  const __m128i offset = _mm_set1_epi32( 16 );
+
+  for( int y = 0; y < height; y++, deltaPos += intraPredAngle, pDst += dstStride )
+  {
+    const int  deltaFract = deltaPos & 31;
+    const Pel* ref        = refMain + ( deltaPos >> 5 ) + 1;
+    const __m128i c01     = _mm_unpacklo_epi16( _mm_set1_epi16( 32 - deltaFract ), _mm_set1_epi16( deltaFract ) );
+
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      const __m256i c01_256    = _mm256_inserti128_si256( _mm256_castsi128_si256( c01 ), c01, 1 );
+      const __m256i offset_256 = _mm256_set1_epi32( 16 );
+
+      for( ; x + 16 <= width; x += 16 )
+      {
+        const __m256i a = _mm256_loadu_si256( ( const __m256i* ) &ref[x] );
+        const __m256i b = _mm256_loadu_si256( ( const __m256i* ) &ref[x + 1] );
+        _mm256_storeu_si256( ( __m256i* ) &pDst[x], ipFilter2<5>( a, b, c01_256, offset_256 ) );
+      }
+    }
+#endif
+    for( ; x + 4 <= width; )
+    {
+      const int     num = x + 8 <= width ? 8 : 4;
+      const __m128i a   = ipLoad( &ref[x], num );
+      const __m128i b   = ipLoad( &ref[x + 1], num );
+      ipStore( &pDst[x], ipFilter2<5>( a, b, c01, offset ), num );
+      x += num;
+    }
+    for( ; x < width; x++ )
+    {
+      pDst[x] = ( Pel ) ( ( ( 32 - deltaFract ) * ref[x] + deltaFract * ref[x + 1] + 16 ) >> 5 );
+    }
+  }
+}
+
+template<X86_VEXT vext, bool useCubicFilter>
+static void simdPredIntraAngLuma( Pel* pDst, const int dstStride, const Pel* refMain, const int width, const int height, int deltaPos, const int intraPredAngle, const ClpRng& clpRng )
+{
+  const __m128i offset = _mm_set1_epi32( 32 );
+  const __m128i vmin   = _mm_set1_epi16( clpRng.min );
+  const __m128i vmax   = _mm_set1_epi16( clpRng.max );
+
+  for( int y = 0; y < height; y++, deltaPos += intraPredAngle, pDst += dstStride )
+  {
+    const int           deltaFract = deltaPos & 31;
+    const Pel*          ref        = refMain + ( deltaPos >> 5 );
+    const TFilterCoeff* f          = useCubicFilter ? InterpolationFilter::getChromaFilterTable( deltaFract ) : g_intraGaussFilter[deltaFract];
+    const __m128i       c01        = _mm_unpacklo_epi16( _mm_set1_epi16( f[0] ), _mm_set1_epi16( f[1] ) );
+    const __m128i       c23        = _mm_unpacklo_epi16( _mm_set1_epi16( f[2] ), _mm_set1_epi16( f[3] ) );
+
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      const __m256i c01_256    = _mm256_inserti128_si256( _mm256_castsi128_si256( c01 ), c01, 1 );
+      const __m256i c23_256    = _mm256_inserti128_si256( _mm256_castsi128_si256( c23 ), c23, 1 );
+      const __m256i offset_256 = _mm256_set1_epi32( 32 );
+      const __m256i vmin_256   = _mm256_set1_epi16( clpRng.min );
+      const __m256i vmax_256   = _mm256_set1_epi16( clpRng.max );
+
+      for( ; x + 16 <= width; x += 16 )
+      {
+        const __m256i a = _mm256_loadu_si256( ( const __m256i* ) &ref[x] );
+        const __m256i b = _mm256_loadu_si256( ( const __m256i* ) &ref[x + 1] );
+        const __m256i c = _mm256_loadu_si256( ( const __m256i* ) &ref[x + 2] );
+        const __m256i d = _mm256_loadu_si256( ( const __m256i* ) &ref[x + 3] );
+        __m256i val     = ipFilter4<6>( a, b, c, d, c01_256, c23_256, offset_256 );
+        if( useCubicFilter )
+        {
+          val = _mm256_min_epi16( _mm256_max_epi16( val, vmin_256 ), vmax_256 );
+        }
+        _mm256_storeu_si256( ( __m256i* ) &pDst[x], val );
+      }
+    }
+#endif
+    for( ; x + 4 <= width; )
+    {
+      const int     num = x + 8 <= width ? 8 : 4;
+      const __m128i a   = ipLoad( &ref[x], num );
+      const __m128i b   = ipLoad( &ref[x + 1], num );
+      const __m128i c   = ipLoad( &ref[x + 2], num );
+      const __m128i d   = ipLoad( &ref[x + 3], num );
+      __m128i val       = ipFilter4<6>( a, b, c, d, c01, c23, offset );
+      if( useCubicFilter )
+      {
+        val = _mm_min_epi16( _mm_max_epi16( val, vmin ), vmax );
+      }
+      ipStore( &pDst[x], val, num );
+      x += num;
+    }
+    for( ; x < width; x++ )
+    {
+      const int p3 = f[3] != 0 ? ref[x + 3] : 0;
+      const Pel val = static_cast<Pel>( ( f[0] * ref[x] + f[1] * ref[x + 1] + f[2] * ref[x + 2] + f[3] * p3 + 32 ) >> 6 );
+      pDst[x] = useCubicFilter ? ClipPel( val, clpRng ) : val;
+    }
+  }
+}
+
+template<X86_VEXT vext>
+static void simdPredIntraPlanar( const CPelBuf &pSrc, PelBuf &pDst )
+{
+  const int      width      = pDst.width;
+  const int      height     = pDst.height;
+  const uint32_t log2W      = g_aucLog2[width  < 2 ? 2 : width];
+  const uint32_t log2H      = g_aucLog2[height < 2 ? 2 : height];
+  const uint32_t finalShift = 1 + log2W + log2H;
+  const int      offset     = 1 << ( log2W + log2H );
+
+  const Pel* top        = pSrc.buf + 1;
+  const int  topRight   = pSrc.at( width + 1, 0 );
+  const int  bottomLeft = pSrc.at( 0, height + 1 );
+
+  // vertical part of the prediction, ( topRow << log2H ) + ( y + 1 ) * bottomRow, updated line by line
+  int vertPred[MAX_CU_SIZE], bottomRow[MAX_CU_SIZE];
+  for( int x = 0; x < width; x++ )
+  {
+    bottomRow[x] = bottomLeft - top[x];
+    vertPred [x] = top[x] << log2H;
+  }
+
+  const __m128i vOffset = _mm_set1_epi32( offset );
+  const __m128i vShiftH = _mm_cvtsi32_si128( log2H );
+  const __m128i vShiftW = _mm_cvtsi32_si128( log2W );
+  const __m128i vShiftF = _mm_cvtsi32_si128( finalShift );
+
+  Pel* pred = pDst.buf;
+  for( int y = 0; y < height; y++, pred += pDst.stride )
+  {
+    const int left        = pSrc.at( 0, y + 1 );
+    const int rightColumn = topRight - left;
+    const int horBase     = left << log2W;
+
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      const __m256i vRight   = _mm256_set1_epi32( rightColumn );
+      const __m256i vStep    = _mm256_set1_epi32( 8 * rightColumn );
+      const __m256i vOff256  = _mm256_set1_epi32( offset );
+      __m256i       horPred  = _mm256_add_epi32( _mm256_set1_epi32( horBase ), _mm256_mullo_epi32( _mm256_setr_epi32( 1, 2, 3, 4, 5, 6, 7, 8 ), vRight ) );
+
+      for( ; x + 8 <= width; x += 8 )
+      {
+        __m256i vert = _mm256_add_epi32( _mm256_loadu_si256( ( const __m256i* ) &vertPred[x] ), _mm256_loadu_si256( ( const __m256i* ) &bottomRow[x] ) );
+        _mm256_storeu_si256( ( __m256i* ) &vertPred[x], vert );
+
+        __m256i val = _mm256_add_epi32( _mm256_sll_epi32( horPred, vShiftH ), _mm256_sll_epi32( vert, vShiftW ) );
+        val         = _mm256_sra_epi32( _mm256_add_epi32( val, vOff256 ), vShiftF );
+        _mm_storeu_si128( ( __m128i* ) &pred[x], _mm_packs_epi32( _mm256_castsi256_si128( val ), _mm256_extracti128_si256( val, 1 ) ) );
+
+        horPred = _mm256_add_epi32( horPred, vStep );
+      }
+    }
+#endif
+    if( x + 4 <= width )
+    {
+      const __m128i vStep   = _mm_set1_epi32( 4 * rightColumn );
+      __m128i       horPred = _mm_add_epi32( _mm_set1_epi32( horBase + x * rightColumn ), _mm_mullo_epi32( _mm_setr_epi32( 1, 2, 3, 4 ), _mm_set1_epi32( rightColumn ) ) );
+
+      for( ; x + 4 <= width; x += 4 )
+      {
+        __m128i vert = _mm_add_epi32( _mm_loadu_si128( ( const __m128i* ) &vertPred[x] ), _mm_loadu_si128( ( const __m128i* ) &bottomRow[x] ) );
+        _mm_storeu_si128( ( __m128i* ) &vertPred[x], vert );
+
+        __m128i val = _mm_add_epi32( _mm_sll_epi32( horPred, vShiftH ), _mm_sll_epi32( vert, vShiftW ) );
+        val         = _mm_sra_epi32( _mm_add_epi32( val, vOffset ), vShiftF );
+        _mm_storel_epi64( ( __m128i* ) &pred[x], _mm_packs_epi32( val, val ) );
+
+        horPred = _mm_add_epi32( horPred, vStep );
+      }
+    }
+    for( ; x < width; x++ )
+    {
+      vertPred[x] += bottomRow[x];
+      const int horPred = horBase + ( x + 1 ) * rightColumn;
+      pred[x] = ( ( horPred << log2H ) + ( vertPred[x] << log2W ) + offset ) >> finalShift;
+    }
+  }
+}
+
+template<X86_VEXT vext>
+static void simdPredIntraDc( const CPelBuf &pSrc, PelBuf &pDst )
+{
+  const int width     = pDst.width;
+  const int height    = pDst.height;
+  const int denom     = ( width == height ) ? ( width << 1 ) : std::max( width, height );
+  const int divShift  = g_aucLog2[denom];
+  const int divOffset = ( denom >> 1 );
+
+  int sum = 0;
+  if( width >= height )
+  {
+    const Pel* top = pSrc.buf + 1;
+    __m128i    acc = _mm_setzero_si128();
+    int        x   = 0;
+    for( ; x + 4 <= width; )
+    {
+      const int num = x + 8 <= width ? 8 : 4;
+      acc = _mm_add_epi32( acc, _mm_madd_epi16( ipLoad( &top[x], num ), _mm_set1_epi16( 1 ) ) );
+      x += num;
+    }
+    acc = _mm_hadd_epi32( acc, acc );
+    acc = _mm_hadd_epi32( acc, acc );
+    sum = _mm_cvtsi128_si32( acc );
+    for( ; x < width; x++ )
+    {
+      sum += top[x];
+    }
+  }
+  if( width <= height )
+  {
+    for( int y = 0; y < height; y++ )
+    {
+      sum += pSrc.at( 0, 1 + y );
+    }
+  }
+
+  const Pel dcVal = ( sum + divOffset ) >> divShift;
+  const __m128i vDc = _mm_set1_epi16( dcVal );
+
+  Pel* dst = pDst.buf;
+  for( int y = 0; y < height; y++, dst += pDst.stride )
+  {
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      const __m256i vDc256 = _mm256_set1_epi16( dcVal );
+      for( ; x + 16 <= width; x += 16 )
+      {
+        _mm256_storeu_si256( ( __m256i* ) &dst[x], vDc256 );
+      }
+    }
+#endif
+    for( ; x + 4 <= width; )
+    {
+      const int num = x + 8 <= width ? 8 : 4;
+      ipStore( &dst[x], vDc, num );
+      x += num;
+    }
+    for( ; x < width; x++ )
+    {
+      dst[x] = dcVal;
+    }
+  }
+}
+
+// PDPC of planar, DC, HOR and VER: wTL is zero for planar, ( wL >> 4 ) + ( wT >> 4 ) for DC, wT for HOR (wL = 0)
+// and wL for VER (wT = 0). A line is only processed as far as one of the weights is non-zero.
+template<X86_VEXT vext>
+static void simdIntraPdpc( const CPelBuf &pSrc, PelBuf &pDst, const uint32_t dirMode, const int scale, const ClpRng& clpRng )
+{
+  if( dirMode != PLANAR_IDX && dirMode != DC_IDX && dirMode != HOR_IDX && dirMode != VER_IDX )
+  {
+    return;
+  }
+
+  const int  width   = pDst.width;
+  const int  height  = pDst.height;
+  const Pel* top     = pSrc.buf + 1;
+  const Pel  topLeft = pSrc.at( 0, 0 );
+
+  int16_t wLTab[MAX_CU_SIZE];
+  int     numWL = 0;
+  for( int x = 0; x < width; x++ )
+  {
+    wLTab[x] = dirMode == HOR_IDX ? 0 : 32 >> std::min( 31, ( ( x << 1 ) >> scale ) );
+    numWL    = wLTab[x] ? x + 1 : numWL;
+  }
+
+  const __m128i vmin     = _mm_set1_epi16( clpRng.min );
+  const __m128i vmax     = _mm_set1_epi16( clpRng.max );
+  const __m128i vTopLeft = _mm_set1_epi16( topLeft );
+
+  Pel* dst = pDst.buf;
+  for( int y = 0; y < height; y++, dst += pDst.stride )
+  {
+    const int wT   = dirMode == VER_IDX ? 0 : 32 >> std::min( 31, ( ( y << 1 ) >> scale ) );
+    const int xEnd = wT ? width : numWL;
+    const Pel left = pSrc.at( 0, y + 1 );
+
+    const __m128i vLeft = _mm_set1_epi16( left );
+    const __m128i vWT   = _mm_set1_epi16( wT );
+
+    int x = 0;
+    for( ; x < xEnd && x + 4 <= width; )
+    {
+      const int num = x + 8 <= width ? 8 : 4;
+      const __m128i wL  = ipLoad( &wLTab[x], num );
+      const __m128i wTL = dirMode == PLANAR_IDX ? _mm_setzero_si128()
+                        : dirMode == DC_IDX     ? _mm_add_epi16( _mm_srli_epi16( wL, 4 ), _mm_srli_epi16( vWT, 4 ) )
+                        : dirMode == HOR_IDX    ? vWT
+                        :                         wL;
+      ipStore( &dst[x], ipPdpcBlend( ipLoad( &dst[x], num ), vLeft, ipLoad( &top[x], num ), vTopLeft, wL, vWT, wTL, vmin, vmax ), num );
+      x += num;
+    }
+    for( ; x < xEnd; x++ )
+    {
+      const int wL  = wLTab[x];
+      const int wTL = dirMode == PLANAR_IDX ? 0 : dirMode == DC_IDX ? ( wL >> 4 ) + ( wT >> 4 ) : dirMode == HOR_IDX ? wT : wL;
+      dst[x] = ipPdpcSample( dst[x], left, top[x], topLeft, wL, wT, wTL, clpRng );
+    }
+  }
+}
+
+// PDPC of the diagonal modes 2 and VDIA, left and top are read along the anti-diagonal x + y + 1
+template<X86_VEXT vext>
+static void simdIntraPdpcDiagonal( Pel* pDst, const int dstStride, const Pel* refMain, const Pel* refSide, const int width, const int height, const int scale, const ClpRng& clpRng )
+{
+  int16_t wLTab[MAX_CU_SIZE];
+  int     numWL = 0;
+  for( int x = 0; x < width; x++ )
+  {
+    wLTab[x] = 16 >> std::min( 31, ( ( x << 1 ) >> scale ) );
+    numWL    = wLTab[x] ? x + 1 : numWL;
+  }
+
+  const __m128i vmin  = _mm_set1_epi16( clpRng.min );
+  const __m128i vmax  = _mm_set1_epi16( clpRng.max );
+  const __m128i vZero = _mm_setzero_si128();
+  const __m128i vIdx  = _mm_setr_epi16( 0, 1, 2, 3, 4, 5, 6, 7 );
+
+  for( int y = 0; y < height; y++, pDst += dstStride )
+  {
+    const int wT = 16 >> std::min( 31, ( ( y << 1 ) >> scale ) );
+
+    // samples with c = x + y + 1 >= 2 * height get no left and those with c >= 2 * width no top contribution
+    const int xEndL = std::min( numWL, 2 * height - y - 1 );
+    const int xEndT = wT ? 2 * width - y - 1 : 0;
+    const int xEnd  = std::min( width, std::max( xEndL, xEndT ) );
+
+    const __m128i vWT   = _mm_set1_epi16( wT );
+    const __m128i vLimL = _mm_set1_epi16( 2 * height - y - 1 );
+    const __m128i vLimT = _mm_set1_epi16( 2 * width  - y - 1 );
+
+    int x = 0;
+    for( ; x < xEnd && x + 4 <= width; )
+    {
+      const int     num = x + 8 <= width ? 8 : 4;
+      const __m128i xv  = _mm_add_epi16( vIdx, _mm_set1_epi16( x ) );
+      const __m128i wL  = _mm_and_si128( ipLoad( &wLTab[x], num ), _mm_cmpgt_epi16( vLimL, xv ) );
+      const __m128i wTv = _mm_and_si128( vWT, _mm_cmpgt_epi16( vLimT, xv ) );
+      const __m128i l   = ipLoad( &refSide[x + y + 2], num );
+      const __m128i t   = ipLoad( &refMain[x + y + 2], num );
+      ipStore( &pDst[x], ipPdpcBlend( ipLoad( &pDst[x], num ), l, t, vZero, wL, wTv, vZero, vmin, vmax ), num );
+      x += num;
+    }
+    for( ; x < xEnd; x++ )
+    {
+      const int c   = x + y + 1;
+      const int wL  = c >= 2 * height ? 0 : wLTab[x];
+      const int wTc = c >= 2 * width  ? 0 : wT;
+      pDst[x] = ipPdpcSample( pDst[x], wL ? refSide[c + 1] : 0, wTc ? refMain[c + 1] : 0, 0, wL, wTc, 0, clpRng );
+    }
+  }
+}
+
+// PDPC of the angular modes with a positive angle, the left sample positions are the same for every line
+// up to the line offset, they are gathered into a temporary line and blended with SIMD
+template<X86_VEXT vext>
+static void simdIntraPdpcAngular( Pel* pDst, const int dstStride, const Pel* refSide, const int width, const int height, const int scale, const int invAngle, const int refSideLength, const ClpRng& clpRng )
+{
+  int16_t wLTab[MAX_CU_SIZE];
+  int     deltaInt[MAX_CU_SIZE];
+  int     leftIdx [MAX_CU_SIZE];
+  int     xEnd = 0;
+
+  int invAngleSum0 = 2;
+  for( int x = 0; x < width; x++ )
+  {
+    invAngleSum0 += invAngle;
+    const int deltaPos0 = invAngleSum0 >> 2;
+    deltaInt[x] = deltaPos0 >> 6;
+    leftIdx [x] = deltaInt[x] + 1 + ( ( deltaPos0 & 63 ) >> 5 );
+    wLTab   [x] = 32 >> std::min( 31, ( ( x << 1 ) >> scale ) );
+    if( wLTab[x] == 0 )
+    {
+      break;
+    }
+    xEnd = x + 1;
+  }
+
+  const __m128i vmin  = _mm_set1_epi16( clpRng.min );
+  const __m128i vmax  = _mm_set1_epi16( clpRng.max );
+  const __m128i vZero = _mm_setzero_si128();
+  const __m128i vIdx  = _mm_setr_epi16( 0, 1, 2, 3, 4, 5, 6, 7 );
+
+  Pel left[MAX_CU_SIZE];
+  ::memset( left, 0, sizeof( left ) );
+
+  for( int y = 0; y < height; y++, pDst += dstStride )
+  {
+    // the line stops at the first sample whose left reference lies beyond the side reference
+    while( xEnd > 0 && y + deltaInt[xEnd - 1] + 1 > refSideLength - 1 )
+    {
+      xEnd--;
+    }
+    if( xEnd == 0 )
+    {
+      break;
+    }
+
+    for( int x = 0; x < xEnd; x++ )
+    {
+      left[x] = refSide[y + leftIdx[x]];
+    }
+
+    const __m128i vEnd = _mm_set1_epi16( xEnd );
+
+    int x = 0;
+    for( ; x < xEnd && x + 4 <= width; )
+    {
+      const int     num = x + 8 <= width ? 8 : 4;
+      const __m128i xv  = _mm_add_epi16( vIdx, _mm_set1_epi16( x ) );
+      const __m128i wL  = _mm_and_si128( ipLoad( &wLTab[x], num ), _mm_cmpgt_epi16( vEnd, xv ) );
+      ipStore( &pDst[x], ipPdpcBlend( ipLoad( &pDst[x], num ), ipLoad( &left[x], num ), vZero, vZero, wL, vZero, vZero, vmin, vmax ), num );
+      x += num;
+    }
+    for( ; x < xEnd; x++ )
+    {
+      pDst[x] = ipPdpcSample( pDst[x], left[x], 0, 0, wLTab[x], 0, 0, clpRng );
+    }
+  }
+}
+
+// CCLM luma downsampling: each output uses the even luma sample and its right neighbour (weights in A)
+// plus the left neighbour (weight in B), both pairs are reduced with a single madd per row
+template<CclmDownsampleKernel kernel>
+static inline Pel cclmDownsampleSample( const Pel* piSrc, const int recStride )
+{
+  if( kernel == CCLM_DOWN_420 )
+  {
+    return ( piSrc[0] * 2 + piSrc[1] + piSrc[-1] + piSrc[recStride] * 2 + piSrc[1 + recStride] + piSrc[-1 + recStride] + 4 ) >> 3;
+  }
+  else if( kernel == CCLM_DOWN_420_COLLOC )
+  {
+    return ( piSrc[-recStride] + piSrc[0] * 4 + piSrc[-1] + piSrc[1] + piSrc[recStride] + 4 ) >> 3;
+  }
+  return ( piSrc[0] * 2 + piSrc[-1] + piSrc[1] + 2 ) >> 2;
+}
+
+template<X86_VEXT vext, CclmDownsampleKernel kernel>
+static void simdCclmDownsample( const Pel* pRec, const int recStride, Pel* pDst, const int dstStride, const int width, const int height )
+{
+  const int recStride2 = kernel == CCLM_DOWN_422 ? recStride : recStride << 1;
+  const int shift      = kernel == CCLM_DOWN_422 ? 2 : 3;
+
+  const __m128i vWA    = _mm_set1_epi32( kernel == CCLM_DOWN_420_COLLOC ? 0x00010004 : 0x00010002 );
+  const __m128i vWB    = _mm_set1_epi32( 0x00000001 );
+  const __m128i vOff   = _mm_set1_epi32( 1 << ( shift - 1 ) );
+#ifdef USE_AVX2
+  const __m256i vWA256 = _mm256_set1_epi32( kernel == CCLM_DOWN_420_COLLOC ? 0x00010004 : 0x00010002 );
+  const __m256i vWB256 = _mm256_set1_epi32( 0x00000001 );
+  const __m256i vOff256= _mm256_set1_epi32( 1 << ( shift - 1 ) );
+#endif
+
+  for( int y = 0; y < height; y++, pRec += recStride2, pDst += dstStride )
+  {
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      for( ; x + 8 <= width; x += 8 )
+      {
+        const Pel* piSrc = pRec + 2 * x;
+        __m256i vSum = _mm256_add_epi32( _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* ) piSrc ), vWA256 ),
+                                         _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* ) ( piSrc - 1 ) ), vWB256 ) );
+        if( kernel == CCLM_DOWN_420 )
+        {
+          vSum = _mm256_add_epi32( vSum, _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* ) ( piSrc + recStride ) ), vWA256 ) );
+          vSum = _mm256_add_epi32( vSum, _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* ) ( piSrc + recStride - 1 ) ), vWB256 ) );
+        }
+        else if( kernel == CCLM_DOWN_420_COLLOC )
+        {
+          vSum = _mm256_add_epi32( vSum, _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* ) ( piSrc - recStride ) ), vWB256 ) );
+          vSum = _mm256_add_epi32( vSum, _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* ) ( piSrc + recStride ) ), vWB256 ) );
+        }
+        vSum = _mm256_srai_epi32( _mm256_add_epi32( vSum, vOff256 ), shift );
+        vSum = _mm256_permute4x64_epi64( _mm256_packs_epi32( vSum, vSum ), 0x08 );
+        _mm_storeu_si128( ( __m128i* ) &pDst[x], _mm256_castsi256_si128( vSum ) );
+      }
+    }
+#endif
+    for( ; x + 4 <= width; x += 4 )
+    {
+      const Pel* piSrc = pRec + 2 * x;
+      __m128i vSum = _mm_add_epi32( _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) piSrc ), vWA ),
+                                    _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) ( piSrc - 1 ) ), vWB ) );
+      if( kernel == CCLM_DOWN_420 )
+      {
+        vSum = _mm_add_epi32( vSum, _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) ( piSrc + recStride ) ), vWA ) );
+        vSum = _mm_add_epi32( vSum, _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) ( piSrc + recStride - 1 ) ), vWB ) );
+      }
+      else if( kernel == CCLM_DOWN_420_COLLOC )
+      {
+        vSum = _mm_add_epi32( vSum, _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) ( piSrc - recStride ) ), vWB ) );
+        vSum = _mm_add_epi32( vSum, _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) ( piSrc + recStride ) ), vWB ) );
+      }
+      vSum = _mm_srai_epi32( _mm_add_epi32( vSum, vOff ), shift );
+      _mm_storel_epi64( ( __m128i* ) &pDst[x], _mm_packs_epi32( vSum, vSum ) );
+    }
+    for( ; x < width; x++ )
+    {
+      pDst[x] = cclmDownsampleSample<kernel>( pRec + 2 * x, recStride );
+    }
+  }
+}
+
+template <X86_VEXT vext>
+void IntraPrediction::_initIntraPredictionX86()
+{
+  m_xPredIntraPlanar                   = simdPredIntraPlanar<vext>;
+  m_xPredIntraDc                       = simdPredIntraDc<vext>;
+  m_xPredIntraAng[INTRA_ANG_INT_SLOPE] = simdPredIntraAngIntSlope<vext>;
+  m_xPredIntraAng[INTRA_ANG_LINEAR]    = simdPredIntraAngLinear<vext>;
+  m_xPredIntraAng[INTRA_ANG_CUBIC]     = simdPredIntraAngLuma<vext, true>;
+  m_xPredIntraAng[INTRA_ANG_GAUSS]     = simdPredIntraAngLuma<vext, false>;
+  m_xIntraPdpc                         = simdIntraPdpc<vext>;
+  m_xIntraPdpcDiagonal                 = simdIntraPdpcDiagonal<vext>;
+  m_xIntraPdpcAngular                  = simdIntraPdpcAngular<vext>;
+  m_xCclmDownsample[CCLM_DOWN_420]        = simdCclmDownsample<vext, CCLM_DOWN_420>;
+  m_xCclmDownsample[CCLM_DOWN_420_COLLOC] = simdCclmDownsample<vext, CCLM_DOWN_420_COLLOC>;
+  m_xCclmDownsample[CCLM_DOWN_422]        = simdCclmDownsample<vext, CCLM_DOWN_422>;
+}
+
+template void IntraPrediction::_initIntraPredictionX86<SIMDX86>();
+
+#endif //#ifdef TARGET_SIMD_X86
+#endif
+//! \}
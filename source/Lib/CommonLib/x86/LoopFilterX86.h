@@ -0,0 +1,540 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     LoopFilterX86.h
+    \brief    SIMD deblocking filter
+*/
+
+//! \ingroup CommonLib
+//! \{
+
+#include "CommonLib/CommonDef.h"
+#include "CommonDefX86.h"
+#include "CommonLib/LoopFilter.h"
+
+#if ENABLE_SIMD_DBLF
+#ifdef TARGET_SIMD_X86
+
+// An edge segment is held transposed: one register per sample position across the edge (p0..p7, q0..q7),
+// one segment line per 32-bit lane. Vertical edges are transposed on load and store, horizontal edges map
+// directly onto rows. Only the sample positions the scalar filter may access are loaded.
+
+static inline __m128i dbLoadRow( const Pel* src, const int num )
+{
+  return num == 8 ? _mm_loadu_si128( ( const __m128i* ) src )
+       : num == 4 ? _mm_loadl_epi64( ( const __m128i* ) src )
+       :            _mm_cvtsi32_si128( *( const int32_t* ) src );
+}
+
+static inline void dbStoreRow( Pel* dst, const __m128i val, const int num )
+{
+  if( num == 8 )
+  {
+    _mm_storeu_si128( ( __m128i* ) dst, val );
+  }
+  else if( num == 4 )
+  {
+    _mm_storel_epi64( ( __m128i* ) dst, val );
+  }
+  else
+  {
+    *( int32_t* ) dst = _mm_cvtsi128_si32( val );
+  }
+}
+
+// 4 rows of 8 x 16 bit -> 8 columns of 4 x 32 bit
+static inline void dbRowsToCols( const __m128i* row, __m128i* col )
+{
+  const __m128i t0 = _mm_unpacklo_epi16( row[0], row[1] );
+  const __m128i t1 = _mm_unpacklo_epi16( row[2], row[3] );
+  const __m128i t2 = _mm_unpackhi_epi16( row[0], row[1] );
+  const __m128i t3 = _mm_unpackhi_epi16( row[2], row[3] );
+
+  const __m128i u[4] = { _mm_unpacklo_epi32( t0, t1 ), _mm_unpackhi_epi32( t0, t1 ), _mm_unpacklo_epi32( t2, t3 ), _mm_unpackhi_epi32( t2, t3 ) };
+
+  for( int j = 0; j < 4; j++ )
+  {
+    col[2 * j    ] = _mm_cvtepi16_epi32( u[j] );
+    col[2 * j + 1] = _mm_cvtepi16_epi32( _mm_unpackhi_epi64( u[j], u[j] ) );
+  }
+}
+
+// 8 columns of 4 x 32 bit -> 4 rows of 8 x 16 bit
+static inline void dbColsToRows( const __m128i* col, __m128i* row )
+{
+  const __m128i u0 = _mm_packs_epi32( col[0], col[1] );
+  const __m128i u1 = _mm_packs_epi32( col[2], col[3] );
+  const __m128i u2 = _mm_packs_epi32( col[4], col[5] );
+  const __m128i u3 = _mm_packs_epi32( col[6], col[7] );
+
+  const __m128i x0 = _mm_unpacklo_epi16( u0, u1 );
+  const __m128i x1 = _mm_unpackhi_epi16( u0, u1 );
+  const __m128i x2 = _mm_unpacklo_epi16( u2, u3 );
+  const __m128i x3 = _mm_unpackhi_epi16( u2, u3 );
+
+  const __m128i y0 = _mm_unpacklo_epi16( x0, x1 );
+  const __m128i y1 = _mm_unpackhi_epi16( x0, x1 );
+  const __m128i y2 = _mm_unpacklo_epi16( x2, x3 );
+  const __m128i y3 = _mm_unpackhi_epi16( x2, x3 );
+
+  row[0] = _mm_unpacklo_epi64( y0, y2 );
+  row[1] = _mm_unpackhi_epi64( y0, y2 );
+  row[2] = _mm_unpacklo_epi64( y1, y3 );
+  row[3] = _mm_unpackhi_epi64( y1, y3 );
+}
+
+// loads numPos sample positions of one edge side for numLines (2 or 4) lines, src points to q0 of the first line
+template<bool qSide>
+static inline void dbLoadSide( const Pel* src, const int step, const int offset, const int numLines, const int numPos, __m128i* pos )
+{
+  if( offset == 1 )
+  {
+    __m128i row[4], col[8];
+    for( int k = 0; k < 4; k++ )
+    {
+      row[k] = k < numLines ? dbLoadRow( src + k * step - ( qSide ? 0 : numPos ), numPos ) : row[k - 1];
+    }
+    dbRowsToCols( row, col );
+    for( int i = 0; i < numPos; i++ )
+    {
+      pos[i] = qSide ? col[i] : col[numPos - 1 - i];
+    }
+  }
+  else
+  {
+    for( int i = 0; i < numPos; i++ )
+    {
+      pos[i] = _mm_cvtepi16_epi32( dbLoadRow( src + ( qSide ? i : -( i + 1 ) ) * offset, numLines ) );
+    }
+  }
+}
+
+template<bool qSide>
+static inline void dbStoreSide( Pel* src, const int step, const int offset, const int numLines, const int numPos, const __m128i* pos )
+{
+  if( offset == 1 )
+  {
+    __m128i row[4], col[8];
+    for( int i = 0; i < 8; i++ )
+    {
+      col[i] = i >= numPos ? _mm_setzero_si128() : qSide ? pos[i] : pos[numPos - 1 - i];
+    }
+    dbColsToRows( col, row );
+    for( int k = 0; k < numLines; k++ )
+    {
+      dbStoreRow( src + k * step - ( qSide ? 0 : numPos ), row[k], numPos );
+    }
+  }
+  else
+  {
+    for( int i = 0; i < numPos; i++ )
+    {
+      dbStoreRow( src + ( qSide ? i : -( i + 1 ) ) * offset, _mm_packs_epi32( pos[i], pos[i] ), numLines );
+    }
+  }
+}
+
+static inline __m128i dbClip( const __m128i val, const __m128i org, const __m128i range )
+{
+  return _mm_min_epi32( _mm_max_epi32( val, _mm_sub_epi32( org, range ) ), _mm_add_epi32( org, range ) );
+}
+
+// ( sum + rnd ) >> shift
+static inline __m128i dbRound( const __m128i sum, const int rnd, const int shift )
+{
+  return _mm_srai_epi32( _mm_add_epi32( sum, _mm_set1_epi32( rnd ) ), shift );
+}
+
+// |a - 2 * b + c|
+static inline __m128i dbSecondDiff( const __m128i a, const __m128i b, const __m128i c )
+{
+  return _mm_abs_epi32( _mm_sub_epi32( _mm_add_epi32( a, c ), _mm_slli_epi32( b, 1 ) ) );
+}
+
+static inline bool dbStrongDecision( const int sp, const int sq, const int pq, const int d, const int beta, const int tc, const bool large )
+{
+  return ( sp + sq < ( large ? ( beta * 3 >> 5 ) : ( beta >> 3 ) ) ) && ( d < ( beta >> 2 ) ) && ( pq < ( ( tc * 5 + 1 ) >> 1 ) );
+}
+
+// long-tap filter, see LoopFilter::xFilteringPandQ / xBilinearFilter
+static inline void dbFilterLumaLong( __m128i* p, __m128i* q, const int numberPSide, const int numberQSide, const int tc )
+{
+  static const int dbCoeffs7[7] = { 59, 50, 41, 32, 23, 14, 5 };
+  static const int dbCoeffs3[3] = { 53, 32, 11 };
+  static const int dbCoeffs5[5] = { 58, 45, 32, 19, 6 };
+  static const int tc7[7] = { 6, 5, 4, 3, 2, 1, 1 };
+  static const int tc3[3] = { 6, 4, 2 };
+
+  const int* dbCoeffsP = numberPSide == 7 ? dbCoeffs7 : numberPSide == 5 ? dbCoeffs5 : dbCoeffs3;
+  const int* dbCoeffsQ = numberQSide == 7 ? dbCoeffs7 : numberQSide == 5 ? dbCoeffs5 : dbCoeffs3;
+  const int* tcP       = numberPSide == 3 ? tc3 : tc7;
+  const int* tcQ       = numberQSide == 3 ? tc3 : tc7;
+
+  // ( x[n-2] + x[n-1] + 1 ) >> 1 with n = 3 -> 2,3 / 5 -> 4,5 / 7 -> 6,7
+  const __m128i refP = dbRound( _mm_add_epi32( p[numberPSide - 1], p[numberPSide] ), 1, 1 );
+  const __m128i refQ = dbRound( _mm_add_epi32( q[numberQSide - 1], q[numberQSide] ), 1, 1 );
+
+  __m128i refMiddle;
+
+  if( numberPSide == numberQSide )
+  {
+    __m128i sum = _mm_add_epi32( _mm_add_epi32( p[0], q[0] ), _mm_add_epi32( _mm_add_epi32( p[1], q[1] ), _mm_add_epi32( p[2], q[2] ) ) );
+    sum = _mm_add_epi32( sum, _mm_add_epi32( _mm_add_epi32( p[3], q[3] ), _mm_add_epi32( p[4], q[4] ) ) );
+    if( numberPSide == 5 )
+    {
+      // 2 * ( p0 + q0 + p1 + q1 + p2 + q2 ) + p3 + q3 + p4 + q4
+      sum = _mm_add_epi32( sum, _mm_add_epi32( _mm_add_epi32( p[0], q[0] ), _mm_add_epi32( _mm_add_epi32( p[1], q[1] ), _mm_add_epi32( p[2], q[2] ) ) ) );
+    }
+    else
+    {
+      // 2 * ( p0 + q0 ) + p1 + q1 + ... + p6 + q6
+      sum = _mm_add_epi32( sum, _mm_add_epi32( _mm_add_epi32( p[0], q[0] ), _mm_add_epi32( _mm_add_epi32( p[5], q[5] ), _mm_add_epi32( p[6], q[6] ) ) ) );
+    }
+    refMiddle = dbRound( sum, 8, 4 );
+  }
+  else
+  {
+    const bool pIsLong   = numberPSide > numberQSide;
+    const int  longSide  = pIsLong ? numberPSide : numberQSide;
+    const int  shortSide = pIsLong ? numberQSide : numberPSide;
+
+    if( longSide == 7 && shortSide == 5 )
+    {
+      __m128i sum = _mm_add_epi32( _mm_add_epi32( p[0], q[0] ), _mm_add_epi32( p[1], q[1] ) );
+      sum = _mm_slli_epi32( sum, 1 );
+      sum = _mm_add_epi32( sum, _mm_add_epi32( _mm_add_epi32( p[2], q[2] ), _mm_add_epi32( p[3], q[3] ) ) );
+      sum = _mm_add_epi32( sum, _mm_add_epi32( _mm_add_epi32( p[4], q[4] ), _mm_add_epi32( p[5], q[5] ) ) );
+      refMiddle = dbRound( sum, 8, 4 );
+    }
+    else if( longSide == 7 && shortSide == 3 )
+    {
+      const __m128i* l = pIsLong ? p : q;
+      const __m128i* s = pIsLong ? q : p;
+      // 2 * ( l0 + s0 ) + s0 + 2 * ( s1 + s2 ) + l1 + s1 + l2 + l3 + l4 + l5 + l6
+      __m128i sum = _mm_slli_epi32( _mm_add_epi32( _mm_add_epi32( l[0], s[0] ), _mm_add_epi32( s[1], s[2] ) ), 1 );
+      sum = _mm_add_epi32( sum, _mm_add_epi32( _mm_add_epi32( s[0], s[1] ), _mm_add_epi32( l[1], l[2] ) ) );
+      sum = _mm_add_epi32( sum, _mm_add_epi32( _mm_add_epi32( l[3], l[4] ), _mm_add_epi32( l[5], l[6] ) ) );
+      refMiddle = dbRound( sum, 8, 4 );
+    }
+    else
+    {
+      __m128i sum = _mm_add_epi32( _mm_add_epi32( p[0], q[0] ), _mm_add_epi32( p[1], q[1] ) );
+      sum = _mm_add_epi32( sum, _mm_add_epi32( _mm_add_epi32( p[2], q[2] ), _mm_add_epi32( p[3], q[3] ) ) );
+      refMiddle = dbRound( sum, 4, 3 );
+    }
+  }
+
+  for( int pos = 0; pos < numberPSide; pos++ )
+  {
+    const __m128i cvalue = _mm_set1_epi32( ( tc * tcP[pos] ) >> 1 );
+    const __m128i val    = _mm_add_epi32( _mm_mullo_epi32( refMiddle, _mm_set1_epi32( dbCoeffsP[pos] ) ), _mm_mullo_epi32( refP, _mm_set1_epi32( 64 - dbCoeffsP[pos] ) ) );
+    p[pos] = dbClip( dbRound( val, 32, 6 ), p[pos], cvalue );
+  }
+  for( int pos = 0; pos < numberQSide; pos++ )
+  {
+    const __m128i cvalue = _mm_set1_epi32( ( tc * tcQ[pos] ) >> 1 );
+    const __m128i val    = _mm_add_epi32( _mm_mullo_epi32( refMiddle, _mm_set1_epi32( dbCoeffsQ[pos] ) ), _mm_mullo_epi32( refQ, _mm_set1_epi32( 64 - dbCoeffsQ[pos] ) ) );
+    q[pos] = dbClip( dbRound( val, 32, 6 ), q[pos], cvalue );
+  }
+}
+
+// strong filter for short sides, see LoopFilter::xPelFilterLuma
+static inline void dbFilterLumaStrong( __m128i* p, __m128i* q, const int tc )
+{
+  const __m128i tc1 = _mm_set1_epi32( tc );
+  const __m128i tc2 = _mm_set1_epi32( 2 * tc );
+  const __m128i tc3 = _mm_set1_epi32( 3 * tc );
+
+  const __m128i p0q0 = _mm_add_epi32( p[0], q[0] );
+  const __m128i p1p0q0 = _mm_add_epi32( p0q0, p[1] );
+  const __m128i p0q0q1 = _mm_add_epi32( p0q0, q[1] );
+
+  // p2 + 2 * p1 + 2 * p0 + 2 * q0 + q1
+  const __m128i sP0 = _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( p1p0q0, 1 ), p[2] ), q[1] );
+  // p1 + 2 * p0 + 2 * q0 + 2 * q1 + q2
+  const __m128i sQ0 = _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( p0q0q1, 1 ), p[1] ), q[2] );
+  // p2 + p1 + p0 + q0
+  const __m128i sP1 = _mm_add_epi32( p1p0q0, p[2] );
+  // p0 + q0 + q1 + q2
+  const __m128i sQ1 = _mm_add_epi32( p0q0q1, q[2] );
+  // 2 * p3 + 3 * p2 + p1 + p0 + q0
+  const __m128i sP2 = _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( _mm_add_epi32( p[3], p[2] ), 1 ), p[2] ), p1p0q0 );
+  // p0 + q0 + q1 + 3 * q2 + 2 * q3
+  const __m128i sQ2 = _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( _mm_add_epi32( q[3], q[2] ), 1 ), q[2] ), p0q0q1 );
+
+  const __m128i nP0 = dbClip( dbRound( sP0, 4, 3 ), p[0], tc3 );
+  const __m128i nQ0 = dbClip( dbRound( sQ0, 4, 3 ), q[0], tc3 );
+  const __m128i nP1 = dbClip( dbRound( sP1, 2, 2 ), p[1], tc2 );
+  const __m128i nQ1 = dbClip( dbRound( sQ1, 2, 2 ), q[1], tc2 );
+  const __m128i nP2 = dbClip( dbRound( sP2, 4, 3 ), p[2], tc1 );
+  const __m128i nQ2 = dbClip( dbRound( sQ2, 4, 3 ), q[2], tc1 );
+
+  p[0] = nP0; p[1] = nP1; p[2] = nP2;
+  q[0] = nQ0; q[1] = nQ1; q[2] = nQ2;
+}
+
+// weak filter, see LoopFilter::xPelFilterLuma
+static inline void dbFilterLumaWeak( __m128i* p, __m128i* q, const int tc, const int thrCut, const bool filterSecondP, const bool filterSecondQ, const ClpRng& clpRng )
+{
+  const __m128i vmin = _mm_set1_epi32( clpRng.min );
+  const __m128i vmax = _mm_set1_epi32( clpRng.max );
+  const __m128i vtc  = _mm_set1_epi32( tc );
+  const __m128i vtc2 = _mm_set1_epi32( tc >> 1 );
+
+  // ( 9 * ( q0 - p0 ) - 3 * ( q1 - p1 ) + 8 ) >> 4
+  const __m128i d0 = _mm_sub_epi32( q[0], p[0] );
+  const __m128i d1 = _mm_sub_epi32( q[1], p[1] );
+  __m128i delta    = _mm_sub_epi32( _mm_add_epi32( _mm_slli_epi32( d0, 3 ), d0 ), _mm_add_epi32( _mm_slli_epi32( d1, 1 ), d1 ) );
+  delta            = dbRound( delta, 8, 4 );
+
+  const __m128i mask = _mm_cmplt_epi32( _mm_abs_epi32( delta ), _mm_set1_epi32( thrCut ) );
+
+  delta = _mm_min_epi32( _mm_max_epi32( delta, _mm_sub_epi32( _mm_setzero_si128(), vtc ) ), vtc );
+
+  const __m128i nP0 = _mm_min_epi32( _mm_max_epi32( _mm_add_epi32( p[0], delta ), vmin ), vmax );
+  const __m128i nQ0 = _mm_min_epi32( _mm_max_epi32( _mm_sub_epi32( q[0], delta ), vmin ), vmax );
+
+  if( filterSecondP )
+  {
+    // ( ( ( p2 + p0 + 1 ) >> 1 ) - p1 + delta ) >> 1
+    __m128i delta1 = _mm_srai_epi32( _mm_add_epi32( _mm_sub_epi32( dbRound( _mm_add_epi32( p[2], p[0] ), 1, 1 ), p[1] ), delta ), 1 );
+    delta1 = _mm_min_epi32( _mm_max_epi32( delta1, _mm_sub_epi32( _mm_setzero_si128(), vtc2 ) ), vtc2 );
+    const __m128i nP1 = _mm_min_epi32( _mm_max_epi32( _mm_add_epi32( p[1], delta1 ), vmin ), vmax );
+    p[1] = _mm_blendv_epi8( p[1], nP1, mask );
+  }
+  if( filterSecondQ )
+  {
+    // ( ( ( q2 + q0 + 1 ) >> 1 ) - q1 - delta ) >> 1
+    __m128i delta2 = _mm_srai_epi32( _mm_sub_epi32( _mm_sub_epi32( dbRound( _mm_add_epi32( q[2], q[0] ), 1, 1 ), q[1] ), delta ), 1 );
+    delta2 = _mm_min_epi32( _mm_max_epi32( delta2, _mm_sub_epi32( _mm_setzero_si128(), vtc2 ) ), vtc2 );
+    const __m128i nQ1 = _mm_min_epi32( _mm_max_epi32( _mm_add_epi32( q[1], delta2 ), vmin ), vmax );
+    q[1] = _mm_blendv_epi8( q[1], nQ1, mask );
+  }
+
+  p[0] = _mm_blendv_epi8( p[0], nP0, mask );
+  q[0] = _mm_blendv_epi8( q[0], nQ0, mask );
+}
+
+template<X86_VEXT vext>
+static void simdFilterLumaSegment( Pel* piSrc, const int iSrcStep, const int iOffset, const int iTc, const int iBeta, const bool sidePisLarge, const bool sideQisLarge, const int maxFilterLengthP, const int maxFilterLengthQ, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng )
+{
+  const int numP = sidePisLarge ? 8 : 4;
+  const int numQ = sideQisLarge ? 8 : 4;
+
+  __m128i p[8], q[8];
+  dbLoadSide<false>( piSrc, iSrcStep, iOffset, 4, numP, p );
+  dbLoadSide<true> ( piSrc, iSrcStep, iOffset, 4, numQ, q );
+
+  const int iSideThreshold = ( iBeta + ( iBeta >> 1 ) ) >> 3;
+
+  const __m128i vdp = dbSecondDiff( p[2], p[1], p[0] );
+  const __m128i vdq = dbSecondDiff( q[2], q[1], q[0] );
+  const __m128i vsp = _mm_abs_epi32( _mm_sub_epi32( p[3], p[0] ) );
+  const __m128i vsq = _mm_abs_epi32( _mm_sub_epi32( q[3], q[0] ) );
+  const __m128i vpq = _mm_abs_epi32( _mm_sub_epi32( p[0], q[0] ) );
+
+  const int dp0 = _mm_cvtsi128_si32( vdp ), dp3 = _mm_extract_epi32( vdp, 3 );
+  const int dq0 = _mm_cvtsi128_si32( vdq ), dq3 = _mm_extract_epi32( vdq, 3 );
+  const int sp0 = _mm_cvtsi128_si32( vsp ), sp3 = _mm_extract_epi32( vsp, 3 );
+  const int sq0 = _mm_cvtsi128_si32( vsq ), sq3 = _mm_extract_epi32( vsq, 3 );
+  const int pq0 = _mm_cvtsi128_si32( vpq ), pq3 = _mm_extract_epi32( vpq, 3 );
+
+  bool filtered = false;
+
+  if( sidePisLarge || sideQisLarge )
+  {
+    __m128i vdpL = vdp, vdqL = vdq, vspL = vsp, vsqL = vsq;
+    const __m128i one = _mm_set1_epi32( 1 );
+
+    if( sidePisLarge )
+    {
+      vdpL = _mm_srai_epi32( _mm_add_epi32( _mm_add_epi32( vdp, dbSecondDiff( p[5], p[4], p[3] ) ), one ), 1 );
+      vspL = _mm_srai_epi32( _mm_add_epi32( _mm_add_epi32( vsp, _mm_abs_epi32( _mm_sub_epi32( p[3], maxFilterLengthP == 5 ? p[5] : p[7] ) ) ), one ), 1 );
+    }
+    if( sideQisLarge )
+    {
+      vdqL = _mm_srai_epi32( _mm_add_epi32( _mm_add_epi32( vdq, dbSecondDiff( q[5], q[4], q[3] ) ), one ), 1 );
+      vsqL = _mm_srai_epi32( _mm_add_epi32( _mm_add_epi32( vsq, _mm_abs_epi32( _mm_sub_epi32( q[3], maxFilterLengthQ == 5 ? q[5] : q[7] ) ) ), one ), 1 );
+    }
+
+    const int d0L = _mm_cvtsi128_si32( vdpL ) + _mm_cvtsi128_si32( vdqL );
+    const int d3L = _mm_extract_epi32( vdpL, 3 ) + _mm_extract_epi32( vdqL, 3 );
+
+    if( d0L + d3L < iBeta )
+    {
+      const bool swL = dbStrongDecision( _mm_cvtsi128_si32( vspL ), _mm_cvtsi128_si32( vsqL ), pq0, 2 * d0L, iBeta, iTc, true )
+                    && dbStrongDecision( _mm_extract_epi32( vspL, 3 ), _mm_extract_epi32( vsqL, 3 ), pq3, 2 * d3L, iBeta, iTc, true );
+      if( swL )
+      {
+        dbFilterLumaLong( p, q, sidePisLarge ? maxFilterLengthP : 3, sideQisLarge ? maxFilterLengthQ : 3, iTc );
+        filtered = true;
+      }
+    }
+  }
+
+  if( !filtered )
+  {
+    const int d0 = dp0 + dq0;
+    const int d3 = dp3 + dq3;
+
+    if( d0 + d3 >= iBeta )
+    {
+      return;
+    }
+
+    const bool sw = maxFilterLengthP > 2 && maxFilterLengthQ > 2
+                 && dbStrongDecision( sp0, sq0, pq0, 2 * d0, iBeta, iTc, false )
+                 && dbStrongDecision( sp3, sq3, pq3, 2 * d3, iBeta, iTc, false );
+
+    if( sw )
+    {
+      dbFilterLumaStrong( p, q, iTc );
+    }
+    else
+    {
+      dbFilterLumaWeak( p, q, iTc, iTc * 10, dp0 + dp3 < iSideThreshold, dq0 + dq3 < iSideThreshold, clpRng );
+    }
+  }
+
+  if( !bPartPNoFilter )
+  {
+    dbStoreSide<false>( piSrc, iSrcStep, iOffset, 4, numP, p );
+  }
+  if( !bPartQNoFilter )
+  {
+    dbStoreSide<true> ( piSrc, iSrcStep, iOffset, 4, numQ, q );
+  }
+}
+
+// see LoopFilter::xPelFilterChroma
+static inline void dbFilterChroma( __m128i* p, __m128i* q, const int tc, const bool sw, const ClpRng& clpRng )
+{
+  if( sw )
+  {
+    const __m128i vtc  = _mm_set1_epi32( tc );
+    const __m128i p0q0 = _mm_add_epi32( p[0], q[0] );
+
+    // 3 * p3 + 2 * p2 + p1 + p0 + q0
+    const __m128i sP2 = _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( _mm_add_epi32( p[3], p[2] ), 1 ), p[3] ), _mm_add_epi32( p[1], p0q0 ) );
+    // 2 * p3 + p2 + 2 * p1 + p0 + q0 + q1
+    const __m128i sP1 = _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( _mm_add_epi32( p[3], p[1] ), 1 ), p[2] ), _mm_add_epi32( p0q0, q[1] ) );
+    // p3 + p2 + p1 + 2 * p0 + q0 + q1 + q2
+    const __m128i sP0 = _mm_add_epi32( _mm_add_epi32( _mm_add_epi32( p[3], p[2] ), _mm_add_epi32( p[1], p[0] ) ), _mm_add_epi32( _mm_add_epi32( p0q0, q[1] ), q[2] ) );
+    // p2 + p1 + p0 + 2 * q0 + q1 + q2 + q3
+    const __m128i sQ0 = _mm_add_epi32( _mm_add_epi32( _mm_add_epi32( q[3], q[2] ), _mm_add_epi32( q[1], q[0] ) ), _mm_add_epi32( _mm_add_epi32( p0q0, p[1] ), p[2] ) );
+    // p1 + p0 + q0 + 2 * q1 + q2 + 2 * q3
+    const __m128i sQ1 = _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( _mm_add_epi32( q[3], q[1] ), 1 ), q[2] ), _mm_add_epi32( p0q0, p[1] ) );
+    // p0 + q0 + q1 + 2 * q2 + 3 * q3
+    const __m128i sQ2 = _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( _mm_add_epi32( q[3], q[2] ), 1 ), q[3] ), _mm_add_epi32( q[1], p0q0 ) );
+
+    const __m128i nP2 = dbClip( dbRound( sP2, 4, 3 ), p[2], vtc );
+    const __m128i nP1 = dbClip( dbRound( sP1, 4, 3 ), p[1], vtc );
+    const __m128i nP0 = dbClip( dbRound( sP0, 4, 3 ), p[0], vtc );
+    const __m128i nQ0 = dbClip( dbRound( sQ0, 4, 3 ), q[0], vtc );
+    const __m128i nQ1 = dbClip( dbRound( sQ1, 4, 3 ), q[1], vtc );
+    const __m128i nQ2 = dbClip( dbRound( sQ2, 4, 3 ), q[2], vtc );
+
+    p[0] = nP0; p[1] = nP1; p[2] = nP2;
+    q[0] = nQ0; q[1] = nQ1; q[2] = nQ2;
+  }
+  else
+  {
+    const __m128i vtc = _mm_set1_epi32( tc );
+    // ( ( ( q0 - p0 ) << 2 ) + p1 - q1 + 4 ) >> 3
+    __m128i delta = _mm_add_epi32( _mm_slli_epi32( _mm_sub_epi32( q[0], p[0] ), 2 ), _mm_sub_epi32( p[1], q[1] ) );
+    delta = dbRound( delta, 4, 3 );
+    delta = _mm_min_epi32( _mm_max_epi32( delta, _mm_sub_epi32( _mm_setzero_si128(), vtc ) ), vtc );
+
+    const __m128i vmin = _mm_set1_epi32( clpRng.min );
+    const __m128i vmax = _mm_set1_epi32( clpRng.max );
+    p[0] = _mm_min_epi32( _mm_max_epi32( _mm_add_epi32( p[0], delta ), vmin ), vmax );
+    q[0] = _mm_min_epi32( _mm_max_epi32( _mm_sub_epi32( q[0], delta ), vmin ), vmax );
+  }
+}
+
+template<X86_VEXT vext>
+static void simdFilterChromaSegment( Pel* piSrc, const int iSrcStep, const int iOffset, const int numLines, const int iTc, const int iBeta, const bool largeBoundary, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng )
+{
+  bool sw = false;
+
+  for( int line = 0; line < numLines; line += 4 )
+  {
+    Pel* src = piSrc + line * iSrcStep;
+    const int n = std::min( 4, numLines - line );
+
+    __m128i p[4], q[4];
+    dbLoadSide<false>( src, iSrcStep, iOffset, n, 4, p );
+    dbLoadSide<true> ( src, iSrcStep, iOffset, n, 4, q );
+
+    if( line == 0 && largeBoundary )
+    {
+      // the decision is based on the first two lines of the segment
+      const __m128i vd  = _mm_add_epi32( dbSecondDiff( p[2], p[1], p[0] ), dbSecondDiff( q[2], q[1], q[0] ) );
+      const __m128i vs  = _mm_add_epi32( _mm_abs_epi32( _mm_sub_epi32( p[3], p[0] ) ), _mm_abs_epi32( _mm_sub_epi32( q[3], q[0] ) ) );
+      const __m128i vpq = _mm_abs_epi32( _mm_sub_epi32( p[0], q[0] ) );
+
+      const int d0 = _mm_cvtsi128_si32( vd );
+      const int d1 = _mm_extract_epi32( vd, 1 );
+
+      if( d0 + d1 < iBeta )
+      {
+        sw = dbStrongDecision( _mm_cvtsi128_si32( vs ), 0, _mm_cvtsi128_si32( vpq ), 2 * d0, iBeta, iTc, false )
+          && dbStrongDecision( _mm_extract_epi32( vs, 1 ), 0, _mm_extract_epi32( vpq, 1 ), 2 * d1, iBeta, iTc, false );
+      }
+    }
+
+    dbFilterChroma( p, q, iTc, sw, clpRng );
+
+    if( !bPartPNoFilter )
+    {
+      dbStoreSide<false>( src, iSrcStep, iOffset, n, 4, p );
+    }
+    if( !bPartQNoFilter )
+    {
+      dbStoreSide<true> ( src, iSrcStep, iOffset, n, 4, q );
+    }
+  }
+}
+
+template <X86_VEXT vext>
+void LoopFilter::_initLoopFilterX86()
+{
+  m_filterLumaSegment   = simdFilterLumaSegment<vext>;
+  m_filterChromaSegment = simdFilterChromaSegment<vext>;
+}
+
+template void LoopFilter::_initLoopFilterX86<SIMDX86>();
+
+#endif //#ifdef TARGET_SIMD_X86
+#endif
+//! \}
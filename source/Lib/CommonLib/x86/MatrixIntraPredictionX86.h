@@ -0,0 +1,297 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     MatrixIntraPredictionX86.h
+    \brief    SIMD matrix-based intra prediction
+*/
+
+//! \ingroup CommonLib
+//! \{
+
+#include "CommonLib/CommonDef.h"
+#include "CommonDefX86.h"
+#include "CommonLib/MatrixIntraPrediction.h"
+
+#if ENABLE_SIMD_OPT_MIP
+#ifdef TARGET_SIMD_X86
+
+// The reduced boundary holds at most 8 sample values, which are packed to 16 bit so that one pmaddwd
+// covers a matrix row (input size 8) or two rows (input size 4). Four output samples are summed up
+// with phaddd and stored as 32 bit values.
+
+template<X86_VEXT vext>
+static void simdMatrixTimesRedBndryPlusBias( int* const result, const int* const input,
+                                             const short* matrix, const short* bias, const int inputSize,
+                                             const int outputWidth, const int outputHeight, const int xStep, const int yStep,
+                                             const int shiftMatrix, const int shiftBias )
+{
+  const int       offset    = 1 << ( shiftMatrix - 1 );
+  const int       rowStep   = xStep * inputSize;
+  const int       lineSize  = ( outputWidth * xStep + yStep ) * inputSize;
+  const __m128i   vShift    = _mm_cvtsi32_si128( shiftMatrix );
+  const __m128i   in16      = inputSize == 8 ? _mm_packs_epi32( _mm_loadu_si128( ( const __m128i* ) &input[0] ), _mm_loadu_si128( ( const __m128i* ) &input[4] ) )
+                                             : _mm_packs_epi32( _mm_loadu_si128( ( const __m128i* ) &input[0] ), _mm_loadu_si128( ( const __m128i* ) &input[0] ) );
+
+  int* res = result;
+  for( int y = 0; y < outputHeight; y++ )
+  {
+    const short* weight  = matrix + y * lineSize;
+    const short* biasPtr = bias   + y * ( lineSize / inputSize );
+
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 && inputSize == 8 )
+    {
+      const __m256i in256 = _mm256_inserti128_si256( _mm256_castsi128_si256( in16 ), in16, 1 );
+
+      for( ; x + 8 <= outputWidth; x += 8, weight += 8 * rowStep, res += 8 )
+      {
+        // lane 0 holds the rows x .. x + 3, lane 1 the rows x + 4 .. x + 7
+        __m256i m[4];
+        for( int k = 0; k < 4; k++ )
+        {
+          const __m256i row = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( ( const __m128i* ) &weight[k * rowStep] ) ),
+                                                       _mm_loadu_si128( ( const __m128i* ) &weight[( k + 4 ) * rowStep] ), 1 );
+          m[k] = _mm256_madd_epi16( row, in256 );
+        }
+        __m256i sum = _mm256_hadd_epi32( _mm256_hadd_epi32( m[0], m[1] ), _mm256_hadd_epi32( m[2], m[3] ) );
+
+        const __m256i vBias = _mm256_setr_epi32( ( biasPtr[( x + 0 ) * xStep] << shiftBias ) + offset, ( biasPtr[( x + 1 ) * xStep] << shiftBias ) + offset,
+                                                 ( biasPtr[( x + 2 ) * xStep] << shiftBias ) + offset, ( biasPtr[( x + 3 ) * xStep] << shiftBias ) + offset,
+                                                 ( biasPtr[( x + 4 ) * xStep] << shiftBias ) + offset, ( biasPtr[( x + 5 ) * xStep] << shiftBias ) + offset,
+                                                 ( biasPtr[( x + 6 ) * xStep] << shiftBias ) + offset, ( biasPtr[( x + 7 ) * xStep] << shiftBias ) + offset );
+        sum = _mm256_sra_epi32( _mm256_add_epi32( sum, vBias ), vShift );
+        _mm256_storeu_si256( ( __m256i* ) res, sum );
+      }
+    }
+#endif
+    for( ; x + 4 <= outputWidth; x += 4, weight += 4 * rowStep, res += 4 )
+    {
+      __m128i sum;
+      if( inputSize == 8 )
+      {
+        const __m128i m0 = _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) &weight[0 * rowStep] ), in16 );
+        const __m128i m1 = _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) &weight[1 * rowStep] ), in16 );
+        const __m128i m2 = _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) &weight[2 * rowStep] ), in16 );
+        const __m128i m3 = _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* ) &weight[3 * rowStep] ), in16 );
+        sum = _mm_hadd_epi32( _mm_hadd_epi32( m0, m1 ), _mm_hadd_epi32( m2, m3 ) );
+      }
+      else
+      {
+        const __m128i r01 = _mm_unpacklo_epi64( _mm_loadl_epi64( ( const __m128i* ) &weight[0 * rowStep] ), _mm_loadl_epi64( ( const __m128i* ) &weight[1 * rowStep] ) );
+        const __m128i r23 = _mm_unpacklo_epi64( _mm_loadl_epi64( ( const __m128i* ) &weight[2 * rowStep] ), _mm_loadl_epi64( ( const __m128i* ) &weight[3 * rowStep] ) );
+        sum = _mm_hadd_epi32( _mm_madd_epi16( r01, in16 ), _mm_madd_epi16( r23, in16 ) );
+      }
+
+      const __m128i vBias = _mm_setr_epi32( ( biasPtr[( x + 0 ) * xStep] << shiftBias ) + offset, ( biasPtr[( x + 1 ) * xStep] << shiftBias ) + offset,
+                                            ( biasPtr[( x + 2 ) * xStep] << shiftBias ) + offset, ( biasPtr[( x + 3 ) * xStep] << shiftBias ) + offset );
+      sum = _mm_sra_epi32( _mm_add_epi32( sum, vBias ), vShift );
+      _mm_storeu_si128( ( __m128i* ) res, sum );
+    }
+    for( ; x < outputWidth; x++, weight += rowStep, res++ )
+    {
+      int sum = 0;
+      for( int i = 0; i < inputSize; i++ )
+      {
+        sum += input[i] * weight[i];
+      }
+      *res = ( sum + ( biasPtr[x * xStep] << shiftBias ) + offset ) >> shiftMatrix;
+    }
+  }
+}
+
+// ( val + ( 1 << ( log2UpsmpFactor - 1 ) ) - ( val < 0 ? 1 : 0 ) ) >> log2UpsmpFactor
+static inline __m128i mipRoundShift( const __m128i val, const __m128i rnd, const __m128i shift )
+{
+  return _mm_sra_epi32( _mm_add_epi32( _mm_add_epi32( val, rnd ), _mm_cmplt_epi32( val, _mm_setzero_si128() ) ), shift );
+}
+
+#ifdef USE_AVX2
+static inline __m256i mipRoundShift( const __m256i val, const __m256i rnd, const __m128i shift )
+{
+  return _mm256_sra_epi32( _mm256_add_epi32( _mm256_add_epi32( val, rnd ), _mm256_cmpgt_epi32( _mm256_setzero_si256(), val ) ), shift );
+}
+#endif
+
+static inline __m128i mipLoad4( const int* src, const SizeType stride )
+{
+  return stride == 1 ? _mm_loadu_si128( ( const __m128i* ) src ) : _mm_setr_epi32( src[0], src[stride], src[2 * stride], src[3 * stride] );
+}
+
+static inline void mipStore4( int* dst, const SizeType stride, const __m128i val )
+{
+  if( stride == 1 )
+  {
+    _mm_storeu_si128( ( __m128i* ) dst, val );
+  }
+  else
+  {
+    dst[0]          = _mm_extract_epi32( val, 0 );
+    dst[stride]     = _mm_extract_epi32( val, 1 );
+    dst[2 * stride] = _mm_extract_epi32( val, 2 );
+    dst[3 * stride] = _mm_extract_epi32( val, 3 );
+  }
+}
+
+// Upsampling along contiguous destination lines (dstStep == 1) is vectorized along the line, one segment between
+// two source samples per register (two segments for an upsampling factor of 2). Otherwise four lines of the
+// orthogonal dimension are processed in parallel, the boundary is contiguous along that dimension.
+template<X86_VEXT vext>
+static void simdPredictionUpsampling1D( int* const dst, const int* const src, const int* const bndry,
+                                        const SizeType srcSizeUpsmpDim, const SizeType srcSizeOrthDim,
+                                        const SizeType srcStep, const SizeType srcStride,
+                                        const SizeType dstStep, const SizeType dstStride,
+                                        const unsigned int upsmpFactor )
+{
+  const int     log2UpsmpFactor = g_aucLog2[upsmpFactor];
+  const __m128i vShift          = _mm_cvtsi32_si128( log2UpsmpFactor );
+  const __m128i vRnd            = _mm_set1_epi32( 1 << ( log2UpsmpFactor - 1 ) );
+  CHECKD( upsmpFactor <= 1, "Upsampling factor must be at least 2." );
+
+  if( dstStep == 1 )
+  {
+    const __m128i vPos = upsmpFactor == 2 ? _mm_setr_epi32( 1, 2, 1, 2 ) : _mm_setr_epi32( 1, 2, 3, 4 );
+
+    for( SizeType idxOrthDim = 0; idxOrthDim < srcSizeOrthDim; idxOrthDim++ )
+    {
+      const int* srcLine = src + idxOrthDim * srcStride;
+      int*       dstLine = dst + idxOrthDim * dstStride;
+      int        before  = bndry[idxOrthDim];
+
+      if( upsmpFactor == 2 )
+      {
+        for( SizeType idxUpsmpDim = 0; idxUpsmpDim < srcSizeUpsmpDim; idxUpsmpDim += 2, dstLine += 4 )
+        {
+          const int behind0 = srcLine[idxUpsmpDim * srcStep];
+          const int behind1 = srcLine[( idxUpsmpDim + 1 ) * srcStep];
+          const __m128i vBefore = _mm_setr_epi32( before, before, behind0, behind0 );
+          const __m128i vDiff   = _mm_setr_epi32( behind0 - before, behind0 - before, behind1 - behind0, behind1 - behind0 );
+          const __m128i val     = _mm_add_epi32( _mm_slli_epi32( vBefore, 1 ), _mm_mullo_epi32( vDiff, vPos ) );
+          _mm_storeu_si128( ( __m128i* ) dstLine, mipRoundShift( val, vRnd, vShift ) );
+          before = behind1;
+        }
+      }
+      else
+      {
+        for( SizeType idxUpsmpDim = 0; idxUpsmpDim < srcSizeUpsmpDim; idxUpsmpDim++ )
+        {
+          const int     behind  = srcLine[idxUpsmpDim * srcStep];
+          const __m128i vDiff   = _mm_set1_epi32( behind - before );
+          __m128i       val     = _mm_add_epi32( _mm_set1_epi32( before << log2UpsmpFactor ), _mm_mullo_epi32( vDiff, vPos ) );
+          const __m128i vStep   = _mm_slli_epi32( vDiff, 2 );
+          for( unsigned int pos = 0; pos < upsmpFactor; pos += 4, dstLine += 4 )
+          {
+            _mm_storeu_si128( ( __m128i* ) dstLine, mipRoundShift( val, vRnd, vShift ) );
+            val = _mm_add_epi32( val, vStep );
+          }
+          before = behind;
+        }
+      }
+    }
+    return;
+  }
+
+  SizeType idxOrthDim = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 && srcStride == 1 && dstStride == 1 )
+  {
+    const __m256i vRnd256 = _mm256_set1_epi32( 1 << ( log2UpsmpFactor - 1 ) );
+
+    for( ; idxOrthDim + 8 <= srcSizeOrthDim; idxOrthDim += 8 )
+    {
+      __m256i    before = _mm256_loadu_si256( ( const __m256i* ) &bndry[idxOrthDim] );
+      const int* behind = src + idxOrthDim;
+      int*       curDst = dst + idxOrthDim;
+      for( SizeType idxUpsmpDim = 0; idxUpsmpDim < srcSizeUpsmpDim; idxUpsmpDim++, behind += srcStep )
+      {
+        const __m256i vBehind = _mm256_loadu_si256( ( const __m256i* ) behind );
+        const __m256i vDiff   = _mm256_sub_epi32( vBehind, before );
+        __m256i       val     = _mm256_sll_epi32( before, vShift );
+        for( unsigned int pos = 0; pos < upsmpFactor; pos++, curDst += dstStep )
+        {
+          val = _mm256_add_epi32( val, vDiff );
+          _mm256_storeu_si256( ( __m256i* ) curDst, mipRoundShift( val, vRnd256, vShift ) );
+        }
+        before = vBehind;
+      }
+    }
+  }
+#endif
+  for( ; idxOrthDim + 4 <= srcSizeOrthDim; idxOrthDim += 4 )
+  {
+    __m128i    before = _mm_loadu_si128( ( const __m128i* ) &bndry[idxOrthDim] );
+    const int* behind = src + idxOrthDim * srcStride;
+    int*       curDst = dst + idxOrthDim * dstStride;
+    for( SizeType idxUpsmpDim = 0; idxUpsmpDim < srcSizeUpsmpDim; idxUpsmpDim++, behind += srcStep )
+    {
+      const __m128i vBehind = mipLoad4( behind, srcStride );
+      const __m128i vDiff   = _mm_sub_epi32( vBehind, before );
+      __m128i       val     = _mm_sll_epi32( before, vShift );
+      for( unsigned int pos = 0; pos < upsmpFactor; pos++, curDst += dstStep )
+      {
+        val = _mm_add_epi32( val, vDiff );
+        mipStore4( curDst, dstStride, mipRoundShift( val, vRnd, vShift ) );
+      }
+      before = vBehind;
+    }
+  }
+  for( ; idxOrthDim < srcSizeOrthDim; idxOrthDim++ )
+  {
+    int        before = bndry[idxOrthDim];
+    const int* behind = src + idxOrthDim * srcStride;
+    int*       curDst = dst + idxOrthDim * dstStride;
+    for( SizeType idxUpsmpDim = 0; idxUpsmpDim < srcSizeUpsmpDim; idxUpsmpDim++, behind += srcStep )
+    {
+      int val = before << log2UpsmpFactor;
+      for( unsigned int pos = 0; pos < upsmpFactor; pos++, curDst += dstStep )
+      {
+        val += *behind - before;
+        *curDst = ( val + ( 1 << ( log2UpsmpFactor - 1 ) ) - ( val < 0 ? 1 : 0 ) ) >> log2UpsmpFactor;
+      }
+      before = *behind;
+    }
+  }
+}
+
+template <X86_VEXT vext>
+void Mip::PredictorMIP::_initPredictorMIPX86()
+{
+  m_matrixTimesRedBndryPlusBias = simdMatrixTimesRedBndryPlusBias<vext>;
+  m_predictionUpsampling1D      = simdPredictionUpsampling1D<vext>;
+}
+
+template void Mip::PredictorMIP::_initPredictorMIPX86<SIMDX86>();
+
+#endif //#ifdef TARGET_SIMD_X86
+#endif
+//! \}
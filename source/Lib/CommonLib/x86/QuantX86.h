@@ -0,0 +1,335 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     QuantX86.h
+    \brief    SIMD quantization and de-quantization
+*/
+
+//! \ingroup CommonLib
+//! \{
+
+#include "CommonLib/CommonDef.h"
+#include "CommonDefX86.h"
+#include "CommonLib/Quant.h"
+
+#if ENABLE_SIMD_OPT_QUANT
+#ifdef TARGET_SIMD_X86
+
+// The product of the coefficient magnitude and the quantization scale needs up to 35 bits with scaling lists,
+// hence it is calculated as two times two 64 bit products (even and odd lanes) with pmuludq.
+
+static inline void quantMul64( const __m128i absLevel, const __m128i scale, __m128i& prodEven, __m128i& prodOdd )
+{
+  prodEven = _mm_mul_epu32( absLevel, scale );
+  prodOdd  = _mm_mul_epu32( _mm_srli_epi64( absLevel, 32 ), _mm_srli_epi64( scale, 32 ) );
+}
+
+// merges the low 32 bit of the even and odd 64 bit lanes
+static inline __m128i quantPackLo( const __m128i even, const __m128i odd )
+{
+  return _mm_blend_epi16( even, _mm_slli_epi64( odd, 32 ), 0xCC );
+}
+
+static inline __m128i quantLoadScale( const int* quantCoeff, const __m128i defaultScale, const int n )
+{
+  return quantCoeff ? _mm_loadu_si128( ( const __m128i* ) &quantCoeff[n] ) : defaultScale;
+}
+
+#ifdef USE_AVX2
+static inline void quantMul64( const __m256i absLevel, const __m256i scale, __m256i& prodEven, __m256i& prodOdd )
+{
+  prodEven = _mm256_mul_epu32( absLevel, scale );
+  prodOdd  = _mm256_mul_epu32( _mm256_srli_epi64( absLevel, 32 ), _mm256_srli_epi64( scale, 32 ) );
+}
+
+static inline __m256i quantPackLo( const __m256i even, const __m256i odd )
+{
+  return _mm256_blend_epi32( even, _mm256_slli_epi64( odd, 32 ), 0xAA );
+}
+
+static inline __m256i quantLoadScale( const int* quantCoeff, const __m256i defaultScale, const int n )
+{
+  return quantCoeff ? _mm256_loadu_si256( ( const __m256i* ) &quantCoeff[n] ) : defaultScale;
+}
+#endif
+
+template<X86_VEXT vext>
+static TCoeff simdQuantCore( const TCoeff* src, TCoeff* dst, TCoeff* deltaU, const int* quantCoeff, const int defaultQuantCoeff, const int64_t add, const int qBits,
+                             const TCoeff outputMinimum, const TCoeff outputMaximum, const int numCoeff )
+{
+  // the remainder ( tmpLevel - ( magnitude << qBits ) ) lies in ( -2^qBits, 2^qBits ), it is offset by 2^qBits
+  // to allow for a logical shift, the offset is removed after the shift
+  const __m128i vShift   = _mm_cvtsi32_si128( qBits );
+  const __m128i vShift8  = _mm_cvtsi32_si128( qBits - 8 );
+  const int64_t remOffset = int64_t( 1 ) << qBits;
+
+  int n = 0;
+  TCoeff absSum = 0;
+
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i vAdd     = _mm256_set1_epi64x( add );
+    const __m256i vRemOff  = _mm256_set1_epi64x( remOffset );
+    const __m256i vDefault = _mm256_set1_epi32( defaultQuantCoeff );
+    const __m256i vMin     = _mm256_set1_epi32( outputMinimum );
+    const __m256i vMax     = _mm256_set1_epi32( outputMaximum );
+    const __m256i v256     = _mm256_set1_epi32( 256 );
+    __m256i       vAbsSum  = _mm256_setzero_si256();
+
+    for( ; n + 8 <= numCoeff; n += 8 )
+    {
+      const __m256i level    = _mm256_loadu_si256( ( const __m256i* ) &src[n] );
+      const __m256i absLevel = _mm256_abs_epi32( level );
+
+      __m256i tmpEven, tmpOdd;
+      quantMul64( absLevel, quantLoadScale( quantCoeff, vDefault, n ), tmpEven, tmpOdd );
+
+      const __m256i magEven = _mm256_srl_epi64( _mm256_add_epi64( tmpEven, vAdd ), vShift );
+      const __m256i magOdd  = _mm256_srl_epi64( _mm256_add_epi64( tmpOdd,  vAdd ), vShift );
+      const __m256i mag     = quantPackLo( magEven, magOdd );
+
+      if( deltaU )
+      {
+        const __m256i remEven = _mm256_srl_epi64( _mm256_add_epi64( _mm256_sub_epi64( tmpEven, _mm256_sll_epi64( magEven, vShift ) ), vRemOff ), vShift8 );
+        const __m256i remOdd  = _mm256_srl_epi64( _mm256_add_epi64( _mm256_sub_epi64( tmpOdd,  _mm256_sll_epi64( magOdd,  vShift ) ), vRemOff ), vShift8 );
+        _mm256_storeu_si256( ( __m256i* ) &deltaU[n], _mm256_sub_epi32( quantPackLo( remEven, remOdd ), v256 ) );
+      }
+
+      vAbsSum = _mm256_add_epi32( vAbsSum, mag );
+
+      // sign( 0 ) is 0 for psignd, the magnitude of a zero level is always zero though
+      __m256i coeff = _mm256_sign_epi32( mag, level );
+      coeff = _mm256_min_epi32( vMax, _mm256_max_epi32( vMin, coeff ) );
+      _mm256_storeu_si256( ( __m256i* ) &dst[n], coeff );
+    }
+
+    __m128i sum = _mm_add_epi32( _mm256_castsi256_si128( vAbsSum ), _mm256_extracti128_si256( vAbsSum, 1 ) );
+    sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, 0x4e ) );
+    sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, 0xb1 ) );
+    absSum += _mm_cvtsi128_si32( sum );
+  }
+#endif
+  {
+    const __m128i vAdd     = _mm_set1_epi64x( add );
+    const __m128i vRemOff  = _mm_set1_epi64x( remOffset );
+    const __m128i vDefault = _mm_set1_epi32( defaultQuantCoeff );
+    const __m128i vMin     = _mm_set1_epi32( outputMinimum );
+    const __m128i vMax     = _mm_set1_epi32( outputMaximum );
+    const __m128i v256     = _mm_set1_epi32( 256 );
+    __m128i       vAbsSum  = _mm_setzero_si128();
+
+    for( ; n + 4 <= numCoeff; n += 4 )
+    {
+      const __m128i level    = _mm_loadu_si128( ( const __m128i* ) &src[n] );
+      const __m128i absLevel = _mm_abs_epi32( level );
+
+      __m128i tmpEven, tmpOdd;
+      quantMul64( absLevel, quantLoadScale( quantCoeff, vDefault, n ), tmpEven, tmpOdd );
+
+      const __m128i magEven = _mm_srl_epi64( _mm_add_epi64( tmpEven, vAdd ), vShift );
+      const __m128i magOdd  = _mm_srl_epi64( _mm_add_epi64( tmpOdd,  vAdd ), vShift );
+      const __m128i mag     = quantPackLo( magEven, magOdd );
+
+      if( deltaU )
+      {
+        const __m128i remEven = _mm_srl_epi64( _mm_add_epi64( _mm_sub_epi64( tmpEven, _mm_sll_epi64( magEven, vShift ) ), vRemOff ), vShift8 );
+        const __m128i remOdd  = _mm_srl_epi64( _mm_add_epi64( _mm_sub_epi64( tmpOdd,  _mm_sll_epi64( magOdd,  vShift ) ), vRemOff ), vShift8 );
+        _mm_storeu_si128( ( __m128i* ) &deltaU[n], _mm_sub_epi32( quantPackLo( remEven, remOdd ), v256 ) );
+      }
+
+      vAbsSum = _mm_add_epi32( vAbsSum, mag );
+
+      __m128i coeff = _mm_sign_epi32( mag, level );
+      coeff = _mm_min_epi32( vMax, _mm_max_epi32( vMin, coeff ) );
+      _mm_storeu_si128( ( __m128i* ) &dst[n], coeff );
+    }
+
+    vAbsSum = _mm_add_epi32( vAbsSum, _mm_shuffle_epi32( vAbsSum, 0x4e ) );
+    vAbsSum = _mm_add_epi32( vAbsSum, _mm_shuffle_epi32( vAbsSum, 0xb1 ) );
+    absSum += _mm_cvtsi128_si32( vAbsSum );
+  }
+
+  if( n < numCoeff )
+  {
+    absSum += Quant::xQuantCore( src + n, dst + n, deltaU ? deltaU + n : nullptr, quantCoeff ? quantCoeff + n : nullptr, defaultQuantCoeff, add, qBits,
+                                 outputMinimum, outputMaximum, numCoeff - n );
+  }
+
+  return absSum;
+}
+
+template<X86_VEXT vext>
+static void simdDeQuantCore( const TCoeff* src, TCoeff* dst, const int* dequantCoeff, const int defaultScale, const int rightShift,
+                             const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff outputMinimum, const TCoeff outputMaximum, const int numCoeff )
+{
+  // the input clipping guarantees that the scaled value fits into 32 bit
+  const __m128i vShift = _mm_cvtsi32_si128( rightShift > 0 ? rightShift : -rightShift );
+  const int     add    = rightShift > 0 ? 1 << ( rightShift - 1 ) : 0;
+
+  int n = 0;
+
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i vInMin   = _mm256_set1_epi32( inputMinimum );
+    const __m256i vInMax   = _mm256_set1_epi32( inputMaximum );
+    const __m256i vOutMin  = _mm256_set1_epi32( outputMinimum );
+    const __m256i vOutMax  = _mm256_set1_epi32( outputMaximum );
+    const __m256i vScale   = _mm256_set1_epi32( defaultScale );
+    const __m256i vAdd     = _mm256_set1_epi32( add );
+
+    for( ; n + 8 <= numCoeff; n += 8 )
+    {
+      const __m256i level = _mm256_min_epi32( vInMax, _mm256_max_epi32( vInMin, _mm256_loadu_si256( ( const __m256i* ) &src[n] ) ) );
+      const __m256i scale = dequantCoeff ? _mm256_loadu_si256( ( const __m256i* ) &dequantCoeff[n] ) : vScale;
+      __m256i       coeff = _mm256_mullo_epi32( level, scale );
+
+      coeff = rightShift > 0 ? _mm256_sra_epi32( _mm256_add_epi32( coeff, vAdd ), vShift ) : _mm256_sll_epi32( coeff, vShift );
+      coeff = _mm256_min_epi32( vOutMax, _mm256_max_epi32( vOutMin, coeff ) );
+      _mm256_storeu_si256( ( __m256i* ) &dst[n], coeff );
+    }
+  }
+#endif
+  {
+    const __m128i vInMin   = _mm_set1_epi32( inputMinimum );
+    const __m128i vInMax   = _mm_set1_epi32( inputMaximum );
+    const __m128i vOutMin  = _mm_set1_epi32( outputMinimum );
+    const __m128i vOutMax  = _mm_set1_epi32( outputMaximum );
+    const __m128i vScale   = _mm_set1_epi32( defaultScale );
+    const __m128i vAdd     = _mm_set1_epi32( add );
+
+    for( ; n + 4 <= numCoeff; n += 4 )
+    {
+      const __m128i level = _mm_min_epi32( vInMax, _mm_max_epi32( vInMin, _mm_loadu_si128( ( const __m128i* ) &src[n] ) ) );
+      const __m128i scale = dequantCoeff ? _mm_loadu_si128( ( const __m128i* ) &dequantCoeff[n] ) : vScale;
+      __m128i       coeff = _mm_mullo_epi32( level, scale );
+
+      coeff = rightShift > 0 ? _mm_sra_epi32( _mm_add_epi32( coeff, vAdd ), vShift ) : _mm_sll_epi32( coeff, vShift );
+      coeff = _mm_min_epi32( vOutMax, _mm_max_epi32( vOutMin, coeff ) );
+      _mm_storeu_si128( ( __m128i* ) &dst[n], coeff );
+    }
+  }
+
+  if( n < numCoeff )
+  {
+    Quant::xDeQuantCore( src + n, dst + n, dequantCoeff ? dequantCoeff + n : nullptr, defaultScale, rightShift,
+                         inputMinimum, inputMaximum, outputMinimum, outputMaximum, numCoeff - n );
+  }
+}
+
+template<X86_VEXT vext>
+static void simdQuantLevelsCore( const TCoeff* src, Intermediate_Int* levelDouble, uint32_t* maxAbsLevel, const int* quantCoeff, const int defaultQuantCoeff, const int qBits,
+                                 const TCoeff maxLevel, const int numCoeff )
+{
+  // the 64 bit product is limited to INT_MAX - 2^( qBits - 1 ), which is done on the 32 bit halves:
+  // the limit applies if the upper half is non-zero or the lower half exceeds the limit (unsigned)
+  const int     rnd     = 1 << ( qBits - 1 );
+  const int     limit   = std::numeric_limits<int>::max() - rnd;
+  const __m128i vShift  = _mm_cvtsi32_si128( qBits );
+
+  int n = 0;
+
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i vSign    = _mm256_set1_epi32( 0x80000000 );
+    const __m256i vLimit   = _mm256_set1_epi32( limit );
+    const __m256i vLimitS  = _mm256_xor_si256( vLimit, vSign );
+    const __m256i vRnd     = _mm256_set1_epi32( rnd );
+    const __m256i vMax     = _mm256_set1_epi32( maxLevel );
+    const __m256i vDefault = _mm256_set1_epi32( defaultQuantCoeff );
+
+    for( ; n + 8 <= numCoeff; n += 8 )
+    {
+      const __m256i absLevel = _mm256_abs_epi32( _mm256_loadu_si256( ( const __m256i* ) &src[n] ) );
+
+      __m256i tmpEven, tmpOdd;
+      quantMul64( absLevel, quantLoadScale( quantCoeff, vDefault, n ), tmpEven, tmpOdd );
+
+      const __m256i lo    = quantPackLo( tmpEven, tmpOdd );
+      const __m256i hi    = _mm256_blend_epi32( _mm256_srli_epi64( tmpEven, 32 ), tmpOdd, 0xAA );
+      const __m256i clip  = _mm256_or_si256( _mm256_xor_si256( _mm256_cmpeq_epi32( hi, _mm256_setzero_si256() ), _mm256_set1_epi32( -1 ) ),
+                                             _mm256_cmpgt_epi32( _mm256_xor_si256( lo, vSign ), vLimitS ) );
+      const __m256i level = _mm256_blendv_epi8( lo, vLimit, clip );
+
+      _mm256_storeu_si256( ( __m256i* ) &levelDouble[n], level );
+      _mm256_storeu_si256( ( __m256i* ) &maxAbsLevel[n], _mm256_min_epi32( vMax, _mm256_srl_epi32( _mm256_add_epi32( level, vRnd ), vShift ) ) );
+    }
+  }
+#endif
+  {
+    const __m128i vSign    = _mm_set1_epi32( 0x80000000 );
+    const __m128i vLimit   = _mm_set1_epi32( limit );
+    const __m128i vLimitS  = _mm_xor_si128( vLimit, vSign );
+    const __m128i vRnd     = _mm_set1_epi32( rnd );
+    const __m128i vMax     = _mm_set1_epi32( maxLevel );
+    const __m128i vDefault = _mm_set1_epi32( defaultQuantCoeff );
+
+    for( ; n + 4 <= numCoeff; n += 4 )
+    {
+      const __m128i absLevel = _mm_abs_epi32( _mm_loadu_si128( ( const __m128i* ) &src[n] ) );
+
+      __m128i tmpEven, tmpOdd;
+      quantMul64( absLevel, quantLoadScale( quantCoeff, vDefault, n ), tmpEven, tmpOdd );
+
+      const __m128i lo    = quantPackLo( tmpEven, tmpOdd );
+      const __m128i hi    = _mm_blend_epi16( _mm_srli_epi64( tmpEven, 32 ), tmpOdd, 0xCC );
+      const __m128i clip  = _mm_or_si128( _mm_xor_si128( _mm_cmpeq_epi32( hi, _mm_setzero_si128() ), _mm_set1_epi32( -1 ) ),
+                                          _mm_cmpgt_epi32( _mm_xor_si128( lo, vSign ), vLimitS ) );
+      const __m128i level = _mm_blendv_epi8( lo, vLimit, clip );
+
+      _mm_storeu_si128( ( __m128i* ) &levelDouble[n], level );
+      _mm_storeu_si128( ( __m128i* ) &maxAbsLevel[n], _mm_min_epi32( vMax, _mm_srl_epi32( _mm_add_epi32( level, vRnd ), vShift ) ) );
+    }
+  }
+
+  if( n < numCoeff )
+  {
+    Quant::xQuantLevelsCore( src + n, levelDouble + n, maxAbsLevel + n, quantCoeff ? quantCoeff + n : nullptr, defaultQuantCoeff, qBits, maxLevel, numCoeff - n );
+  }
+}
+
+template <X86_VEXT vext>
+void Quant::_initQuantX86()
+{
+  m_quantCore       = simdQuantCore<vext>;
+  m_deQuantCore     = simdDeQuantCore<vext>;
+  m_quantLevelsCore = simdQuantLevelsCore<vext>;
+}
+
+template void Quant::_initQuantX86<SIMDX86>();
+
+#endif //#ifdef TARGET_SIMD_X86
+#endif
+//! \}
@@ -220,6 +220,27 @@ Distortion RdCost::xGetSAD_SIMD( const DistParam &rcDtParam )
   const int iStrideSrc2 = rcDtParam.cur.stride * iSubStep;
 
   uint32_t uiSum = 0;
+#ifdef USE_AVX512
+  if( vext >= AVX512 && ( iCols & 31 ) == 0 )
+  {
+    // Do for width that multiple of 32
+    __m512i vone   = _mm512_set1_epi16( 1 );
+    __m512i vsum32 = _mm512_setzero_si512();
+    for( int iY = 0; iY < iRows; iY+=iSubStep )
+    {
+      for( int iX = 0; iX < iCols; iX+=32 )
+      {
+        __m512i vsrc1 = _mm512_loadu_si512( ( const void* )( &pSrc1[iX] ) );
+        __m512i vsrc2 = _mm512_loadu_si512( ( const void* )( &pSrc2[iX] ) );
+        vsum32 = _mm512_add_epi32( vsum32, _mm512_madd_epi16( _mm512_abs_epi16( _mm512_sub_epi16( vsrc1, vsrc2 ) ), vone ) );
+      }
+      pSrc1   += iStrideSrc1;
+      pSrc2   += iStrideSrc2;
+    }
+    uiSum = _mm512_reduce_add_epi32( vsum32 );
+  }
+  else
+#endif
   if( vext >= AVX2 && ( iCols & 15 ) == 0 )
   {
 #ifdef USE_AVX2
@@ -305,8 +326,8 @@ Distortion RdCost::xGetSAD_IBD_SIMD(const DistParam &rcDtParam)
 
   const short* src0 = (const short*)rcDtParam.org.buf;
   const short* src1 = (const short*)rcDtParam.cur.buf;
-  int  width = rcDtParam.org.height;
-  int  height = rcDtParam.org.width;
+  int  width = rcDtParam.org.width;
+  int  height = rcDtParam.org.height;
   int  subShift = rcDtParam.subShift;
   int  subStep = (1 << subShift);
   const int src0Stride = rcDtParam.org.stride * subStep;
@@ -398,6 +419,27 @@ Distortion RdCost::xGetSAD_NxN_SIMD( const DistParam &rcDtParam )
   }
   else
   {
+#ifdef USE_AVX512
+    if( vext >= AVX512 && iWidth >= 32 )
+    {
+      // Do for width that multiple of 32
+      __m512i vone   = _mm512_set1_epi16( 1 );
+      __m512i vsum32 = _mm512_setzero_si512();
+      for( int iY = 0; iY < iRows; iY+=iSubStep )
+      {
+        for( int iX = 0; iX < iWidth; iX+=32 )
+        {
+          __m512i vsrc1 = _mm512_loadu_si512( ( const void* )( &pSrc1[iX] ) );
+          __m512i vsrc2 = _mm512_loadu_si512( ( const void* )( &pSrc2[iX] ) );
+          vsum32 = _mm512_add_epi32( vsum32, _mm512_madd_epi16( _mm512_abs_epi16( _mm512_sub_epi16( vsrc1, vsrc2 ) ), vone ) );
+        }
+        pSrc1   += iStrideSrc1;
+        pSrc2   += iStrideSrc2;
+      }
+      uiSum = _mm512_reduce_add_epi32( vsum32 );
+    }
+    else
+#endif
     if( vext >= AVX2 && iWidth >= 16 )
     {
 #ifdef USE_AVX2
@@ -2286,6 +2328,187 @@ static uint32_t xCalcHAD8x16_AVX2( const Torg *piOrg, const Tcur *piCur, const i
 }
 
 
+template< typename Torg, typename Tcur/*, bool bHorDownsampling*/ >
+static uint32_t xCalcHAD32x8_AVX512( const Torg *piOrg, const Tcur *piCur, const int iStrideOrg, const int iStrideCur, const int iBitDepth )
+{
+  uint32_t sad = 0;
+
+#ifdef USE_AVX512
+  // four 8x8 hadamard transforms side by side, one per 128-bit lane
+  __m512i m1[8], m2[8];
+
+  for( int k = 0; k < 8; k++ )
+  {
+    __m512i r0 = ( sizeof( Torg ) > 1 ) ? ( _mm512_loadu_si512( ( const void* )piOrg ) ) : ( _mm512_cvtepu8_epi16( _mm256_loadu_si256( ( const __m256i* )piOrg ) ) );
+    __m512i r1 = ( sizeof( Tcur ) > 1 ) ? ( _mm512_loadu_si512( ( const void* )piCur ) ) : ( _mm512_cvtepu8_epi16( _mm256_loadu_si256( ( const __m256i* )piCur ) ) );
+    m2[k] = _mm512_sub_epi16( r0, r1 );
+    piCur += iStrideCur;
+    piOrg += iStrideOrg;
+  }
+
+  // horizontal
+
+  m1[0] = _mm512_add_epi16( m2[0], m2[4] );
+  m1[1] = _mm512_add_epi16( m2[1], m2[5] );
+  m1[2] = _mm512_add_epi16( m2[2], m2[6] );
+  m1[3] = _mm512_add_epi16( m2[3], m2[7] );
+  m1[4] = _mm512_sub_epi16( m2[0], m2[4] );
+  m1[5] = _mm512_sub_epi16( m2[1], m2[5] );
+  m1[6] = _mm512_sub_epi16( m2[2], m2[6] );
+  m1[7] = _mm512_sub_epi16( m2[3], m2[7] );
+
+  m2[0] = _mm512_add_epi16( m1[0], m1[2] );
+  m2[1] = _mm512_add_epi16( m1[1], m1[3] );
+  m2[2] = _mm512_sub_epi16( m1[0], m1[2] );
+  m2[3] = _mm512_sub_epi16( m1[1], m1[3] );
+  m2[4] = _mm512_add_epi16( m1[4], m1[6] );
+  m2[5] = _mm512_add_epi16( m1[5], m1[7] );
+  m2[6] = _mm512_sub_epi16( m1[4], m1[6] );
+  m2[7] = _mm512_sub_epi16( m1[5], m1[7] );
+
+  m1[0] = _mm512_add_epi16( m2[0], m2[1] );
+  m1[1] = _mm512_sub_epi16( m2[0], m2[1] );
+  m1[2] = _mm512_add_epi16( m2[2], m2[3] );
+  m1[3] = _mm512_sub_epi16( m2[2], m2[3] );
+  m1[4] = _mm512_add_epi16( m2[4], m2[5] );
+  m1[5] = _mm512_sub_epi16( m2[4], m2[5] );
+  m1[6] = _mm512_add_epi16( m2[6], m2[7] );
+  m1[7] = _mm512_sub_epi16( m2[6], m2[7] );
+
+  // transpose 4 8x8 blocks in parallel
+
+  m2[0] = _mm512_unpacklo_epi16( m1[0], m1[1] );
+  m2[1] = _mm512_unpacklo_epi16( m1[2], m1[3] );
+  m2[2] = _mm512_unpacklo_epi16( m1[4], m1[5] );
+  m2[3] = _mm512_unpacklo_epi16( m1[6], m1[7] );
+  m2[4] = _mm512_unpackhi_epi16( m1[0], m1[1] );
+  m2[5] = _mm512_unpackhi_epi16( m1[2], m1[3] );
+  m2[6] = _mm512_unpackhi_epi16( m1[4], m1[5] );
+  m2[7] = _mm512_unpackhi_epi16( m1[6], m1[7] );
+
+  m1[0] = _mm512_unpacklo_epi32( m2[0], m2[1] );
+  m1[1] = _mm512_unpackhi_epi32( m2[0], m2[1] );
+  m1[2] = _mm512_unpacklo_epi32( m2[2], m2[3] );
+  m1[3] = _mm512_unpackhi_epi32( m2[2], m2[3] );
+  m1[4] = _mm512_unpacklo_epi32( m2[4], m2[5] );
+  m1[5] = _mm512_unpackhi_epi32( m2[4], m2[5] );
+  m1[6] = _mm512_unpacklo_epi32( m2[6], m2[7] );
+  m1[7] = _mm512_unpackhi_epi32( m2[6], m2[7] );
+
+  m2[0] = _mm512_unpacklo_epi64( m1[0], m1[2] );
+  m2[1] = _mm512_unpackhi_epi64( m1[0], m1[2] );
+  m2[2] = _mm512_unpacklo_epi64( m1[1], m1[3] );
+  m2[3] = _mm512_unpackhi_epi64( m1[1], m1[3] );
+  m2[4] = _mm512_unpacklo_epi64( m1[4], m1[6] );
+  m2[5] = _mm512_unpackhi_epi64( m1[4], m1[6] );
+  m2[6] = _mm512_unpacklo_epi64( m1[5], m1[7] );
+  m2[7] = _mm512_unpackhi_epi64( m1[5], m1[7] );
+
+  // vertical
+  if( iBitDepth >= 10 )
+  {
+    const __m512i vperm = _mm512_setr_epi64( 0, 2, 4, 6, 1, 3, 5, 7 );
+    __m512i n1[8][2];
+    __m512i n2[8][2];
+
+    for( int i = 0; i < 8; i++ )
+    {
+      __m512i vtmp = _mm512_permutexvar_epi64( vperm, m2[i] );
+      n2[i][0] = _mm512_cvtepi16_epi32( _mm512_castsi512_si256( vtmp ) );
+      n2[i][1] = _mm512_cvtepi16_epi32( _mm512_extracti64x4_epi64( vtmp, 1 ) );
+    }
+
+    for( int i = 0; i < 2; i++ )
+    {
+      n1[0][i] = _mm512_add_epi32( n2[0][i], n2[4][i] );
+      n1[1][i] = _mm512_add_epi32( n2[1][i], n2[5][i] );
+      n1[2][i] = _mm512_add_epi32( n2[2][i], n2[6][i] );
+      n1[3][i] = _mm512_add_epi32( n2[3][i], n2[7][i] );
+      n1[4][i] = _mm512_sub_epi32( n2[0][i], n2[4][i] );
+      n1[5][i] = _mm512_sub_epi32( n2[1][i], n2[5][i] );
+      n1[6][i] = _mm512_sub_epi32( n2[2][i], n2[6][i] );
+      n1[7][i] = _mm512_sub_epi32( n2[3][i], n2[7][i] );
+
+      n2[0][i] = _mm512_add_epi32( n1[0][i], n1[2][i] );
+      n2[1][i] = _mm512_add_epi32( n1[1][i], n1[3][i] );
+      n2[2][i] = _mm512_sub_epi32( n1[0][i], n1[2][i] );
+      n2[3][i] = _mm512_sub_epi32( n1[1][i], n1[3][i] );
+      n2[4][i] = _mm512_add_epi32( n1[4][i], n1[6][i] );
+      n2[5][i] = _mm512_add_epi32( n1[5][i], n1[7][i] );
+      n2[6][i] = _mm512_sub_epi32( n1[4][i], n1[6][i] );
+      n2[7][i] = _mm512_sub_epi32( n1[5][i], n1[7][i] );
+
+      n1[0][i] = _mm512_abs_epi32( _mm512_add_epi32( n2[0][i], n2[1][i] ) );
+      n1[1][i] = _mm512_abs_epi32( _mm512_sub_epi32( n2[0][i], n2[1][i] ) );
+      n1[2][i] = _mm512_abs_epi32( _mm512_add_epi32( n2[2][i], n2[3][i] ) );
+      n1[3][i] = _mm512_abs_epi32( _mm512_sub_epi32( n2[2][i], n2[3][i] ) );
+      n1[4][i] = _mm512_abs_epi32( _mm512_add_epi32( n2[4][i], n2[5][i] ) );
+      n1[5][i] = _mm512_abs_epi32( _mm512_sub_epi32( n2[4][i], n2[5][i] ) );
+      n1[6][i] = _mm512_abs_epi32( _mm512_add_epi32( n2[6][i], n2[7][i] ) );
+      n1[7][i] = _mm512_abs_epi32( _mm512_sub_epi32( n2[6][i], n2[7][i] ) );
+    }
+    for( int i = 0; i < 8; i++ )
+    {
+      m1[i] = _mm512_add_epi32( n1[i][0], n1[i][1] );
+    }
+  }
+  else
+  {
+    m1[0] = _mm512_add_epi16( m2[0], m2[4] );
+    m1[1] = _mm512_add_epi16( m2[1], m2[5] );
+    m1[2] = _mm512_add_epi16( m2[2], m2[6] );
+    m1[3] = _mm512_add_epi16( m2[3], m2[7] );
+    m1[4] = _mm512_sub_epi16( m2[0], m2[4] );
+    m1[5] = _mm512_sub_epi16( m2[1], m2[5] );
+    m1[6] = _mm512_sub_epi16( m2[2], m2[6] );
+    m1[7] = _mm512_sub_epi16( m2[3], m2[7] );
+
+    m2[0] = _mm512_add_epi16( m1[0], m1[2] );
+    m2[1] = _mm512_add_epi16( m1[1], m1[3] );
+    m2[2] = _mm512_sub_epi16( m1[0], m1[2] );
+    m2[3] = _mm512_sub_epi16( m1[1], m1[3] );
+    m2[4] = _mm512_add_epi16( m1[4], m1[6] );
+    m2[5] = _mm512_add_epi16( m1[5], m1[7] );
+    m2[6] = _mm512_sub_epi16( m1[4], m1[6] );
+    m2[7] = _mm512_sub_epi16( m1[5], m1[7] );
+
+    m1[0] = _mm512_abs_epi16( _mm512_add_epi16( m2[0], m2[1] ) );
+    m1[1] = _mm512_abs_epi16( _mm512_sub_epi16( m2[0], m2[1] ) );
+    m1[2] = _mm512_abs_epi16( _mm512_add_epi16( m2[2], m2[3] ) );
+    m1[3] = _mm512_abs_epi16( _mm512_sub_epi16( m2[2], m2[3] ) );
+    m1[4] = _mm512_abs_epi16( _mm512_add_epi16( m2[4], m2[5] ) );
+    m1[5] = _mm512_abs_epi16( _mm512_sub_epi16( m2[4], m2[5] ) );
+    m1[6] = _mm512_abs_epi16( _mm512_add_epi16( m2[6], m2[7] ) );
+    m1[7] = _mm512_abs_epi16( _mm512_sub_epi16( m2[6], m2[7] ) );
+
+    __m512i vzero = _mm512_setzero_si512();
+
+    for( int i = 0; i < 8; i++ )
+    {
+      m1[i] = _mm512_add_epi32( _mm512_unpacklo_epi16( m1[i], vzero ), _mm512_unpackhi_epi16( m1[i], vzero ) );
+    }
+  }
+
+  m1[0] = _mm512_add_epi32( m1[0], m1[1] );
+  m1[2] = _mm512_add_epi32( m1[2], m1[3] );
+  m1[4] = _mm512_add_epi32( m1[4], m1[5] );
+  m1[6] = _mm512_add_epi32( m1[6], m1[7] );
+
+  m1[0] = _mm512_add_epi32( m1[0], m1[2] );
+  m1[4] = _mm512_add_epi32( m1[4], m1[6] );
+
+  // per block sums, rounded separately as in the 8x8 kernels
+  __m512i iSum = _mm512_add_epi32( m1[0], m1[4] );
+  iSum = _mm512_add_epi32( iSum, _mm512_shuffle_epi32( iSum, _MM_PERM_BADC ) );
+  iSum = _mm512_add_epi32( iSum, _mm512_shuffle_epi32( iSum, _MM_PERM_CDAB ) );
+  iSum = _mm512_srli_epi32( _mm512_add_epi32( iSum, _mm512_set1_epi32( 2 ) ), 2 );
+
+  sad = _mm512_mask_reduce_add_epi32( 0x1111, iSum );
+
+#endif
+  return ( sad );
+}
+
 template< typename Torg, typename Tcur, X86_VEXT vext >
 Distortion RdCost::xGetHADs_SIMD( const DistParam &rcDtParam )
 {
@@ -2359,6 +2582,20 @@ Distortion RdCost::xGetHADs_SIMD( const DistParam &rcDtParam )
       piCur += iStrideCur * 8;
     }
   }
+#ifdef USE_AVX512
+  else if( vext >= AVX512 && ( ( ( iRows | iCols ) & 31 ) == 0 ) && ( iRows == iCols ) )
+  {
+    for( y = 0; y < iRows; y += 8 )
+    {
+      for( x = 0; x < iCols; x += 32 )
+      {
+        uiSum += xCalcHAD32x8_AVX512<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, iBitDepth );
+      }
+      piOrg += iStrideOrg * 8;
+      piCur += iStrideCur * 8;
+    }
+  }
+#endif
   else if( vext >= AVX2 && ( ( ( iRows | iCols ) & 15 ) == 0 ) && ( iRows == iCols ) )
   {
     int  iOffsetOrg = iStrideOrg << 4;
@@ -2424,6 +2661,397 @@ Distortion RdCost::xGetHADs_SIMD( const DistParam &rcDtParam )
   return uiSum >> DISTORTION_PRECISION_ADJUSTMENT(rcDtParam.bitDepth);
 }
 
+#if WCG_EXT
+template< X86_VEXT vext >
+Distortion RdCost::xGetSSE_WTD_SIMD( const DistParam &rcDtParam )
+{
+  if( rcDtParam.applyWeight || rcDtParam.bitDepth > 10 || rcDtParam.cShiftX > 1 )
+  {
+    return RdCost::xGetSSE_WTD( rcDtParam );
+  }
+
+  const Pel* piOrg          = rcDtParam.org.buf;
+  const Pel* piCur          = rcDtParam.cur.buf;
+  const Pel* piOrgLuma      = rcDtParam.orgLuma.buf;
+  const int  iRows          = rcDtParam.org.height;
+  const int  iCols          = rcDtParam.org.width;
+  const int  iStrideOrg     = rcDtParam.org.stride;
+  const int  iStrideCur     = rcDtParam.cur.stride;
+  const int  iStrideOrgLuma = rcDtParam.orgLuma.stride << rcDtParam.cShiftY;
+  const int  cShift         = rcDtParam.cShiftX;
+  const uint32_t uiShift    = DISTORTION_PRECISION_ADJUSTMENT( rcDtParam.bitDepth ) << 1;
+
+  // the weight is taken per sample from the luma level table unless SDR chroma uses the constant chroma weight
+  const bool    lumaLevelWeight = rcDtParam.compID == COMPONENT_Y || m_signalType != RESHAPE_SIGNAL_SDR;
+  const double* pLumaWeight     = m_reshapeLumaLevelToWeightPLUT.data();
+  const __m128i vChromaWeight   = _mm_set1_epi32( ( int ) ( int64_t ) ( m_chromaWeight * ( double ) ( 1 << 16 ) ) );
+  const __m128i vLumaMask       = _mm_set1_epi32( 0xffff );
+  const __m128i vRound          = _mm_set1_epi64x( 1 << 15 );
+
+  __m128i vSum = _mm_setzero_si128();
+  Distortion uiSum = 0;
+
+#ifdef USE_AVX2
+  const __m256d vFixedPoint  = _mm256_set1_pd( ( double ) ( 1 << 16 ) );
+  __m256i       vSum256      = _mm256_setzero_si256();
+#endif
+
+  for( int y = 0; y < iRows; y++ )
+  {
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      const __m256i vLumaMask256 = _mm256_set1_epi32( 0xffff );
+      const __m256i vRound256    = _mm256_set1_epi64x( 1 << 15 );
+
+      for( ; x + 8 <= iCols; x += 8 )
+      {
+        __m256i vLuma = cShift ? _mm256_and_si256( _mm256_loadu_si256( ( const __m256i* ) &piOrgLuma[x << 1] ), vLumaMask256 )
+                               : _mm256_cvtepu16_epi32( _mm_loadu_si128( ( const __m128i* ) &piOrgLuma[x] ) );
+        __m256i vWeight;
+        if( lumaLevelWeight )
+        {
+          __m128i vW0 = _mm256_cvttpd_epi32( _mm256_mul_pd( _mm256_i32gather_pd( pLumaWeight, _mm256_castsi256_si128( vLuma ), 8 ), vFixedPoint ) );
+          __m128i vW1 = _mm256_cvttpd_epi32( _mm256_mul_pd( _mm256_i32gather_pd( pLumaWeight, _mm256_extracti128_si256( vLuma, 1 ), 8 ), vFixedPoint ) );
+          vWeight = _mm256_inserti128_si256( _mm256_castsi128_si256( vW0 ), vW1, 1 );
+        }
+        else
+        {
+          vWeight = _mm256_broadcastsi128_si256( vChromaWeight );
+        }
+
+        __m128i vDiff16 = _mm_sub_epi16( _mm_loadu_si128( ( const __m128i* ) &piOrg[x] ), _mm_loadu_si128( ( const __m128i* ) &piCur[x] ) );
+        __m256i vDiff   = _mm256_cvtepi16_epi32( vDiff16 );
+        __m256i vSqr    = _mm256_mullo_epi32( vDiff, vDiff );
+
+        // 64-bit fixed point products of the even and odd samples
+        __m256i vEven   = _mm256_srli_epi64( _mm256_add_epi64( _mm256_mul_epu32( vSqr, vWeight ), vRound256 ), 16 );
+        __m256i vOdd    = _mm256_srli_epi64( _mm256_add_epi64( _mm256_mul_epu32( _mm256_srli_epi64( vSqr, 32 ), _mm256_srli_epi64( vWeight, 32 ) ), vRound256 ), 16 );
+
+        if( sizeof( Intermediate_Int ) == 4 )
+        {
+          __m256i vMse = _mm256_unpacklo_epi32( _mm256_shuffle_epi32( vEven, 0x08 ), _mm256_shuffle_epi32( vOdd, 0x08 ) );
+          vMse    = _mm256_srai_epi32( vMse, uiShift );
+          vSum256 = _mm256_add_epi64( vSum256, _mm256_cvtepi32_epi64( _mm256_castsi256_si128( vMse ) ) );
+          vSum256 = _mm256_add_epi64( vSum256, _mm256_cvtepi32_epi64( _mm256_extracti128_si256( vMse, 1 ) ) );
+        }
+        else
+        {
+          vSum256 = _mm256_add_epi64( vSum256, _mm256_srli_epi64( vEven, uiShift ) );
+          vSum256 = _mm256_add_epi64( vSum256, _mm256_srli_epi64( vOdd,  uiShift ) );
+        }
+      }
+    }
+#endif
+    for( ; x + 4 <= iCols; x += 4 )
+    {
+      __m128i vWeight;
+      if( lumaLevelWeight )
+      {
+        __m128i vLuma = cShift ? _mm_and_si128( _mm_loadu_si128( ( const __m128i* ) &piOrgLuma[x << 1] ), vLumaMask )
+                               : _mm_cvtepu16_epi32( _mm_loadl_epi64( ( const __m128i* ) &piOrgLuma[x] ) );
+        vWeight = _mm_setr_epi32( ( int ) ( int64_t ) ( pLumaWeight[_mm_cvtsi128_si32( vLuma )]       * ( double ) ( 1 << 16 ) ),
+                                  ( int ) ( int64_t ) ( pLumaWeight[_mm_extract_epi32( vLuma, 1 )] * ( double ) ( 1 << 16 ) ),
+                                  ( int ) ( int64_t ) ( pLumaWeight[_mm_extract_epi32( vLuma, 2 )] * ( double ) ( 1 << 16 ) ),
+                                  ( int ) ( int64_t ) ( pLumaWeight[_mm_extract_epi32( vLuma, 3 )] * ( double ) ( 1 << 16 ) ) );
+      }
+      else
+      {
+        vWeight = vChromaWeight;
+      }
+
+      __m128i vDiff16 = _mm_sub_epi16( _mm_loadl_epi64( ( const __m128i* ) &piOrg[x] ), _mm_loadl_epi64( ( const __m128i* ) &piCur[x] ) );
+      __m128i vDiff   = _mm_cvtepi16_epi32( vDiff16 );
+      __m128i vSqr    = _mm_mullo_epi32( vDiff, vDiff );
+
+      __m128i vEven   = _mm_srli_epi64( _mm_add_epi64( _mm_mul_epu32( vSqr, vWeight ), vRound ), 16 );
+      __m128i vOdd    = _mm_srli_epi64( _mm_add_epi64( _mm_mul_epu32( _mm_srli_epi64( vSqr, 32 ), _mm_srli_epi64( vWeight, 32 ) ), vRound ), 16 );
+
+      if( sizeof( Intermediate_Int ) == 4 )
+      {
+        // keep the 32-bit wrap-around of the scalar intermediate
+        __m128i vMse = _mm_unpacklo_epi32( _mm_shuffle_epi32( vEven, 0x08 ), _mm_shuffle_epi32( vOdd, 0x08 ) );
+        vMse = _mm_srai_epi32( vMse, uiShift );
+        vSum = _mm_add_epi64( vSum, _mm_cvtepi32_epi64( vMse ) );
+        vSum = _mm_add_epi64( vSum, _mm_cvtepi32_epi64( _mm_unpackhi_epi64( vMse, vMse ) ) );
+      }
+      else
+      {
+        vSum = _mm_add_epi64( vSum, _mm_srli_epi64( vEven, uiShift ) );
+        vSum = _mm_add_epi64( vSum, _mm_srli_epi64( vOdd,  uiShift ) );
+      }
+    }
+    for( ; x < iCols; x++ )
+    {
+      uiSum += getWeightedMSE( rcDtParam.compID, piOrg[x], piCur[x], uiShift, piOrgLuma[x << cShift] );
+    }
+
+    piOrg     += iStrideOrg;
+    piCur     += iStrideCur;
+    piOrgLuma += iStrideOrgLuma;
+  }
+
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    vSum = _mm_add_epi64( vSum, _mm_add_epi64( _mm256_castsi256_si128( vSum256 ), _mm256_extracti128_si256( vSum256, 1 ) ) );
+  }
+#endif
+  vSum   = _mm_add_epi64( vSum, _mm_unpackhi_epi64( vSum, vSum ) );
+  uiSum += _mm_cvtsi128_si64( vSum );
+
+  return uiSum;
+}
+#endif
+
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+// 32-bit sample distortion kernels; they mirror the scalar functions including the per-row early exit of xGetSAD
+template< X86_VEXT vext, bool earlyExit >
+Distortion RdCost::xGetSAD_HBD_SIMD( const DistParam &rcDtParam )
+{
+  if( ( rcDtParam.org.width & 3 ) != 0 || rcDtParam.applyWeight )
+    return RdCost::xGetSAD( rcDtParam );
+
+  const Pel* pSrc1     = rcDtParam.org.buf;
+  const Pel* pSrc2     = rcDtParam.cur.buf;
+  int  iRows           = rcDtParam.org.height;
+  const int  iCols     = rcDtParam.org.width;
+  const int  iSubShift = rcDtParam.subShift;
+  const int  iSubStep  = ( 1 << iSubShift );
+  const int iStrideSrc1 = rcDtParam.org.stride * iSubStep;
+  const int iStrideSrc2 = rcDtParam.cur.stride * iSubStep;
+  const uint32_t distortionShift = DISTORTION_PRECISION_ADJUSTMENT( rcDtParam.bitDepth );
+
+  Distortion uiSum = 0;
+  for( ; iRows != 0; iRows -= iSubStep )
+  {
+    __m128i vsum32 = _mm_setzero_si128();
+    int iX = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 )
+    {
+      __m256i vsum256 = _mm256_setzero_si256();
+      for( ; iX + 8 <= iCols; iX += 8 )
+      {
+        __m256i vsrc1 = _mm256_loadu_si256( ( const __m256i* )( &pSrc1[iX] ) );
+        __m256i vsrc2 = _mm256_loadu_si256( ( const __m256i* )( &pSrc2[iX] ) );
+        vsum256 = _mm256_add_epi32( vsum256, _mm256_abs_epi32( _mm256_sub_epi32( vsrc1, vsrc2 ) ) );
+      }
+      vsum32 = _mm_add_epi32( _mm256_castsi256_si128( vsum256 ), _mm256_extracti128_si256( vsum256, 1 ) );
+    }
+#endif
+    for( ; iX < iCols; iX += 4 )
+    {
+      __m128i vsrc1 = _mm_loadu_si128( ( const __m128i* )( &pSrc1[iX] ) );
+      __m128i vsrc2 = _mm_loadu_si128( ( const __m128i* )( &pSrc2[iX] ) );
+      vsum32 = _mm_add_epi32( vsum32, _mm_abs_epi32( _mm_sub_epi32( vsrc1, vsrc2 ) ) );
+    }
+    vsum32 = _mm_hadd_epi32( vsum32, vsum32 );
+    vsum32 = _mm_hadd_epi32( vsum32, vsum32 );
+    uiSum += ( uint32_t ) _mm_cvtsi128_si32( vsum32 );
+
+    if( earlyExit && rcDtParam.maximumDistortionForEarlyExit < ( uiSum >> distortionShift ) )
+    {
+      return ( uiSum >> distortionShift );
+    }
+    pSrc1 += iStrideSrc1;
+    pSrc2 += iStrideSrc2;
+  }
+
+  uiSum <<= iSubShift;
+  return ( uiSum >> distortionShift );
+}
+
+// un-normalized WxH Hadamard SATD (W, H in 4, 8, 16), the rows are kept as vectors of 4 samples
+template< int W, int H >
+static uint32_t xCalcHADWxH_HBD_SSE( const Pel *piOrg, const Pel *piCur, const int iStrideOrg, const int iStrideCur )
+{
+  static const int V = W >> 2;
+  __m128i m[H][V];
+
+  for( int y = 0; y < H; y++ )
+  {
+    for( int v = 0; v < V; v++ )
+    {
+      m[y][v] = _mm_sub_epi32( _mm_loadu_si128( ( const __m128i* ) &piOrg[4 * v] ), _mm_loadu_si128( ( const __m128i* ) &piCur[4 * v] ) );
+    }
+    piOrg += iStrideOrg;
+    piCur += iStrideCur;
+  }
+
+  // vertical butterflies, lane-wise between rows
+  for( int s = H >> 1; s > 0; s >>= 1 )
+  {
+    for( int i = 0; i < H; i += 2 * s )
+    {
+      for( int j = i; j < i + s; j++ )
+      {
+        for( int v = 0; v < V; v++ )
+        {
+          const __m128i a = m[j][v];
+          const __m128i b = m[j + s][v];
+          m[j    ][v] = _mm_add_epi32( a, b );
+          m[j + s][v] = _mm_sub_epi32( a, b );
+        }
+      }
+    }
+  }
+
+  // horizontal butterflies between the vectors of a row
+  for( int s = V >> 1; s > 0; s >>= 1 )
+  {
+    for( int i = 0; i < V; i += 2 * s )
+    {
+      for( int j = i; j < i + s; j++ )
+      {
+        for( int y = 0; y < H; y++ )
+        {
+          const __m128i a = m[y][j];
+          const __m128i b = m[y][j + s];
+          m[y][j    ] = _mm_add_epi32( a, b );
+          m[y][j + s] = _mm_sub_epi32( a, b );
+        }
+      }
+    }
+  }
+
+  // horizontal butterflies inside the vectors: lanes ( 0, 2 ), ( 1, 3 ) and then ( 0, 1 ), ( 2, 3 )
+  const __m128i vsign0 = _mm_set_epi32( -1, -1, 1, 1 );
+  const __m128i vsign1 = _mm_set_epi32( -1, 1, -1, 1 );
+  __m128i vsum = _mm_setzero_si128();
+  for( int y = 0; y < H; y++ )
+  {
+    for( int v = 0; v < V; v++ )
+    {
+      __m128i x = m[y][v];
+      x = _mm_add_epi32( _mm_sign_epi32( x, vsign0 ), _mm_shuffle_epi32( x, 0x4e ) );
+      x = _mm_add_epi32( _mm_sign_epi32( x, vsign1 ), _mm_shuffle_epi32( x, 0xb1 ) );
+      vsum = _mm_add_epi32( vsum, _mm_abs_epi32( x ) );
+    }
+  }
+  vsum = _mm_hadd_epi32( vsum, vsum );
+  vsum = _mm_hadd_epi32( vsum, vsum );
+
+  return ( uint32_t ) _mm_cvtsi128_si32( vsum );
+}
+
+template< X86_VEXT vext >
+Distortion RdCost::xGetHADs_HBD_SIMD( const DistParam &rcDtParam )
+{
+  if( rcDtParam.applyWeight || rcDtParam.step != 1 )
+  {
+    return RdCost::xGetHADs( rcDtParam );
+  }
+
+  const Pel* piOrg = rcDtParam.org.buf;
+  const Pel* piCur = rcDtParam.cur.buf;
+  const int iRows = rcDtParam.org.height;
+  const int iCols = rcDtParam.org.width;
+  const int iStrideCur = rcDtParam.cur.stride;
+  const int iStrideOrg = rcDtParam.org.stride;
+
+  int  x, y;
+  Distortion uiSum = 0;
+
+  // same block partitioning and normalization as RdCost::xGetHADs
+  if( iCols > iRows && ( iRows & 7 ) == 0 && ( iCols & 15 ) == 0 )
+  {
+    for( y = 0; y < iRows; y += 8 )
+    {
+      for( x = 0; x < iCols; x += 16 )
+      {
+        int sad = xCalcHADWxH_HBD_SSE<16, 8>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur );
+        uiSum += ( int ) ( sad / sqrt( 16.0 * 8 ) * 2 );
+      }
+      piOrg += iStrideOrg * 8;
+      piCur += iStrideCur * 8;
+    }
+  }
+  else if( iCols < iRows && ( iCols & 7 ) == 0 && ( iRows & 15 ) == 0 )
+  {
+    for( y = 0; y < iRows; y += 16 )
+    {
+      for( x = 0; x < iCols; x += 8 )
+      {
+        int sad = xCalcHADWxH_HBD_SSE<8, 16>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur );
+        uiSum += ( int ) ( sad / sqrt( 16.0 * 8 ) * 2 );
+      }
+      piOrg += iStrideOrg * 16;
+      piCur += iStrideCur * 16;
+    }
+  }
+  else if( iCols > iRows && ( iRows & 3 ) == 0 && ( iCols & 7 ) == 0 )
+  {
+    for( y = 0; y < iRows; y += 4 )
+    {
+      for( x = 0; x < iCols; x += 8 )
+      {
+        int sad = xCalcHADWxH_HBD_SSE<8, 4>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur );
+        uiSum += ( int ) ( sad / sqrt( 4.0 * 8 ) * 2 );
+      }
+      piOrg += iStrideOrg * 4;
+      piCur += iStrideCur * 4;
+    }
+  }
+  else if( iCols < iRows && ( iCols & 3 ) == 0 && ( iRows & 7 ) == 0 )
+  {
+    for( y = 0; y < iRows; y += 8 )
+    {
+      for( x = 0; x < iCols; x += 4 )
+      {
+        int sad = xCalcHADWxH_HBD_SSE<4, 8>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur );
+        uiSum += ( int ) ( sad / sqrt( 4.0 * 8 ) * 2 );
+      }
+      piOrg += iStrideOrg * 8;
+      piCur += iStrideCur * 8;
+    }
+  }
+  else if( ( iRows % 8 == 0 ) && ( iCols % 8 == 0 ) )
+  {
+    for( y = 0; y < iRows; y += 8 )
+    {
+      for( x = 0; x < iCols; x += 8 )
+      {
+        uiSum += ( xCalcHADWxH_HBD_SSE<8, 8>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur ) + 2 ) >> 2;
+      }
+      piOrg += iStrideOrg * 8;
+      piCur += iStrideCur * 8;
+    }
+  }
+  else if( ( iRows % 4 == 0 ) && ( iCols % 4 == 0 ) )
+  {
+    for( y = 0; y < iRows; y += 4 )
+    {
+      for( x = 0; x < iCols; x += 4 )
+      {
+        uiSum += ( xCalcHADWxH_HBD_SSE<4, 4>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur ) + 1 ) >> 1;
+      }
+      piOrg += iStrideOrg * 4;
+      piCur += iStrideCur * 4;
+    }
+  }
+  else if( ( iRows % 2 == 0 ) && ( iCols % 2 == 0 ) )
+  {
+    for( y = 0; y < iRows; y += 2 )
+    {
+      for( x = 0; x < iCols; x += 2 )
+      {
+        uiSum += xCalcHADs2x2( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, 1 );
+      }
+      piOrg += iStrideOrg * 2;
+      piCur += iStrideCur * 2;
+    }
+  }
+  else
+  {
+    THROW( "Invalid size" );
+  }
+
+  return ( uiSum >> DISTORTION_PRECISION_ADJUSTMENT( rcDtParam.bitDepth ) );
+}
+#endif
+
 template <X86_VEXT vext>
 void RdCost::_initRdCostX86()
 {
@@ -2438,6 +3066,31 @@ void RdCost::_initRdCostX86()
   //m_afpDistortFunc[DF_SSE64  ] = xGetSSE_NxN_SIMD<Pel, Pel, 64, vext>;
   //m_afpDistortFunc[DF_SSE16N ] = xGetSSE_SIMD<Pel, Pel, vext>;
 
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+  m_afpDistortFunc[DF_SAD    ] = xGetSAD_HBD_SIMD<vext, true>;
+  m_afpDistortFunc[DF_SAD2   ] = xGetSAD_HBD_SIMD<vext, true>;
+  m_afpDistortFunc[DF_SAD4   ] = xGetSAD_HBD_SIMD<vext, false>;
+  m_afpDistortFunc[DF_SAD8   ] = xGetSAD_HBD_SIMD<vext, false>;
+  m_afpDistortFunc[DF_SAD16  ] = xGetSAD_HBD_SIMD<vext, false>;
+  m_afpDistortFunc[DF_SAD32  ] = xGetSAD_HBD_SIMD<vext, false>;
+  m_afpDistortFunc[DF_SAD64  ] = xGetSAD_HBD_SIMD<vext, false>;
+  m_afpDistortFunc[DF_SAD16N]  = xGetSAD_HBD_SIMD<vext, false>;
+
+  m_afpDistortFunc[DF_SAD12  ] = RdCost::xGetSAD_HBD_SIMD<vext, false>;
+  m_afpDistortFunc[DF_SAD24  ] = RdCost::xGetSAD_HBD_SIMD<vext, false>;
+  m_afpDistortFunc[DF_SAD48  ] = RdCost::xGetSAD_HBD_SIMD<vext, false>;
+
+  m_afpDistortFunc[DF_HAD]     = RdCost::xGetHADs_HBD_SIMD<vext>;
+  m_afpDistortFunc[DF_HAD2]    = RdCost::xGetHADs_HBD_SIMD<vext>;
+  m_afpDistortFunc[DF_HAD4]    = RdCost::xGetHADs_HBD_SIMD<vext>;
+  m_afpDistortFunc[DF_HAD8]    = RdCost::xGetHADs_HBD_SIMD<vext>;
+  m_afpDistortFunc[DF_HAD16]   = RdCost::xGetHADs_HBD_SIMD<vext>;
+  m_afpDistortFunc[DF_HAD32]   = RdCost::xGetHADs_HBD_SIMD<vext>;
+  m_afpDistortFunc[DF_HAD64]   = RdCost::xGetHADs_HBD_SIMD<vext>;
+  m_afpDistortFunc[DF_HAD16N]  = RdCost::xGetHADs_HBD_SIMD<vext>;
+
+  m_afpDistortFunc[DF_SAD_INTERMEDIATE_BITDEPTH] = RdCost::xGetSAD_HBD_SIMD<vext, true>;
+#else
   m_afpDistortFunc[DF_SAD    ] = xGetSAD_SIMD<vext>;
   m_afpDistortFunc[DF_SAD2   ] = xGetSAD_SIMD<vext>;
   m_afpDistortFunc[DF_SAD4   ] = xGetSAD_NxN_SIMD<4,  vext>;
@@ -2461,6 +3114,18 @@ void RdCost::_initRdCostX86()
   m_afpDistortFunc[DF_HAD16N]  = RdCost::xGetHADs_SIMD<Pel, Pel, vext>;
 
   m_afpDistortFunc[DF_SAD_INTERMEDIATE_BITDEPTH] = RdCost::xGetSAD_IBD_SIMD<vext>;
+#endif
+
+#if WCG_EXT && !RExt__HIGH_BIT_DEPTH_SUPPORT
+  m_afpDistortFunc[DF_SSE_WTD   ] = RdCost::xGetSSE_WTD_SIMD<vext>;
+  m_afpDistortFunc[DF_SSE2_WTD  ] = RdCost::xGetSSE_WTD_SIMD<vext>;
+  m_afpDistortFunc[DF_SSE4_WTD  ] = RdCost::xGetSSE_WTD_SIMD<vext>;
+  m_afpDistortFunc[DF_SSE8_WTD  ] = RdCost::xGetSSE_WTD_SIMD<vext>;
+  m_afpDistortFunc[DF_SSE16_WTD ] = RdCost::xGetSSE_WTD_SIMD<vext>;
+  m_afpDistortFunc[DF_SSE32_WTD ] = RdCost::xGetSSE_WTD_SIMD<vext>;
+  m_afpDistortFunc[DF_SSE64_WTD ] = RdCost::xGetSSE_WTD_SIMD<vext>;
+  m_afpDistortFunc[DF_SSE16N_WTD] = RdCost::xGetSSE_WTD_SIMD<vext>;
+#endif
 }
 
 template void RdCost::_initRdCostX86<SIMDX86>();
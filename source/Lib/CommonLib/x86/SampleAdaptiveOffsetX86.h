@@ -0,0 +1,288 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SampleAdaptiveOffsetX86.h
+    \brief    SIMD sample adaptive offset
+*/
+
+//! \ingroup CommonLib
+//! \{
+
+#include "CommonLib/CommonDef.h"
+#include "CommonDefX86.h"
+#include "CommonLib/SampleAdaptiveOffset.h"
+
+#if ENABLE_SIMD_OPT_SAO
+#ifdef TARGET_SIMD_X86
+
+// The scalar code carries the edge signs between lines and columns in sign buffers; here the edge class of
+// every sample is computed directly as sgn(c - a) + sgn(c - b) from its two neighbours a and b along the
+// class direction, which gives identical results. The offsets are looked up with a 16 bit pshufb.
+
+// 16 bit table lookup, idx in [0, 7]
+static inline __m128i saoLookup( const __m128i tab, const __m128i idx )
+{
+  return _mm_shuffle_epi8( tab, _mm_add_epi16( _mm_mullo_epi16( idx, _mm_set1_epi16( 0x0202 ) ), _mm_set1_epi16( 0x0100 ) ) );
+}
+
+// sgn( c - a ) + sgn( c - b ) + 2
+static inline __m128i saoEdgeIdx( const __m128i c, const __m128i a, const __m128i b )
+{
+  const __m128i sa = _mm_sub_epi16( _mm_cmpgt_epi16( a, c ), _mm_cmpgt_epi16( c, a ) );
+  const __m128i sb = _mm_sub_epi16( _mm_cmpgt_epi16( b, c ), _mm_cmpgt_epi16( c, b ) );
+  return _mm_add_epi16( _mm_add_epi16( sa, sb ), _mm_set1_epi16( 2 ) );
+}
+
+#ifdef USE_AVX2
+static inline __m256i saoLookup( const __m256i tab, const __m256i idx )
+{
+  return _mm256_shuffle_epi8( tab, _mm256_add_epi16( _mm256_mullo_epi16( idx, _mm256_set1_epi16( 0x0202 ) ), _mm256_set1_epi16( 0x0100 ) ) );
+}
+
+static inline __m256i saoEdgeIdx( const __m256i c, const __m256i a, const __m256i b )
+{
+  const __m256i sa = _mm256_sub_epi16( _mm256_cmpgt_epi16( a, c ), _mm256_cmpgt_epi16( c, a ) );
+  const __m256i sb = _mm256_sub_epi16( _mm256_cmpgt_epi16( b, c ), _mm256_cmpgt_epi16( c, b ) );
+  return _mm256_add_epi16( _mm256_add_epi16( sa, sb ), _mm256_set1_epi16( 2 ) );
+}
+#endif
+
+// edge offset for samples [xs, xe) of one line, dA and dB are the neighbour offsets
+template<X86_VEXT vext>
+static inline void saoEdgeOffsetLine( const Pel* srcLine, Pel* resLine, const int xs, const int xe, const ptrdiff_t dA, const ptrdiff_t dB, const int* offset, const ClpRng& clpRng )
+{
+  const __m128i tab  = _mm_setr_epi16( offset[0], offset[1], offset[2], offset[3], offset[4], 0, 0, 0 );
+  const __m128i vmin = _mm_set1_epi16( clpRng.min );
+  const __m128i vmax = _mm_set1_epi16( clpRng.max );
+
+  int x = xs;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i tab256  = _mm256_inserti128_si256( _mm256_castsi128_si256( tab ), tab, 1 );
+    const __m256i vmin256 = _mm256_set1_epi16( clpRng.min );
+    const __m256i vmax256 = _mm256_set1_epi16( clpRng.max );
+
+    for( ; x + 16 <= xe; x += 16 )
+    {
+      const __m256i c   = _mm256_loadu_si256( ( const __m256i* ) &srcLine[x] );
+      const __m256i a   = _mm256_loadu_si256( ( const __m256i* ) &srcLine[x + dA] );
+      const __m256i b   = _mm256_loadu_si256( ( const __m256i* ) &srcLine[x + dB] );
+      const __m256i off = saoLookup( tab256, saoEdgeIdx( c, a, b ) );
+      _mm256_storeu_si256( ( __m256i* ) &resLine[x], _mm256_min_epi16( _mm256_max_epi16( _mm256_adds_epi16( c, off ), vmin256 ), vmax256 ) );
+    }
+  }
+#endif
+  for( ; x + 8 <= xe; x += 8 )
+  {
+    const __m128i c   = _mm_loadu_si128( ( const __m128i* ) &srcLine[x] );
+    const __m128i a   = _mm_loadu_si128( ( const __m128i* ) &srcLine[x + dA] );
+    const __m128i b   = _mm_loadu_si128( ( const __m128i* ) &srcLine[x + dB] );
+    const __m128i off = saoLookup( tab, saoEdgeIdx( c, a, b ) );
+    _mm_storeu_si128( ( __m128i* ) &resLine[x], _mm_min_epi16( _mm_max_epi16( _mm_adds_epi16( c, off ), vmin ), vmax ) );
+  }
+  if( x + 4 <= xe )
+  {
+    const __m128i c   = _mm_loadl_epi64( ( const __m128i* ) &srcLine[x] );
+    const __m128i a   = _mm_loadl_epi64( ( const __m128i* ) &srcLine[x + dA] );
+    const __m128i b   = _mm_loadl_epi64( ( const __m128i* ) &srcLine[x + dB] );
+    const __m128i off = saoLookup( tab, saoEdgeIdx( c, a, b ) );
+    _mm_storel_epi64( ( __m128i* ) &resLine[x], _mm_min_epi16( _mm_max_epi16( _mm_adds_epi16( c, off ), vmin ), vmax ) );
+    x += 4;
+  }
+  for( ; x < xe; x++ )
+  {
+    const int edgeType = sgn( srcLine[x] - srcLine[x + dA] ) + sgn( srcLine[x] - srcLine[x + dB] );
+    resLine[x] = ClipPel<int>( srcLine[x] + offset[edgeType + 2], clpRng );
+  }
+}
+
+template<X86_VEXT vext>
+static void simdOffsetBlock( const int channelBitDepth, const ClpRng& clpRng, int typeIdx, int* offset, const Pel* srcBlk, Pel* resBlk, int srcStride, int resStride, int width, int height
+                           , bool isLeftAvail, bool isRightAvail, bool isAboveAvail, bool isBelowAvail, bool isAboveLeftAvail, bool isAboveRightAvail, bool isBelowLeftAvail, bool isBelowRightAvail
+#if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
+                           , bool isCtuCrossedByVirtualBoundaries, int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry, int numVerVirBndry
+#endif
+                           , int8_t* signLineBuf1, int8_t* signLineBuf2
+  )
+{
+  if( typeIdx == SAO_TYPE_BO )
+  {
+    const __m128i shift = _mm_cvtsi32_si128( channelBitDepth - NUM_SAO_BO_CLASSES_LOG2 );
+    const __m128i vmin  = _mm_set1_epi16( clpRng.min );
+    const __m128i vmax  = _mm_set1_epi16( clpRng.max );
+    const __m128i seven = _mm_set1_epi16( 7 );
+    __m128i tab[4];
+    for( int i = 0; i < 4; i++ )
+    {
+      tab[i] = _mm_setr_epi16( offset[8 * i + 0], offset[8 * i + 1], offset[8 * i + 2], offset[8 * i + 3], offset[8 * i + 4], offset[8 * i + 5], offset[8 * i + 6], offset[8 * i + 7] );
+    }
+
+    for( int y = 0; y < height; y++ )
+    {
+      const Pel* srcLine = srcBlk + y * srcStride;
+            Pel* resLine = resBlk + y * resStride;
+
+      int x = 0;
+      for( ; x + 8 <= width; x += 8 )
+      {
+        const __m128i c    = _mm_loadu_si128( ( const __m128i* ) &srcLine[x] );
+        const __m128i band = _mm_sra_epi16( c, shift );
+        const __m128i lo   = _mm_and_si128( band, seven );
+        const __m128i hi   = _mm_srai_epi16( band, 3 );
+        __m128i off        = _mm_setzero_si128();
+        for( int i = 0; i < 4; i++ )
+        {
+          off = _mm_or_si128( off, _mm_and_si128( saoLookup( tab[i], lo ), _mm_cmpeq_epi16( hi, _mm_set1_epi16( i ) ) ) );
+        }
+        _mm_storeu_si128( ( __m128i* ) &resLine[x], _mm_min_epi16( _mm_max_epi16( _mm_adds_epi16( c, off ), vmin ), vmax ) );
+      }
+      for( ; x < width; x++ )
+      {
+        resLine[x] = ClipPel<int>( srcLine[x] + offset[srcLine[x] >> ( channelBitDepth - NUM_SAO_BO_CLASSES_LOG2 )], clpRng );
+      }
+    }
+    return;
+  }
+
+  ptrdiff_t dA = 0, dB = 0;
+  bool useVerVirBndry = false, useHorVirBndry = false;
+
+  switch( typeIdx )
+  {
+  case SAO_TYPE_EO_0:   dA = -1;             dB = 1;             useVerVirBndry = true;                         break;
+  case SAO_TYPE_EO_90:  dA = -srcStride;     dB = srcStride;     useHorVirBndry = true;                         break;
+  case SAO_TYPE_EO_135: dA = -srcStride - 1; dB = srcStride + 1; useVerVirBndry = true; useHorVirBndry = true; break;
+  case SAO_TYPE_EO_45:  dA = -srcStride + 1; dB = srcStride - 1; useVerVirBndry = true; useHorVirBndry = true; break;
+  default:
+    THROW( "Not a supported SAO types\n" );
+  }
+
+#if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
+  if( !isCtuCrossedByVirtualBoundaries )
+#endif
+  {
+    useVerVirBndry = useHorVirBndry = false;
+  }
+
+  const int startX = isLeftAvail  ? 0 : 1;
+  const int endX   = isRightAvail ? width : width - 1;
+  const int startY = isAboveAvail ? 0 : 1;
+  const int endY   = isBelowAvail ? height : height - 1;
+
+  for( int y = 0; y < height; y++ )
+  {
+    int xs = startX, xe = endX;
+
+    if( typeIdx == SAO_TYPE_EO_90 )
+    {
+      if( y < startY || y >= endY )
+      {
+        continue;
+      }
+      xs = 0;
+      xe = width;
+    }
+    else if( typeIdx != SAO_TYPE_EO_0 && y == 0 )
+    {
+      xs = typeIdx == SAO_TYPE_EO_135 ? ( isAboveLeftAvail ? 0 : 1 ) : ( isAboveAvail ? startX : width - 1 );
+      xe = typeIdx == SAO_TYPE_EO_135 ? ( isAboveAvail ? endX : 1 ) : ( isAboveRightAvail ? width : width - 1 );
+    }
+    else if( typeIdx != SAO_TYPE_EO_0 && y == height - 1 )
+    {
+      xs = typeIdx == SAO_TYPE_EO_135 ? ( isBelowAvail ? startX : width - 1 ) : ( isBelowLeftAvail ? 0 : 1 );
+      xe = typeIdx == SAO_TYPE_EO_135 ? ( isBelowRightAvail ? width : width - 1 ) : ( isBelowAvail ? endX : 1 );
+    }
+
+    if( xs >= xe )
+    {
+      continue;
+    }
+
+#if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
+    if( useHorVirBndry )
+    {
+      bool disabled = false;
+      for( int i = 0; i < numHorVirBndry; i++ )
+      {
+        disabled |= y == horVirBndryPos[i] || y == horVirBndryPos[i] - 1;
+      }
+      if( disabled )
+      {
+        continue;
+      }
+    }
+#endif
+
+    const Pel* srcLine = srcBlk + y * srcStride;
+          Pel* resLine = resBlk + y * resStride;
+
+#if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
+    // samples next to a vertical virtual boundary are left untouched
+    Pel keep[2 * 3];
+    if( useVerVirBndry )
+    {
+      for( int i = 0; i < numVerVirBndry; i++ )
+      {
+        keep[2 * i    ] = verVirBndryPos[i] - 1 >= xs && verVirBndryPos[i] - 1 < xe ? resLine[verVirBndryPos[i] - 1] : 0;
+        keep[2 * i + 1] = verVirBndryPos[i]     >= xs && verVirBndryPos[i]     < xe ? resLine[verVirBndryPos[i]    ] : 0;
+      }
+    }
+#endif
+
+    saoEdgeOffsetLine<vext>( srcLine, resLine, xs, xe, dA, dB, offset, clpRng );
+
+#if JVET_N0438_LOOP_FILTER_DISABLED_ACROSS_VIR_BOUND
+    if( useVerVirBndry )
+    {
+      for( int i = 0; i < numVerVirBndry; i++ )
+      {
+        if( verVirBndryPos[i] - 1 >= xs && verVirBndryPos[i] - 1 < xe ) resLine[verVirBndryPos[i] - 1] = keep[2 * i    ];
+        if( verVirBndryPos[i]     >= xs && verVirBndryPos[i]     < xe ) resLine[verVirBndryPos[i]    ] = keep[2 * i + 1];
+      }
+    }
+#endif
+  }
+}
+
+template <X86_VEXT vext>
+void SampleAdaptiveOffset::_initSampleAdaptiveOffsetX86()
+{
+  m_offsetBlock = simdOffsetBlock<vext>;
+}
+
+template void SampleAdaptiveOffset::_initSampleAdaptiveOffsetX86<SIMDX86>();
+
+#endif //#ifdef TARGET_SIMD_X86
+#endif
+//! \}
@@ -0,0 +1,593 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TrQuantX86.h
+    \brief    SIMD partial butterfly / matrix transforms (DCT-II, DST-VII, DCT-VIII)
+*/
+
+//! \ingroup CommonLib
+//! \{
+
+#include "CommonLib/CommonDef.h"
+#include "CommonDefX86.h"
+#include "CommonLib/Rom.h"
+#include "CommonLib/TrQuant.h"
+#include "CommonLib/TrQuant_EMT.h"
+
+#if ENABLE_SIMD_TRAFO
+#ifdef TARGET_SIMD_X86
+
+// The kernels process 4 (SSE) or 8 (AVX2) transform lines in parallel, one line per 32-bit lane,
+// so that the arithmetic of every lane is exactly the arithmetic of the scalar partial butterflies.
+// The forward transform reads rows of the residual block and transposes them on load, the inverse
+// transform reads coefficient columns directly and transposes the result on store.
+
+static inline __m128i trVecSet1 ( __m128i, int v )                  { return _mm_set1_epi32( v ); }
+static inline __m128i trVecZero ( __m128i )                         { return _mm_setzero_si128(); }
+static inline __m128i trVecAdd  ( __m128i a, __m128i b )            { return _mm_add_epi32( a, b ); }
+static inline __m128i trVecSub  ( __m128i a, __m128i b )            { return _mm_sub_epi32( a, b ); }
+static inline __m128i trVecMul  ( __m128i a, int c )                { return _mm_mullo_epi32( a, _mm_set1_epi32( c ) ); }
+static inline __m128i trVecMac  ( __m128i acc, __m128i a, int c )   { return _mm_add_epi32( acc, _mm_mullo_epi32( a, _mm_set1_epi32( c ) ) ); }
+static inline __m128i trVecShift( __m128i a, __m128i add, int s )   { return _mm_srai_epi32( _mm_add_epi32( a, add ), s ); }
+static inline __m128i trVecClip ( __m128i a, __m128i mn, __m128i mx ) { return _mm_min_epi32( _mm_max_epi32( a, mn ), mx ); }
+static inline __m128i trVecLoad ( __m128i, const TCoeff* p )        { return _mm_loadu_si128( ( const __m128i* ) p ); }
+static inline void    trVecStore( TCoeff* p, __m128i v )            { _mm_storeu_si128( ( __m128i* ) p, v ); }
+
+#ifdef USE_AVX2
+static inline __m256i trVecSet1 ( __m256i, int v )                  { return _mm256_set1_epi32( v ); }
+static inline __m256i trVecZero ( __m256i )                         { return _mm256_setzero_si256(); }
+static inline __m256i trVecAdd  ( __m256i a, __m256i b )            { return _mm256_add_epi32( a, b ); }
+static inline __m256i trVecSub  ( __m256i a, __m256i b )            { return _mm256_sub_epi32( a, b ); }
+static inline __m256i trVecMul  ( __m256i a, int c )                { return _mm256_mullo_epi32( a, _mm256_set1_epi32( c ) ); }
+static inline __m256i trVecMac  ( __m256i acc, __m256i a, int c )   { return _mm256_add_epi32( acc, _mm256_mullo_epi32( a, _mm256_set1_epi32( c ) ) ); }
+static inline __m256i trVecShift( __m256i a, __m256i add, int s )   { return _mm256_srai_epi32( _mm256_add_epi32( a, add ), s ); }
+static inline __m256i trVecClip ( __m256i a, __m256i mn, __m256i mx ) { return _mm256_min_epi32( _mm256_max_epi32( a, mn ), mx ); }
+static inline __m256i trVecLoad ( __m256i, const TCoeff* p )        { return _mm256_loadu_si256( ( const __m256i* ) p ); }
+static inline void    trVecStore( TCoeff* p, __m256i v )            { _mm256_storeu_si256( ( __m256i* ) p, v ); }
+#endif
+
+/** even/odd decomposition of the DCT-II, applied recursively
+ *  L     - number of input vectors at this decomposition level
+ *  fwd   - X holds L spatial vectors, the outputs are the rows jStart + t * jStep, t < L
+ *  inv   - C holds the coefficient rows k * kStep, the L outputs are written to Y
+ */
+template<typename V, int L>
+struct DCT2Butterfly
+{
+  static inline void fwd( const V* X, V* Y, const TMatrixCoeff* iT, const int trSize, const int jStart, const int jStep, const int cutoff )
+  {
+    V E[L >> 1], O[L >> 1];
+
+    for( int k = 0; k < ( L >> 1 ); k++ )
+    {
+      E[k] = trVecAdd( X[k], X[L - 1 - k] );
+      O[k] = trVecSub( X[k], X[L - 1 - k] );
+    }
+
+    for( int j = jStart + jStep; j < cutoff; j += 2 * jStep )
+    {
+      const TMatrixCoeff* c = iT + j * trSize;
+      V acc = trVecMul( O[0], c[0] );
+      for( int k = 1; k < ( L >> 1 ); k++ )
+      {
+        acc = trVecMac( acc, O[k], c[k] );
+      }
+      Y[j] = acc;
+    }
+
+    DCT2Butterfly<V, ( L >> 1 )>::fwd( E, Y, iT, trSize, jStart, 2 * jStep, cutoff );
+  }
+
+  static inline void inv( const V* C, V* Y, const TMatrixCoeff* iT, const int trSize, const int kStep, const int cutoff )
+  {
+    V E[L >> 1], O[L >> 1];
+
+    for( int j = 0; j < ( L >> 1 ); j++ )
+    {
+      V acc = trVecZero( O[j] );
+      for( int k = kStep; k < cutoff; k += 2 * kStep )
+      {
+        acc = trVecMac( acc, C[k], iT[k * trSize + j] );
+      }
+      O[j] = acc;
+    }
+
+    DCT2Butterfly<V, ( L >> 1 )>::inv( C, E, iT, trSize, 2 * kStep, cutoff );
+
+    for( int j = 0; j < ( L >> 1 ); j++ )
+    {
+      Y[j        ] = trVecAdd( E[j], O[j] );
+      Y[L - 1 - j] = trVecSub( E[j], O[j] );
+    }
+  }
+};
+
+template<typename V>
+struct DCT2Butterfly<V, 1>
+{
+  static inline void fwd( const V* X, V* Y, const TMatrixCoeff* iT, const int trSize, const int jStart, const int jStep, const int cutoff )
+  {
+    Y[jStart] = trVecMul( X[0], iT[jStart * trSize] );
+  }
+
+  static inline void inv( const V* C, V* Y, const TMatrixCoeff* iT, const int trSize, const int kStep, const int cutoff )
+  {
+    Y[0] = trVecMul( C[0], iT[0] );
+  }
+};
+
+template<typename V, int trType, int trSize>
+static inline void simdFwdCore( const V* X, V* Y, const TMatrixCoeff* iT, const int cutoff )
+{
+  if( trType == DCT2 )
+  {
+    DCT2Butterfly<V, trSize>::fwd( X, Y, iT, trSize, 0, 1, cutoff );
+  }
+  else
+  {
+    for( int j = 0; j < cutoff; j++ )
+    {
+      const TMatrixCoeff* c = iT + j * trSize;
+      V acc = trVecMul( X[0], c[0] );
+      for( int k = 1; k < trSize; k++ )
+      {
+        acc = trVecMac( acc, X[k], c[k] );
+      }
+      Y[j] = acc;
+    }
+  }
+}
+
+template<typename V, int trType, int trSize>
+static inline void simdInvCore( const V* C, V* Y, const TMatrixCoeff* iT, const int cutoff )
+{
+  if( trType == DCT2 )
+  {
+    DCT2Butterfly<V, trSize>::inv( C, Y, iT, trSize, 1, cutoff );
+  }
+  else
+  {
+    for( int j = 0; j < trSize; j++ )
+    {
+      V acc = trVecMul( C[0], iT[j] );
+      for( int k = 1; k < cutoff; k++ )
+      {
+        acc = trVecMac( acc, C[k], iT[k * trSize + j] );
+      }
+      Y[j] = acc;
+    }
+  }
+}
+
+static constexpr int simdTrSizeIdx( const int trSize )
+{
+  return trSize <= 2 ? 0 : 1 + simdTrSizeIdx( trSize >> 1 );
+}
+
+template<int trType, int trSize>
+static inline const TMatrixCoeff* simdTrMatrix( const int dir )
+{
+  if( trType == DCT2 )
+  {
+    switch( trSize )
+    {
+    case  2: return g_trCoreDCT2P2 [dir][0];
+    case  4: return g_trCoreDCT2P4 [dir][0];
+    case  8: return g_trCoreDCT2P8 [dir][0];
+    case 16: return g_trCoreDCT2P16[dir][0];
+    case 32: return g_trCoreDCT2P32[dir][0];
+    default: return g_trCoreDCT2P64[dir][0];
+    }
+  }
+  else if( trType == DCT8 )
+  {
+    switch( trSize )
+    {
+    case  4: return g_trCoreDCT8P4 [dir][0];
+    case  8: return g_trCoreDCT8P8 [dir][0];
+    case 16: return g_trCoreDCT8P16[dir][0];
+    default: return g_trCoreDCT8P32[dir][0];
+    }
+  }
+  else
+  {
+    switch( trSize )
+    {
+    case  4: return g_trCoreDST7P4 [dir][0];
+    case  8: return g_trCoreDST7P8 [dir][0];
+    case 16: return g_trCoreDST7P16[dir][0];
+    default: return g_trCoreDST7P32[dir][0];
+    }
+  }
+}
+
+template<X86_VEXT vext, int trType, int trSize>
+void fastForwardTrans_SIMD( const TCoeff *src, TCoeff *dst, int shift, int line, int iSkipLine, int iSkipLine2 )
+{
+  const int reducedLine = line - iSkipLine;
+
+  if( reducedLine < 4 || ( reducedLine & 3 ) )
+  {
+    fastFwdTrans[trType][simdTrSizeIdx( trSize )]( src, dst, shift, line, iSkipLine, iSkipLine2 );
+    return;
+  }
+
+  if( trType == DCT2 ? trSize != 64 : trSize == 4 )
+  {
+    iSkipLine2 = 0; // same as the scalar kernels, which do not apply the zero-out for these sizes
+  }
+
+  const int cutoff = trSize - iSkipLine2;
+
+  const TMatrixCoeff* iT = simdTrMatrix<trType, trSize>( TRANSFORM_FORWARD );
+  const int           add = ( shift > 0 ) ? ( 1 << ( shift - 1 ) ) : 0;
+
+  int i = 0;
+
+#ifdef USE_AVX2
+  if( vext >= AVX2 && trSize >= 8 )
+  {
+    const __m256i vadd = _mm256_set1_epi32( add );
+    __m256i X[trSize < 8 ? 8 : trSize], Y[trSize < 8 ? 8 : trSize];
+
+    for( ; i + 8 <= reducedLine; i += 8 )
+    {
+      for( int k = 0; k < trSize; k += 8 )
+      {
+        for( int l = 0; l < 8; l++ )
+        {
+          X[k + l] = _mm256_loadu_si256( ( const __m256i* ) &src[( i + l ) * trSize + k] );
+        }
+        TRANSPOSE8x8_32b_AVX2( &X[k] );
+      }
+
+      simdFwdCore<__m256i, trType, trSize>( X, Y, iT, cutoff );
+
+      for( int j = 0; j < cutoff; j++ )
+      {
+        trVecStore( &dst[j * line + i], trVecShift( Y[j], vadd, shift ) );
+      }
+    }
+  }
+#endif
+
+  if( i < reducedLine )
+  {
+    const __m128i vadd = _mm_set1_epi32( add );
+    __m128i X[trSize < 4 ? 4 : trSize], Y[trSize < 4 ? 4 : trSize];
+
+    for( ; i < reducedLine; i += 4 )
+    {
+      if( trSize == 2 )
+      {
+        const __m128i a = _mm_loadu_si128( ( const __m128i* ) &src[i * 2    ] );
+        const __m128i b = _mm_loadu_si128( ( const __m128i* ) &src[i * 2 + 4] );
+        X[0] = _mm_castps_si128( _mm_shuffle_ps( _mm_castsi128_ps( a ), _mm_castsi128_ps( b ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+        X[1] = _mm_castps_si128( _mm_shuffle_ps( _mm_castsi128_ps( a ), _mm_castsi128_ps( b ), _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+      }
+      else
+      {
+        for( int k = 0; k < trSize; k += 4 )
+        {
+          __m128i* T = &X[k];
+          for( int l = 0; l < 4; l++ )
+          {
+            T[l] = _mm_loadu_si128( ( const __m128i* ) &src[( i + l ) * trSize + k] );
+          }
+          TRANSPOSE4x4( T );
+        }
+      }
+
+      simdFwdCore<__m128i, trType, trSize>( X, Y, iT, cutoff );
+
+      for( int j = 0; j < cutoff; j++ )
+      {
+        trVecStore( &dst[j * line + i], trVecShift( Y[j], vadd, shift ) );
+      }
+    }
+  }
+
+  if( iSkipLine )
+  {
+    for( int j = 0; j < cutoff; j++ )
+    {
+      memset( dst + j * line + reducedLine, 0, sizeof( TCoeff ) * iSkipLine );
+    }
+  }
+
+  if( iSkipLine2 )
+  {
+    memset( dst + line * cutoff, 0, sizeof( TCoeff ) * line * iSkipLine2 );
+  }
+}
+
+template<X86_VEXT vext, int trType, int trSize>
+void fastInverseTrans_SIMD( const TCoeff *src, TCoeff *dst, int shift, int line, int iSkipLine, int iSkipLine2, const TCoeff outputMinimum, const TCoeff outputMaximum )
+{
+  const int reducedLine = line - iSkipLine;
+  const int cutoff      = trSize - iSkipLine2; // coefficients in the zero-out region are zero by construction
+
+  if( reducedLine < 4 || ( reducedLine & 3 ) )
+  {
+    fastInvTrans[trType][simdTrSizeIdx( trSize )]( src, dst, shift, line, iSkipLine, iSkipLine2, outputMinimum, outputMaximum );
+    return;
+  }
+
+  const TMatrixCoeff* iT = simdTrMatrix<trType, trSize>( TRANSFORM_INVERSE );
+  const int           add = ( shift > 0 ) ? ( 1 << ( shift - 1 ) ) : 0;
+
+  int i = 0;
+
+#ifdef USE_AVX2
+  if( vext >= AVX2 && trSize >= 8 )
+  {
+    const __m256i vadd = _mm256_set1_epi32( add );
+    const __m256i vmin = _mm256_set1_epi32( outputMinimum );
+    const __m256i vmax = _mm256_set1_epi32( outputMaximum );
+    __m256i C[trSize], Y[trSize < 8 ? 8 : trSize];
+
+    for( ; i + 8 <= reducedLine; i += 8 )
+    {
+      for( int k = 0; k < cutoff; k++ )
+      {
+        C[k] = _mm256_loadu_si256( ( const __m256i* ) &src[k * line + i] );
+      }
+
+      simdInvCore<__m256i, trType, trSize>( C, Y, iT, cutoff );
+
+      for( int j = 0; j < trSize; j += 8 )
+      {
+        __m256i* T = &Y[j];
+        for( int l = 0; l < 8; l++ )
+        {
+          T[l] = trVecClip( trVecShift( T[l], vadd, shift ), vmin, vmax );
+        }
+        TRANSPOSE8x8_32b_AVX2( T );
+        for( int l = 0; l < 8; l++ )
+        {
+          _mm256_storeu_si256( ( __m256i* ) &dst[( i + l ) * trSize + j], T[l] );
+        }
+      }
+    }
+  }
+#endif
+
+  if( i < reducedLine )
+  {
+    const __m128i vadd = _mm_set1_epi32( add );
+    const __m128i vmin = _mm_set1_epi32( outputMinimum );
+    const __m128i vmax = _mm_set1_epi32( outputMaximum );
+    __m128i C[trSize], Y[trSize < 4 ? 4 : trSize];
+
+    for( ; i < reducedLine; i += 4 )
+    {
+      for( int k = 0; k < cutoff; k++ )
+      {
+        C[k] = _mm_loadu_si128( ( const __m128i* ) &src[k * line + i] );
+      }
+
+      simdInvCore<__m128i, trType, trSize>( C, Y, iT, cutoff );
+
+      for( int j = 0; j < trSize; j++ )
+      {
+        Y[j] = trVecClip( trVecShift( Y[j], vadd, shift ), vmin, vmax );
+      }
+
+      if( trSize == 2 )
+      {
+        _mm_storeu_si128( ( __m128i* ) &dst[i * 2    ], _mm_unpacklo_epi32( Y[0], Y[1] ) );
+        _mm_storeu_si128( ( __m128i* ) &dst[i * 2 + 4], _mm_unpackhi_epi32( Y[0], Y[1] ) );
+      }
+      else
+      {
+        for( int j = 0; j < trSize; j += 4 )
+        {
+          __m128i* T = &Y[j];
+          TRANSPOSE4x4( T );
+          for( int l = 0; l < 4; l++ )
+          {
+            _mm_storeu_si128( ( __m128i* ) &dst[( i + l ) * trSize + j], T[l] );
+          }
+        }
+      }
+    }
+  }
+
+  if( iSkipLine )
+  {
+    memset( dst + reducedLine * trSize, 0, ( iSkipLine * trSize ) * sizeof( TCoeff ) );
+  }
+}
+
+#if JVET_N0193_LFNST
+// LFNST forward: every output is the dot product of the input vector with one basis vector. The input is kept
+// in registers, four outputs are reduced at once with horizontal adds.
+template<X86_VEXT vext>
+static void simdFwdLfnstCore( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize )
+{
+  const __m128i vadd = _mm_set1_epi32( 64 );
+  int j = 0;
+
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    __m256i vsrc[6];
+    for( int i = 0; i < trSize; i += 8 )
+    {
+      vsrc[i >> 3] = _mm256_loadu_si256( ( const __m256i* ) &src[i] );
+    }
+
+    for( ; j + 4 <= zeroOutSize; j += 4 )
+    {
+      __m128i vsum[4];
+      for( int k = 0; k < 4; k++, trMat += trSize )
+      {
+        __m256i vacc = _mm256_setzero_si256();
+        for( int i = 0; i < trSize; i += 8 )
+        {
+          const __m256i vmat = _mm256_cvtepi8_epi32( _mm_loadl_epi64( ( const __m128i* ) &trMat[i] ) );
+          vacc = _mm256_add_epi32( vacc, _mm256_mullo_epi32( vsrc[i >> 3], vmat ) );
+        }
+        vsum[k] = _mm_add_epi32( _mm256_castsi256_si128( vacc ), _mm256_extracti128_si256( vacc, 1 ) );
+      }
+      __m128i vres = _mm_hadd_epi32( _mm_hadd_epi32( vsum[0], vsum[1] ), _mm_hadd_epi32( vsum[2], vsum[3] ) );
+      _mm_storeu_si128( ( __m128i* ) &dst[j], _mm_srai_epi32( _mm_add_epi32( vres, vadd ), 7 ) );
+    }
+  }
+  else
+#endif
+  {
+    __m128i vsrc[12];
+    for( int i = 0; i < trSize; i += 4 )
+    {
+      vsrc[i >> 2] = _mm_loadu_si128( ( const __m128i* ) &src[i] );
+    }
+
+    for( ; j + 4 <= zeroOutSize; j += 4 )
+    {
+      __m128i vsum[4];
+      for( int k = 0; k < 4; k++, trMat += trSize )
+      {
+        __m128i vacc = _mm_setzero_si128();
+        for( int i = 0; i < trSize; i += 4 )
+        {
+          const __m128i vmat = _mm_cvtepi8_epi32( _mm_cvtsi32_si128( *( const int* ) &trMat[i] ) );
+          vacc = _mm_add_epi32( vacc, _mm_mullo_epi32( vsrc[i >> 2], vmat ) );
+        }
+        vsum[k] = vacc;
+      }
+      __m128i vres = _mm_hadd_epi32( _mm_hadd_epi32( vsum[0], vsum[1] ), _mm_hadd_epi32( vsum[2], vsum[3] ) );
+      _mm_storeu_si128( ( __m128i* ) &dst[j], _mm_srai_epi32( _mm_add_epi32( vres, vadd ), 7 ) );
+    }
+  }
+
+  if( j < zeroOutSize )
+  {
+    TrQuant::xFwdLfnstCore( src, dst + j, trMat, trSize, zeroOutSize - j );
+  }
+}
+
+// LFNST inverse: the outputs are processed in parallel, accumulating one scaled basis vector per input
+template<X86_VEXT vext>
+static void simdInvLfnstCore( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize )
+{
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i vadd = _mm256_set1_epi32( 64 );
+    const __m256i vmin = _mm256_set1_epi32( -( 1 << 15 ) );
+    const __m256i vmax = _mm256_set1_epi32( ( 1 << 15 ) - 1 );
+
+    for( int j = 0; j < trSize; j += 8 )
+    {
+      __m256i       vacc     = _mm256_setzero_si256();
+      const int8_t* trMatTmp = trMat + j;
+      for( int i = 0; i < zeroOutSize; i++, trMatTmp += trSize )
+      {
+        const __m256i vmat = _mm256_cvtepi8_epi32( _mm_loadl_epi64( ( const __m128i* ) trMatTmp ) );
+        vacc = _mm256_add_epi32( vacc, _mm256_mullo_epi32( _mm256_set1_epi32( src[i] ), vmat ) );
+      }
+      vacc = _mm256_srai_epi32( _mm256_add_epi32( vacc, vadd ), 7 );
+      _mm256_storeu_si256( ( __m256i* ) &dst[j], _mm256_min_epi32( _mm256_max_epi32( vacc, vmin ), vmax ) );
+    }
+    return;
+  }
+#endif
+
+  const __m128i vadd = _mm_set1_epi32( 64 );
+  const __m128i vmin = _mm_set1_epi32( -( 1 << 15 ) );
+  const __m128i vmax = _mm_set1_epi32( ( 1 << 15 ) - 1 );
+
+  for( int j = 0; j < trSize; j += 4 )
+  {
+    __m128i       vacc     = _mm_setzero_si128();
+    const int8_t* trMatTmp = trMat + j;
+    for( int i = 0; i < zeroOutSize; i++, trMatTmp += trSize )
+    {
+      const __m128i vmat = _mm_cvtepi8_epi32( _mm_cvtsi32_si128( *( const int* ) trMatTmp ) );
+      vacc = _mm_add_epi32( vacc, _mm_mullo_epi32( _mm_set1_epi32( src[i] ), vmat ) );
+    }
+    vacc = _mm_srai_epi32( _mm_add_epi32( vacc, vadd ), 7 );
+    _mm_storeu_si128( ( __m128i* ) &dst[j], _mm_min_epi32( _mm_max_epi32( vacc, vmin ), vmax ) );
+  }
+}
+#endif
+
+template<X86_VEXT vext>
+void TrQuant::_initTrQuantX86()
+{
+  m_fwdTrans[DCT2][0] = fastForwardTrans_SIMD<vext, DCT2,  2>;
+  m_fwdTrans[DCT2][1] = fastForwardTrans_SIMD<vext, DCT2,  4>;
+  m_fwdTrans[DCT2][2] = fastForwardTrans_SIMD<vext, DCT2,  8>;
+  m_fwdTrans[DCT2][3] = fastForwardTrans_SIMD<vext, DCT2, 16>;
+  m_fwdTrans[DCT2][4] = fastForwardTrans_SIMD<vext, DCT2, 32>;
+  m_fwdTrans[DCT2][5] = fastForwardTrans_SIMD<vext, DCT2, 64>;
+
+  m_fwdTrans[DCT8][1] = fastForwardTrans_SIMD<vext, DCT8,  4>;
+  m_fwdTrans[DCT8][2] = fastForwardTrans_SIMD<vext, DCT8,  8>;
+  m_fwdTrans[DCT8][3] = fastForwardTrans_SIMD<vext, DCT8, 16>;
+  m_fwdTrans[DCT8][4] = fastForwardTrans_SIMD<vext, DCT8, 32>;
+
+  m_fwdTrans[DST7][1] = fastForwardTrans_SIMD<vext, DST7,  4>;
+  m_fwdTrans[DST7][2] = fastForwardTrans_SIMD<vext, DST7,  8>;
+  m_fwdTrans[DST7][3] = fastForwardTrans_SIMD<vext, DST7, 16>;
+  m_fwdTrans[DST7][4] = fastForwardTrans_SIMD<vext, DST7, 32>;
+
+  m_invTrans[DCT2][0] = fastInverseTrans_SIMD<vext, DCT2,  2>;
+  m_invTrans[DCT2][1] = fastInverseTrans_SIMD<vext, DCT2,  4>;
+  m_invTrans[DCT2][2] = fastInverseTrans_SIMD<vext, DCT2,  8>;
+  m_invTrans[DCT2][3] = fastInverseTrans_SIMD<vext, DCT2, 16>;
+  m_invTrans[DCT2][4] = fastInverseTrans_SIMD<vext, DCT2, 32>;
+  m_invTrans[DCT2][5] = fastInverseTrans_SIMD<vext, DCT2, 64>;
+
+  m_invTrans[DCT8][1] = fastInverseTrans_SIMD<vext, DCT8,  4>;
+  m_invTrans[DCT8][2] = fastInverseTrans_SIMD<vext, DCT8,  8>;
+  m_invTrans[DCT8][3] = fastInverseTrans_SIMD<vext, DCT8, 16>;
+  m_invTrans[DCT8][4] = fastInverseTrans_SIMD<vext, DCT8, 32>;
+
+  m_invTrans[DST7][1] = fastInverseTrans_SIMD<vext, DST7,  4>;
+  m_invTrans[DST7][2] = fastInverseTrans_SIMD<vext, DST7,  8>;
+  m_invTrans[DST7][3] = fastInverseTrans_SIMD<vext, DST7, 16>;
+  m_invTrans[DST7][4] = fastInverseTrans_SIMD<vext, DST7, 32>;
+
+#if JVET_N0193_LFNST
+  m_fwdLfnstCore = simdFwdLfnstCore<vext>;
+  m_invLfnstCore = simdInvLfnstCore<vext>;
+#endif
+}
+
+template void TrQuant::_initTrQuantX86<SIMDX86>();
+
+#endif // TARGET_SIMD_X86
+#endif
+//! \}
@@ -0,0 +1 @@
+#include "../RdCostX86.h"
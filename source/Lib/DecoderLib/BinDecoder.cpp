@@ -55,6 +55,9 @@ BinDecoderBase::BinDecoderBase( const BinProbModel* dummy )
   , m_Range     ( 0 )
   , m_Value     ( 0 )
   , m_bitsNeeded( 0 )
+#if DECODER_STAGE_PROFILE
+  , m_profileCounters( StageProfile::getCounters() )
+#endif
 {}
 
 
@@ -116,6 +119,9 @@ unsigned BinDecoderBase::decodeBinEP()
   }
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::IncrementStatisticEP( *ptype, 1, int(bin) );
+#endif
+#if DECODER_STAGE_PROFILE
+  m_profileCounters[PROF_COUNT_BINS_EP] += 1;
 #endif
   DTRACE( g_trace_ctx, D_CABAC, "%d" "  " "%d" "  EP=%d \n",  DTRACE_GET_COUNTER( g_trace_ctx, D_CABAC ), m_Range, bin );
   return bin;
@@ -171,6 +177,9 @@ unsigned BinDecoderBase::decodeBinsEP( unsigned numBins )
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::IncrementStatisticEP( *ptype, numBins, int(bins) );
 #endif
+#if DECODER_STAGE_PROFILE
+  m_profileCounters[PROF_COUNT_BINS_EP] += numBins;
+#endif
 #if ENABLE_TRACING
   for( int i = 0; i < numBinsOrig; i++ )
   {
@@ -227,6 +236,9 @@ unsigned BinDecoderBase::decodeRemAbsEP( unsigned goRicePar, bool useLimitedPref
 
 unsigned BinDecoderBase::decodeBinTrm()
 {
+#if DECODER_STAGE_PROFILE
+  m_profileCounters[PROF_COUNT_BINS_TRM]++;
+#endif
   m_Range    -= 2;
   unsigned SR = m_Range << 7;
   if( m_Value >= SR )
@@ -310,6 +322,9 @@ unsigned BinDecoderBase::decodeAlignedBinsEP( unsigned numBins )
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::IncrementStatisticEP( *ptype, numBins, int(bins) );
 #endif
+#if DECODER_STAGE_PROFILE
+  m_profileCounters[PROF_COUNT_BINS_EP] += numBins;
+#endif
 #if ENABLE_TRACING
   for( int i = 0; i < numBinsOrig; i++ )
   {
@@ -332,6 +347,9 @@ TBinDecoder<BinProbModel>::TBinDecoder()
 template <class BinProbModel>
 unsigned TBinDecoder<BinProbModel>::decodeBin( unsigned ctxId )
 {
+#if DECODER_STAGE_PROFILE
+  m_profileCounters[PROF_COUNT_BINS_CTX]++;
+#endif
   BinProbModel& rcProbModel = m_Ctx[ctxId];
   unsigned      bin         = rcProbModel.mps();
   uint32_t      LPS         = rcProbModel.getLPS( m_Range );
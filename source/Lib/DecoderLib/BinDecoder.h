@@ -40,6 +40,7 @@
 
 #include "CommonLib/Contexts.h"
 #include "CommonLib/BitStream.h"
+#include "CommonLib/StageProfile.h"
 
 
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
@@ -86,6 +87,9 @@ protected:
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   const CodingStatisticsClassType* ptype;
 #endif
+#if DECODER_STAGE_PROFILE
+  uint64_t*         m_profileCounters;
+#endif
 };
 
 
@@ -0,0 +1,259 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     DecCtuRowFilter.cpp
+    \brief    CTU row pipeline of the decoder in-loop filters
+*/
+
+#include "DecCtuRowFilter.h"
+
+#include "CommonLib/UnitTools.h"
+#include "CommonLib/StageProfile.h"
+
+//! \ingroup DecoderLib
+//! \{
+
+// ====================================================================================================================
+// Constructor / init
+// ====================================================================================================================
+
+DecCtuRowFilter::DecCtuRowFilter()
+  : m_pcLoopFilter    ( nullptr )
+  , m_pcSAO           ( nullptr )
+  , m_pcALF           ( nullptr )
+  , m_pcReshaper      ( nullptr )
+  , m_pcPic           ( nullptr )
+  , m_numDecodedRows  ( 0 )
+  , m_numFilteredRows ( 0 )
+  , m_isFiltering     ( false )
+  , m_useReshaper     ( false )
+  , m_useALF          ( false )
+  , m_deblockRow      ( 0 )
+  , m_motionRow       ( 0 )
+  , m_saoRow          ( 0 )
+  , m_alfRow          ( 0 )
+{
+}
+
+void DecCtuRowFilter::init( LoopFilter* loopFilter, SampleAdaptiveOffset* sao, AdaptiveLoopFilter* alf, Reshape* reshaper )
+{
+  m_pcLoopFilter = loopFilter;
+  m_pcSAO        = sao;
+  m_pcALF        = alf;
+  m_pcReshaper   = reshaper;
+}
+
+// ====================================================================================================================
+// Public member functions
+// ====================================================================================================================
+
+bool DecCtuRowFilter::canFilterCtuRows( const Picture& pic )
+{
+#if JVET_N0415_CTB_ALF
+  const SPS& sps = *pic.cs->sps;
+  const PPS& pps = *pic.cs->pps;
+
+  // the PCM and lossless samples are restored after SAO for the whole picture
+  if( ( sps.getPCMEnabledFlag() && sps.getPCMFilterDisableFlag() ) || pps.getTransquantBypassEnabledFlag() )
+  {
+    return false;
+  }
+  // the wrap-around reference border is extended from the whole picture, IBC reads the unfiltered samples of the left CTU
+  if( sps.getWrapAroundEnabledFlag() || sps.getIBCFlag() )
+  {
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void DecCtuRowFilter::startPicture( Picture* pic )
+{
+  const CodingStructure& cs = *pic->cs;
+
+  m_pcPic           = pic;
+  m_rowNumCtus.assign( cs.pcv->heightInCtus, 0 );
+  m_numDecodedRows  = 0;
+  m_numFilteredRows = 0;
+  m_isFiltering     = false;
+  m_useReshaper     = cs.sps->getUseReshaper() && m_pcReshaper->getSliceReshaperInfo().getUseSliceReshaper();
+  m_useALF          = false;
+  m_deblockRow      = 0;
+  m_motionRow       = 0;
+  m_saoRow          = 0;
+  m_alfRow          = 0;
+
+  if( m_useReshaper )
+  {
+    CHECK( !m_pcReshaper->getRecReshaped(), "Rec picture is not reshaped!" );
+    m_pcSAO->setReshaper( m_pcReshaper );
+  }
+}
+
+void DecCtuRowFilter::finishPicture()
+{
+  // filter the remaining rows, also those a corrupt bitstream has not decoded
+  {
+    std::lock_guard<std::mutex> lock( m_rowMutex );
+    m_numDecodedRows = (int) m_rowNumCtus.size();
+    m_isFiltering    = true;
+  }
+  xFilterCtuRows();
+
+  CHECK( m_alfRow != (int) m_rowNumCtus.size(), "Not all CTU rows have been filtered" );
+  m_pcReshaper->setRecReshaped( false );
+  m_pcPic = nullptr;
+}
+
+void DecCtuRowFilter::ctuDecoded( const unsigned ctuRsAddr )
+{
+  if( !m_pcPic )
+  {
+    return;
+  }
+
+  const unsigned widthInCtus = m_pcPic->cs->pcv->widthInCtus;
+  {
+    std::lock_guard<std::mutex> lock( m_rowMutex );
+
+    m_rowNumCtus[ctuRsAddr / widthInCtus]++;
+    while( m_numDecodedRows < (int) m_rowNumCtus.size() && m_rowNumCtus[m_numDecodedRows] == widthInCtus )
+    {
+      m_numDecodedRows++;
+    }
+
+    // the thread that is running the filter stages picks up the new rows
+    if( m_isFiltering )
+    {
+      return;
+    }
+    m_isFiltering = true;
+  }
+
+  xFilterCtuRows();
+}
+
+// ====================================================================================================================
+// Private member functions
+// ====================================================================================================================
+
+void DecCtuRowFilter::xFilterCtuRows()
+{
+  std::unique_lock<std::mutex> lock( m_rowMutex );
+
+  while( m_numFilteredRows != m_numDecodedRows )
+  {
+    const int numDecodedRows = m_numDecodedRows;
+
+    lock.unlock();
+    xRunCtuRowStages( numDecodedRows );
+    lock.lock();
+
+    m_numFilteredRows = numDecodedRows;
+  }
+
+  m_isFiltering = false;
+}
+
+void DecCtuRowFilter::xRunCtuRowStages( const int numDecodedRows )
+{
+  CodingStructure&     cs      = *m_pcPic->cs;
+  const PreCalcValues& pcv     = *cs.pcv;
+  const int            numRows = (int) pcv.heightInCtus;
+
+  // inverse reshaping and deblocking, the intra prediction of the next row reads the unfiltered samples of the row
+  while( m_deblockRow < numRows && ( m_deblockRow + 1 < numDecodedRows || numDecodedRows == numRows ) )
+  {
+    if( m_useReshaper )
+    {
+      PROFILE_STAGE( PROF_STAGE_LMCS );
+      const CompArea rowArea = clipArea( CompArea( COMPONENT_Y, pcv.chrFormat, Area( 0, m_deblockRow * pcv.maxCUHeight, pcv.lumaWidth, pcv.maxCUHeight ) ), cs.area.Y() );
+      m_pcPic->getRecoBuf( rowArea ).rspSignal( m_pcReshaper->getInvLUT() );
+    }
+    {
+      PROFILE_STAGE( PROF_STAGE_DEBLOCK );
+      m_pcLoopFilter->loopFilterCtuRow( cs, m_deblockRow, EDGE_VER );
+      m_pcLoopFilter->loopFilterCtuRow( cs, m_deblockRow, EDGE_HOR );
+    }
+    m_deblockRow++;
+  }
+
+  // the deblocking of the top edges of the next row uses the unrefined motion
+  while( m_motionRow < m_deblockRow && ( m_motionRow + 1 < m_deblockRow || m_deblockRow == numRows ) )
+  {
+    CS::setRefinedMotionField( cs, m_motionRow );
+    m_motionRow++;
+  }
+
+  // SAO of a row reads the row below, which is final once the top edges of the row after it are deblocked
+  while( m_saoRow < m_deblockRow && ( m_saoRow + 2 < m_deblockRow || m_deblockRow == numRows ) )
+  {
+    if( cs.sps->getSAOEnabledFlag() )
+    {
+      PROFILE_STAGE( PROF_STAGE_SAO );
+      m_pcSAO->SAOProcessCtuRow( cs, m_pcPic->getSAO(), m_saoRow );
+    }
+    m_saoRow++;
+  }
+
+  // ALF reads the SAO output of the row below, a row is final once its samples and its motion are
+  while( m_alfRow < m_saoRow && ( m_alfRow + 1 < m_saoRow || m_saoRow == numRows ) && m_alfRow < m_motionRow )
+  {
+#if JVET_N0415_CTB_ALF
+    {
+      PROFILE_STAGE( PROF_STAGE_ALF );
+      if( m_alfRow == 0 )
+      {
+        m_useALF = cs.sps->getALFEnabledFlag() && cs.slice->getTileGroupAlfEnabledFlag( COMPONENT_Y ) && m_pcALF->ALFInitCtuRows( cs );
+      }
+      if( m_useALF )
+      {
+        m_pcALF->ALFProcessCtuRow( cs, m_alfRow );
+      }
+    }
+#endif
+    m_pcPic->extendPicBorderCtuRow( m_alfRow );
+    m_alfRow++;
+
+    // the rows are published to the pictures decoded in parallel
+    if( !m_pcPic->isCtuRowProgressFinished() )
+    {
+      m_pcPic->setCtuRowProgress( m_alfRow );
+    }
+  }
+}
+
+//! \}
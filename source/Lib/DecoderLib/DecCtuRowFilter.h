@@ -0,0 +1,106 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     DecCtuRowFilter.h
+    \brief    CTU row pipeline of the decoder in-loop filters (header)
+*/
+
+#ifndef __DECCTUROWFILTER__
+#define __DECCTUROWFILTER__
+
+#include "DecSlice.h"
+
+#include "CommonLib/CommonDef.h"
+#include "CommonLib/Picture.h"
+#include "CommonLib/LoopFilter.h"
+#include "CommonLib/SampleAdaptiveOffset.h"
+#include "CommonLib/AdaptiveLoopFilter.h"
+#include "CommonLib/Reshape.h"
+
+#include <vector>
+#include <mutex>
+
+//! \ingroup DecoderLib
+//! \{
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// applies the in-loop filters of a picture CTU row by CTU row while the picture is reconstructed
+/// the rows are filtered as soon as their neighbours allow it, by the thread that completes them
+class DecCtuRowFilter : public DecCtuObserver
+{
+private:
+  LoopFilter*                   m_pcLoopFilter;
+  SampleAdaptiveOffset*         m_pcSAO;
+  AdaptiveLoopFilter*           m_pcALF;
+  Reshape*                      m_pcReshaper;
+
+  Picture*                      m_pcPic;                ///< picture being filtered, nullptr if none
+  std::mutex                    m_rowMutex;
+  std::vector<unsigned>         m_rowNumCtus;           ///< number of decoded CTUs per CTU row
+  int                           m_numDecodedRows;       ///< number of leading CTU rows that are completely decoded
+  int                           m_numFilteredRows;      ///< number of decoded CTU rows the filter stages last ran for
+  bool                          m_isFiltering;          ///< a thread is running the filter stages
+  bool                          m_useReshaper;
+  bool                          m_useALF;
+  int                           m_deblockRow;           ///< next CTU row to be inverse reshaped and deblocked
+  int                           m_motionRow;            ///< next CTU row to get the DMVR refined motion field
+  int                           m_saoRow;               ///< next CTU row to be filtered by SAO
+  int                           m_alfRow;               ///< next CTU row to be filtered by ALF and extended
+
+public:
+  DecCtuRowFilter();
+  virtual ~DecCtuRowFilter() {}
+
+  void      init             ( LoopFilter* loopFilter, SampleAdaptiveOffset* sao, AdaptiveLoopFilter* alf, Reshape* reshaper );
+
+  static bool canFilterCtuRows( const Picture& pic );
+
+  void      startPicture     ( Picture* pic );
+  void      finishPicture    ();
+  void      resetPicture     ()                         { m_pcPic = nullptr; }   ///< stops without filtering the remaining rows
+  Picture*  getPicture       () const                   { return m_pcPic; }
+
+  virtual void ctuDecoded    ( const unsigned ctuRsAddr );
+
+private:
+  void      xFilterCtuRows   ();
+  void      xRunCtuRowStages ( const int numDecodedRows );
+};
+
+//! \}
+
+#endif // __DECCTUROWFILTER__
@@ -42,6 +42,7 @@
 #include "CommonLib/IntraPrediction.h"
 #include "CommonLib/Picture.h"
 #include "CommonLib/UnitTools.h"
+#include "CommonLib/StageProfile.h"
 
 #include "CommonLib/dtrace_buffer.h"
 
@@ -122,10 +123,11 @@ void DecCu::decompressCtu( CodingStructure& cs, const UnitArea& ctuArea )
         if ((currCU.shareParentPos.x >= 0) && (!(currCU.shareParentPos.x == prevTmpPos.x && currCU.shareParentPos.y == prevTmpPos.y)))
         {
           m_shareStateDec = GEN_ON_SHARED_BOUND;
+          LutMotionCand &motionLut = cs.getMotionLut( currCU );
 #if !JVET_N0266_SMALL_BLOCKS
-          cs.motionLut.lutShare = cs.motionLut.lut;
+          motionLut.lutShare = motionLut.lut;
 #endif
-          cs.motionLut.lutShareIbc = cs.motionLut.lutIbc;
+          motionLut.lutShareIbc = motionLut.lutIbc;
         }
 
         if (currCU.shareParentPos.x < 0)
@@ -134,6 +136,10 @@ void DecCu::decompressCtu( CodingStructure& cs, const UnitArea& ctuArea )
         }
         prevTmpPos = currCU.shareParentPos;
       }
+#if DECODER_STAGE_PROFILE
+      StageProfile::countCU( currCU );
+#endif
+      PROFILE_STAGE( currCU.predMode == MODE_INTRA ? PROF_STAGE_INTRA : PROF_STAGE_INTER );
       if (currCU.predMode != MODE_INTRA && currCU.Y().valid())
       {
         xDeriveCUMV(currCU);
@@ -249,6 +255,7 @@ void DecCu::xIntraRecBlk( TransformUnit& tu, const ComponentID compID )
 #endif
   if( TU::getCbf( tu, compID ) )
   {
+    PROFILE_STAGE( PROF_STAGE_INV_TRANSFORM );
     m_pcTrQuant->invTransformNxN( tu, compID, piResi, cQP );
   }
   else
@@ -490,7 +497,8 @@ void DecCu::xReconInter(CodingUnit &cu)
     {
       MotionInfo mi = pu.getMotionInfo();
       mi.GBiIdx = (mi.interDir == 3) ? cu.GBiIdx : GBI_DEFAULT;
-      cu.cs->addMiToLut(CU::isIBC(cu) ? cu.cs->motionLut.lutIbc : cu.cs->motionLut.lut, mi );
+      LutMotionCand &motionLut = cu.cs->getMotionLut( cu );
+      cu.cs->addMiToLut(CU::isIBC(cu) ? motionLut.lutIbc : motionLut.lut, mi );
     }
   }
 
@@ -502,7 +510,7 @@ void DecCu::xReconInter(CodingUnit &cu)
     if (cu.cs->slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag())
 #endif
     {
-      cu.cs->getPredBuf(*cu.firstPU).Y().rspSignal(m_pcReshape->getFwdLUT());
+      cu.cs->getPredBuf(*cu.firstPU).Y().rspSignal(m_pcReshape->getFwdPWL());
     }
     m_pcIntraPred->geneWeightedPred(COMPONENT_Y, cu.cs->getPredBuf(*cu.firstPU).Y(), *cu.firstPU, m_pcIntraPred->getPredictorPtr2(COMPONENT_Y, 0));
     m_pcIntraPred->geneWeightedPred(COMPONENT_Cb, cu.cs->getPredBuf(*cu.firstPU).Cb(), *cu.firstPU, m_pcIntraPred->getPredictorPtr2(COMPONENT_Cb, 0));
@@ -539,7 +547,7 @@ void DecCu::xReconInter(CodingUnit &cu)
       }
 #endif
       if (!cu.firstPU->mhIntraFlag && !CU::isIBC(cu))
-        cs.getPredBuf(cu).get(COMPONENT_Y).rspSignal(m_pcReshape->getFwdLUT());
+        cs.getPredBuf(cu).get(COMPONENT_Y).rspSignal(m_pcReshape->getFwdPWL());
     }
 #if KEEP_PRED_AND_RESI_SIGNALS
     cs.getRecoBuf( cu ).reconstruct( cs.getPredBuf( cu ), cs.getResiBuf( cu ), cs.slice->clpRngs() );
@@ -570,7 +578,7 @@ void DecCu::xReconInter(CodingUnit &cu)
     if (cs.slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag() && !cu.firstPU->mhIntraFlag && !CU::isIBC(cu))
 #endif
     {
-      cs.getRecoBuf(cu).get(COMPONENT_Y).rspSignal(m_pcReshape->getFwdLUT());
+      cs.getRecoBuf(cu).get(COMPONENT_Y).rspSignal(m_pcReshape->getFwdPWL());
     }
   }
 
@@ -601,6 +609,7 @@ void DecCu::xDecodeInterTU( TransformUnit & currTU, const ComponentID compID )
 #endif
   if( TU::getCbf( currTU, compID ) )
   {
+    PROFILE_STAGE( PROF_STAGE_INV_TRANSFORM );
     m_pcTrQuant->invTransformNxN( currTU, compID, resiBuf, cQP );
   }
   else
@@ -660,7 +669,7 @@ void DecCu::xDecodeInterTexture(CodingUnit &cu)
         PelBuf tmpPred = m_tmpStorageLCU->getBuf(tmpArea);
         tmpPred.copyFrom(predY);
       if (!cu.firstPU->mhIntraFlag && !CU::isIBC(cu))
-          tmpPred.rspSignal(m_pcReshape->getFwdLUT());
+          tmpPred.rspSignal(m_pcReshape->getFwdPWL());
         const Pel avgLuma = tmpPred.computeAvg();
         int adj = m_pcReshape->calculateChromaAdj(avgLuma);
         currTU.setChromaAdj(adj);
@@ -42,6 +42,7 @@
 #include "CommonLib/dtrace_buffer.h"
 #include "CommonLib/Buffer.h"
 #include "CommonLib/UnitTools.h"
+#include "CommonLib/StageProfile.h"
 
 #include <fstream>
 #include <stdio.h>
@@ -420,10 +421,17 @@ DecLib::DecLib()
   , m_prefixSEINALUs()
   , m_debugPOC( -1 )
   , m_debugCTU( -1 )
+  , m_numFrameThreads( 1 )
+  , m_nextFrameDecoder( 0 )
 {
 #if ENABLE_SIMD_OPT_BUFFER
+#ifdef TARGET_SIMD_X86
   g_pelBufOP.initPelBufOpsX86();
 #endif
+#ifdef TARGET_SIMD_VEC
+  g_pelBufOP.initPelBufOpsVec();
+#endif
+#endif
 }
 
 DecLib::~DecLib()
@@ -447,6 +455,13 @@ void DecLib::destroy()
   m_apcSlicePilot = NULL;
 
   m_cSliceDecoder.destroy();
+
+  for( auto frameDecoder : m_frameDecoders )
+  {
+    frameDecoder->destroy();
+    delete frameDecoder;
+  }
+  m_frameDecoders.clear();
 }
 
 void DecLib::init(
@@ -456,6 +471,8 @@ void DecLib::init(
 )
 {
   m_cSliceDecoder.init( &m_CABACDecoder, &m_cCuDecoder );
+  m_cSliceDecoder.setCtuObserver( &m_cCtuRowFilter );
+  m_cCtuRowFilter.init( &m_cLoopFilter, &m_cSAO, &m_cALF, &m_cReshaper );
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   m_cacheModel.create( cacheCfgFileName );
   m_cacheModel.clear( );
@@ -466,6 +483,8 @@ void DecLib::init(
 
 void DecLib::deletePicBuffer ( )
 {
+  waitForFrameJobs();
+
   PicList::iterator  iterPic   = m_cListPic.begin();
   int iSize = int( m_cListPic.size() );
 
@@ -497,6 +516,7 @@ Picture* DecLib::xGetNewPicBuffer ( const SPS &sps, const PPS &pps, const uint32
     pcPic = new Picture();
 
     pcPic->create( sps.getChromaFormatIdc(), Size( sps.getPicWidthInLumaSamples(), sps.getPicHeightInLumaSamples() ), sps.getMaxCUWidth(), sps.getMaxCUWidth() + 16, true );
+    pcPic->setBorderExtension( m_numFrameThreads > 1 );
 
     m_cListPic.push_back( pcPic );
 
@@ -507,6 +527,10 @@ Picture* DecLib::xGetNewPicBuffer ( const SPS &sps, const PPS &pps, const uint32
   for(auto * p: m_cListPic)
   {
     pcPic = p;  // workaround because range-based for-loops don't work with existing variables
+    if( xIsPictureInFlight( pcPic ) )
+    {
+      continue;
+    }
     if ( pcPic->reconstructed == false && ! pcPic->neededForOutput )
     {
       pcPic->neededForOutput = false;
@@ -543,7 +567,7 @@ Picture* DecLib::xGetNewPicBuffer ( const SPS &sps, const PPS &pps, const uint32
     }
   }
 
-  pcPic->setBorderExtension( false );
+  pcPic->setBorderExtension( m_numFrameThreads > 1 );   // the frame decoders extend the borders of their pictures
   pcPic->neededForOutput = false;
   pcPic->reconstructed = false;
 
@@ -553,52 +577,33 @@ Picture* DecLib::xGetNewPicBuffer ( const SPS &sps, const PPS &pps, const uint32
 
 void DecLib::executeLoopFilters()
 {
-  if( !m_pcPic )
+  if( !m_pcPic || m_numFrameThreads > 1 )
   {
-    return; // nothing to deblock
+    return; // nothing to deblock, or the frame decoder applies the loop filters
   }
 
-  m_pcPic->cs->slice->startProcessingTimer();
-
-  CodingStructure& cs = *m_pcPic->cs;
-
-  if (cs.sps->getUseReshaper() && m_cReshaper.getSliceReshaperInfo().getUseSliceReshaper())
+  if( m_cCtuRowFilter.getPicture() == m_pcPic )
   {
-      CHECK((m_cReshaper.getRecReshaped() == false), "Rec picture is not reshaped!");
-      m_pcPic->getRecoBuf(COMPONENT_Y).rspSignal(m_cReshaper.getInvLUT());
-      m_cReshaper.setRecReshaped(false);
-      m_cSAO.setReshaper(&m_cReshaper);
-  }
-  // deblocking filter
-  m_cLoopFilter.loopFilterPic( cs );
-  CS::setRefinedMotionField(cs);
-  if( cs.sps->getSAOEnabledFlag() )
-  {
-    m_cSAO.SAOProcess( cs, cs.picture->getSAO() );
+    // most rows have been filtered and extended while the picture was reconstructed
+    m_pcPic->cs->slice->startProcessingTimer();
+    m_cCtuRowFilter.finishPicture();
+    m_pcPic->setBorderExtension( true );
+    m_pcPic->cs->slice->stopProcessingTimer();
+    return;
   }
 
-  if( cs.sps->getALFEnabledFlag() )
-  {
-#if JVET_N0415_CTB_ALF
-    if (cs.slice->getTileGroupAlfEnabledFlag(COMPONENT_Y))
-#else
-    if (cs.slice->getTileGroupAlfEnabledFlag())
-#endif
-    {
-      // ALF decodes the differentially coded coefficients and stores them in the parameters structure.
-      // Code could be restructured to do directly after parsing. So far we just pass a fresh non-const
-      // copy in case the APS gets used more than once.
-#if JVET_N0415_CTB_ALF
-      m_cALF.ALFProcess(cs);
-#else
-      AlfSliceParam alfParamCopy = cs.aps->getAlfAPSParam();
-      m_cALF.ALFProcess(cs, alfParamCopy);
-#endif
-    }
-
-  }
+  applyLoopFilters( *m_pcPic, m_cReshaper, m_cLoopFilter, m_cSAO, m_cALF );
+}
 
-  m_pcPic->cs->slice->stopProcessingTimer();
+bool DecLib::xCanFilterCtuRows( const Slice& slice ) const
+{
+  // the slice covers the picture, so its filter parameters apply to all CTU rows
+  return slice.getSliceCurStartCtuTsAddr() == 0 && slice.getSliceCurEndCtuTsAddr() == m_pcPic->cs->pcv->sizeInCtus
+      && ( m_pcPic->poc != getDebugPOC() || getDebugCTU() < 0 )
+#if ENABLE_TRACING
+      && !g_trace_ctx                                                   // the filter traces follow the CTU traces of the picture
+#endif
+      && DecCtuRowFilter::canFilterCtuRows( *m_pcPic );
 }
 
 void DecLib::finishPictureLight(int& poc, PicList*& rpcListPic )
@@ -615,6 +620,9 @@ void DecLib::finishPictureLight(int& poc, PicList*& rpcListPic )
 
 void DecLib::finishPicture(int& poc, PicList*& rpcListPic, MsgLevel msgl )
 {
+#if DECODER_STAGE_PROFILE
+  StageProfile::finishPicture();
+#endif
 #if RExt__DECODER_DEBUG_TOOL_STATISTICS
   CodingStatistics::StatTool& s = CodingStatistics::GetStatisticTool( STATS__TOOL_TOTAL_FRAME );
   s.count++;
@@ -623,8 +631,38 @@ void DecLib::finishPicture(int& poc, PicList*& rpcListPic, MsgLevel msgl )
 
   Slice*  pcSlice = m_pcPic->cs->slice;
 
+  if( m_numFrameThreads <= 1 )
+  {
+    xPrintPictureInfo( m_pcPic, m_pcPic->referenced, msgl );
+  }
+
+  m_pcPic->neededForOutput = (pcSlice->getPicOutputFlag() ? true : false);
+  m_pcPic->reconstructed = true;
+
+
+  Slice::sortPicList( m_cListPic ); // sorting for application output
+  poc                 = pcSlice->getPOC();
+  rpcListPic          = &m_cListPic;
+  m_bFirstSliceInPicture  = true; // TODO: immer true? hier ist irgendwas faul
+
+  if( m_numFrameThreads > 1 )
+  {
+    // the picture is reconstructed in the background, the application waits for it before the output
+    xStartFrameJob( msgl );
+    return;
+  }
+
+  m_pcPic->destroyTempBuffers();
+  m_pcPic->cs->destroyCoeffs();
+  m_pcPic->cs->releaseIntermediateData();
+}
+
+void DecLib::xPrintPictureInfo( Picture* pic, bool isReferenced, MsgLevel msgl )
+{
+  Slice*  pcSlice = pic->cs->slice;
+
   char c = (pcSlice->isIntra() ? 'I' : pcSlice->isInterP() ? 'P' : 'B');
-  if (!m_pcPic->referenced)
+  if (!isReferenced)
   {
     c += 32;  // tolower
   }
@@ -647,29 +685,96 @@ void DecLib::finishPicture(int& poc, PicList*& rpcListPic, MsgLevel msgl )
   }
   if (m_decodedPictureHashSEIEnabled)
   {
-    SEIMessages pictureHashes = getSeisByType(m_pcPic->SEIs, SEI::DECODED_PICTURE_HASH );
+    SEIMessages pictureHashes = getSeisByType(pic->SEIs, SEI::DECODED_PICTURE_HASH );
     const SEIDecodedPictureHash *hash = ( pictureHashes.size() > 0 ) ? (SEIDecodedPictureHash*) *(pictureHashes.begin()) : NULL;
     if (pictureHashes.size() > 1)
     {
       msg( WARNING, "Warning: Got multiple decoded picture hash SEI messages. Using first.");
     }
-    m_numberOfChecksumErrorsDetected += calcAndPrintHashStatus(((const Picture*) m_pcPic)->getRecoBuf(), hash, pcSlice->getSPS()->getBitDepths(), msgl);
+    m_numberOfChecksumErrorsDetected += calcAndPrintHashStatus(((const Picture*) pic)->getRecoBuf(), hash, pcSlice->getSPS()->getBitDepths(), msgl);
   }
 
   msg( msgl, "\n");
+}
 
-  m_pcPic->neededForOutput = (pcSlice->getPicOutputFlag() ? true : false);
-  m_pcPic->reconstructed = true;
+void DecLib::xStartFrameJob( MsgLevel msgl )
+{
+  if( m_sliceBitstreams.empty() )
+  {
+    return; // the picture has already been handed over to a frame decoder
+  }
+
+  if( m_frameDecoders.empty() )
+  {
+    for( int i = 0; i < m_numFrameThreads; i++ )
+    {
+      m_frameDecoders.push_back( new DecLibRecon );
+      m_frameDecoders.back()->create( m_cSliceDecoder.getNumWppThreads(), m_cSliceDecoder.getNumBrickThreads(), m_cSliceDecoder.getNumReconThreads() );
+    }
+  }
 
+  // retire the jobs in decoding order, the oldest one has to finish if all frame decoders are busy
+  while( !m_frameJobs.empty() && m_frameJobs.front().decoder->getPicture()->isCtuRowProgressFinished() )
+  {
+    xFinishFrameJob();
+  }
+  if( m_frameJobs.size() == m_frameDecoders.size() )
+  {
+    xFinishFrameJob();
+  }
 
-  Slice::sortPicList( m_cListPic ); // sorting for application output
-  poc                 = pcSlice->getPOC();
-  rpcListPic          = &m_cListPic;
-  m_bFirstSliceInPicture  = true; // TODO: immer true? hier ist irgendwas faul
+  // the frame decoders are used round robin, so the next one is the one of the oldest retired job
+  DecLibRecon* frameDecoder = m_frameDecoders[m_nextFrameDecoder];
+  m_nextFrameDecoder = ( m_nextFrameDecoder + 1 ) % m_frameDecoders.size();
 
-  m_pcPic->destroyTempBuffers();
-  m_pcPic->cs->destroyCoeffs();
-  m_pcPic->cs->releaseIntermediateData();
+  frameDecoder->startPicture( m_pcPic, m_sliceBitstreams );
+  m_frameJobs.push_back( FrameJob{ frameDecoder, m_pcPic->referenced, msgl } );
+}
+
+void DecLib::xFinishFrameJob()
+{
+  const FrameJob job = m_frameJobs.front();
+  m_frameJobs.pop_front();
+
+  Picture* pic = job.decoder->finishPicture();
+
+  xPrintPictureInfo( pic, job.isReferenced, job.msgl );
+
+  pic->destroyTempBuffers();
+  pic->cs->destroyCoeffs();
+  pic->cs->releaseIntermediateData();
+}
+
+void DecLib::waitForFrameJobs()
+{
+  while( !m_frameJobs.empty() )
+  {
+    xFinishFrameJob();
+  }
+}
+
+bool DecLib::xIsPictureInFlight( const Picture* pic ) const
+{
+  for( const FrameJob& job : m_frameJobs )
+  {
+    if( job.decoder->isUsingPicture( pic ) )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool DecLib::xIsAPSInFlight( const APS* aps ) const
+{
+  for( const FrameJob& job : m_frameJobs )
+  {
+    if( job.decoder->isUsingAPS( aps ) )
+    {
+      return true;
+    }
+  }
+  return false;
 }
 
 void DecLib::checkNoOutputPriorPics (PicList* pcListPic)
@@ -708,6 +813,7 @@ void DecLib::xUpdateRasInit(Slice* slice)
 void DecLib::xCreateLostPicture(int iLostPoc)
 {
   msg( INFO, "\ninserting lost poc : %d\n",iLostPoc);
+  waitForFrameJobs();
   Picture *cFillPic = xGetNewPicBuffer(*(m_parameterSetManager.getFirstSPS()), *(m_parameterSetManager.getFirstPPS()), 0);
 
   CHECK( !cFillPic->slices.size(), "No slices in picture" );
@@ -732,6 +838,10 @@ void DecLib::xCreateLostPicture(int iLostPoc)
     {
       msg( INFO, "copying picture %d to %d (%d)\n",rpcPic->getPOC() ,iLostPoc,m_apcSlicePilot->getPOC());
       cFillPic->getRecoBuf().copyFrom( rpcPic->getRecoBuf() );
+      if( m_numFrameThreads > 1 )
+      {
+        cFillPic->extendPicBorder( true );
+      }
       break;
     }
   }
@@ -982,6 +1092,7 @@ void DecLib::xActivateParameterSets()
     // RdCost
     m_cRdCost.setCostMode ( COST_STANDARD_LOSSY ); // not used in decoder side RdCost stuff -> set to default
 
+    m_cSliceDecoder.initThreadDecoders( *sps, &m_cTrQuant, &m_cReshaper );
     m_cSliceDecoder.create();
 
     if( sps->getALFEnabledFlag() )
@@ -1317,6 +1428,12 @@ bool DecLib::xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDispl
   m_pcPic->layer       = pcSlice->getTLayer();
   m_pcPic->referenced  = true;
   m_pcPic->layer       = nalu.m_temporalId;
+#if DECODER_STAGE_PROFILE
+  if( m_bFirstSliceInPicture )
+  {
+    StageProfile::startPicture( pcSlice->getPOC(), nalu.m_temporalId, m_pcPic->Y().area() );
+  }
+#endif
 
   // When decoding the slice header, the stored start and end addresses were actually RS addresses, not TS addresses.
   // Now, having set up the maps, convert them to the correct form.
@@ -1337,19 +1454,19 @@ bool DecLib::xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDispl
   const uint32_t numberOfCtusInFrame = m_pcPic->cs->pcv->sizeInCtus;
 
   uint32_t startCtuIdx = 0;
-  while (pcSlice->getSliceCurStartBrickIdx() != tileMap.getBrickIdxBsMap(startCtuIdx) && startCtuIdx < numberOfCtusInFrame)
+  while (startCtuIdx < numberOfCtusInFrame && pcSlice->getSliceCurStartBrickIdx() != tileMap.getBrickIdxBsMap(startCtuIdx))
   {
     startCtuIdx++;
   }
   uint32_t endCtuIdx = startCtuIdx;
-  while (pcSlice->getSliceCurEndBrickIdx() != tileMap.getBrickIdxBsMap(endCtuIdx) && endCtuIdx < numberOfCtusInFrame)
+  while (endCtuIdx < numberOfCtusInFrame && pcSlice->getSliceCurEndBrickIdx() != tileMap.getBrickIdxBsMap(endCtuIdx))
   {
     endCtuIdx++;
   }
   if (endCtuIdx == numberOfCtusInFrame)
     EXIT("Cannot find the last CTU index of the current slice");
 
-  while (pcSlice->getSliceCurEndBrickIdx() == tileMap.getBrickIdxBsMap(endCtuIdx) && endCtuIdx < numberOfCtusInFrame)
+  while (endCtuIdx < numberOfCtusInFrame && pcSlice->getSliceCurEndBrickIdx() == tileMap.getBrickIdxBsMap(endCtuIdx))
   {
     endCtuIdx++;
   }
@@ -1484,100 +1601,32 @@ bool DecLib::xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDispl
     pcSlice->setRefPOCList();
 
 
-#if HEVC_USE_SCALING_LISTS
-  Quant *quant = m_cTrQuant.getQuant();
-
-  if(pcSlice->getSPS()->getScalingListFlag())
+  //  Decode a picture
+  if( m_numFrameThreads > 1 )
   {
-    ScalingList scalingList;
-    if(pcSlice->getPPS()->getScalingListPresentFlag())
-    {
-      scalingList = pcSlice->getPPS()->getScalingList();
-    }
-    else if (pcSlice->getSPS()->getScalingListPresentFlag())
-    {
-      scalingList = pcSlice->getSPS()->getScalingList();
-    }
-    else
-    {
-      scalingList.setDefaultScalingList();
-    }
-    quant->setScalingListDec(scalingList);
-    quant->setUseScalingList(true);
+    // the slice is reconstructed by a frame decoder once all slices of the picture are parsed
+    m_sliceBitstreams.push_back( new InputBitstream( nalu.getBitstream() ) );
   }
   else
   {
-    quant->setUseScalingList(false);
-  }
-#endif
-
+    initSliceScalingList( *pcSlice, m_cTrQuant, m_cSliceDecoder );
+    initSliceReshaper( *pcSlice, m_cReshaper );
 
-  if (pcSlice->getSPS()->getUseReshaper())
-  {
-#if JVET_N0805_APS_LMCS
-    if (pcSlice->getLmcsEnabledFlag())
+    if( !m_bFirstSliceInPicture )
     {
-      APS* lmcsAPS = pcSlice->getLmcsAPS();
-      SliceReshapeInfo& sInfo = lmcsAPS->getReshaperAPSInfo();
-      SliceReshapeInfo& tInfo = m_cReshaper.getSliceReshaperInfo();
-      tInfo.reshaperModelMaxBinIdx = sInfo.reshaperModelMaxBinIdx;
-      tInfo.reshaperModelMinBinIdx = sInfo.reshaperModelMinBinIdx;
-      memcpy(tInfo.reshaperModelBinCWDelta, sInfo.reshaperModelBinCWDelta, sizeof(int)*(PIC_CODE_CW_BINS));
-      tInfo.maxNbitsNeededDeltaCW = sInfo.maxNbitsNeededDeltaCW;
-      tInfo.setUseSliceReshaper(pcSlice->getLmcsEnabledFlag());
-      tInfo.setSliceReshapeChromaAdj(pcSlice->getLmcsChromaResidualScaleFlag());
-      tInfo.setSliceReshapeModelPresentFlag(true);
+      CHECK( m_cCtuRowFilter.getPicture(), "A picture filtered by CTU rows has more than one slice" );
     }
-    else
+    else if( xCanFilterCtuRows( *pcSlice ) )
     {
-      SliceReshapeInfo& tInfo = m_cReshaper.getSliceReshaperInfo();
-      tInfo.setUseSliceReshaper(false);
-      tInfo.setSliceReshapeChromaAdj(false);
-      tInfo.setSliceReshapeModelPresentFlag(false);
-    }
-#endif
-#if !JVET_N0805_APS_LMCS
-    m_cReshaper.copySliceReshaperInfo(m_cReshaper.getSliceReshaperInfo(), pcSlice->getReshapeInfo());
-#endif
-#if JVET_N0805_APS_LMCS
-    if (pcSlice->getLmcsEnabledFlag())
-#else
-    if (pcSlice->getReshapeInfo().getSliceReshapeModelPresentFlag())
-#endif
-    {
-      m_cReshaper.constructReshaper();
+      m_cCtuRowFilter.startPicture( m_pcPic );
     }
     else
     {
-      m_cReshaper.setReshapeFlag(false);
-    }
-    if ((pcSlice->getSliceType() == I_SLICE) && m_cReshaper.getSliceReshaperInfo().getUseSliceReshaper())
-    {
-      m_cReshaper.setCTUFlag(false);
-      m_cReshaper.setRecReshaped(true);
-    }
-    else
-    {
-      if (m_cReshaper.getSliceReshaperInfo().getUseSliceReshaper())
-      {
-        m_cReshaper.setCTUFlag(true);
-        m_cReshaper.setRecReshaped(true);
-      }
-      else
-      {
-        m_cReshaper.setCTUFlag(false);
-        m_cReshaper.setRecReshaped(false);
-      }
+      m_cCtuRowFilter.resetPicture();
     }
-  }
-  else
-  {
-    m_cReshaper.setCTUFlag(false);
-    m_cReshaper.setRecReshaped(false);
-  }
 
-  //  Decode a picture
-  m_cSliceDecoder.decompressSlice( pcSlice, &( nalu.getBitstream() ), ( m_pcPic->poc == getDebugPOC() ? getDebugCTU() : -1 ) );
+    m_cSliceDecoder.decompressSlice( pcSlice, &( nalu.getBitstream() ), ( m_pcPic->poc == getDebugPOC() ? getDebugCTU() : -1 ) );
+  }
 
   m_bFirstSliceInPicture = false;
   m_uiSliceSegmentIdx++;
@@ -1612,6 +1661,10 @@ void DecLib::xDecodeSPS( InputNALUnit& nalu )
   SPS* sps = new SPS();
   m_HLSReader.setBitstream( &nalu.getBitstream() );
   m_HLSReader.parseSPS( sps );
+  if( m_numFrameThreads > 1 && m_parameterSetManager.isSPSReplacedBy( sps->getSPSId(), nalu.getBitstream().getFifo() ) )
+  {
+    waitForFrameJobs(); // the replaced SPS is deleted, the pictures in reconstruction may still use it
+  }
   m_parameterSetManager.storeSPS( sps, nalu.getBitstream().getFifo() );
 
   DTRACE( g_trace_ctx, D_QP_PER_CTU, "CTU Size: %dx%d", sps->getMaxCUWidth(), sps->getMaxCUHeight() );
@@ -1626,6 +1679,10 @@ void DecLib::xDecodePPS( InputNALUnit& nalu )
 #else
   m_HLSReader.parsePPS( pps );
 #endif
+  if( m_numFrameThreads > 1 && m_parameterSetManager.isPPSReplacedBy( pps->getPPSId(), nalu.getBitstream().getFifo() ) )
+  {
+    waitForFrameJobs(); // the replaced PPS is deleted, the pictures in reconstruction may still use it
+  }
   m_parameterSetManager.storePPS( pps, nalu.getBitstream().getFifo() );
 }
 
@@ -1637,6 +1694,16 @@ void DecLib::xDecodeAPS(InputNALUnit& nalu)
 #if JVET_N0415_CTB_ALF
   aps->setTemporalId(nalu.m_temporalId);
 #endif
+#if JVET_N0805_APS_LMCS
+  if( m_numFrameThreads > 1 && m_parameterSetManager.isAPSReplacedBy( aps->getAPSId(), aps->getAPSType(), nalu.getBitstream().getFifo() )
+      && xIsAPSInFlight( m_parameterSetManager.getAPS( aps->getAPSId(), aps->getAPSType() ) ) )
+#else
+  if( m_numFrameThreads > 1 && m_parameterSetManager.isAPSReplacedBy( aps->getAPSId(), nalu.getBitstream().getFifo() )
+      && xIsAPSInFlight( m_parameterSetManager.getAPS( aps->getAPSId() ) ) )
+#endif
+  {
+    waitForFrameJobs(); // the replaced APS is deleted, the pictures in reconstruction may still use it
+  }
   m_parameterSetManager.storeAPS(aps, nalu.getBitstream().getFifo());
 }
 bool DecLib::decode(InputNALUnit& nalu, int& iSkipFrame, int& iPOCLastDisplay)
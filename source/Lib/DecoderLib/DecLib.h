@@ -39,6 +39,7 @@
 #define __DECLIB__
 
 #include "DecSlice.h"
+#include "DecLibRecon.h"
 #include "CABACReader.h"
 #include "VLCReader.h"
 #include "SEIread.h"
@@ -55,6 +56,8 @@
 #include "CommonLib/Unit.h"
 #include "CommonLib/Reshape.h"
 
+#include <deque>
+
 class InputNALUnit;
 
 //! \ingroup DecoderLib
@@ -99,6 +102,7 @@ private:
   SampleAdaptiveOffset    m_cSAO;
   AdaptiveLoopFilter      m_cALF;
   Reshape                 m_cReshaper;                        ///< reshaper class
+  DecCtuRowFilter         m_cCtuRowFilter;                    ///< in-loop filters following the reconstruction CTU row by CTU row
   // decoder side RD cost computation
   RdCost                  m_cRdCost;                      ///< RD cost computation class
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
@@ -130,6 +134,19 @@ private:
   std::list<InputNALUnit*> m_prefixSEINALUs; /// Buffered up prefix SEI NAL Units.
   int                     m_debugPOC;
   int                     m_debugCTU;
+
+  // frame-level parallel decoding: the pictures are parsed here and reconstructed by the frame decoders
+  struct FrameJob
+  {
+    DecLibRecon*          decoder;
+    bool                  isReferenced;                 ///< reference flag of the picture when it was parsed
+    MsgLevel              msgl;
+  };
+  int                     m_numFrameThreads;
+  std::vector<DecLibRecon*> m_frameDecoders;
+  size_t                  m_nextFrameDecoder;
+  std::deque<FrameJob>    m_frameJobs;                  ///< pictures in reconstruction, in decoding order
+  std::vector<InputBitstream*> m_sliceBitstreams;       ///< slices of the current picture waiting for a frame decoder
 public:
   DecLib();
   virtual ~DecLib();
@@ -138,6 +155,10 @@ public:
   void  destroy ();
 
   void  setDecodedPictureHashSEIEnabled(int enabled) { m_decodedPictureHashSEIEnabled=enabled; }
+  void  setNumWppThreads  (int numThreads) { m_cSliceDecoder.setNumWppThreads( numThreads ); }
+  void  setNumBrickThreads(int numThreads) { m_cSliceDecoder.setNumBrickThreads( numThreads ); }
+  void  setNumReconThreads(int numThreads) { m_cSliceDecoder.setNumReconThreads( numThreads ); }
+  void  setNumFrameThreads(int numThreads) { m_numFrameThreads = numThreads; }
 
   void  init(
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
@@ -151,6 +172,7 @@ public:
   void  finishPicture(int& poc, PicList*& rpcListPic, MsgLevel msgl = INFO);
   void  finishPictureLight(int& poc, PicList*& rpcListPic );
   void  checkNoOutputPriorPics (PicList* rpcListPic);
+  void  waitForFrameJobs();
 
 #if JVET_N0278_HLS
   void  setTargetDecLayer (int val) { m_iTargetLayer = val; }
@@ -174,6 +196,13 @@ protected:
 
   Picture * xGetNewPicBuffer(const SPS &sps, const PPS &pps, const uint32_t temporalLayer);
   void  xCreateLostPicture (int iLostPOC);
+  void  xPrintPictureInfo  (Picture* pic, bool isReferenced, MsgLevel msgl);
+  bool  xCanFilterCtuRows  (const Slice& slice) const;
+
+  void  xStartFrameJob     (MsgLevel msgl);
+  void  xFinishFrameJob    ();
+  bool  xIsPictureInFlight (const Picture* pic) const;
+  bool  xIsAPSInFlight     (const APS* aps) const;
 
   void      xActivateParameterSets();
   bool      xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDisplay);
@@ -0,0 +1,436 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     DecLibRecon.cpp
+    \brief    frame decoder of the frame-level parallel decoding
+*/
+
+#include "DecLibRecon.h"
+
+#include "CommonLib/UnitTools.h"
+#include "CommonLib/StageProfile.h"
+
+#include <algorithm>
+
+//! \ingroup DecoderLib
+//! \{
+
+// ====================================================================================================================
+// Picture and slice set-up shared by the serial decoding and the frame decoders
+// ====================================================================================================================
+
+void initSliceScalingList( const Slice& slice, TrQuant& trQuant, DecSlice& sliceDecoder )
+{
+#if HEVC_USE_SCALING_LISTS
+  Quant *quant = trQuant.getQuant();
+
+  if(slice.getSPS()->getScalingListFlag())
+  {
+    ScalingList scalingList;
+    if(slice.getPPS()->getScalingListPresentFlag())
+    {
+      scalingList = slice.getPPS()->getScalingList();
+    }
+    else if (slice.getSPS()->getScalingListPresentFlag())
+    {
+      scalingList = slice.getSPS()->getScalingList();
+    }
+    else
+    {
+      scalingList.setDefaultScalingList();
+    }
+    quant->setScalingListDec(scalingList);
+    quant->setUseScalingList(true);
+    for( int threadId = 1; threadId < sliceDecoder.getNumThreads(); threadId++ )
+    {
+      sliceDecoder.getThreadTrQuant( threadId )->getQuant()->setUseScalingList( true );
+    }
+  }
+  else
+  {
+    quant->setUseScalingList(false);
+    for( int threadId = 1; threadId < sliceDecoder.getNumThreads(); threadId++ )
+    {
+      sliceDecoder.getThreadTrQuant( threadId )->getQuant()->setUseScalingList( false );
+    }
+  }
+#endif
+}
+
+void initSliceReshaper( Slice& slice, Reshape& reshaper )
+{
+  if (slice.getSPS()->getUseReshaper())
+  {
+#if JVET_N0805_APS_LMCS
+    if (slice.getLmcsEnabledFlag())
+    {
+      APS* lmcsAPS = slice.getLmcsAPS();
+      SliceReshapeInfo& sInfo = lmcsAPS->getReshaperAPSInfo();
+      SliceReshapeInfo& tInfo = reshaper.getSliceReshaperInfo();
+      tInfo.reshaperModelMaxBinIdx = sInfo.reshaperModelMaxBinIdx;
+      tInfo.reshaperModelMinBinIdx = sInfo.reshaperModelMinBinIdx;
+      memcpy(tInfo.reshaperModelBinCWDelta, sInfo.reshaperModelBinCWDelta, sizeof(int)*(PIC_CODE_CW_BINS));
+      tInfo.maxNbitsNeededDeltaCW = sInfo.maxNbitsNeededDeltaCW;
+      tInfo.setUseSliceReshaper(slice.getLmcsEnabledFlag());
+      tInfo.setSliceReshapeChromaAdj(slice.getLmcsChromaResidualScaleFlag());
+      tInfo.setSliceReshapeModelPresentFlag(true);
+    }
+    else
+    {
+      SliceReshapeInfo& tInfo = reshaper.getSliceReshaperInfo();
+      tInfo.setUseSliceReshaper(false);
+      tInfo.setSliceReshapeChromaAdj(false);
+      tInfo.setSliceReshapeModelPresentFlag(false);
+    }
+#endif
+#if !JVET_N0805_APS_LMCS
+    reshaper.copySliceReshaperInfo(reshaper.getSliceReshaperInfo(), slice.getReshapeInfo());
+#endif
+#if JVET_N0805_APS_LMCS
+    if (slice.getLmcsEnabledFlag())
+#else
+    if (slice.getReshapeInfo().getSliceReshapeModelPresentFlag())
+#endif
+    {
+      reshaper.constructReshaper();
+    }
+    else
+    {
+      reshaper.setReshapeFlag(false);
+    }
+    if ((slice.getSliceType() == I_SLICE) && reshaper.getSliceReshaperInfo().getUseSliceReshaper())
+    {
+      reshaper.setCTUFlag(false);
+      reshaper.setRecReshaped(true);
+    }
+    else
+    {
+      if (reshaper.getSliceReshaperInfo().getUseSliceReshaper())
+      {
+        reshaper.setCTUFlag(true);
+        reshaper.setRecReshaped(true);
+      }
+      else
+      {
+        reshaper.setCTUFlag(false);
+        reshaper.setRecReshaped(false);
+      }
+    }
+  }
+  else
+  {
+    reshaper.setCTUFlag(false);
+    reshaper.setRecReshaped(false);
+  }
+}
+
+void applyLoopFilters( Picture& pic, Reshape& reshaper, LoopFilter& loopFilter, SampleAdaptiveOffset& sao, AdaptiveLoopFilter& alf )
+{
+  pic.cs->slice->startProcessingTimer();
+
+  CodingStructure& cs = *pic.cs;
+
+  if (cs.sps->getUseReshaper() && reshaper.getSliceReshaperInfo().getUseSliceReshaper())
+  {
+      PROFILE_STAGE( PROF_STAGE_LMCS );
+      CHECK((reshaper.getRecReshaped() == false), "Rec picture is not reshaped!");
+      pic.getRecoBuf(COMPONENT_Y).rspSignal(reshaper.getInvLUT());
+      reshaper.setRecReshaped(false);
+      sao.setReshaper(&reshaper);
+  }
+  // deblocking filter
+  {
+    PROFILE_STAGE( PROF_STAGE_DEBLOCK );
+    loopFilter.loopFilterPic( cs );
+  }
+  CS::setRefinedMotionField(cs);
+  if( cs.sps->getSAOEnabledFlag() )
+  {
+    PROFILE_STAGE( PROF_STAGE_SAO );
+    sao.SAOProcess( cs, cs.picture->getSAO() );
+  }
+
+  if( cs.sps->getALFEnabledFlag() )
+  {
+    PROFILE_STAGE( PROF_STAGE_ALF );
+#if JVET_N0415_CTB_ALF
+    if (cs.slice->getTileGroupAlfEnabledFlag(COMPONENT_Y))
+#else
+    if (cs.slice->getTileGroupAlfEnabledFlag())
+#endif
+    {
+      // ALF decodes the differentially coded coefficients and stores them in the parameters structure.
+      // Code could be restructured to do directly after parsing. So far we just pass a fresh non-const
+      // copy in case the APS gets used more than once.
+#if JVET_N0415_CTB_ALF
+      alf.ALFProcess(cs);
+#else
+      AlfSliceParam alfParamCopy = cs.aps->getAlfAPSParam();
+      alf.ALFProcess(cs, alfParamCopy);
+#endif
+    }
+
+  }
+
+  pic.cs->slice->stopProcessingTimer();
+}
+
+// ====================================================================================================================
+// Constructor / destructor / create / destroy
+// ====================================================================================================================
+
+DecLibRecon::DecLibRecon()
+  : m_pcPic           ( nullptr )
+{
+}
+
+DecLibRecon::~DecLibRecon()
+{
+}
+
+void DecLibRecon::create( const int numWppThreads, const int numBrickThreads, const int numReconThreads )
+{
+  m_cSliceDecoder.init( &m_CABACDecoder, &m_cCuDecoder );
+  m_cSliceDecoder.setNumWppThreads( numWppThreads );
+  m_cSliceDecoder.setNumBrickThreads( numBrickThreads );
+  m_cSliceDecoder.setNumReconThreads( numReconThreads );
+  m_cSliceDecoder.setCtuObserver( &m_cCtuRowFilter );
+  m_cCtuRowFilter.init( &m_cLoopFilter, &m_cSAO, &m_cALF, &m_cReshaper );
+}
+
+void DecLibRecon::destroy()
+{
+  if( m_thread.joinable() )
+  {
+    m_thread.join();
+  }
+  for( auto bitstream : m_sliceBitstreams )
+  {
+    delete bitstream;
+  }
+  m_sliceBitstreams.clear();
+  m_refPics.clear();
+  m_pcPic = nullptr;
+
+  m_cALF.destroy();
+  m_cSAO.destroy();
+  m_cLoopFilter.destroy();
+  m_cCuDecoder.destoryDecCuReshaprBuf();
+  m_cReshaper.destroy();
+  m_cSliceDecoder.destroy();
+}
+
+// ====================================================================================================================
+// Public member functions
+// ====================================================================================================================
+
+void DecLibRecon::startPicture( Picture* pic, std::vector<InputBitstream*>& sliceBitstreams )
+{
+  CHECK( m_pcPic, "The frame decoder is still reconstructing a picture" );
+
+  m_pcPic = pic;
+  m_sliceBitstreams.swap( sliceBitstreams );
+  m_error = nullptr;
+
+  // the reference pictures, the collocated picture is one of them
+  m_refPics.clear();
+  for( size_t sliceIdx = 0; sliceIdx < m_sliceBitstreams.size(); sliceIdx++ )
+  {
+    const Slice* slice = pic->slices[sliceIdx];
+    for( int refList = 0; refList < NUM_REF_PIC_LIST_01; refList++ )
+    {
+      for( int refIdx = 0; refIdx < slice->getNumRefIdx( RefPicList( refList ) ); refIdx++ )
+      {
+        m_refPics.push_back( slice->getRefPic( RefPicList( refList ), refIdx ) );
+      }
+    }
+  }
+
+  pic->startCtuRowProgress();
+  m_thread = std::thread( &DecLibRecon::xDecompressPicture, this );
+}
+
+Picture* DecLibRecon::finishPicture()
+{
+  m_thread.join();
+
+  for( auto bitstream : m_sliceBitstreams )
+  {
+    delete bitstream;
+  }
+  m_sliceBitstreams.clear();
+  m_refPics.clear();
+
+  Picture* pic = m_pcPic;
+  m_pcPic = nullptr;
+
+  if( m_error )
+  {
+    std::exception_ptr error = m_error;
+    m_error = nullptr;
+    std::rethrow_exception( error );
+  }
+  return pic;
+}
+
+bool DecLibRecon::isUsingPicture( const Picture* pic ) const
+{
+  return pic == m_pcPic || std::find( m_refPics.begin(), m_refPics.end(), pic ) != m_refPics.end();
+}
+
+bool DecLibRecon::isUsingAPS( const APS* aps ) const
+{
+  if( !m_pcPic || !aps )
+  {
+    return false;
+  }
+  for( size_t sliceIdx = 0; sliceIdx < m_sliceBitstreams.size(); sliceIdx++ )
+  {
+    Slice* slice = m_pcPic->slices[sliceIdx];
+#if JVET_N0805_APS_LMCS
+    if( slice->getLmcsAPS() == aps )
+    {
+      return true;
+    }
+#endif
+#if JVET_N0415_CTB_ALF
+#if JVET_N0805_APS_LMCS
+    APS** apss = slice->getAlfAPSs();
+#else
+    APS** apss = slice->getAPSs();
+#endif
+    if( std::find( apss, apss + MAX_NUM_APS, aps ) != apss + MAX_NUM_APS )
+    {
+      return true;
+    }
+#else
+    if( slice->getAPS() == aps )
+    {
+      return true;
+    }
+#endif
+  }
+  return false;
+}
+
+// ====================================================================================================================
+// Private member functions
+// ====================================================================================================================
+
+void DecLibRecon::xDecompressPicture()
+{
+  try
+  {
+    CodingStructure& cs = *m_pcPic->cs;
+
+    xInitDecoders( *cs.sps, *cs.pps );
+
+    const bool useCtuRowFilters = xCanFilterCtuRows();
+
+    for( size_t sliceIdx = 0; sliceIdx < m_sliceBitstreams.size(); sliceIdx++ )
+    {
+      Slice* slice = m_pcPic->slices[sliceIdx];
+
+      initSliceScalingList( *slice, m_cTrQuant, m_cSliceDecoder );
+      initSliceReshaper   ( *slice, m_cReshaper );
+
+      if( useCtuRowFilters )
+      {
+        m_cCtuRowFilter.startPicture( m_pcPic );
+      }
+
+      m_cSliceDecoder.decompressSlice( slice, m_sliceBitstreams[sliceIdx], -1 );
+    }
+
+    if( useCtuRowFilters )
+    {
+      m_cCtuRowFilter.finishPicture();
+    }
+    else
+    {
+      applyLoopFilters( *m_pcPic, m_cReshaper, m_cLoopFilter, m_cSAO, m_cALF );
+      m_pcPic->extendPicBorder( true );
+    }
+  }
+  catch( ... )
+  {
+    m_cCtuRowFilter.resetPicture();
+    m_error = std::current_exception();
+  }
+
+  // release the pictures waiting for this one, also if it failed
+  m_pcPic->finishCtuRowProgress();
+}
+
+void DecLibRecon::xInitDecoders( const SPS& sps, const PPS& pps )
+{
+  // same set-up as DecLib::xActivateParameterSets() does for the serial decoding
+  m_cSAO.create( sps.getPicWidthInLumaSamples(), sps.getPicHeightInLumaSamples(), sps.getChromaFormatIdc(), sps.getMaxCUWidth(), sps.getMaxCUHeight(), sps.getMaxCodingDepth(), pps.getPpsRangeExtension().getLog2SaoOffsetScale(CHANNEL_TYPE_LUMA), pps.getPpsRangeExtension().getLog2SaoOffsetScale(CHANNEL_TYPE_CHROMA) );
+  m_cLoopFilter.create( sps.getMaxCodingDepth() );
+  m_cIntraPred.init( sps.getChromaFormatIdc(), sps.getBitDepth( CHANNEL_TYPE_LUMA ) );
+  m_cInterPred.init( &m_cRdCost, sps.getChromaFormatIdc() );
+  if (sps.getUseReshaper())
+  {
+    m_cReshaper.createDec(sps.getBitDepth(CHANNEL_TYPE_LUMA));
+  }
+
+  m_cCuDecoder.init( &m_cTrQuant, &m_cIntraPred, &m_cInterPred );
+  if (sps.getUseReshaper())
+  {
+    m_cCuDecoder.initDecCuReshaper(&m_cReshaper, sps.getChromaFormatIdc());
+  }
+#if MAX_TB_SIZE_SIGNALLING
+  m_cTrQuant.init( nullptr, sps.getMaxTbSize(), false, false, false, false, false );
+#else
+  m_cTrQuant.init( nullptr, MAX_TB_SIZEY, false, false, false, false, false );
+#endif
+
+  m_cRdCost.setCostMode ( COST_STANDARD_LOSSY );
+
+  m_cSliceDecoder.initThreadDecoders( sps, &m_cTrQuant, &m_cReshaper );
+  m_cSliceDecoder.create();
+
+  if( sps.getALFEnabledFlag() )
+  {
+    m_cALF.create( sps.getPicWidthInLumaSamples(), sps.getPicHeightInLumaSamples(), sps.getChromaFormatIdc(), sps.getMaxCUWidth(), sps.getMaxCUHeight(), sps.getMaxCodingDepth(), sps.getBitDepths().recon );
+  }
+}
+
+bool DecLibRecon::xCanFilterCtuRows() const
+{
+  // the slice-level filter parameters are constant over the picture
+  return m_sliceBitstreams.size() == 1 && DecCtuRowFilter::canFilterCtuRows( *m_pcPic );
+}
+
+//! \}
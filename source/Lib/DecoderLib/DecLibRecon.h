@@ -0,0 +1,121 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     DecLibRecon.h
+    \brief    frame decoder of the frame-level parallel decoding (header)
+*/
+
+#ifndef __DECLIBRECON__
+#define __DECLIBRECON__
+
+#include "DecSlice.h"
+#include "DecCu.h"
+#include "DecCtuRowFilter.h"
+#include "CABACReader.h"
+
+#include "CommonLib/CommonDef.h"
+#include "CommonLib/Picture.h"
+#include "CommonLib/TrQuant.h"
+#include "CommonLib/InterPrediction.h"
+#include "CommonLib/IntraPrediction.h"
+#include "CommonLib/LoopFilter.h"
+#include "CommonLib/SampleAdaptiveOffset.h"
+#include "CommonLib/AdaptiveLoopFilter.h"
+#include "CommonLib/Reshape.h"
+#include "CommonLib/RdCost.h"
+
+#include <vector>
+#include <thread>
+#include <exception>
+
+//! \ingroup DecoderLib
+//! \{
+
+// ====================================================================================================================
+// Picture and slice set-up shared by the serial decoding and the frame decoders
+// ====================================================================================================================
+
+void initSliceScalingList( const Slice& slice, TrQuant& trQuant, DecSlice& sliceDecoder );
+void initSliceReshaper   ( Slice& slice, Reshape& reshaper );
+void applyLoopFilters    ( Picture& pic, Reshape& reshaper, LoopFilter& loopFilter, SampleAdaptiveOffset& sao, AdaptiveLoopFilter& alf );
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// frame decoder, reconstructs a parsed picture in its own thread, including the in-loop filters
+class DecLibRecon
+{
+private:
+  IntraPrediction               m_cIntraPred;
+  InterPrediction               m_cInterPred;
+  TrQuant                       m_cTrQuant;
+  DecSlice                      m_cSliceDecoder;
+  DecCu                         m_cCuDecoder;
+  CABACDecoder                  m_CABACDecoder;
+  LoopFilter                    m_cLoopFilter;
+  SampleAdaptiveOffset          m_cSAO;
+  AdaptiveLoopFilter            m_cALF;
+  Reshape                       m_cReshaper;
+  RdCost                        m_cRdCost;
+  DecCtuRowFilter               m_cCtuRowFilter;
+
+  Picture*                      m_pcPic;
+  std::vector<InputBitstream*>  m_sliceBitstreams;      ///< bitstreams of the slices of the picture in decoding order
+  std::vector<const Picture*>   m_refPics;              ///< pictures read by the reconstruction, they must stay in the DPB
+  std::thread                   m_thread;
+  std::exception_ptr            m_error;
+
+public:
+  DecLibRecon();
+  virtual ~DecLibRecon();
+
+  void      create           ( const int numWppThreads, const int numBrickThreads, const int numReconThreads );
+  void      destroy          ();
+
+  void      startPicture     ( Picture* pic, std::vector<InputBitstream*>& sliceBitstreams );
+  Picture*  finishPicture    ();
+  Picture*  getPicture       () const                   { return m_pcPic; }
+  bool      isUsingPicture   ( const Picture* pic ) const;
+  bool      isUsingAPS       ( const APS* aps ) const;
+
+private:
+  void      xDecompressPicture();
+  void      xInitDecoders    ( const SPS& sps, const PPS& pps );
+  bool      xCanFilterCtuRows() const;
+};
+
+//! \}
+
+#endif // __DECLIBRECON__
@@ -37,9 +37,11 @@
 
 #include "DecSlice.h"
 #include "CommonLib/UnitTools.h"
+#include "CommonLib/StageProfile.h"
 #include "CommonLib/dtrace_next.h"
 
 #include <vector>
+#include <thread>
 
 //! \ingroup DecoderLib
 //! \{
@@ -49,6 +51,16 @@
 //////////////////////////////////////////////////////////////////////
 
 DecSlice::DecSlice()
+  : m_ctuObserver    ( nullptr )
+  , m_numWppThreads  ( 1 )
+  , m_numBrickThreads( 1 )
+  , m_numReconThreads( 0 )
+  , m_wppEndRow      ( 0 )
+  , m_numParsedCtus  ( 0 )
+  , m_isParsingDone  ( false )
+#if JVET_N0857_RECT_SLICES
+  , m_nextBrickJob   ( 0 )
+#endif
 {
 }
 
@@ -62,6 +74,12 @@ void DecSlice::create()
 
 void DecSlice::destroy()
 {
+  for( auto threadDecoder : m_threadDecoders )
+  {
+    threadDecoder->cuDecoder.destoryDecCuReshaprBuf();
+    delete threadDecoder;
+  }
+  m_threadDecoders.clear();
 }
 
 void DecSlice::init( CABACDecoder* cabacDecoder, DecCu* pcCuDecoder )
@@ -70,6 +88,32 @@ void DecSlice::init( CABACDecoder* cabacDecoder, DecCu* pcCuDecoder )
   m_pcCuDecoder     = pcCuDecoder;
 }
 
+void DecSlice::initThreadDecoders( const SPS& sps, TrQuant* trQuant, Reshape* reshaper )
+{
+  while( (int) m_threadDecoders.size() + 1 < getNumThreads() )
+  {
+    m_threadDecoders.push_back( new SliceThreadDecoder );
+  }
+
+  // mirror the set-up of the thread 0 instances done by DecLib, the scaling lists are shared with trQuant
+  for( auto threadDecoder : m_threadDecoders )
+  {
+    threadDecoder->intraPred.init( sps.getChromaFormatIdc(), sps.getBitDepth( CHANNEL_TYPE_LUMA ) );
+    threadDecoder->interPred.init( &threadDecoder->rdCost, sps.getChromaFormatIdc() );
+    threadDecoder->cuDecoder.init( &threadDecoder->trQuant, &threadDecoder->intraPred, &threadDecoder->interPred );
+    if( sps.getUseReshaper() )
+    {
+      threadDecoder->cuDecoder.initDecCuReshaper( reshaper, sps.getChromaFormatIdc() );
+    }
+#if MAX_TB_SIZE_SIGNALLING
+    threadDecoder->trQuant.init( trQuant->getQuant(), sps.getMaxTbSize(), false, false, false, false, false );
+#else
+    threadDecoder->trQuant.init( trQuant->getQuant(), MAX_TB_SIZEY, false, false, false, false, false );
+#endif
+    threadDecoder->rdCost.setCostMode( COST_STANDARD_LOSSY );
+  }
+}
+
 void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int debugCTU )
 {
   //-- For time output for each slice
@@ -77,12 +121,6 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
 
   const SPS*     sps          = slice->getSPS();
   Picture*       pic          = slice->getPic();
-#if JVET_N0857_TILES_BRICKS
-  const BrickMap& tileMap     = *pic->brickMap;
-#else
-  const TileMap& tileMap      = *pic->tileMap;
-#endif
-  CABACReader&   cabacReader  = *m_CABACDecoder->getCABACReader( 0 );
 
   // setup coding structure
   CodingStructure& cs = *pic->cs;
@@ -130,6 +168,64 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   }
 
   const int       startCtuTsAddr          = slice->getSliceCurStartCtuTsAddr();
+
+  const bool useWppThreads   = xUseWppThreads( *slice, startCtuTsAddr, numSubstreams, debugCTU );
+#if JVET_N0857_RECT_SLICES
+  const bool useBrickThreads = !useWppThreads && xInitBrickJobs( *slice, numSubstreams, debugCTU );
+#else
+  const bool useBrickThreads = false;
+#endif
+  const bool useReconThreads = !useWppThreads && !useBrickThreads && xUseReconThreads( *slice, startCtuTsAddr, debugCTU );
+
+  if( useWppThreads || useBrickThreads )
+  {
+    // a single brick is decoded with wavefronts, so the tile scan address equals the raster scan address
+#if JVET_N0857_RECT_SLICES
+    const bool isLastCtuOfSliceSegment = useWppThreads ? xDecompressWavefronts( slice, ppcSubstreams, startCtuTsAddr ) : xDecompressBricks( slice, ppcSubstreams );
+#else
+    const bool isLastCtuOfSliceSegment = xDecompressWavefronts( slice, ppcSubstreams, startCtuTsAddr );
+#endif
+    CHECK( !isLastCtuOfSliceSegment, "Last CTU of slice segment not signalled as such" );
+
+    for( auto substr: ppcSubstreams )
+    {
+      delete substr;
+    }
+    slice->stopProcessingTimer();
+    return;
+  }
+
+  if( useReconThreads )
+  {
+    // a single brick starting at a CTU row, so the tile scan address equals the raster scan address
+    xDecompressPipelined( slice, ppcSubstreams, startCtuTsAddr );
+  }
+  else
+  {
+    xDecompressCtus( slice, ppcSubstreams, debugCTU, false );
+  }
+
+  // deallocate all created substreams, including internal buffers.
+  for( auto substr: ppcSubstreams )
+  {
+    delete substr;
+  }
+  slice->stopProcessingTimer();
+}
+
+void DecSlice::xDecompressCtus( Slice* slice, const std::vector<InputBitstream*>& ppcSubstreams, const int debugCTU, const bool parseOnly )
+{
+  const SPS*     sps          = slice->getSPS();
+  Picture*       pic          = slice->getPic();
+#if JVET_N0857_TILES_BRICKS
+  const BrickMap& tileMap     = *pic->brickMap;
+#else
+  const TileMap& tileMap      = *pic->tileMap;
+#endif
+  CABACReader&   cabacReader  = *m_CABACDecoder->getCABACReader( 0 );
+  CodingStructure& cs         = *pic->cs;
+
+  const int       startCtuTsAddr          = slice->getSliceCurStartCtuTsAddr();
 #if !JVET_N0857_TILES_BRICKS
   const int       startCtuRsAddr          = tileMap.getCtuTsToRsAddrMap(startCtuTsAddr);
 #endif
@@ -255,9 +351,24 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
       isLastCtuOfSliceSegment = true; // get out here
       break;
     }
-    isLastCtuOfSliceSegment = cabacReader.coding_tree_unit( cs, ctuArea, pic->m_prevQP, ctuRsAddr );
+    {
+      PROFILE_STAGE( PROF_STAGE_PARSE );
+      isLastCtuOfSliceSegment = cabacReader.coding_tree_unit( cs, ctuArea, pic->m_prevQP, ctuRsAddr );
+    }
 
-    m_pcCuDecoder->decompressCtu( cs, ctuArea );
+    if( parseOnly )
+    {
+      // the reconstruction threads pick the CTU up from the coding structure
+      xSetParsedCtus( ctuTsAddr - startCtuTsAddr + 1 );
+    }
+    else
+    {
+      m_pcCuDecoder->decompressCtu( cs, ctuArea );
+      if( m_ctuObserver )
+      {
+        m_ctuObserver->ctuDecoded( ctuRsAddr );
+      }
+    }
 
 #if JVET_N0150_ONE_CTU_DELAY_WPP
     if( ctuXPosInCtus == tileXPosInCtus && wavefrontsEnabled )
@@ -297,13 +408,569 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
     }
   }
   CHECK( !isLastCtuOfSliceSegment, "Last CTU of slice segment not signalled as such" );
+}
 
-  // deallocate all created substreams, including internal buffers.
-  for( auto substr: ppcSubstreams )
+bool DecSlice::xUseReconThreads( const Slice& slice, const unsigned startCtuTsAddr, const int debugCTU ) const
+{
+  return m_numReconThreads > 0 && debugCTU < 0
+      && !g_mctsDecCheckEnabled                                         // the MCTS check uses the tile area of the parsed CTU
+#if JVET_N0857_TILES_BRICKS
+      && slice.getPic()->brickMap->bricks.size() == 1                // the CTU rows are reconstructed as wavefronts within a single brick
+#else
+      && slice.getPic()->tileMap->tiles.size() == 1
+#endif
+      && startCtuTsAddr % slice.getPPS()->pcv->widthInCtus == 0         // and for slices starting at a CTU row
+#if ENABLE_TRACING
+      && !g_trace_ctx
+#endif
+      ;
+}
+
+void DecSlice::xDecompressPipelined( Slice* slice, const std::vector<InputBitstream*>& substreams, const unsigned startCtuRsAddr )
+{
+  CodingStructure& cs         = *slice->getPic()->cs;
+  const unsigned   numRows    = cs.pcv->heightInCtus - startCtuRsAddr / cs.pcv->widthInCtus;
+  const int        numThreads = std::min<int>( m_numReconThreads, numRows );
+
+  // the reconstruction runs as a wavefront behind the parsing, the row progress of the wavefront decoding is reused for it
+  m_wppRowProgress.assign( numRows, 0 );
+  m_wppEndRow     = numRows;
+  m_numParsedCtus = 0;
+  m_isParsingDone = false;
+  m_threadError   = nullptr;
+
+  cs.setCtuParallel( true );
+
+  std::vector<std::thread> threads;
+  for( int threadId = 1; threadId <= numThreads; threadId++ )
   {
-    delete substr;
+    threads.push_back( std::thread( &DecSlice::xReconstructCtuRows, this, threadId, numThreads, slice, startCtuRsAddr ) );
   }
-  slice->stopProcessingTimer();
+
+  // this thread parses the CTUs into the coding structure ahead of the reconstruction
+  try
+  {
+    xDecompressCtus( slice, substreams, -1, true );
+  }
+  catch( ... )
+  {
+    xSetThreadError();
+  }
+  xSetParsingDone();
+
+  for( auto &thread : threads )
+  {
+    thread.join();
+  }
+
+  cs.setCtuParallel( false );
+
+  if( m_threadError )
+  {
+    std::rethrow_exception( m_threadError );
+  }
+}
+
+void DecSlice::xReconstructCtuRows( const int threadId, const int numThreads, Slice* slice, const unsigned startCtuRsAddr )
+{
+  DecCu&           cuDecoder   = xGetCuDecoder( threadId );
+  CodingStructure& cs          = *slice->getPic()->cs;
+  const unsigned   widthInCtus = cs.pcv->widthInCtus;
+  const unsigned   maxCUSize   = cs.pcv->maxCUWidth;
+  const unsigned   startRow    = startCtuRsAddr / widthInCtus;
+  const unsigned   numRows     = (unsigned) m_wppRowProgress.size();
+
+  try
+  {
+    for( unsigned row = threadId - 1; row < numRows; row += numThreads )
+    {
+      for( unsigned ctuXPosInCtus = 0; ctuXPosInCtus < widthInCtus; ctuXPosInCtus++ )
+      {
+        // wait for the CTU to be parsed and for the top-right CTU of the row above to be reconstructed
+        if( !xWaitForParsedCtu( row * widthInCtus + ctuXPosInCtus + 1 ) )
+        {
+          return;
+        }
+        if( row > 0 && !xWaitForCtuRow( row - 1, std::min( ctuXPosInCtus + 2, widthInCtus ) ) )
+        {
+          return;
+        }
+
+        const unsigned ctuYPosInCtus = startRow + row;
+        const unsigned ctuRsAddr     = ctuYPosInCtus * widthInCtus + ctuXPosInCtus;
+        const Position pos( ctuXPosInCtus * maxCUSize, ctuYPosInCtus * maxCUSize );
+        const UnitArea ctuArea( cs.area.chromaFormat, Area( pos.x, pos.y, maxCUSize, maxCUSize ) );
+
+        if( ctuXPosInCtus == 0 && ( cs.slice->getSliceType() != I_SLICE || cs.sps->getIBCFlag() ) )
+        {
+          LutMotionCand &motionLut = cs.getMotionLut( ctuArea );
+          motionLut.lut.resize( 0 );
+          motionLut.lutIbc.resize( 0 );
+#if !JVET_N0266_SMALL_BLOCKS
+          motionLut.lutShare.resize( 0 );
+#endif
+          motionLut.lutShareIbc.resize( 0 );
+        }
+
+        cuDecoder.decompressCtu( cs, ctuArea );
+        if( m_ctuObserver )
+        {
+          m_ctuObserver->ctuDecoded( ctuRsAddr );
+        }
+
+        xSetCtuRowProgress( row, ctuXPosInCtus + 1, false );
+      }
+    }
+  }
+  catch( ... )
+  {
+    xSetThreadError();
+  }
+}
+
+bool DecSlice::xWaitForParsedCtu( const unsigned numCtus )
+{
+  std::unique_lock<std::mutex> lock( m_threadMutex );
+  m_threadCond.wait( lock, [&]{ return m_threadError || m_isParsingDone || m_numParsedCtus >= numCtus; } );
+
+  // CTUs behind the last one of the slice are not parsed
+  return !m_threadError && m_numParsedCtus >= numCtus;
+}
+
+void DecSlice::xSetParsedCtus( const unsigned numCtus )
+{
+  std::lock_guard<std::mutex> lock( m_threadMutex );
+  m_numParsedCtus = numCtus;
+  m_threadCond.notify_all();
+}
+
+void DecSlice::xSetParsingDone()
+{
+  std::lock_guard<std::mutex> lock( m_threadMutex );
+  m_isParsingDone = true;
+  m_threadCond.notify_all();
+}
+
+bool DecSlice::xUseWppThreads( const Slice& slice, const unsigned startCtuTsAddr, const unsigned numSubstreams, const int debugCTU ) const
+{
+  const PPS&           pps = *slice.getPPS();
+  const PreCalcValues& pcv = *pps.pcv;
+
+  return m_numWppThreads > 1 && pps.getEntropyCodingSyncEnabledFlag() && numSubstreams > 1 && debugCTU < 0
+#if JVET_N0857_TILES_BRICKS
+      && slice.getPic()->brickMap->bricks.size() == 1                // the CTU rows are only parallelized within a single brick
+#else
+      && slice.getPic()->tileMap->tiles.size() == 1
+#endif
+      && startCtuTsAddr % pcv.widthInCtus == 0                          // and for slices starting at a CTU row
+      && !pps.getPpsRangeExtension().getChromaQpOffsetListEnabledFlag() // the chroma QP adjustment is carried over CTU rows
+#if ENABLE_TRACING
+      && !g_trace_ctx
+#endif
+      ;
+}
+
+bool DecSlice::xDecompressWavefronts( Slice* slice, const std::vector<InputBitstream*>& substreams, const unsigned startCtuRsAddr )
+{
+  Picture*         pic        = slice->getPic();
+  CodingStructure& cs         = *pic->cs;
+  const unsigned   startRow   = startCtuRsAddr / cs.pcv->widthInCtus;
+  const unsigned   numRows    = std::min<unsigned>( (unsigned) substreams.size(), cs.pcv->heightInCtus - startRow );
+  const int        numThreads = std::min<int>( m_numWppThreads, numRows );
+
+  m_wppRowProgress.assign( numRows, 0 );
+  m_wppRowCtx     .resize( numRows );
+  m_wppEndRow     = numRows;
+  m_threadError      = nullptr;
+
+  // slice-level set-up done per CTU by the sequential decoding
+  if( cs.slice->getSliceType() == B_SLICE )
+  {
+    resetGbiCodingOrder( true, cs );
+  }
+  if( !cs.slice->isIntra() )
+  {
+    pic->mctsInfo.init( &cs, startCtuRsAddr );
+  }
+
+  cs.setCtuParallel( true );
+
+  std::vector<std::thread> threads;
+  for( int threadId = 1; threadId < numThreads; threadId++ )
+  {
+    threads.push_back( std::thread( &DecSlice::xDecompressCtuRows, this, threadId, numThreads, slice, std::cref( substreams ), startCtuRsAddr ) );
+  }
+  xDecompressCtuRows( 0, numThreads, slice, substreams, startCtuRsAddr );
+
+  for( auto &thread : threads )
+  {
+    thread.join();
+  }
+
+  cs.setCtuParallel( false );
+
+  if( m_threadError )
+  {
+    std::rethrow_exception( m_threadError );
+  }
+
+  if( m_wppEndRow == numRows )
+  {
+    return false;
+  }
+
+  // a following dependent slice segment synchronizes with the last CTU row of this one
+  m_entropyCodingSyncContextState = m_wppRowCtx[m_wppEndRow];
+  return true;
+}
+
+void DecSlice::xDecompressCtuRows( const int threadId, const int numThreads, Slice* slice, const std::vector<InputBitstream*>& substreams, const unsigned startCtuRsAddr )
+{
+  CABACReader&     cabacReader = xGetCABACReader( threadId );
+  DecCu&           cuDecoder   = xGetCuDecoder  ( threadId );
+  CodingStructure& cs          = *slice->getPic()->cs;
+  const unsigned   widthInCtus = cs.pcv->widthInCtus;
+  const unsigned   maxCUSize   = cs.pcv->maxCUWidth;
+  const unsigned   startRow    = startCtuRsAddr / widthInCtus;
+  const unsigned   numRows     = (unsigned) m_wppRowProgress.size();
+  int              prevQP[2];
+
+  try
+  {
+    for( unsigned row = threadId; row < numRows; row += numThreads )
+    {
+      for( unsigned ctuXPosInCtus = 0; ctuXPosInCtus < widthInCtus; ctuXPosInCtus++ )
+      {
+        // wait for the top-right CTU of the row above
+        if( row > 0 && !xWaitForCtuRow( row - 1, std::min( ctuXPosInCtus + 2, widthInCtus ) ) )
+        {
+          return;
+        }
+
+        const unsigned ctuYPosInCtus = startRow + row;
+        const unsigned ctuRsAddr     = ctuYPosInCtus * widthInCtus + ctuXPosInCtus;
+        const Position pos( ctuXPosInCtus * maxCUSize, ctuYPosInCtus * maxCUSize );
+        const UnitArea ctuArea( cs.area.chromaFormat, Area( pos.x, pos.y, maxCUSize, maxCUSize ) );
+
+        if( ctuXPosInCtus == 0 )
+        {
+          cabacReader.initBitstream( substreams[row] );
+          cabacReader.initCtxModels( *slice );
+
+          if( row > 0 )
+          {
+            cabacReader.getCtx() = m_wppRowCtx[row - 1];
+          }
+#if JVET_N0150_ONE_CTU_DELAY_WPP
+          else if( startRow > 0 && cs.getCURestricted( pos.offset( 0, -1 ), pos, slice->getIndependentSliceIdx(), 0, CH_L ) )
+#else
+          else if( startRow > 0 && cs.getCURestricted( pos.offset( maxCUSize, -1 ), slice->getIndependentSliceIdx(), 0, CH_L ) )
+#endif
+          {
+            // first row of a dependent slice segment
+            cabacReader.getCtx() = m_entropyCodingSyncContextState;
+          }
+          prevQP[0] = prevQP[1] = slice->getSliceQp();
+
+          if( cs.slice->getSliceType() != I_SLICE || cs.sps->getIBCFlag() )
+          {
+            LutMotionCand &motionLut = cs.getMotionLut( ctuArea );
+            motionLut.lut.resize( 0 );
+            motionLut.lutIbc.resize( 0 );
+#if !JVET_N0266_SMALL_BLOCKS
+            motionLut.lutShare.resize( 0 );
+#endif
+            motionLut.lutShareIbc.resize( 0 );
+          }
+        }
+
+        const bool isLastCtuOfSliceSegment = cabacReader.coding_tree_unit( cs, ctuArea, prevQP, ctuRsAddr );
+
+        cuDecoder.decompressCtu( cs, ctuArea );
+        if( m_ctuObserver )
+        {
+          m_ctuObserver->ctuDecoded( ctuRsAddr );
+        }
+
+#if JVET_N0150_ONE_CTU_DELAY_WPP
+        if( ctuXPosInCtus == 0 )
+#else
+        if( ctuXPosInCtus == 1 )
+#endif
+        {
+          m_wppRowCtx[row] = cabacReader.getCtx();
+        }
+
+        if( isLastCtuOfSliceSegment )
+        {
+#if DECODER_CHECK_SUBSTREAM_AND_SLICE_TRAILING_BYTES
+          cabacReader.remaining_bytes( false );
+#endif
+          slice->setSliceCurEndCtuTsAddr( ctuRsAddr + 1 );
+          xSetCtuRowProgress( row, widthInCtus, true );
+          return;
+        }
+        if( ctuXPosInCtus + 1 == widthInCtus )
+        {
+          // end of wavefront-CTU-row
+          unsigned binVal = cabacReader.terminating_bit();
+          CHECK( !binVal, "Expecting a terminating bit" );
+#if DECODER_CHECK_SUBSTREAM_AND_SLICE_TRAILING_BYTES
+          cabacReader.remaining_bytes( true );
+#endif
+        }
+        xSetCtuRowProgress( row, ctuXPosInCtus + 1, false );
+      }
+    }
+  }
+  catch( ... )
+  {
+    xSetThreadError();
+  }
+}
+
+bool DecSlice::xWaitForCtuRow( const unsigned row, const unsigned numCtus )
+{
+  std::unique_lock<std::mutex> lock( m_threadMutex );
+  m_threadCond.wait( lock, [&]{ return m_threadError || m_wppRowProgress[row] >= numCtus; } );
+
+  // rows below the one containing the last CTU of the slice are not decoded
+  return !m_threadError && row < m_wppEndRow;
+}
+
+void DecSlice::xSetCtuRowProgress( const unsigned row, const unsigned numCtus, const bool isLastCtuOfSlice )
+{
+  std::lock_guard<std::mutex> lock( m_threadMutex );
+  m_wppRowProgress[row] = numCtus;
+  if( isLastCtuOfSlice )
+  {
+    m_wppEndRow = row;
+    std::fill( m_wppRowProgress.begin() + row, m_wppRowProgress.end(), numCtus );
+  }
+  m_threadCond.notify_all();
+}
+
+void DecSlice::xSetThreadError()
+{
+  std::lock_guard<std::mutex> lock( m_threadMutex );
+  if( !m_threadError )
+  {
+    m_threadError = std::current_exception();
+  }
+  m_threadCond.notify_all();
+}
+
+#if JVET_N0857_RECT_SLICES
+bool DecSlice::xInitBrickJobs( const Slice& slice, const unsigned numSubstreams, const int debugCTU )
+{
+  const PPS&      pps         = *slice.getPPS();
+  const BrickMap& brickMap    = *slice.getPic()->brickMap;
+  const unsigned  widthInCtus = pps.pcv->widthInCtus;
+
+  m_brickJobs      .clear();
+  m_brickSubstreams.clear();
+
+  if( m_numBrickThreads <= 1 || numSubstreams <= 1 || debugCTU >= 0 || g_mctsDecCheckEnabled // the MCTS check uses the tile area of the current CTU
+      || pps.getPpsRangeExtension().getChromaQpOffsetListEnabledFlag()                        // the chroma QP adjustment is carried over bricks
+#if ENABLE_TRACING
+      || g_trace_ctx
+#endif
+    )
+  {
+    return false;
+  }
+
+  // the history based motion vector candidates are only reset at the left picture boundary,
+  // so a brick starting further right continues the candidates of the previous brick
+  const bool usesMotionLut = slice.getSliceType() != I_SLICE || slice.getSPS()->getIBCFlag();
+
+  const unsigned startSliceRsAddr = brickMap.getCtuBsToRsAddrMap( slice.getSliceCurStartCtuTsAddr() );
+  const unsigned endSliceRsAddr   = brickMap.getCtuBsToRsAddrMap( slice.getSliceCurEndCtuTsAddr() - 1 );
+  unsigned       subStrmId        = 0;
+
+  for( unsigned brickIdx = slice.getSliceCurStartBrickIdx(); brickIdx <= slice.getSliceCurEndBrickIdx() && brickIdx < brickMap.bricks.size(); brickIdx++ )
+  {
+    const Brick&   brick          = brickMap.bricks[brickIdx];
+    const unsigned brickXPosInCtus = brick.getFirstCtuRsAddr() % widthInCtus;
+    const unsigned brickYPosInCtus = brick.getFirstCtuRsAddr() / widthInCtus;
+
+    if( pps.getRectSliceFlag() &&
+      ( brickYPosInCtus < startSliceRsAddr / widthInCtus || brickYPosInCtus > endSliceRsAddr / widthInCtus ||
+        brickXPosInCtus < startSliceRsAddr % widthInCtus || brickXPosInCtus > endSliceRsAddr % widthInCtus ) )
+    {
+      continue;
+    }
+    if( usesMotionLut && brickXPosInCtus != 0 )
+    {
+      return false;
+    }
+
+    m_brickJobs      .push_back( brickIdx );
+    m_brickSubstreams.push_back( subStrmId );
+    subStrmId += pps.getEntropyCodingSyncEnabledFlag() ? brick.getHeightInCtus() : 1;
+  }
+
+  return m_brickJobs.size() > 1 && subStrmId == numSubstreams;
 }
 
+bool DecSlice::xDecompressBricks( Slice* slice, const std::vector<InputBitstream*>& substreams )
+{
+  CodingStructure& cs         = *slice->getPic()->cs;
+  const int        numThreads = std::min<int>( m_numBrickThreads, (int) m_brickJobs.size() );
+
+  m_nextBrickJob = 0;
+  m_threadError  = nullptr;
+
+  // slice-level set-up done per CTU by the sequential decoding, the MCTS tile area is not needed without the MCTS check
+  if( cs.slice->getSliceType() == B_SLICE )
+  {
+    resetGbiCodingOrder( true, cs );
+  }
+
+  cs.setCtuParallel( true );
+
+  std::vector<std::thread> threads;
+  for( int threadId = 1; threadId < numThreads; threadId++ )
+  {
+    threads.push_back( std::thread( &DecSlice::xDecompressBrickJobs, this, threadId, slice, std::cref( substreams ) ) );
+  }
+  xDecompressBrickJobs( 0, slice, substreams );
+
+  for( auto &thread : threads )
+  {
+    thread.join();
+  }
+
+  cs.setCtuParallel( false );
+
+  if( m_threadError )
+  {
+    std::rethrow_exception( m_threadError );
+  }
+
+  // the end of the slice segment has been checked at the last CTU of the last brick
+  return true;
+}
+
+void DecSlice::xDecompressBrickJobs( const int threadId, Slice* slice, const std::vector<InputBitstream*>& substreams )
+{
+  try
+  {
+    while( true )
+    {
+      size_t jobIdx;
+      {
+        std::lock_guard<std::mutex> lock( m_threadMutex );
+        if( m_threadError || m_nextBrickJob == m_brickJobs.size() )
+        {
+          return;
+        }
+        jobIdx = m_nextBrickJob++;
+      }
+
+      xDecompressBrick( threadId, slice, substreams, jobIdx );
+    }
+  }
+  catch( ... )
+  {
+    xSetThreadError();
+  }
+}
+
+void DecSlice::xDecompressBrick( const int threadId, Slice* slice, const std::vector<InputBitstream*>& substreams, const size_t jobIdx )
+{
+  CABACReader&     cabacReader       = xGetCABACReader( threadId );
+  DecCu&           cuDecoder         = xGetCuDecoder  ( threadId );
+  CodingStructure& cs                = *slice->getPic()->cs;
+  const BrickMap&  brickMap          = *slice->getPic()->brickMap;
+  const unsigned   brickIdx          = m_brickJobs[jobIdx];
+  const Brick&     brick             = brickMap.bricks[brickIdx];
+  const unsigned   widthInCtus       = cs.pcv->widthInCtus;
+  const unsigned   maxCUSize         = cs.pcv->maxCUWidth;
+  const unsigned   brickXPosInCtus   = brick.getFirstCtuRsAddr() % widthInCtus;
+  const unsigned   brickYPosInCtus   = brick.getFirstCtuRsAddr() / widthInCtus;
+  const bool       wavefrontsEnabled = cs.pps->getEntropyCodingSyncEnabledFlag();
+  const bool       isLastBrick       = jobIdx + 1 == m_brickJobs.size();
+  unsigned         subStrmId         = m_brickSubstreams[jobIdx];
+  Ctx              entropyCodingSyncContextState;
+  int              prevQP[2];
+
+  for( unsigned ctuYPosInCtus = brickYPosInCtus; ctuYPosInCtus < brickYPosInCtus + brick.getHeightInCtus(); ctuYPosInCtus++ )
+  {
+    for( unsigned ctuXPosInCtus = brickXPosInCtus; ctuXPosInCtus < brickXPosInCtus + brick.getWidthInCtus(); ctuXPosInCtus++ )
+    {
+      const unsigned ctuRsAddr = ctuYPosInCtus * widthInCtus + ctuXPosInCtus;
+      const Position pos( ctuXPosInCtus * maxCUSize, ctuYPosInCtus * maxCUSize );
+      const UnitArea ctuArea( cs.area.chromaFormat, Area( pos.x, pos.y, maxCUSize, maxCUSize ) );
+
+      // set up CABAC contexts' state at the start of the brick or of a wavefront-CTU-row
+      if( ctuXPosInCtus == brickXPosInCtus && ( ctuYPosInCtus == brickYPosInCtus || wavefrontsEnabled ) )
+      {
+        cabacReader.initBitstream( substreams[subStrmId] );
+        cabacReader.initCtxModels( *slice );
+
+#if JVET_N0150_ONE_CTU_DELAY_WPP
+        if( ctuYPosInCtus != brickYPosInCtus && cs.getCURestricted( pos.offset( 0, -1 ), pos, slice->getIndependentSliceIdx(), brickIdx, CH_L ) )
+#else
+        if( ctuYPosInCtus != brickYPosInCtus && cs.getCURestricted( pos.offset( maxCUSize, -1 ), slice->getIndependentSliceIdx(), brickIdx, CH_L ) )
+#endif
+        {
+          cabacReader.getCtx() = entropyCodingSyncContextState;
+        }
+        prevQP[0] = prevQP[1] = slice->getSliceQp();
+      }
+
+      if( ( cs.slice->getSliceType() != I_SLICE || cs.sps->getIBCFlag() ) && ctuXPosInCtus == 0 )
+      {
+        LutMotionCand &motionLut = cs.getMotionLut( ctuArea );
+        motionLut.lut.resize( 0 );
+        motionLut.lutIbc.resize( 0 );
+#if !JVET_N0266_SMALL_BLOCKS
+        motionLut.lutShare.resize( 0 );
+#endif
+        motionLut.lutShareIbc.resize( 0 );
+      }
+
+      const bool isLastCtuOfSliceSegment = cabacReader.coding_tree_unit( cs, ctuArea, prevQP, ctuRsAddr );
+
+      cuDecoder.decompressCtu( cs, ctuArea );
+      if( m_ctuObserver )
+      {
+        m_ctuObserver->ctuDecoded( ctuRsAddr );
+      }
+
+#if JVET_N0150_ONE_CTU_DELAY_WPP
+      if( ctuXPosInCtus == brickXPosInCtus && wavefrontsEnabled )
+#else
+      if( ctuXPosInCtus == brickXPosInCtus + 1 && wavefrontsEnabled )
+#endif
+      {
+        entropyCodingSyncContextState = cabacReader.getCtx();
+      }
+
+      const bool isLastCtuOfBrick = ctuXPosInCtus + 1 == brickXPosInCtus + brick.getWidthInCtus() && ctuYPosInCtus + 1 == brickYPosInCtus + brick.getHeightInCtus();
+      CHECK( isLastCtuOfSliceSegment != ( isLastBrick && isLastCtuOfBrick ), "End of slice segment not signalled at the last CTU of the slice" );
+
+      if( isLastCtuOfSliceSegment )
+      {
+#if DECODER_CHECK_SUBSTREAM_AND_SLICE_TRAILING_BYTES
+        cabacReader.remaining_bytes( false );
+#endif
+        slice->setSliceCurEndCtuTsAddr( brickMap.getCtuRsToBsAddrMap( ctuRsAddr ) + 1 );
+      }
+      else if( ctuXPosInCtus + 1 == brickXPosInCtus + brick.getWidthInCtus() && ( isLastCtuOfBrick || wavefrontsEnabled ) )
+      {
+        // end of brick or of wavefront-CTU-row
+        unsigned binVal = cabacReader.terminating_bit();
+        CHECK( !binVal, "Expecting a terminating bit" );
+#if DECODER_CHECK_SUBSTREAM_AND_SLICE_TRAILING_BYTES
+        cabacReader.remaining_bytes( true );
+#endif
+        subStrmId++;
+      }
+    }
+  }
+}
+#endif
+
 //! \}
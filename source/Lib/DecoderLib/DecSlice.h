@@ -47,6 +47,10 @@
 #include "DecCu.h"
 #include "CABACReader.h"
 
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
 //! \ingroup DecoderLib
 //! \{
 
@@ -54,6 +58,25 @@
 // Class definition
 // ====================================================================================================================
 
+/// decoder instances of one additional thread of the parallel CTU row, brick and reconstruction decoding
+struct SliceThreadDecoder
+{
+  RdCost          rdCost;
+  IntraPrediction intraPred;
+  InterPrediction interPred;
+  TrQuant         trQuant;
+  DecCu           cuDecoder;
+  CABACDecoder    cabacDecoder;
+};
+
+/// receives the CTUs as soon as they are reconstructed, called concurrently by the threads of the parallel CTU row and brick decoding
+class DecCtuObserver
+{
+public:
+  virtual ~DecCtuObserver() {}
+  virtual void ctuDecoded( const unsigned ctuRsAddr ) = 0;
+};
+
 /// slice decoder class
 class DecSlice
 {
@@ -63,6 +86,32 @@ private:
   DecCu*          m_pcCuDecoder;
 
   Ctx             m_entropyCodingSyncContextState;      ///< context storage for state of contexts at the wavefront/WPP/entropy-coding-sync second CTU of tile-row
+  DecCtuObserver* m_ctuObserver;
+
+  // parallel decoding, thread 0 uses the instances passed to init()
+  int                              m_numWppThreads;
+  int                              m_numBrickThreads;
+  int                              m_numReconThreads;
+  std::vector<SliceThreadDecoder*> m_threadDecoders;
+  std::mutex                       m_threadMutex;
+  std::condition_variable          m_threadCond;
+  std::exception_ptr               m_threadError;
+
+  // wavefront parallel CTU row decoding
+  std::vector<unsigned>            m_wppRowProgress;    ///< number of decoded CTUs per CTU row of the slice
+  std::vector<Ctx>                 m_wppRowCtx;         ///< context states for the synchronization of the next CTU row
+  unsigned                         m_wppEndRow;         ///< CTU row containing the last CTU of the slice
+
+  // parsing and reconstruction pipeline, the coding structure holds the parsed CTUs until they are reconstructed
+  unsigned                         m_numParsedCtus;     ///< number of parsed CTUs of the slice
+  bool                             m_isParsingDone;
+
+#if JVET_N0857_RECT_SLICES
+  // brick parallel decoding
+  std::vector<unsigned>            m_brickJobs;         ///< bricks of the slice in decoding order
+  std::vector<unsigned>            m_brickSubstreams;   ///< first substream of each brick of the slice
+  size_t                           m_nextBrickJob;      ///< next brick to be picked up by a thread
+#endif
 
 public:
   DecSlice();
@@ -72,7 +121,44 @@ public:
   void  create            ();
   void  destroy           ();
 
+  void  setNumWppThreads  ( int numThreads )            { m_numWppThreads = numThreads; }
+  int   getNumWppThreads  () const                      { return m_numWppThreads; }
+  void  setNumBrickThreads( int numThreads )            { m_numBrickThreads = numThreads; }
+  int   getNumBrickThreads() const                      { return m_numBrickThreads; }
+  void  setNumReconThreads( int numThreads )            { m_numReconThreads = numThreads; }
+  int   getNumReconThreads() const                      { return m_numReconThreads; }
+  int   getNumThreads     () const                      { return std::max( std::max( m_numWppThreads, m_numBrickThreads ), m_numReconThreads + 1 ); }
+  void  setCtuObserver    ( DecCtuObserver* observer )  { m_ctuObserver = observer; }
+  void  initThreadDecoders( const SPS& sps, TrQuant* trQuant, Reshape* reshaper );
+  TrQuant* getThreadTrQuant( int threadId )             { return &m_threadDecoders[threadId - 1]->trQuant; }
+
   void  decompressSlice   ( Slice* slice, InputBitstream* bitstream, int debugCTU );
+
+private:
+  CABACReader& xGetCABACReader( const int threadId )    { return *( threadId == 0 ? m_CABACDecoder : &m_threadDecoders[threadId - 1]->cabacDecoder )->getCABACReader( 0 ); }
+  DecCu&       xGetCuDecoder  ( const int threadId )    { return threadId == 0 ? *m_pcCuDecoder : m_threadDecoders[threadId - 1]->cuDecoder; }
+  void  xSetThreadError   ();
+
+  void  xDecompressCtus   ( Slice* slice, const std::vector<InputBitstream*>& ppcSubstreams, const int debugCTU, const bool parseOnly );
+  bool  xUseReconThreads  ( const Slice& slice, const unsigned startCtuTsAddr, const int debugCTU ) const;
+  void  xDecompressPipelined( Slice* slice, const std::vector<InputBitstream*>& substreams, const unsigned startCtuRsAddr );
+  void  xReconstructCtuRows( const int threadId, const int numThreads, Slice* slice, const unsigned startCtuRsAddr );
+  bool  xWaitForParsedCtu ( const unsigned numCtus );
+  void  xSetParsedCtus    ( const unsigned numCtus );
+  void  xSetParsingDone   ();
+
+  bool  xUseWppThreads    ( const Slice& slice, const unsigned startCtuTsAddr, const unsigned numSubstreams, const int debugCTU ) const;
+  bool  xDecompressWavefronts( Slice* slice, const std::vector<InputBitstream*>& substreams, const unsigned startCtuRsAddr );
+  void  xDecompressCtuRows( const int threadId, const int numThreads, Slice* slice, const std::vector<InputBitstream*>& substreams, const unsigned startCtuRsAddr );
+  bool  xWaitForCtuRow    ( const unsigned row, const unsigned numCtus );
+  void  xSetCtuRowProgress( const unsigned row, const unsigned numCtus, const bool isLastCtuOfSlice );
+
+#if JVET_N0857_RECT_SLICES
+  bool  xInitBrickJobs    ( const Slice& slice, const unsigned numSubstreams, const int debugCTU );
+  bool  xDecompressBricks ( Slice* slice, const std::vector<InputBitstream*>& substreams );
+  void  xDecompressBrickJobs( const int threadId, Slice* slice, const std::vector<InputBitstream*>& substreams );
+  void  xDecompressBrick  ( const int threadId, Slice* slice, const std::vector<InputBitstream*>& substreams, const size_t jobIdx );
+#endif
 };
 
 //! \}
@@ -738,6 +738,9 @@ protected:
   std::string m_summaryOutFilename;                           ///< filename to use for producing summary output file.
   std::string m_summaryPicFilenameBase;                       ///< Base filename to use for producing summary picture output files. The actual filenames used will have I.txt, P.txt and B.txt appended.
   uint32_t        m_summaryVerboseness;                           ///< Specifies the level of the verboseness of the text output.
+#if ENCODER_MODE_PROFILE
+  std::string m_modeProfileFilename;                          ///< filename to use for the mode decision profile, no file is written if empty
+#endif
   int       m_ImvMode;
   int       m_Imv4PelFast;
   std::string m_decodeBitstreams[2];                          ///< filename for decode bitstreams.
@@ -1802,6 +1805,10 @@ public:
 
   void         setSummaryVerboseness(uint32_t v)                         { m_summaryVerboseness = v; }
   uint32_t         getSummaryVerboseness( ) const                        { return m_summaryVerboseness; }
+#if ENCODER_MODE_PROFILE
+  void         setModeProfileFilename(const std::string &s)          { m_modeProfileFilename = s; }
+  const std::string& getModeProfileFilename() const                  { return m_modeProfileFilename; }
+#endif
   void         setIMV(int n)                                         { m_ImvMode = n; }
   int          getIMV() const                                        { return m_ImvMode; }
   void         setIMV4PelFast(int n)                                 { m_Imv4PelFast = n; }
@@ -130,6 +130,11 @@ void EncCu::create( EncCfg* encCfg )
   m_modeCtrl = new EncModeCtrlMTnoRQT();
 
   m_modeCtrl->create( *encCfg );
+#if ENCODER_MODE_PROFILE
+  m_modeCtrl->setModeProfile( &m_modeProfile );
+  m_modeProfileChildTime = 0;
+  m_modeProfileCost      = MAX_DOUBLE;
+#endif
 
   for (unsigned ui = 0; ui < MMVD_MRG_MAX_RD_BUF_NUM; ui++)
   {
@@ -552,6 +557,9 @@ bool EncCu::xCheckBestMode( CodingStructure *&tempCS, CodingStructure *&bestCS,
       const CodingUnit& cu = *tempCS->cus.front();
       CHECK( cu.skip && !cu.firstPU->mergeFlag, "Skip flag without a merge flag is not allowed!" );
     }
+#if ENCODER_MODE_PROFILE
+    m_modeProfileCost = std::min( m_modeProfileCost, tempCS->cost );
+#endif
 
 #if WCG_EXT
     DTRACE_BEST_MODE( tempCS, bestCS, m_pcRdCost->getLambda( true ) );
@@ -668,9 +676,24 @@ void EncCu::xCompressCU( CodingStructure *&tempCS, CodingStructure *&bestCS, Par
   int startShareThisLevel = 0;
   m_pcInterSearch->resetSavedAffineMotion();
 
+#if ENCODER_MODE_PROFILE
+  // mode checks of sub-CUs run nested inside the split mode checks of this level
+  const double savedProfileChildTime = m_modeProfileChildTime;
+  const double savedProfileCost      = m_modeProfileCost;
+  std::vector<EncModeProfile::ModeCheck> profileChecks;
+  int profileBestIdx = -1;
+
+#endif
   do
   {
     EncTestMode currTestMode = m_modeCtrl->currTestMode();
+#if ENCODER_MODE_PROFILE
+    const uint32_t profileKey      = EncModeProfile::getKey( *tempCS, partitioner, currTestMode );
+    const double   profileBestCost = bestCS->cost;
+    const EncModeProfile::Clock::time_point profileStart = EncModeProfile::Clock::now();
+    m_modeProfileChildTime = 0;
+    m_modeProfileCost      = MAX_DOUBLE;
+#endif
 
     if (pps.getUseDQP() && CS::isDualITree(*tempCS) && isChroma(partitioner.chType))
     {
@@ -773,8 +796,29 @@ void EncCu::xCompressCU( CodingStructure *&tempCS, CodingStructure *&bestCS, Par
     {
       THROW( "Don't know how to handle mode: type = " << currTestMode.type << ", options = " << currTestMode.opts );
     }
+#if ENCODER_MODE_PROFILE
+
+    const double profileTime = std::chrono::duration<double>( EncModeProfile::Clock::now() - profileStart ).count();
+    if( bestCS->cost < profileBestCost )
+    {
+      profileBestIdx = int( profileChecks.size() );
+    }
+    profileChecks.push_back( { profileKey, profileTime, profileTime - m_modeProfileChildTime, m_modeProfileCost } );
+#endif
   } while( m_modeCtrl->nextMode( *tempCS, partitioner ) );
 
+#if ENCODER_MODE_PROFILE
+  double profileLevelTime = 0;
+  for( int i = 0; i < int( profileChecks.size() ); i++ )
+  {
+    m_modeProfile.addCheck( profileChecks[i], i == profileBestIdx, bestCS->cost );
+    profileLevelTime += profileChecks[i].totalTime;
+  }
+  m_modeProfileChildTime = savedProfileChildTime + profileLevelTime;
+  m_modeProfileCost      = savedProfileCost;
+
+#endif
+
   if(startShareThisLevel == 1)
   {
     m_shareState = NO_SHARE;
@@ -1851,7 +1895,7 @@ void EncCu::xFillPCMBuffer( CodingUnit &cu )
         CompArea    tmpArea(COMPONENT_Y, compArea.chromaFormat, Position(0, 0), compArea.size());
         PelBuf tempOrgBuf = m_tmpStorageLCU->getBuf(tmpArea);
         tempOrgBuf.copyFrom(source);
-        tempOrgBuf.rspSignal(m_pcReshape->getFwdLUT());
+        tempOrgBuf.rspSignal(m_pcReshape->getFwdPWL());
         destination.copyFrom(tempOrgBuf);
       }
       else
@@ -2241,7 +2285,7 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
           if (pu.cs->slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag())
 #endif
           {
-            pu.cs->getPredBuf(pu).Y().rspSignal(m_pcReshape->getFwdLUT());
+            pu.cs->getPredBuf(pu).Y().rspSignal(m_pcReshape->getFwdPWL());
           }
           m_pcIntraSearch->geneWeightedPred(COMPONENT_Y, pu.cs->getPredBuf(pu).Y(), pu, m_pcIntraSearch->getPredictorPtr2(COMPONENT_Y, intraCnt));
 
@@ -2262,7 +2306,7 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
           if (pu.cs->slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag())
 #endif
           {
-            pu.cs->getPredBuf(pu).Y().rspSignal(m_pcReshape->getFwdLUT());
+            pu.cs->getPredBuf(pu).Y().rspSignal(m_pcReshape->getFwdPWL());
           }
 #if JVET_N0327_MERGE_BIT_CALC_FIX
           m_CABACEstimator->getCtx() = ctxStart;
@@ -2314,7 +2358,7 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
             pu.cs->getPredBuf(pu).copyFrom(acMergeBuffer[mergeCand]);
             if (pu.cs->slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag())
             {
-              pu.cs->getPredBuf(pu).Y().rspSignal(m_pcReshape->getFwdLUT());
+              pu.cs->getPredBuf(pu).Y().rspSignal(m_pcReshape->getFwdPWL());
             }
             m_pcIntraSearch->geneWeightedPred(COMPONENT_Y, pu.cs->getPredBuf(pu).Y(), pu, m_pcIntraSearch->getPredictorPtr2(COMPONENT_Y, intraCnt));
 
@@ -2327,7 +2371,7 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
             Distortion sadValue = distParam.distFunc(distParam);
             if (pu.cs->slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag())
             {
-              pu.cs->getPredBuf(pu).Y().rspSignal(m_pcReshape->getFwdLUT());
+              pu.cs->getPredBuf(pu).Y().rspSignal(m_pcReshape->getFwdPWL());
             }
 #if JVET_N0327_MERGE_BIT_CALC_FIX
             m_CABACEstimator->getCtx() = ctxStart;
@@ -2639,7 +2683,7 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
           if (pu.cs->slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag())
 #endif
           {
-            tmpBuf.rspSignal(m_pcReshape->getFwdLUT());
+            tmpBuf.rspSignal(m_pcReshape->getFwdPWL());
           }
           m_pcIntraSearch->geneWeightedPred(COMPONENT_Y, tmpBuf, pu, m_pcIntraSearch->getPredictorPtr2(COMPONENT_Y, bufIdx));
           tmpBuf = tempCS->getPredBuf(pu).Cb();
@@ -3463,7 +3507,7 @@ void EncCu::xCheckRDCostIBCModeMerge2Nx2N(CodingStructure *&tempCS, CodingStruct
         CompArea    tmpArea(COMPONENT_Y, area.chromaFormat, Position(0, 0), area.size());
         PelBuf tmpLuma = m_tmpStorageLCU->getBuf(tmpArea);
         tmpLuma.copyFrom(tempCS->getOrgBuf().Y());
-        tmpLuma.rspSignal(m_pcReshape->getFwdLUT());
+        tmpLuma.rspSignal(m_pcReshape->getFwdPWL());
         m_pcRdCost->setDistParam(distParam, tmpLuma, refBuf, sps.getBitDepth(CHANNEL_TYPE_LUMA), COMPONENT_Y, bUseHadamard);
       }
       else
@@ -4306,7 +4350,7 @@ Distortion EncCu::getDistortionDb( CodingStructure &cs, CPelBuf org, CPelBuf rec
       CompArea    tmpArea( COMPONENT_Y, cs.area.chromaFormat, Position( 0, 0 ), compArea.size() );
       PelBuf tmpRecLuma = m_tmpStorageLCU->getBuf( tmpArea );
       tmpRecLuma.copyFrom( reco );
-      tmpRecLuma.rspSignal( m_pcReshape->getFwdLUT() );
+      tmpRecLuma.rspSignal( m_pcReshape->getFwdPWL() );
       dist += m_pcRdCost->getDistPart( org, tmpRecLuma, cs.sps->getBitDepth( toChannelType( compID ) ), compID, DF_SSE );
     }
     else
@@ -55,6 +55,9 @@
 #include "InterSearch.h"
 #include "RateCtrl.h"
 #include "EncModeCtrl.h"
+#if ENCODER_MODE_PROFILE
+#include "EncModeProfile.h"
+#endif
 //! \ingroup EncoderLib
 //! \{
 
@@ -146,6 +149,11 @@ private:
   void    updateLambda      ( Slice* slice, const int dQP, const bool updateRdCostLambda );
 #endif
   double                m_sbtCostSave[2];
+#if ENCODER_MODE_PROFILE
+  EncModeProfile        m_modeProfile;
+  double                m_modeProfileChildTime;   ///< time spent in mode checks of sub-CUs during the current mode check
+  double                m_modeProfileCost;        ///< best RD cost produced by the current mode check
+#endif
 
 public:
   /// copy parameters from encoder class
@@ -163,6 +171,9 @@ public:
   int   updateCtuDataISlice ( const CPelBuf buf );
 
   EncModeCtrl* getModeCtrl  () { return m_modeCtrl; }
+#if ENCODER_MODE_PROFILE
+  const EncModeProfile& getModeProfile() const { return m_modeProfile; }
+#endif
 
 
   void   setMergeBestSATDCost(double cost) { m_mergeBestSATDCost = cost; }
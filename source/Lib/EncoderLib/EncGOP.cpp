@@ -2387,7 +2387,7 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
         //reshape original signal
         if (m_pcReshaper->getSliceReshaperInfo().getUseSliceReshaper())
         {
-          pcPic->getOrigBuf(COMPONENT_Y).rspSignal(m_pcReshaper->getFwdLUT());
+          pcPic->getOrigBuf(COMPONENT_Y).rspSignal(m_pcReshaper->getFwdPWL());
           m_pcReshaper->setSrcReshaped(true);
           m_pcReshaper->setRecReshaped(true);
         }
@@ -80,8 +80,13 @@ EncLib::EncLib()
   m_iMaxRefPicNum     = 0;
 
 #if ENABLE_SIMD_OPT_BUFFER
+#ifdef TARGET_SIMD_X86
   g_pelBufOP.initPelBufOpsX86();
 #endif
+#ifdef TARGET_SIMD_VEC
+  g_pelBufOP.initPelBufOpsVec();
+#endif
+#endif
 
 #if JVET_N0415_CTB_ALF
   memset(m_apss, 0, sizeof(m_apss));
@@ -568,6 +573,27 @@ void EncLib::xInitPPSforLT(PPS& pps)
 // Public member functions
 // ====================================================================================================================
 
+#if ENCODER_MODE_PROFILE
+void EncLib::printModeProfile()
+{
+  EncModeProfile modeProfile;
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+  for( int jId = 0; jId < m_numCuEncStacks; jId++ )
+  {
+    modeProfile.merge( m_cCuEncoder[jId].getModeProfile() );
+  }
+#else
+  modeProfile.merge( m_cCuEncoder.getModeProfile() );
+#endif
+
+  modeProfile.printSummary();
+  if( !getModeProfileFilename().empty() && !modeProfile.writeReport( getModeProfileFilename() ) )
+  {
+    msg( WARNING, "\nWarning: could not write mode profile to %s\n", getModeProfileFilename().c_str() );
+  }
+}
+
+#endif
 void EncLib::deletePicBuffer()
 {
   PicList::iterator iterPic = m_cListPic.begin();
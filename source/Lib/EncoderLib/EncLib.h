@@ -284,6 +284,9 @@ public:
 
 
   void printSummary(bool isField) { m_cGOPEncoder.printOutSummary (m_uiNumAllPicCoded, isField, m_printMSEBasedSequencePSNR, m_printSequenceMSE, m_printHexPsnr, m_spsMap.getFirstPS()->getBitDepths()); }
+#if ENCODER_MODE_PROFILE
+  void printModeProfile();
+#endif
 
 };
 
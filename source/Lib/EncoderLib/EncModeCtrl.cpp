@@ -39,6 +39,9 @@
 
 #include "AQp.h"
 #include "RateCtrl.h"
+#if ENCODER_MODE_PROFILE
+#include "EncModeProfile.h"
+#endif
 
 #include "CommonLib/RdCost.h"
 #include "CommonLib/CodingStructure.h"
@@ -73,7 +76,16 @@ bool EncModeCtrl::tryModeMaster( const EncTestMode& encTestmode, const CodingStr
     }
   }
 #endif
+#if ENCODER_MODE_PROFILE
+  const bool testMode = tryMode( encTestmode, cs, partitioner );
+  if( !testMode && m_modeProfile )
+  {
+    m_modeProfile->countSkipped( cs, partitioner, encTestmode );
+  }
+  return testMode;
+#else
   return tryMode( encTestmode, cs, partitioner );
+#endif
 }
 
 void EncModeCtrl::setEarlySkipDetected()
@@ -47,6 +47,10 @@
 #include <typeinfo>
 #include <vector>
 
+#if ENCODER_MODE_PROFILE
+class EncModeProfile;
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Encoder modes to try out
 //////////////////////////////////////////////////////////////////////////
@@ -266,6 +270,9 @@ protected:
 #if ENABLE_SPLIT_PARALLELISM
   int                   m_runNextInParallel;
 #endif
+#if ENCODER_MODE_PROFILE
+  EncModeProfile       *m_modeProfile = nullptr;
+#endif
 
 public:
 
@@ -305,6 +312,9 @@ public:
   bool         getIsHashPerfectMatch() { return m_ComprCUCtxList.back().isHashPerfectMatch; }
   virtual void setBest              ( CodingStructure& cs );
   bool         anyMode              () const;
+#if ENCODER_MODE_PROFILE
+  void         setModeProfile       ( EncModeProfile* modeProfile ) { m_modeProfile = modeProfile; }
+#endif
 
   const ComprCUCtx& getComprCUCtx   () { CHECK( m_ComprCUCtxList.empty(), "Accessing empty list!"); return m_ComprCUCtxList.back(); }
 
@@ -0,0 +1,247 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     EncModeProfile.cpp
+    \brief    encoder mode decision profiler
+*/
+
+#include "EncModeProfile.h"
+
+#if ENCODER_MODE_PROFILE
+
+#include "CommonLib/Rom.h"
+#include "CommonLib/Slice.h"
+#include "CommonLib/UnitPartitioner.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+//! \ingroup EncoderLib
+//! \{
+
+// key layout (most significant first), so the report is ordered by temporal layer, channel, size and mode
+static const int KEY_IMV_BITS  = 1;
+static const int KEY_MODE_BITS = 5;
+static const int KEY_SIZE_BITS = 3;
+static const int KEY_CH_BITS   = 1;
+
+static_assert( ETM_INVALID < ( 1 << KEY_MODE_BITS ), "Mode type does not fit into the profile key" );
+static_assert( MAX_CU_DEPTH < ( 1 << KEY_SIZE_BITS ), "CU size does not fit into the profile key" );
+
+static inline int keyImv        ( uint32_t key ) { return   key                                                                  & ( ( 1 << KEY_IMV_BITS  ) - 1 ); }
+static inline int keyMode       ( uint32_t key ) { return ( key >>   KEY_IMV_BITS )                                              & ( ( 1 << KEY_MODE_BITS ) - 1 ); }
+static inline int keyLog2Height ( uint32_t key ) { return ( key >> ( KEY_IMV_BITS + KEY_MODE_BITS ) )                            & ( ( 1 << KEY_SIZE_BITS ) - 1 ); }
+static inline int keyLog2Width  ( uint32_t key ) { return ( key >> ( KEY_IMV_BITS + KEY_MODE_BITS + KEY_SIZE_BITS ) )            & ( ( 1 << KEY_SIZE_BITS ) - 1 ); }
+static inline int keyChType     ( uint32_t key ) { return ( key >> ( KEY_IMV_BITS + KEY_MODE_BITS + 2 * KEY_SIZE_BITS ) )        & ( ( 1 << KEY_CH_BITS   ) - 1 ); }
+static inline int keyTemporalId ( uint32_t key ) { return   key >> ( KEY_IMV_BITS + KEY_MODE_BITS + 2 * KEY_SIZE_BITS + KEY_CH_BITS ); }
+
+void EncModeProfile::Stats::add( const Stats& other )
+{
+  numTests     += other.numTests;
+  numSkipped   += other.numSkipped;
+  numBest      += other.numBest;
+  numCosts     += other.numCosts;
+  totalTime    += other.totalTime;
+  selfTime     += other.selfTime;
+  costDelta    += other.costDelta;
+  relCostDelta += other.relCostDelta;
+}
+
+uint32_t EncModeProfile::getKey( const CodingStructure& cs, const Partitioner& partitioner, const EncTestMode& encTestMode )
+{
+  const CompArea& area = partitioner.currArea().blocks[partitioner.chType == CHANNEL_TYPE_LUMA ? COMPONENT_Y : COMPONENT_Cb];
+  const uint32_t  tid  = std::min<uint32_t>( cs.slice->getTLayer(), MAX_TLAYER - 1 );
+  const uint32_t  ch   = partitioner.chType == CHANNEL_TYPE_LUMA ? 0 : 1;
+  const uint32_t  log2W = std::min<int>( g_aucLog2[std::min<int>( area.width,  MAX_CU_SIZE )], MAX_CU_DEPTH );
+  const uint32_t  log2H = std::min<int>( g_aucLog2[std::min<int>( area.height, MAX_CU_SIZE )], MAX_CU_DEPTH );
+  const uint32_t  imv   = encTestMode.type == ETM_INTER_ME && ( encTestMode.opts & ETO_IMV ) != 0 ? 1 : 0;
+
+  uint32_t key = tid;
+  key = ( key << KEY_CH_BITS   ) | ch;
+  key = ( key << KEY_SIZE_BITS ) | log2W;
+  key = ( key << KEY_SIZE_BITS ) | log2H;
+  key = ( key << KEY_MODE_BITS ) | uint32_t( encTestMode.type );
+  key = ( key << KEY_IMV_BITS  ) | imv;
+  return key;
+}
+
+const char* EncModeProfile::getModeName( const EncTestMode& encTestMode )
+{
+  switch( encTestMode.type )
+  {
+  case ETM_HASH_INTER       : return "HASH_INTER";
+  case ETM_MERGE_SKIP       : return "MERGE_SKIP";
+  case ETM_INTER_ME         : return ( encTestMode.opts & ETO_IMV ) != 0 ? "INTER_ME_IMV" : "INTER_ME";
+  case ETM_AFFINE           : return "AFFINE";
+  case ETM_MERGE_TRIANGLE   : return "MERGE_TRIANGLE";
+  case ETM_INTRA            : return "INTRA";
+  case ETM_IPCM             : return "IPCM";
+  case ETM_SPLIT_QT         : return "SPLIT_QT";
+  case ETM_SPLIT_BT_H       : return "SPLIT_BT_H";
+  case ETM_SPLIT_BT_V       : return "SPLIT_BT_V";
+  case ETM_SPLIT_TT_H       : return "SPLIT_TT_H";
+  case ETM_SPLIT_TT_V       : return "SPLIT_TT_V";
+  case ETM_POST_DONT_SPLIT  : return "POST_DONT_SPLIT";
+#if REUSE_CU_RESULTS
+  case ETM_RECO_CACHED      : return "RECO_CACHED";
+#endif
+  case ETM_TRIGGER_IMV_LIST : return "TRIGGER_IMV_LIST";
+  case ETM_IBC              : return "IBC";
+  case ETM_IBC_MERGE        : return "IBC_MERGE";
+  default                   : return "INVALID";
+  }
+}
+
+void EncModeProfile::countSkipped( const CodingStructure& cs, const Partitioner& partitioner, const EncTestMode& encTestMode )
+{
+  // control modes are never checked, they only trigger state changes of the mode controller
+  if( encTestMode.type == ETM_POST_DONT_SPLIT || encTestMode.type == ETM_TRIGGER_IMV_LIST )
+  {
+    return;
+  }
+  m_stats[getKey( cs, partitioner, encTestMode )].numSkipped++;
+}
+
+void EncModeProfile::addCheck( const ModeCheck& check, bool isBest, double bestCost )
+{
+  Stats& stats = m_stats[check.key];
+  stats.numTests++;
+  stats.totalTime += check.totalTime;
+  stats.selfTime  += check.selfTime;
+  if( isBest )
+  {
+    stats.numBest++;
+  }
+  if( check.cost != MAX_DOUBLE && bestCost != MAX_DOUBLE )
+  {
+    stats.numCosts++;
+    stats.costDelta    += check.cost - bestCost;
+    stats.relCostDelta += bestCost > 0 ? ( check.cost - bestCost ) / bestCost : 0.0;
+  }
+}
+
+void EncModeProfile::merge( const EncModeProfile& other )
+{
+  for( const auto& entry : other.m_stats )
+  {
+    m_stats[entry.first].add( entry.second );
+  }
+}
+
+static EncTestMode xModeFromKey( uint32_t key )
+{
+  return EncTestMode( EncTestModeType( keyMode( key ) ), keyImv( key ) ? EncTestModeOpts( 1 << ETO_IMV_SHIFT ) : ETO_STANDARD, -1, false );
+}
+
+bool EncModeProfile::writeReport( const std::string& fileName ) const
+{
+  FILE* fp = fopen( fileName.c_str(), "w" );
+  if( !fp )
+  {
+    return false;
+  }
+
+  const bool json = fileName.size() >= 5 && fileName.compare( fileName.size() - 5, 5, ".json" ) == 0;
+  if( json )
+  {
+    fprintf( fp, "[\n" );
+  }
+  else
+  {
+    fprintf( fp, "temporal_id,channel,width,height,mode,tests,skipped,best,best_rate,total_ms,self_ms,avg_self_us,avg_cost_delta,avg_rel_cost_delta\n" );
+  }
+
+  bool first = true;
+  for( const auto& entry : m_stats )
+  {
+    const uint32_t key = entry.first;
+    const Stats&   s   = entry.second;
+    const double   bestRate     = s.numTests ? double( s.numBest ) / s.numTests          : 0.0;
+    const double   avgSelf      = s.numTests ? s.selfTime * 1e6 / s.numTests            : 0.0;
+    const double   avgDelta     = s.numCosts ? s.costDelta / s.numCosts                  : 0.0;
+    const double   avgRelDelta  = s.numCosts ? s.relCostDelta / s.numCosts               : 0.0;
+    const char*    channel      = keyChType( key ) ? "chroma" : "luma";
+
+    if( json )
+    {
+      fprintf( fp, "%s  { \"temporalId\": %d, \"channel\": \"%s\", \"width\": %d, \"height\": %d, \"mode\": \"%s\", \"tests\": %" PRIu64 ", \"skipped\": %" PRIu64
+                   ", \"best\": %" PRIu64 ", \"bestRate\": %.4f, \"totalMs\": %.3f, \"selfMs\": %.3f, \"avgSelfUs\": %.3f, \"avgCostDelta\": %.1f, \"avgRelCostDelta\": %.5f }",
+               first ? "" : ",\n", keyTemporalId( key ), channel, 1 << keyLog2Width( key ), 1 << keyLog2Height( key ), getModeName( xModeFromKey( key ) ),
+               s.numTests, s.numSkipped, s.numBest, bestRate, s.totalTime * 1000.0, s.selfTime * 1000.0, avgSelf, avgDelta, avgRelDelta );
+    }
+    else
+    {
+      fprintf( fp, "%d,%s,%d,%d,%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.4f,%.3f,%.3f,%.3f,%.1f,%.5f\n",
+               keyTemporalId( key ), channel, 1 << keyLog2Width( key ), 1 << keyLog2Height( key ), getModeName( xModeFromKey( key ) ),
+               s.numTests, s.numSkipped, s.numBest, bestRate, s.totalTime * 1000.0, s.selfTime * 1000.0, avgSelf, avgDelta, avgRelDelta );
+    }
+    first = false;
+  }
+
+  if( json )
+  {
+    fprintf( fp, "\n]\n" );
+  }
+
+  fclose( fp );
+  return true;
+}
+
+void EncModeProfile::printSummary() const
+{
+  // aggregate over sizes, channels and temporal layers
+  std::map<uint32_t, Stats> perMode;
+  double selfTotal = 0;
+  for( const auto& entry : m_stats )
+  {
+    perMode[entry.first & ( ( 1 << ( KEY_MODE_BITS + KEY_IMV_BITS ) ) - 1 )].add( entry.second );
+    selfTotal += entry.second.selfTime;
+  }
+
+  msg( INFO, "\n\nMode decision profile\n" );
+  msg( INFO, "%-16s %10s %10s %10s %9s %12s %7s %12s\n", "mode", "tests", "skipped", "best", "best[%]", "self[s]", "time[%]", "rel.delta" );
+  for( const auto& entry : perMode )
+  {
+    const Stats& s = entry.second;
+    msg( INFO, "%-16s %10" PRIu64 " %10" PRIu64 " %10" PRIu64 " %9.2f %12.3f %7.2f %12.5f\n",
+         getModeName( xModeFromKey( entry.first ) ), s.numTests, s.numSkipped, s.numBest,
+         s.numTests ? 100.0 * s.numBest / s.numTests : 0.0, s.selfTime,
+         selfTotal > 0 ? 100.0 * s.selfTime / selfTotal : 0.0,
+         s.numCosts ? s.relCostDelta / s.numCosts : 0.0 );
+  }
+}
+
+//! \}
+
+#endif // ENCODER_MODE_PROFILE
@@ -0,0 +1,112 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file     EncModeProfile.h
+    \brief    encoder mode decision profiler (header)
+*/
+
+#ifndef __ENCMODEPROFILE__
+#define __ENCMODEPROFILE__
+
+#include "CommonLib/CommonDef.h"
+
+#if ENCODER_MODE_PROFILE
+
+#include "EncModeCtrl.h"
+
+#include <chrono>
+#include <map>
+#include <string>
+
+//! \ingroup EncoderLib
+//! \{
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// records per test mode, CU size, channel type and temporal layer how often a mode is tested, pruned and selected,
+/// how long it takes and how far its RD cost is from the selected mode
+class EncModeProfile
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  struct Stats
+  {
+    uint64_t numTests;        ///< number of times the mode was checked
+    uint64_t numSkipped;      ///< number of times the mode controller rejected the mode (not allowed or pruned by a fast decision)
+    uint64_t numBest;         ///< number of times the mode was selected for the CU
+    uint64_t numCosts;        ///< number of checks that produced a valid RD cost
+    double   totalTime;       ///< seconds, including the sub-CU search of split modes
+    double   selfTime;        ///< seconds, excluding the sub-CU search of split modes
+    double   costDelta;       ///< sum of (mode cost - selected cost)
+    double   relCostDelta;    ///< sum of (mode cost - selected cost) / selected cost
+
+    Stats() : numTests( 0 ), numSkipped( 0 ), numBest( 0 ), numCosts( 0 ), totalTime( 0 ), selfTime( 0 ), costDelta( 0 ), relCostDelta( 0 ) {}
+
+    void add( const Stats& other );
+  };
+
+  /// bookkeeping of one tested mode of the CU currently being compressed
+  struct ModeCheck
+  {
+    uint32_t key;
+    double   totalTime;
+    double   selfTime;
+    double   cost;
+  };
+
+  static uint32_t     getKey      ( const CodingStructure& cs, const Partitioner& partitioner, const EncTestMode& encTestMode );
+  static const char*  getModeName ( const EncTestMode& encTestMode );
+
+  void countSkipped ( const CodingStructure& cs, const Partitioner& partitioner, const EncTestMode& encTestMode );
+  void addCheck     ( const ModeCheck& check, bool isBest, double bestCost );
+  void merge        ( const EncModeProfile& other );
+  void clear        ()                                                        { m_stats.clear(); }
+
+  /// writes the profile as JSON if the file name ends with ".json", as CSV otherwise
+  bool writeReport  ( const std::string& fileName ) const;
+  /// prints the profile aggregated per mode
+  void printSummary () const;
+
+private:
+  std::map<uint32_t, Stats> m_stats;
+};
+
+//! \}
+
+#endif // ENCODER_MODE_PROFILE
+
+#endif // __ENCMODEPROFILE__
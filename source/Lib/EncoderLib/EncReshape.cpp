@@ -67,6 +67,9 @@ void  EncReshape::createEnc(int picWidth, int picHeight, uint32_t maxCUWidth, ui
   m_reshapeLUTSize = 1 << m_lumaBD;
   m_initCWAnalyze = m_reshapeLUTSize / PIC_ANALYZE_CW_BINS;
   m_initCW = m_reshapeLUTSize / PIC_CODE_CW_BINS;
+  memset( &m_fwdPWL, 0, sizeof( m_fwdPWL ) );
+  m_fwdPWL.log2BinLen = floorLog2( m_initCW );
+  m_fwdPWL.maxVal     = m_reshapeLUTSize - 1;
 
   if (m_fwdLUT.empty())
     m_fwdLUT.resize(m_reshapeLUTSize, 0);
@@ -1064,6 +1067,8 @@ void EncReshape::initLUTfromdQPModel()
     m_fwdLUT[i*pwlFwdBinLen] = Clip3((Pel)0, (Pel)((1 << m_lumaBD) - 1), (Pel)Y1);
     int log2PwlFwdBinLen = floorLog2(pwlFwdBinLen);
     int32_t scale = ((int32_t)(Y2 - Y1) * (1 << FP_PREC) + (1 << (log2PwlFwdBinLen - 1))) >> (log2PwlFwdBinLen);
+    m_fwdPWL.base [i] = Y1;
+    m_fwdPWL.scale[i] = scale;
     for (int j = 1; j < pwlFwdBinLen; j++)
     {
       int tempVal = Y1 + (((int32_t)scale * (int32_t)j + (1 << (FP_PREC - 1))) >> FP_PREC);
@@ -1262,6 +1267,8 @@ void EncReshape::constructReshaperSDR()
     int16_t Y2 = tempFwdLUT[(i + 1)*histLenth];
     m_reshapePivot[i + 1] = Y2;
     int32_t scale = ((int32_t)(Y2 - Y1) * (1 << FP_PREC) + (1 << (log2HistLenth - 1))) >> (log2HistLenth);
+    m_fwdPWL.base [i] = Y1;
+    m_fwdPWL.scale[i] = scale;
     m_fwdLUT[i*histLenth] = Clip3((Pel)0, (Pel)((1 << m_lumaBD) - 1), (Pel)Y1);
     for (j = 1; j < histLenth; j++)
     {
@@ -1310,6 +1317,7 @@ void EncReshape::copyState(const EncReshape &other)
   m_recReshaped      = other.m_recReshaped;
   m_invLUT           = other.m_invLUT;
   m_fwdLUT           = other.m_fwdLUT;
+  m_fwdPWL           = other.m_fwdPWL;
   m_chromaAdjHelpLUT = other.m_chromaAdjHelpLUT;
   m_binCW            = other.m_binCW;
   m_initCW           = other.m_initCW;
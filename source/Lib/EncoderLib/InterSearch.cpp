@@ -1302,7 +1302,7 @@ void InterSearch::xIBCEstimation(PredictionUnit& pu, PelUnitBuf& origBuf,
     CompArea    tmpArea(COMPONENT_Y, area.chromaFormat, Position(0, 0), area.size());
     PelBuf tmpOrgLuma = m_tmpStorageLCU.getBuf(tmpArea);
     tmpOrgLuma.copyFrom(tmpPattern);
-    tmpOrgLuma.rspSignal(m_pcReshape->getFwdLUT());
+    tmpOrgLuma.rspSignal(m_pcReshape->getFwdPWL());
     pcPatternKey = (CPelBuf*)&tmpOrgLuma;
   }
 
@@ -1460,7 +1460,7 @@ void InterSearch::xIBCEstimation(PredictionUnit& pu, PelUnitBuf& origBuf,
       CompArea    tmpArea(COMPONENT_Y, area.chromaFormat, Position(0, 0), area.size());
       PelBuf tmpOrgLuma = m_tmpStorageLCU.getBuf(tmpArea);
       tmpOrgLuma.copyFrom(tmpPattern);
-      tmpOrgLuma.rspSignal(m_pcReshape->getFwdLUT());
+      tmpOrgLuma.rspSignal(m_pcReshape->getFwdPWL());
       pcPatternKey = (CPelBuf*)&tmpOrgLuma;
     }
 
@@ -6615,7 +6615,7 @@ void InterSearch::xEstimateInterResidualQT(CodingStructure &cs, Partitioner &par
       PelBuf tmpPred = m_tmpStorageLCU.getBuf(tmpArea);
       tmpPred.copyFrom(piPredY);
       if (!cu.firstPU->mhIntraFlag && !CU::isIBC(cu))
-        tmpPred.rspSignal(m_pcReshape->getFwdLUT());
+        tmpPred.rspSignal(m_pcReshape->getFwdPWL());
       const Pel           avgLuma = tmpPred.computeAvg();
       int                    adj  = m_pcReshape->calculateChromaAdj(avgLuma);
       tu.setChromaAdj(adj);
@@ -7242,7 +7242,7 @@ void InterSearch::encodeResAndCalcRdInterCU(CodingStructure &cs, Partitioner &pa
       if (m_pcEncCfg->getReshaper() && (cs.slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag()) && !cu.firstPU->mhIntraFlag && !CU::isIBC(cu))
 #endif
       {
-        cs.getRecoBuf().Y().rspSignal(m_pcReshape->getFwdLUT());
+        cs.getRecoBuf().Y().rspSignal(m_pcReshape->getFwdPWL());
       }
     }
 
@@ -7348,8 +7348,8 @@ void InterSearch::encodeResAndCalcRdInterCU(CodingStructure &cs, Partitioner &pa
       tmpPred.copyFrom(cs.getPredBuf(COMPONENT_Y));
 
       if (!cu.firstPU->mhIntraFlag && !CU::isIBC(cu))
-        tmpPred.rspSignal(m_pcReshape->getFwdLUT());
-      cs.getResiBuf(COMPONENT_Y).rspSignal(m_pcReshape->getFwdLUT());
+        tmpPred.rspSignal(m_pcReshape->getFwdPWL());
+      cs.getResiBuf(COMPONENT_Y).rspSignal(m_pcReshape->getFwdPWL());
       cs.getResiBuf(COMPONENT_Y).subtract(tmpPred);
     }
     else
@@ -7454,7 +7454,7 @@ void InterSearch::encodeResAndCalcRdInterCU(CodingStructure &cs, Partitioner &pa
       tmpPred.copyFrom(cs.getPredBuf(COMPONENT_Y));
 
       if (!cu.firstPU->mhIntraFlag && !CU::isIBC(cu))
-        tmpPred.rspSignal(m_pcReshape->getFwdLUT());
+        tmpPred.rspSignal(m_pcReshape->getFwdPWL());
 
       cs.getRecoBuf(COMPONENT_Y).reconstruct(tmpPred, cs.getResiBuf(COMPONENT_Y), cs.slice->clpRng(COMPONENT_Y));
     }
@@ -7467,7 +7467,7 @@ void InterSearch::encodeResAndCalcRdInterCU(CodingStructure &cs, Partitioner &pa
       if (cs.slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag() && !cu.firstPU->mhIntraFlag && !CU::isIBC(cu))
 #endif
       {
-        cs.getRecoBuf().bufs[0].rspSignal(m_pcReshape->getFwdLUT());
+        cs.getRecoBuf().bufs[0].rspSignal(m_pcReshape->getFwdPWL());
       }
     }
   }
@@ -502,7 +502,7 @@ void IntraSearch::estIntraPredLumaQT( CodingUnit &cu, Partitioner &partitioner,
           CompArea      tmpArea(COMPONENT_Y, area.chromaFormat, Position(0, 0), area.size());
           PelBuf tmpOrg = m_tmpStorageLCU.getBuf(tmpArea);
           tmpOrg.copyFrom(piOrg);
-          tmpOrg.rspSignal(m_pcReshape->getFwdLUT());
+          tmpOrg.rspSignal(m_pcReshape->getFwdPWL());
 #if JVET_N0363_INTRA_COST_MOD
           m_pcRdCost->setDistParam(distParamSad, tmpOrg, piPred, sps.getBitDepth(CHANNEL_TYPE_LUMA), COMPONENT_Y, false); // Use SAD cost
           m_pcRdCost->setDistParam(distParamHad, tmpOrg, piPred, sps.getBitDepth(CHANNEL_TYPE_LUMA), COMPONENT_Y,  true); // Use HAD (SATD) cost
@@ -2033,7 +2033,7 @@ void IntraSearch::xEncPCM(CodingStructure &cs, Partitioner& partitioner, const C
   if (cs.slice->getReshapeInfo().getUseSliceReshaper() && m_pcReshape->getCTUFlag() && compID == COMPONENT_Y)
 #endif
   {
-    tempOrgBuf.rspSignal(m_pcReshape->getFwdLUT());
+    tempOrgBuf.rspSignal(m_pcReshape->getFwdPWL());
   }
   for (uint32_t uiY = 0; uiY < pcmBuf.height; uiY++)
   {
@@ -2480,7 +2480,7 @@ void IntraSearch::xIntraCodingTUBlock(TransformUnit &tu, const ComponentID &comp
     CompArea      tmpArea(COMPONENT_Y, area.chromaFormat, Position(0, 0), area.size());
     PelBuf tmpPred = m_tmpStorageLCU.getBuf(tmpArea);
     tmpPred.copyFrom(piPred);
-    piResi.rspSignal(m_pcReshape->getFwdLUT());
+    piResi.rspSignal(m_pcReshape->getFwdPWL());
     piResi.subtract(tmpPred);
   }
   else